@@ -255,6 +255,10 @@ namespace CNFW {
 		SendMessageA(window, WM_SETICON, 1, LPARAM(icon));
 	}
 
+	auto Window::setTitle(const char* title) -> void {
+		SetWindowTextA(window, title);
+	}
+
 	auto Window::poll() -> void {
 		auto message = MSG{};
 
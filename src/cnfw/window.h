@@ -40,6 +40,9 @@ namespace CNFW {
 
 		auto setIcon(i32) -> void;
 
+		/// the window's title bar, also where the viewer puts its messages
+		static auto setTitle(const char*) -> void;
+
 		auto poll() -> void;
 		auto swap() -> void;
 
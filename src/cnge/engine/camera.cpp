@@ -1,9 +1,17 @@
 
+#include <algorithm>
+
 #include "camera.h"
 
 namespace CNGE {
 	/// default initialization
-	Camera::Camera() : transform(), projection(), projview(), width(0), height(0) {}
+	Camera::Camera() :
+		width(0), height(0),
+		transform(),
+		projection(), projview(),
+		affineProjection(), affineProjview(),
+		projectionVersion(1), version(0),
+		viewProjectionVersion(0), viewTransformVersion(0) {}
 
 	/// a pos up orthographic projection matrix
 	/// for 2d games
@@ -11,31 +19,63 @@ namespace CNGE {
 		this->width = width;
 		this->height = height;
 
-		projection.setOrthographic(0, width, 0, height, -1, 1);
+		setProjection(Matrix4f::makeOrthographic(0, width, 0, height, -1, 1), Affine2f::makeOrthographic(0, width, 0, height));
 	}
 
 	void Camera::setOrthoPixel(u32 width, u32 height) {
 		this->width = width;
 		this->height = height;
 
-		projection.setOrthographic(0, width, height, 0, -1, 1);
+		setProjection(Matrix4f::makeOrthographic(0, width, height, 0, -1, 1), Affine2f::makeOrthographic(0, width, height, 0));
+	}
+
+	/// a resize to the same size leaves the projview alone
+	void Camera::setProjection(const Matrix4f& projection, const Affine2f& affineProjection) {
+		if (std::equal(projection.m, projection.m + 16, this->projection.m))
+			return;
+
+		this->projection = projection;
+		this->affineProjection = affineProjection;
+		++projectionVersion;
 	}
 
 	/// sets the view based off the transform
 	void Camera::update() {
+		if (viewProjectionVersion == projectionVersion && viewTransformVersion == transform.getVersion())
+			return;
+
 		transform.cameraTransform(projview);
 		projview = projection * projview;
+
+		transform.cameraTransform(affineProjview);
+		affineProjview = affineProjection * affineProjview;
+
+		viewProjectionVersion = projectionVersion;
+		viewTransformVersion = transform.getVersion();
+		++version;
 	}
 
 	/// use this in shaders to get a non moving projection
-	f32* Camera::getProjection() const {
+	const f32* Camera::getProjection() const {
 		return projection.m;
 	}
 
 	/// use this in shaders to get a projection that moves
 	/// with the camera
-	f32* Camera::getProjview() const {
+	const f32* Camera::getProjview() const {
 		return projview.m;
 	}
 
+	/// the same two for mat3x2 shaders
+	const Affine2f& Camera::getAffineProjection() const {
+		return affineProjection;
+	}
+
+	const Affine2f& Camera::getAffineProjview() const {
+		return affineProjview;
+	}
+
+	u64 Camera::getVersion() const {
+		return version;
+	}
 }
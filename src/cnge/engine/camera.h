@@ -25,19 +25,39 @@ namespace CNGE {
 		/// for gui applications
 		void setOrthoPixel(u32, u32);
 		
-		/// sets the view based off the transform
+		/// sets the view based off the transform,
+		/// does nothing if neither it nor the projection changed
 		void update();
 
 		/// use this in shaders to get a non moving projection
-		[[nodiscard]] f32* getProjection() const;
+		[[nodiscard]] const f32* getProjection() const;
 
 		/// use this in shaders to get a projection that moves
 		/// with the camera
-		[[nodiscard]] f32* getProjview() const;
+		[[nodiscard]] const f32* getProjview() const;
+
+		/// the same two for mat3x2 shaders
+		[[nodiscard]] const Affine2f& getAffineProjection() const;
+		[[nodiscard]] const Affine2f& getAffineProjview() const;
+
+		/// goes up by one every time the projview changes
+		[[nodiscard]] u64 getVersion() const;
 
 	private:
 		Matrix4f projection;
 		Matrix4f projview;
+
+		Affine2f affineProjection;
+		Affine2f affineProjview;
+
+		u64 projectionVersion;
+		u64 version;
+
+		/* what the projview was last made from */
+		u64 viewProjectionVersion;
+		u64 viewTransformVersion;
+
+		void setProjection(const Matrix4f&, const Affine2f&);
 	};
 }
 
@@ -0,0 +1,302 @@
+
+#include <cstring>
+
+#include "glState.h"
+
+namespace CNGE {
+	/* nothing is known until the first call sets it */
+	GLuint GLState::program = UNKNOWN;
+	GLuint GLState::vertexArray = UNKNOWN;
+
+	u32 GLState::activeUnit = UNKNOWN;
+	GLuint GLState::textures[NUM_TEXTURE_UNITS] { UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN };
+
+	GLState::BufferRange GLState::uniformBuffers[NUM_UNIFORM_BINDINGS] {};
+
+	i32 GLState::blend = -1;
+	GLenum GLState::blendSource = UNKNOWN;
+	GLenum GLState::blendDestination = UNKNOWN;
+
+	i32 GLState::viewportRect[4] { -1, -1, -1, -1 };
+
+	std::unordered_map<GLuint, std::vector<GLState::Uniform>> GLState::programUniforms;
+	std::vector<GLState::Uniform>* GLState::uniforms = nullptr;
+
+	u64 GLState::issued[NUM_CALLS] {};
+	u64 GLState::filtered[NUM_CALLS] {};
+
+	auto GLState::changed(Call call, bool changed) -> bool {
+		if (changed)
+			++issued[call];
+		else
+			++filtered[call];
+
+		return changed;
+	}
+
+	auto GLState::uniformChanged(GLint location, const void* data, u32 bytes) -> bool {
+		/* gl silently ignores uniforms that were optimized out */
+		if (location < 0)
+			return changed(UNIFORM, false);
+
+		/* a program we did not see bound, can't know what it holds */
+		if (uniforms == nullptr)
+			return changed(UNIFORM, true);
+
+		if (u32(location) >= uniforms->size())
+			uniforms->resize(location + 1, Uniform { 0, {} });
+
+		auto& uniform = (*uniforms)[location];
+
+		if (uniform.bytes == bytes && std::memcmp(uniform.data, data, bytes) == 0)
+			return changed(UNIFORM, false);
+
+		uniform.bytes = bytes;
+		std::memcpy(uniform.data, data, bytes);
+
+		return changed(UNIFORM, true);
+	}
+
+	/*
+	 * binds
+	 */
+
+	auto GLState::useProgram(GLuint newProgram) -> void {
+		if (!changed(PROGRAM, program != newProgram))
+			return;
+
+		glUseProgram(newProgram);
+
+		program = newProgram;
+		uniforms = newProgram == 0 ? nullptr : &programUniforms[newProgram];
+	}
+
+	auto GLState::bindVertexArray(GLuint newVertexArray) -> void {
+		if (!changed(VERTEX_ARRAY, vertexArray != newVertexArray))
+			return;
+
+		glBindVertexArray(newVertexArray);
+
+		vertexArray = newVertexArray;
+	}
+
+	auto GLState::bindTexture(u32 unit, GLuint texture) -> void {
+		/* units past what is tracked, or bad slots, go straight to gl uncached */
+		if (unit >= NUM_TEXTURE_UNITS) {
+			changed(TEXTURE, true);
+
+			glActiveTexture(GL_TEXTURE0 + unit);
+			glBindTexture(GL_TEXTURE_2D, texture);
+
+			activeUnit = unit;
+			return;
+		}
+
+		if (!changed(TEXTURE, textures[unit] != texture))
+			return;
+
+		if (activeUnit != unit) {
+			glActiveTexture(GL_TEXTURE0 + unit);
+			activeUnit = unit;
+		}
+
+		glBindTexture(GL_TEXTURE_2D, texture);
+
+		textures[unit] = texture;
+	}
+
+	auto GLState::bindTexture(GLuint texture) -> void {
+		/* the same unit the plain glBindTexture would have used */
+		bindTexture(activeUnit == UNKNOWN ? 0 : activeUnit, texture);
+	}
+
+	auto GLState::bindUniformBufferRange(u32 binding, GLuint buffer, size offset, size bytes) -> void {
+		if (binding >= NUM_UNIFORM_BINDINGS) {
+			changed(UNIFORM_BUFFER, true);
+			glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, GLintptr(offset), GLsizeiptr(bytes));
+			return;
+		}
+
+		auto& range = uniformBuffers[binding];
+
+		if (!changed(UNIFORM_BUFFER, range.buffer != buffer || range.offset != offset || range.bytes != bytes))
+			return;
+
+		glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, GLintptr(offset), GLsizeiptr(bytes));
+
+		range = { buffer, offset, bytes };
+	}
+
+	/*
+	 * deletes
+	 */
+
+	auto GLState::deleteProgram(GLuint deleted) -> void {
+		glDeleteProgram(deleted);
+
+		programUniforms.erase(deleted);
+
+		/* a deleted program stays in use until something else is, but its name may come back */
+		if (program == deleted) {
+			program = UNKNOWN;
+			uniforms = nullptr;
+		}
+	}
+
+	auto GLState::deleteVertexArrays(i32 count, const GLuint* deleted) -> void {
+		glDeleteVertexArrays(count, deleted);
+
+		/* gl unbinds deleted vertex arrays */
+		for (auto i = 0; i < count; ++i)
+			if (vertexArray == deleted[i])
+				vertexArray = 0;
+	}
+
+	auto GLState::deleteTextures(i32 count, const GLuint* deleted) -> void {
+		glDeleteTextures(count, deleted);
+
+		/* and deleted textures from every unit they were on */
+		for (auto i = 0; i < count; ++i)
+			for (auto& texture : textures)
+				if (texture == deleted[i])
+					texture = 0;
+	}
+
+	auto GLState::deleteBuffers(i32 count, const GLuint* deleted) -> void {
+		glDeleteBuffers(count, deleted);
+
+		/* gl empties the bindings of deleted buffers */
+		for (auto i = 0; i < count; ++i)
+			for (auto& range : uniformBuffers)
+				if (range.buffer == deleted[i])
+					range = { 0, 0, 0 };
+	}
+
+	/*
+	 * uniforms
+	 */
+
+	auto GLState::uniform1i(GLint location, i32 x) -> void {
+		if (uniformChanged(location, &x, sizeof(x)))
+			glUniform1i(location, x);
+	}
+
+	auto GLState::uniform1f(GLint location, f32 x) -> void {
+		if (uniformChanged(location, &x, sizeof(x)))
+			glUniform1f(location, x);
+	}
+
+	auto GLState::uniform2f(GLint location, f32 x, f32 y) -> void {
+		const f32 values[2] { x, y };
+
+		if (uniformChanged(location, values, sizeof(values)))
+			glUniform2f(location, x, y);
+	}
+
+	auto GLState::uniform3f(GLint location, f32 x, f32 y, f32 z) -> void {
+		const f32 values[3] { x, y, z };
+
+		if (uniformChanged(location, values, sizeof(values)))
+			glUniform3f(location, x, y, z);
+	}
+
+	auto GLState::uniform4f(GLint location, f32 x, f32 y, f32 z, f32 w) -> void {
+		const f32 values[4] { x, y, z, w };
+
+		if (uniformChanged(location, values, sizeof(values)))
+			glUniform4f(location, x, y, z, w);
+	}
+
+	auto GLState::uniform4fv(GLint location, const f32 values[]) -> void {
+		if (uniformChanged(location, values, sizeof(f32) * 4))
+			glUniform4fv(location, 1, values);
+	}
+
+	auto GLState::uniformMatrix4fv(GLint location, const f32 values[]) -> void {
+		if (uniformChanged(location, values, sizeof(f32) * 16))
+			glUniformMatrix4fv(location, 1, false, values);
+	}
+
+	auto GLState::uniformMatrix3x2fv(GLint location, const f32 values[]) -> void {
+		if (uniformChanged(location, values, sizeof(f32) * 6))
+			glUniformMatrix3x2fv(location, 1, false, values);
+	}
+
+	/*
+	 * fixed function
+	 */
+
+	auto GLState::setBlend(bool enabled) -> void {
+		if (!changed(BLEND, blend != i32(enabled)))
+			return;
+
+		if (enabled)
+			glEnable(GL_BLEND);
+		else
+			glDisable(GL_BLEND);
+
+		blend = enabled;
+	}
+
+	auto GLState::blendFunc(GLenum source, GLenum destination) -> void {
+		if (!changed(BLEND, blendSource != source || blendDestination != destination))
+			return;
+
+		glBlendFunc(source, destination);
+
+		blendSource = source;
+		blendDestination = destination;
+	}
+
+	auto GLState::viewport(i32 x, i32 y, i32 width, i32 height) -> void {
+		const i32 rect[4] { x, y, width, height };
+
+		if (!changed(VIEWPORT, std::memcmp(viewportRect, rect, sizeof(rect)) != 0))
+			return;
+
+		glViewport(x, y, width, height);
+
+		std::memcpy(viewportRect, rect, sizeof(rect));
+	}
+
+	auto GLState::invalidate() -> void {
+		program = UNKNOWN;
+		vertexArray = UNKNOWN;
+
+		activeUnit = UNKNOWN;
+		for (auto& texture : textures)
+			texture = UNKNOWN;
+
+		for (auto& range : uniformBuffers)
+			range = { UNKNOWN, 0, 0 };
+
+		blend = -1;
+		blendSource = UNKNOWN;
+		blendDestination = UNKNOWN;
+
+		for (auto& value : viewportRect)
+			value = -1;
+
+		programUniforms.clear();
+		uniforms = nullptr;
+	}
+
+	/*
+	 * counters
+	 */
+
+	auto GLState::getIssued(Call call) -> u64 {
+		return issued[call];
+	}
+
+	auto GLState::getFiltered(Call call) -> u64 {
+		return filtered[call];
+	}
+
+	auto GLState::resetCounters() -> void {
+		for (auto i = 0_u32; i < NUM_CALLS; ++i) {
+			issued[i] = 0;
+			filtered[i] = 0;
+		}
+	}
+}
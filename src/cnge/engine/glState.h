@@ -0,0 +1,153 @@
+#ifndef CNGE_GL_STATE
+#define CNGE_GL_STATE
+
+#include <GL/glew.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include "types.h"
+
+namespace CNGE {
+	/// remembers what is currently bound in the one gl context
+	/// and drops calls that would set something to what it already is,
+	/// every bind, uniform, blend and viewport change goes through here
+	/// so the cache never falls out of step with the driver
+	class GLState {
+	public:
+		/// the kinds of calls that are tracked
+		enum Call : u32 {
+			PROGRAM,
+			VERTEX_ARRAY,
+			TEXTURE,
+			UNIFORM_BUFFER,
+			UNIFORM,
+			BLEND,
+			VIEWPORT,
+			NUM_CALLS
+		};
+
+		constexpr static u32 NUM_TEXTURE_UNITS = 16;
+		constexpr static u32 NUM_UNIFORM_BINDINGS = 16;
+
+		/*
+		 * binds
+		 */
+
+		static auto useProgram(GLuint program) -> void;
+
+		static auto bindVertexArray(GLuint vertexArray) -> void;
+
+		/// binds to GL_TEXTURE_2D of unit, switching the active unit only if needed,
+		/// units from NUM_TEXTURE_UNITS up are not cached and always make the calls
+		static auto bindTexture(u32 unit, GLuint texture) -> void;
+
+		static auto bindTexture(GLuint texture) -> void;
+
+		/// points a GL_UNIFORM_BUFFER binding at part of a buffer,
+		/// bindings from NUM_UNIFORM_BINDINGS up are not cached
+		static auto bindUniformBufferRange(u32 binding, GLuint buffer, size offset, size bytes) -> void;
+
+		/*
+		 * deletes, so that reused names are not mistaken for bound ones
+		 */
+
+		static auto deleteProgram(GLuint program) -> void;
+
+		static auto deleteVertexArrays(i32 count, const GLuint* vertexArrays) -> void;
+
+		static auto deleteTextures(i32 count, const GLuint* textures) -> void;
+
+		static auto deleteBuffers(i32 count, const GLuint* buffers) -> void;
+
+		/*
+		 * uniforms of the program in use
+		 */
+
+		static auto uniform1i(GLint location, i32 x) -> void;
+
+		static auto uniform1f(GLint location, f32 x) -> void;
+
+		static auto uniform2f(GLint location, f32 x, f32 y) -> void;
+
+		static auto uniform3f(GLint location, f32 x, f32 y, f32 z) -> void;
+
+		static auto uniform4f(GLint location, f32 x, f32 y, f32 z, f32 w) -> void;
+
+		static auto uniform4fv(GLint location, const f32 values[]) -> void;
+
+		static auto uniformMatrix4fv(GLint location, const f32 values[]) -> void;
+
+		static auto uniformMatrix3x2fv(GLint location, const f32 values[]) -> void;
+
+		/*
+		 * fixed function
+		 */
+
+		static auto setBlend(bool enabled) -> void;
+
+		static auto blendFunc(GLenum source, GLenum destination) -> void;
+
+		static auto viewport(i32 x, i32 y, i32 width, i32 height) -> void;
+
+		/// forget everything, for after something outside of here touched the context
+		static auto invalidate() -> void;
+
+		/*
+		 * counters
+		 */
+
+		/// calls that reached the driver
+		[[nodiscard]] static auto getIssued(Call call) -> u64;
+
+		/// calls that were dropped because nothing would have changed
+		[[nodiscard]] static auto getFiltered(Call call) -> u64;
+
+		static auto resetCounters() -> void;
+
+	private:
+		/* one value as it was last uploaded, big enough for a mat4 */
+		struct Uniform {
+			u32 bytes;
+			u8 data[sizeof(f32) * 16];
+		};
+
+		/* what a uniform buffer binding points at */
+		struct BufferRange {
+			GLuint buffer;
+			size offset;
+			size bytes;
+		};
+
+		constexpr static GLuint UNKNOWN = ~0_u32;
+
+		static GLuint program;
+		static GLuint vertexArray;
+
+		static u32 activeUnit;
+		static GLuint textures[NUM_TEXTURE_UNITS];
+
+		static BufferRange uniformBuffers[NUM_UNIFORM_BINDINGS];
+
+		static i32 blend;
+		static GLenum blendSource;
+		static GLenum blendDestination;
+
+		static i32 viewportRect[4];
+
+		/* per program, indexed by location */
+		static std::unordered_map<GLuint, std::vector<Uniform>> programUniforms;
+		static std::vector<Uniform>* uniforms;
+
+		static u64 issued[NUM_CALLS];
+		static u64 filtered[NUM_CALLS];
+
+		/// true and counted as issued when the call should go through
+		static auto changed(Call call, bool changed) -> bool;
+
+		/// compares against and then stores the last value given to location
+		static auto uniformChanged(GLint location, const void* data, u32 bytes) -> bool;
+	};
+}
+
+#endif
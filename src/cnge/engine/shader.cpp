@@ -1,11 +1,14 @@
 
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 
 #include "shader.h"
 
+#include "glState.h"
 #include "transform.h"
+#include "uniformRing.h"
 
 namespace CNGE {
 
@@ -21,7 +24,13 @@ namespace CNGE {
 		fragmentData(nullptr),
 	
 		modelLocation(),
-		projviewLocation()
+		projviewLocation(),
+		affine(false),
+
+		drawBlockSize(0),
+		modelOffset(-1),
+		projviewOffset(-1),
+		drawBlock(nullptr)
 	{
 		if (!hasGather) {
 			auto vertexLen = strlen(vertex) + 1;
@@ -130,12 +139,37 @@ namespace CNGE {
 		modelLocation = getUniform(MODEL_NAME);
 		projviewLocation = getUniform(PROJVIEW_NAME);
 
+		// 2d shaders can take the compact transforms
+		auto modelName = MODEL_NAME;
+		auto modelIndex = GLuint();
+		glGetUniformIndices(program, 1, &modelName, &modelIndex);
+
+		if (modelIndex != GL_INVALID_INDEX) {
+			auto modelType = GLint();
+			glGetActiveUniformsiv(program, 1, &modelIndex, GL_UNIFORM_TYPE, &modelType);
+			affine = modelType == GL_FLOAT_MAT3x2;
+		}
+
+		// per draw uniforms that live in a block
+		auto blockIndex = glGetUniformBlockIndex(program, DRAW_BLOCK_NAME);
+
+		if (blockIndex != GL_INVALID_INDEX) {
+			glUniformBlockBinding(program, blockIndex, DRAW_BLOCK_BINDING);
+
+			auto blockSize = GLint();
+			glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize);
+			drawBlockSize = blockSize;
+
+			modelOffset = getBlockOffset(MODEL_NAME);
+			projviewOffset = getBlockOffset(PROJVIEW_NAME);
+		}
+
 		// now load custom uniforms
 		getUniforms();
 	}
 
 	void Shader::customUnload() {
-		glDeleteProgram(program);
+		GLState::deleteProgram(program);
 	}
 
 	void Shader::customDiscard() {
@@ -152,48 +186,138 @@ namespace CNGE {
 		return glGetUniformLocation(program, _name);
 	}
 
+	int Shader::getBlockOffset(const char* name) {
+		auto index = GLuint();
+		glGetUniformIndices(program, 1, &name, &index);
+
+		if (index == GL_INVALID_INDEX)
+			return -1;
+
+		// uniforms outside of any block report -1 themselves
+		auto offset = GLint();
+		glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &offset);
+
+		return offset;
+	}
+
+	void Shader::beginDraw() {
+		auto offset = 0_u32;
+		drawBlock = UniformRing::allocate(drawBlockSize, offset);
+
+		UniformRing::bind(DRAW_BLOCK_BINDING, offset, drawBlockSize);
+	}
+
 	/// startLoading using this shader
 	/// after calling this then give other things
-	void Shader::enable(f32 model[], f32 projview[]) {
-		glUseProgram(program);
+	void Shader::enable(const f32 model[], const f32 projview[]) {
+		GLState::useProgram(program);
+
+		if (drawBlockSize > 0) {
+			beginDraw();
 
-		giveMatrix4(modelLocation, model);
-		giveMatrix4(projviewLocation, projview);
+			giveBlockMatrix4(modelOffset, model);
+			giveBlockMatrix4(projviewOffset, projview);
+
+		} else {
+			giveMatrix4(modelLocation, model);
+			giveMatrix4(projviewLocation, projview);
+		}
 	}
 
-	void Shader::enable() {
-		glUseProgram(program);
+	void Shader::enable(const Affine2f & model, const Affine2f & projview) {
+		GLState::useProgram(program);
 
-		giveMatrix4(modelLocation, Transform::defaultModel);
-		giveMatrix4(projviewLocation, Transform::defaultProjview);
+		if (drawBlockSize > 0) {
+			beginDraw();
+
+			giveBlockMatrix3x2(modelOffset, model.m);
+			giveBlockMatrix3x2(projviewOffset, projview.m);
+
+		} else {
+			giveMatrix3x2(modelLocation, model.m);
+			giveMatrix3x2(projviewLocation, projview.m);
+		}
+	}
+
+	void Shader::enable() {
+		if (affine)
+			enable(Transform::defaultAffineModel, Transform::defaultAffineProjview);
+		else
+			enable(Transform::defaultModel.m, Transform::defaultProjview.m);
 	}
 
 	/*
 	 * GIVERS
 	 */
 
+	void Shader::giveInt(const int location, const int x) {
+		GLState::uniform1i(location, x);
+	}
+
 	void Shader::giveFloat(const int location, const float x) {
-		glUniform1f(location, x);
+		GLState::uniform1f(location, x);
 	}
 
 	void Shader::giveVector2(const int location, const float x, const float y) {
-		glUniform2f(location, x, y);
+		GLState::uniform2f(location, x, y);
 	}
 
 	void Shader::giveVector3(const int location, const float x, const float y, const float z) {
-		glUniform3f(location, x, y, z);
+		GLState::uniform3f(location, x, y, z);
 	}
 
 	void Shader::giveVector4(const int location, const float x, const float y, const float z, const float w) {
-		glUniform4f(location, x, y, z, w);
+		GLState::uniform4f(location, x, y, z, w);
 	}
 
 	void Shader::giveVector4(const int location, const float values[]) {
-		glUniform4fv(location, 1, values);
+		GLState::uniform4fv(location, values);
 	}
 
 	void Shader::giveMatrix4(const int location, const float values[]) {
-		glUniformMatrix4fv(location, 1, false, values);
+		GLState::uniformMatrix4fv(location, values);
+	}
+
+	void Shader::giveMatrix3x2(const int location, const float values[]) {
+		GLState::uniformMatrix3x2fv(location, values);
+	}
+
+	/*
+	 * BLOCK GIVERS
+	 */
+
+	void Shader::giveBlockInt(const int offset, const int x) {
+		if (offset >= 0)
+			std::memcpy(drawBlock + offset, &x, sizeof(x));
+	}
+
+	void Shader::giveBlockFloat(const int offset, const float x) {
+		if (offset >= 0)
+			std::memcpy(drawBlock + offset, &x, sizeof(x));
+	}
+
+	void Shader::giveBlockVector4(const int offset, const float x, const float y, const float z, const float w) {
+		const float values[4] { x, y, z, w };
+		giveBlockVector4(offset, values);
+	}
+
+	void Shader::giveBlockVector4(const int offset, const float values[]) {
+		if (offset >= 0)
+			std::memcpy(drawBlock + offset, values, sizeof(float) * 4);
+	}
+
+	void Shader::giveBlockMatrix4(const int offset, const float values[]) {
+		if (offset >= 0)
+			std::memcpy(drawBlock + offset, values, sizeof(float) * 16);
+	}
+
+	void Shader::giveBlockMatrix3x2(const int offset, const float values[]) {
+		if (offset < 0)
+			return;
+
+		// std140 pads each vec2 column out to a vec4
+		for (auto column = 0; column < 3; ++column)
+			std::memcpy(drawBlock + offset + column * sizeof(float) * 4, values + column * 2, sizeof(float) * 2);
 	}
 
 	Shader::~Shader() {}
@@ -6,6 +6,7 @@
 
 #include "types.h"
 #include "cnge/load/resource.h"
+#include "cnge/math/affine2.h"
 
 namespace CNGE {
 	class Shader : public Resource {
@@ -13,6 +14,11 @@ namespace CNGE {
 		constexpr static char const * MODEL_NAME = "model";
 		constexpr static char const * PROJVIEW_NAME = "projView";
 
+		/// shaders that declare a std140 uniform block with this name get their
+		/// per draw uniforms through the uniform ring instead of glUniform calls
+		constexpr static char const * DRAW_BLOCK_NAME = "Draw";
+		constexpr static u32 DRAW_BLOCK_BINDING = 0;
+
 		/*
 		 * load
 		 */
@@ -25,9 +31,16 @@ namespace CNGE {
 		/// getter
 		int getUniform(const char* name);
 
+		/// where a member of the draw block is, -1 if it is not in one
+		int getBlockOffset(const char* name);
+
 		/// startLoading using this shader
 		/// after calling this then give other things
-		void enable(f32 model[], f32 projview[]);
+		void enable(const f32 model[], const f32 projview[]);
+
+		/// the same for shaders that declare model and projView as mat3x2,
+		/// 2d draws only need 12 floats uploaded instead of 32
+		void enable(const Affine2f & model, const Affine2f & projview);
 
 		/// enables the shader and covers the entire ndc coordinates
 		void enable();
@@ -36,6 +49,8 @@ namespace CNGE {
 		 * GIVERS
 		 */
 
+		void giveInt(const int location, const int x);
+
 		void giveFloat(const int location, const float x);
 
 		void giveVector2(const int location, const float x, const float y);
@@ -48,6 +63,26 @@ namespace CNGE {
 
 		void giveMatrix4(const int location, const float values[]);
 
+		void giveMatrix3x2(const int location, const float values[]);
+
+		/*
+		 * BLOCK GIVERS
+		 * write into the draw block that the last enable handed out,
+		 * every member has to be given again for each draw
+		 */
+
+		void giveBlockInt(const int offset, const int x);
+
+		void giveBlockFloat(const int offset, const float x);
+
+		void giveBlockVector4(const int offset, const float x, const float y, const float z, const float w);
+
+		void giveBlockVector4(const int offset, const float values[]);
+
+		void giveBlockMatrix4(const int offset, const float values[]);
+
+		void giveBlockMatrix3x2(const int offset, const float values[]);
+
 		~Shader();
 
 	protected:
@@ -72,6 +107,20 @@ namespace CNGE {
 
 		GLint modelLocation;
 		GLint projviewLocation;
+
+		/// model and projView are mat3x2 instead of mat4
+		bool affine;
+
+		/* the draw block, a size of 0 when the shader has none */
+		u32 drawBlockSize;
+		GLint modelOffset;
+		GLint projviewOffset;
+
+		/* this draw's block in the uniform ring */
+		u8* drawBlock;
+
+		/// hands out a fresh draw block and binds it
+		void beginDraw();
 	};
 
 }
@@ -0,0 +1,41 @@
+
+#include "GL/glew.h"
+#include "GL/gl.h"
+
+#include "avifTexture.h"
+
+namespace CNGE {
+	AvifTexture::AvifTexture(const char* path, TextureParams params, u32 threads)
+		: Texture(path, params), threads(threads), avifImage() {}
+
+	auto AvifTexture::customGather() -> void {
+		avifImage = std::make_unique<AvifImage>(assetPath, threads);
+
+		width = avifImage->getWidth();
+		height = avifImage->getHeight();
+	}
+
+	auto AvifTexture::customProcess() -> void {
+		createTexture();
+
+		switch (avifImage->getFormat()) {
+			case AvifImage::Format::RGBA8:
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, avifImage->getPixels());
+				break;
+
+			case AvifImage::Format::RGB10_A2:
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB10_A2, width, height, 0, GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, avifImage->getPixels());
+				break;
+
+			case AvifImage::Format::RGBA16:
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 8);
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16, width, height, 0, GL_RGBA, GL_UNSIGNED_SHORT, avifImage->getPixels());
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+				break;
+		}
+	}
+
+	auto AvifTexture::customDiscard() -> void {
+		avifImage = nullptr;
+	}
+}
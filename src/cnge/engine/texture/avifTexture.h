@@ -0,0 +1,28 @@
+
+#ifndef CNGE_AVIF_TEXTURE
+#define CNGE_AVIF_TEXTURE
+
+#include "texture.h"
+#include "cnge/image/avif/avifImage.h"
+
+namespace CNGE {
+	/// a texture from an avif file
+	/// 10 bit images go up as GL_RGB10_A2, 12 bit ones and 10 bit with alpha as GL_RGBA16
+	class AvifTexture : public Texture {
+	public:
+		/// 0 threads means one per hardware thread
+		AvifTexture(const char*, TextureParams = TextureParams(), u32 threads = 0);
+
+	protected:
+		auto customGather() -> void override;
+		auto customProcess() -> void override;
+		auto customDiscard() -> void override;
+
+	private:
+		u32 threads;
+
+		std::unique_ptr<AvifImage> avifImage;
+	};
+}
+
+#endif
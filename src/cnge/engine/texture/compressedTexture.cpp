@@ -0,0 +1,47 @@
+
+#include "GL/glew.h"
+#include "GL/gl.h"
+
+#include <stdexcept>
+
+#include "compressedTexture.h"
+
+namespace CNGE {
+	CompressedTexture::CompressedTexture(const char* path, TextureParams params)
+		: Texture(path, params), compressedImage(), numLevels(0) {}
+
+	auto CompressedTexture::customGather() -> void {
+		compressedImage = std::make_unique<CompressedImage>(assetPath);
+
+		const auto& levels = compressedImage->getLevels();
+
+		width = levels[0].width;
+		height = levels[0].height;
+		numLevels = u32(levels.size());
+	}
+
+	auto CompressedTexture::customProcess() -> void {
+		createTexture();
+
+		/* only the mips the file has, so the texture is complete with a mipmap filter */
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLint(numLevels - 1));
+
+		/* clear anything earlier so the check below is only about this upload */
+		while (glGetError() != GL_NO_ERROR);
+
+		auto level = 0;
+		for (const auto& mip : compressedImage->getLevels())
+			glCompressedTexImage2D(GL_TEXTURE_2D, level++, compressedImage->getFormat(), mip.width, mip.height, 0, GLsizei(mip.length), mip.data);
+
+		if (glGetError() != GL_NO_ERROR)
+			throw std::runtime_error("Compressed format is not supported by this GPU");
+	}
+
+	auto CompressedTexture::customDiscard() -> void {
+		compressedImage = nullptr;
+	}
+
+	auto CompressedTexture::getNumLevels() const -> u32 {
+		return numLevels;
+	}
+}
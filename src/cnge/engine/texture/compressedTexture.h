@@ -0,0 +1,29 @@
+
+#ifndef CNGE_COMPRESSED_TEXTURE
+#define CNGE_COMPRESSED_TEXTURE
+
+#include "texture.h"
+#include "cnge/image/compressed/compressedImage.h"
+
+namespace CNGE {
+	/// a texture from a ktx2 or dds file, uploaded in its block compressed form with every mip
+	/// what is drawn is exactly what the gpu samples from the shipped file
+	class CompressedTexture : public Texture {
+	public:
+		CompressedTexture(const char*, TextureParams = TextureParams());
+
+		[[nodiscard]] auto getNumLevels() const -> u32;
+
+	protected:
+		auto customGather() -> void override;
+		auto customProcess() -> void override;
+		auto customDiscard() -> void override;
+
+	private:
+		std::unique_ptr<CompressedImage> compressedImage;
+
+		u32 numLevels;
+	};
+}
+
+#endif
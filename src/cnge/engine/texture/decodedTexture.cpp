@@ -0,0 +1,23 @@
+
+#include "GL/glew.h"
+#include "GL/gl.h"
+
+#include "decodedTexture.h"
+
+namespace CNGE {
+	DecodedTexture::DecodedTexture(std::shared_ptr<const DecodedImage> image, TextureParams params)
+		: Texture("", params), decodedImage(std::move(image)) {
+		width = decodedImage->width;
+		height = decodedImage->height;
+	}
+
+	auto DecodedTexture::customProcess() -> void {
+		createTexture();
+
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, decodedImage->pixels.get());
+	}
+
+	auto DecodedTexture::customDiscard() -> void {
+		decodedImage = nullptr;
+	}
+}
@@ -0,0 +1,27 @@
+
+#ifndef CNGE_DECODED_TEXTURE
+#define CNGE_DECODED_TEXTURE
+
+#include <memory>
+
+#include "texture.h"
+#include "cnge/image/decoderRegistry.h"
+
+namespace CNGE {
+	/// a texture from an image that was already decoded somewhere else, like an archive page
+	/// there is nothing to gather, process uploads straight away
+	class DecodedTexture : public Texture {
+	public:
+		DecodedTexture(std::shared_ptr<const DecodedImage>, TextureParams = TextureParams());
+
+	protected:
+		auto customGather() -> void override {} // no gather
+		auto customProcess() -> void override;
+		auto customDiscard() -> void override;
+
+	private:
+		std::shared_ptr<const DecodedImage> decodedImage;
+	};
+}
+
+#endif
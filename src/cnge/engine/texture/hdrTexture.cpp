@@ -0,0 +1,30 @@
+
+#include "GL/glew.h"
+#include "GL/gl.h"
+
+#include "hdrTexture.h"
+
+namespace CNGE {
+	HdrTexture::HdrTexture(const char* path, TextureParams params)
+		: Texture(path, params), hdrImage() {}
+
+	auto HdrTexture::customGather() -> void {
+		hdrImage = std::make_unique<HdrImage>(assetPath);
+
+		width = hdrImage->getWidth();
+		height = hdrImage->getHeight();
+	}
+
+	auto HdrTexture::customProcess() -> void {
+		createTexture();
+
+		/* halves go up as they are, no conversion on the driver side */
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 8);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, width, height, 0, GL_RGBA, GL_HALF_FLOAT, hdrImage->getPixels());
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+
+	auto HdrTexture::customDiscard() -> void {
+		hdrImage = nullptr;
+	}
+}
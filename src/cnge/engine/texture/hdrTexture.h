@@ -0,0 +1,25 @@
+
+#ifndef CNGE_HDR_TEXTURE
+#define CNGE_HDR_TEXTURE
+
+#include "texture.h"
+#include "cnge/image/hdr/hdrImage.h"
+
+namespace CNGE {
+	/// a texture from a radiance or openexr file
+	/// kept as half floats on the gpu so exposure can be changed after loading
+	class HdrTexture : public Texture {
+	public:
+		HdrTexture(const char*, TextureParams = TextureParams());
+
+	protected:
+		auto customGather() -> void override;
+		auto customProcess() -> void override;
+		auto customDiscard() -> void override;
+
+	private:
+		std::unique_ptr<HdrImage> hdrImage;
+	};
+}
+
+#endif
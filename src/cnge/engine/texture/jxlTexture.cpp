@@ -0,0 +1,117 @@
+
+#include "GL/glew.h"
+#include "GL/gl.h"
+
+#include <cstring>
+
+#include "jxlTexture.h"
+
+namespace CNGE {
+	JxlTexture::JxlTexture(const char* path, TextureParams params, u32 numWorkers) :
+		Texture(path, params),
+		workers(numWorkers),
+		jxlImage(),
+		decodeThread(),
+		stopping(false),
+		stagedMutex(),
+		staged(),
+		hasStaged(false),
+		stagedFinal(false),
+		error(),
+		uploading(),
+		complete(false),
+		numPasses(0)
+	{}
+
+	auto JxlTexture::customGather() -> void {
+		jxlImage = std::make_unique<JxlImage>(assetPath, workers);
+
+		width = jxlImage->getWidth();
+		height = jxlImage->getHeight();
+	}
+
+	auto JxlTexture::customProcess() -> void {
+		createTexture();
+
+		/* blank until the first pass comes in */
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+		stopping = false;
+
+		decodeThread = std::thread([this] {
+			try {
+				jxlImage->decode([this](const u8* pixels, bool final) {
+					auto lock = std::lock_guard(stagedMutex);
+
+					staged.resize(size(width) * height * 4);
+					std::memcpy(staged.data(), pixels, staged.size());
+
+					hasStaged = true;
+					stagedFinal = final;
+				}, stopping);
+
+			} catch (std::exception& ex) {
+				/* whatever passes made it stay on screen */
+				auto lock = std::lock_guard(stagedMutex);
+				error = ex.what();
+			}
+		});
+	}
+
+	auto JxlTexture::update() -> bool {
+		{
+			auto lock = std::lock_guard(stagedMutex);
+
+			if (!hasStaged)
+				return false;
+
+			/* upload outside the lock so the decoder can stage the next pass meanwhile */
+			std::swap(staged, uploading);
+			hasStaged = false;
+			complete = stagedFinal;
+		}
+
+		bind();
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, uploading.data());
+
+		++numPasses;
+
+		return true;
+	}
+
+	auto JxlTexture::stopDecode() -> void {
+		stopping = true;
+
+		if (decodeThread.joinable())
+			decodeThread.join();
+	}
+
+	auto JxlTexture::customDiscard() -> void {
+		stopDecode();
+
+		jxlImage = nullptr;
+	}
+
+	auto JxlTexture::customUnload() -> void {
+		stopDecode();
+
+		Texture::customUnload();
+	}
+
+	auto JxlTexture::getComplete() const -> bool {
+		return complete;
+	}
+
+	auto JxlTexture::getNumPasses() const -> u32 {
+		return numPasses;
+	}
+
+	auto JxlTexture::getError() -> std::string {
+		auto lock = std::lock_guard(stagedMutex);
+		return error;
+	}
+
+	JxlTexture::~JxlTexture() {
+		stopDecode();
+	}
+}
@@ -0,0 +1,66 @@
+
+#ifndef CNGE_JXL_TEXTURE
+#define CNGE_JXL_TEXTURE
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "texture.h"
+#include "cnge/image/jxl/jxlImage.h"
+#include "cnge/load/threadPool.h"
+
+namespace CNGE {
+	/// a jpeg xl texture that shows up early and sharpens
+	/// gathering only reads the header, processing starts the decode,
+	/// and update uploads each progressive pass over the last one
+	class JxlTexture : public Texture {
+	public:
+		/// 0 workers means one per hardware thread
+		JxlTexture(const char*, TextureParams = TextureParams(), u32 numWorkers = 0);
+
+		auto update() -> bool override;
+
+		/// whether the last pass has been uploaded
+		[[nodiscard]] auto getComplete() const -> bool;
+		[[nodiscard]] auto getNumPasses() const -> u32;
+
+		/// why decoding stopped early, empty if it hasn't
+		auto getError() -> std::string override;
+
+		~JxlTexture();
+
+	protected:
+		auto customGather() -> void override;
+		auto customProcess() -> void override;
+		auto customDiscard() -> void override;
+		auto customUnload() -> void override;
+
+	private:
+		ThreadPool workers;
+		std::unique_ptr<JxlImage> jxlImage;
+
+		std::thread decodeThread;
+		std::atomic<bool> stopping;
+
+		/* the newest pass, swapped in by the decode thread */
+		std::mutex stagedMutex;
+		std::vector<u8> staged;
+		bool hasStaged;
+		bool stagedFinal;
+
+		/* set by the decode thread if it fails */
+		std::string error;
+
+		std::vector<u8> uploading;
+
+		bool complete;
+		u32 numPasses;
+
+		auto stopDecode() -> void;
+	};
+}
+
+#endif
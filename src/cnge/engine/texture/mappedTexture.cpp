@@ -0,0 +1,66 @@
+
+#include "GL/glew.h"
+#include "GL/gl.h"
+
+#include <stdexcept>
+
+#include "mappedTexture.h"
+
+namespace CNGE {
+	MappedTexture::MappedTexture(const char* path, TextureParams params)
+		: Texture(path, params), rawImage() {}
+
+	auto MappedTexture::customGather() -> void {
+		/* only the header is read here, the pages come in during the upload */
+		rawImage = std::make_unique<RawImage>(assetPath);
+
+		width = rawImage->getWidth();
+		height = rawImage->getHeight();
+	}
+
+	auto MappedTexture::customProcess() -> void {
+		constexpr static GLenum FORMATS[4] { GL_RED, GL_RG, GL_RGB, GL_RGBA };
+		constexpr static GLint FORMATS_8[4] { GL_R8, GL_RG8, GL_RGB8, GL_RGBA8 };
+		constexpr static GLint FORMATS_16[4] { GL_R16, GL_RG16, GL_RGB16, GL_RGBA16 };
+
+		const auto channels = rawImage->getChannels();
+		const auto wide = rawImage->getBytesPerChannel() == 2;
+		const auto pixelBytes = channels * rawImage->getBytesPerChannel();
+
+		if (rawImage->getRowBytes() % pixelBytes != 0)
+			throw std::runtime_error("Raw image stride is not a whole number of pixels");
+
+		createTexture();
+
+		if (channels == 1) {
+			constexpr static GLint GRAY[4] { GL_RED, GL_RED, GL_RED, GL_ONE };
+			glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, GRAY);
+
+		} else if (channels == 2) {
+			constexpr static GLint GRAY_ALPHA[4] { GL_RED, GL_RED, GL_RED, GL_GREEN };
+			glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, GRAY_ALPHA);
+		}
+
+		/* describe the mapping as it is so the driver reads it in place */
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, GLint(rawImage->getRowBytes() / pixelBytes));
+		glPixelStorei(GL_UNPACK_SWAP_BYTES, rawImage->getBigEndian());
+
+		glTexImage2D(
+			GL_TEXTURE_2D, 0,
+			wide ? FORMATS_16[channels - 1] : FORMATS_8[channels - 1],
+			width, height, 0,
+			FORMATS[channels - 1],
+			wide ? GL_UNSIGNED_SHORT : GL_UNSIGNED_BYTE,
+			rawImage->getPixels()
+		);
+
+		glPixelStorei(GL_UNPACK_SWAP_BYTES, GL_FALSE);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+
+	auto MappedTexture::customDiscard() -> void {
+		rawImage = nullptr;
+	}
+}
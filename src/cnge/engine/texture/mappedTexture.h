@@ -0,0 +1,25 @@
+
+#ifndef CNGE_MAPPED_TEXTURE
+#define CNGE_MAPPED_TEXTURE
+
+#include "texture.h"
+#include "cnge/image/raw/rawImage.h"
+
+namespace CNGE {
+	/// a texture uploaded straight out of a memory mapped raw image
+	/// gray images are swizzled on the gpu instead of being expanded to rgba
+	class MappedTexture : public Texture {
+	public:
+		MappedTexture(const char*, TextureParams = TextureParams());
+
+	protected:
+		auto customGather() -> void override;
+		auto customProcess() -> void override;
+		auto customDiscard() -> void override;
+
+	private:
+		std::unique_ptr<RawImage> rawImage;
+	};
+}
+
+#endif
@@ -0,0 +1,47 @@
+
+#include "GL/glew.h"
+#include "GL/gl.h"
+
+#include "pngStreamTexture.h"
+
+namespace CNGE {
+	PngStreamTexture::PngStreamTexture(const char* path, TextureParams params)
+		: Texture(path, params), stream() {}
+
+	auto PngStreamTexture::customGather() -> void {
+		stream = std::make_unique<PngStream>(assetPath);
+
+		width = stream->getWidth();
+		height = stream->getHeight();
+	}
+
+	auto PngStreamTexture::customProcess() -> void {
+		createTexture();
+
+		/* transparent until rows come in */
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glClearTexImage(get(), 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	}
+
+	auto PngStreamTexture::update() -> bool {
+		if (stream == nullptr)
+			return false;
+
+		return stream->takeChanged([this](const u8* pixels, u32 top, u32 bottom) {
+			bind();
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, top, width, bottom - top, GL_RGBA, GL_UNSIGNED_BYTE, pixels + size(top) * width * 4);
+		});
+	}
+
+	auto PngStreamTexture::getFinished() const -> bool {
+		return stream == nullptr || stream->getFinished();
+	}
+
+	auto PngStreamTexture::getError() -> std::string {
+		return stream == nullptr ? std::string() : stream->getError();
+	}
+
+	auto PngStreamTexture::customDiscard() -> void {
+		stream = nullptr;
+	}
+}
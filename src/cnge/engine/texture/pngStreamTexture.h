@@ -0,0 +1,32 @@
+
+#ifndef CNGE_PNG_STREAM_TEXTURE
+#define CNGE_PNG_STREAM_TEXTURE
+
+#include "texture.h"
+#include "cnge/image/png/pngStream.h"
+
+namespace CNGE {
+	/// a png texture filled in as the file is piped in
+	/// gathering waits only for the header, update uploads whichever rows have arrived
+	class PngStreamTexture : public Texture {
+	public:
+		/// "-" for stdin, or the path of a fifo
+		PngStreamTexture(const char*, TextureParams = TextureParams());
+
+		auto update() -> bool override;
+
+		[[nodiscard]] auto getFinished() const -> bool;
+
+		auto getError() -> std::string override;
+
+	protected:
+		auto customGather() -> void override;
+		auto customProcess() -> void override;
+		auto customDiscard() -> void override;
+
+	private:
+		std::unique_ptr<PngStream> stream;
+	};
+}
+
+#endif
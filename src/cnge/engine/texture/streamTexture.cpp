@@ -0,0 +1,126 @@
+
+#include <cstring>
+
+#include "streamTexture.h"
+#include "cnge/engine/glState.h"
+
+namespace CNGE {
+	/* one second, in the nanoseconds fences are waited in */
+	constexpr static GLuint64 FENCE_TIMEOUT = 1000000000;
+
+	StreamTexture::StreamTexture(u32 width, u32 height, u32 numSlots, TextureParams params) :
+		Resource(false),
+		width(width),
+		height(height),
+		frameSize(size(width) * height * 4),
+		numSlots(numSlots),
+		nextSlot(0),
+		texture(0),
+		buffer(0),
+		mapped(nullptr),
+		fences(std::make_unique<GLsync[]>(numSlots)),
+		horzWrap(params.horzWrap), vertWrap(params.vertWrap),
+		minFilter(params.minFilter), magFilter(params.magFilter) {}
+
+	auto StreamTexture::customProcess() -> void {
+		glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+
+		glTextureParameteri(texture, GL_TEXTURE_WRAP_S, horzWrap);
+		glTextureParameteri(texture, GL_TEXTURE_WRAP_T, vertWrap);
+		glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, minFilter);
+		glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, magFilter);
+
+		glTextureStorage2D(texture, 1, GL_RGBA8, width, height);
+
+		/* the mapping stays valid for the life of the buffer */
+		constexpr auto flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		glCreateBuffers(1, &buffer);
+		glNamedBufferStorage(buffer, frameSize * numSlots, nullptr, flags);
+
+		mapped = static_cast<u8*>(glMapNamedBufferRange(buffer, 0, frameSize * numSlots, flags));
+	}
+
+	auto StreamTexture::upload(const u8* pixels) -> void {
+		stage(pixels);
+		commit();
+	}
+
+	auto StreamTexture::stage(const u8* pixels) -> void {
+		auto& fence = fences[nextSlot];
+
+		/* wait until the gpu is done reading the last frame that used this slot, */
+		/* however long that takes, writing into it any earlier would tear the upload in flight */
+		if (fence != nullptr) {
+			while (true) {
+				const auto result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+
+				if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+					break;
+
+				/* the fence can't be waited on, so wait on everything */
+				if (result == GL_WAIT_FAILED) {
+					glFinish();
+					break;
+				}
+			}
+
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+
+		std::memcpy(mapped + frameSize * nextSlot, pixels, frameSize);
+	}
+
+	auto StreamTexture::commit() -> void {
+		auto& fence = fences[nextSlot];
+		const auto offset = frameSize * nextSlot;
+
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+		glTextureSubImage2D(texture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, reinterpret_cast<void*>(offset));
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+		fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		nextSlot = (nextSlot + 1) % numSlots;
+	}
+
+	auto StreamTexture::customUnload() -> void {
+		for (auto i = 0_u32; i < numSlots; ++i) {
+			if (fences[i] != nullptr) {
+				glDeleteSync(fences[i]);
+				fences[i] = nullptr;
+			}
+		}
+
+		glUnmapNamedBuffer(buffer);
+		mapped = nullptr;
+
+		glDeleteBuffers(1, &buffer);
+		GLState::deleteTextures(1, &texture);
+	}
+
+	auto StreamTexture::bind() -> void {
+		GLState::bindTexture(texture);
+	}
+
+	auto StreamTexture::bind(i32 slot) -> void {
+		GLState::bindTexture(slot - GL_TEXTURE0, texture);
+	}
+
+	auto StreamTexture::get() const -> u32 {
+		return texture;
+	}
+
+	auto StreamTexture::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto StreamTexture::getHeight() const -> u32 {
+		return height;
+	}
+
+	StreamTexture::~StreamTexture() {
+		smartDestroy();
+	}
+}
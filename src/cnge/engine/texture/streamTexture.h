@@ -0,0 +1,69 @@
+
+#ifndef CNGE_STREAM_TEXTURE
+#define CNGE_STREAM_TEXTURE
+
+#include <GL/glew.h>
+
+#include <memory>
+
+#include "types.h"
+#include "cnge/load/resource.h"
+#include "textureParams.h"
+
+namespace CNGE {
+	/// an rgba8 texture whose contents are replaced often
+	/// pixels go through a persistently mapped pixel buffer split into slots,
+	/// so an upload is a memcpy and the driver copies to the texture on its own time
+	class StreamTexture : public Resource {
+	public:
+		StreamTexture(u32, u32, u32 = 3, TextureParams = TextureParams());
+
+		/* no copying the texture */
+		StreamTexture(const StreamTexture&) = delete;
+		auto operator=(const StreamTexture&) -> void = delete;
+
+		/// copies a full frame of rgba8 pixels into the next free slot
+		/// and starts the transfer into the texture
+		auto upload(const u8*) -> void;
+
+		/// the two halves of upload, for sources that can only tell after copying
+		/// whether the frame was good, a staged frame that isn't committed is dropped
+		auto stage(const u8*) -> void;
+		auto commit() -> void;
+
+		auto bind() -> void;
+		auto bind(i32) -> void;
+
+		[[nodiscard]] auto get() const -> u32;
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+
+		~StreamTexture();
+
+	protected:
+		auto customGather() -> void override {} // no gather
+		auto customDiscard() -> void override {}
+
+		auto customProcess() -> void override;
+		auto customUnload() -> void override;
+
+	private:
+		u32 width;
+		u32 height;
+		size frameSize;
+
+		u32 numSlots;
+		u32 nextSlot;
+
+		GLuint texture;
+		GLuint buffer;
+		u8* mapped;
+
+		/* one fence per slot, set when the gpu is given the slot to read */
+		std::unique_ptr<GLsync[]> fences;
+
+		i32 horzWrap, vertWrap, minFilter, magFilter;
+	};
+}
+
+#endif
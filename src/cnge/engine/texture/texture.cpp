@@ -3,6 +3,7 @@
 #include "GL/gl.h"
 
 #include "texture.h"
+#include "cnge/engine/glState.h"
 
 namespace CNGE {
 	float Texture::tileValues[4]{ 1, 1, 0, 0 };
@@ -24,7 +25,7 @@ namespace CNGE {
 		height = assetImage->getHeight();
 	}
 
-	void Texture::customProcess() {
+	auto Texture::createTexture() -> void {
 		glCreateTextures(GL_TEXTURE_2D, 1, &texture);
 
 		bind();
@@ -33,6 +34,10 @@ namespace CNGE {
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, vertWrap);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
+	}
+
+	void Texture::customProcess() {
+		createTexture();
 
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, assetImage->getPixels());
 	}
@@ -42,18 +47,17 @@ namespace CNGE {
 	}
 
 	void Texture::customUnload() {
-		glDeleteTextures(1, &texture);
+		GLState::deleteTextures(1, &texture);
 	}
 
 	/* use */
 
 	void Texture::bind() {
-		glBindTexture(GL_TEXTURE_2D, texture);
+		GLState::bindTexture(texture);
 	}
 
 	void Texture::bind(i32 slot) {
-		glActiveTexture(slot);
-		glBindTexture(GL_TEXTURE_2D, texture);
+		GLState::bindTexture(slot - GL_TEXTURE0, texture);
 	}
 
 	int Texture::get() {
@@ -64,6 +68,22 @@ namespace CNGE {
 		return assetImage.get();
 	}
 
+	auto Texture::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto Texture::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto Texture::update() -> bool {
+		return false;
+	}
+
+	auto Texture::getError() -> std::string {
+		return {};
+	}
+
 	Texture::~Texture() {
 		unload();
 	}
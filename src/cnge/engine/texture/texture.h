@@ -2,6 +2,8 @@
 #ifndef CNGE_TEXTURE
 #define CNGE_TEXTURE
 
+#include <string>
+
 #include "types.h"
 #include "cnge/image/image.h"
 #include "cnge/load/resource.h"
@@ -21,7 +23,17 @@ namespace CNGE {
 
 		[[nodiscard]] auto getImage() const -> Image1D*;
 
-		~Texture();
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+
+		/// for textures that keep refining after they are processed
+		/// uploads anything new, returns whether the texture changed
+		virtual auto update() -> bool;
+
+		/// why a texture that keeps refining stopped early, empty if it hasn't
+		virtual auto getError() -> std::string;
+
+		virtual ~Texture();
 
 	protected:
 		static float tileValues[4];
@@ -31,11 +43,16 @@ namespace CNGE {
 		virtual void customDiscard();
 		virtual void customUnload();
 
+		/// creates and binds the gl texture with this texture's params
+		/// subclasses that upload their own pixel formats call this first
+		auto createTexture() -> void;
+
 		u32 width;
 		u32 height;
 
-	private:
 		const char* assetPath;
+
+	private:
 		std::unique_ptr<Image1D> assetImage;
 
 		u32 texture;
@@ -0,0 +1,46 @@
+
+#include "GL/glew.h"
+
+#include "textureLoader.h"
+#include "hdrTexture.h"
+#include "mappedTexture.h"
+#include "compressedTexture.h"
+#include "jxlTexture.h"
+#include "avifTexture.h"
+
+namespace CNGE {
+	template<typename T>
+	static auto makeFactory() -> TextureLoader::Factory {
+		return [](const char* path, TextureParams params) -> std::unique_ptr<Texture> {
+			return std::make_unique<T>(path, params);
+		};
+	}
+
+	auto TextureLoader::getFactories() -> std::unordered_map<std::string, Factory>& {
+		static auto factories = std::unordered_map<std::string, Factory> {
+			{ "hdr", makeFactory<HdrTexture>() },
+			{ "raw", makeFactory<MappedTexture>() },
+			{ "jxl", makeFactory<JxlTexture>() },
+			{ "avif", makeFactory<AvifTexture>() },
+			/* the file's own mips are worth seeing */
+			{ "compressed", [](const char* path, TextureParams params) -> std::unique_ptr<Texture> {
+				return std::make_unique<CompressedTexture>(path, params.setMinFilter(GL_LINEAR_MIPMAP_LINEAR));
+			} },
+		};
+
+		return factories;
+	}
+
+	auto TextureLoader::add(const std::string& decoderName, Factory&& factory) -> void {
+		getFactories()[decoderName] = std::move(factory);
+	}
+
+	auto TextureLoader::create(const Decoder& decoder, const char* path, TextureParams params) -> std::unique_ptr<Texture> {
+		const auto& factories = getFactories();
+
+		if (const auto found = factories.find(decoder.name); found != factories.end())
+			return found->second(path, params);
+
+		return std::make_unique<Texture>(path, params);
+	}
+}
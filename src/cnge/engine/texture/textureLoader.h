@@ -0,0 +1,32 @@
+
+#ifndef CNGE_TEXTURE_LOADER
+#define CNGE_TEXTURE_LOADER
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "texture.h"
+#include "cnge/image/decoderRegistry.h"
+
+namespace CNGE {
+	/// makes the right kind of texture for a decoder
+	/// formats without a texture of their own go through the plain rgba8 texture
+	class TextureLoader {
+	public:
+		using Factory = std::function<std::unique_ptr<Texture>(const char*, TextureParams)>;
+
+	private:
+		static auto getFactories() -> std::unordered_map<std::string, Factory>&;
+
+	public:
+		/// uses this texture for every file the named decoder recognizes
+		static auto add(const std::string& decoderName, Factory&&) -> void;
+
+		/// the texture is made but not gathered
+		static auto create(const Decoder&, const char*, TextureParams = TextureParams()) -> std::unique_ptr<Texture>;
+	};
+}
+
+#endif
@@ -31,6 +31,8 @@ namespace CNGE {
 		auto setMagFilter(i32)->TextureParams;
 
 		friend class Texture;
+		friend class StreamTexture;
+		friend class TiledTexture;
 	};
 }
 
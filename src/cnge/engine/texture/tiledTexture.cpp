@@ -0,0 +1,183 @@
+
+#include <algorithm>
+
+#include "tiledTexture.h"
+#include "cnge/engine/glState.h"
+
+namespace CNGE {
+	TiledTexture::TiledTexture(std::unique_ptr<TileSource>&& source, size budget, u32 numWorkers, TextureParams params) :
+		source(std::move(source)),
+		maxTiles(),
+		horzWrap(params.horzWrap), vertWrap(params.vertWrap),
+		minFilter(params.minFilter), magFilter(params.magFilter),
+		tiles(),
+		freeTextures(),
+		inFlight(),
+		failed(),
+		decodedMutex(),
+		decoded(),
+		frame(0),
+		visibleLeft(0), visibleTop(0), visibleRight(0), visibleBottom(0),
+		workers(numWorkers)
+	{
+		const auto tileBytes = size(this->source->getTileWidth()) * this->source->getTileHeight() * 4;
+
+		maxTiles = u32(std::max(budget / tileBytes, 1_size));
+	}
+
+	auto TiledTexture::makeKey(u32 x, u32 y) -> u64 {
+		return u64(y) << 32 | x;
+	}
+
+	auto TiledTexture::isVisible(u32 x, u32 y) const -> bool {
+		return x >= visibleLeft.load() && x < visibleRight.load() && y >= visibleTop.load() && y < visibleBottom.load();
+	}
+
+	auto TiledTexture::request(u32 left, u32 top, u32 right, u32 bottom) -> void {
+		++frame;
+
+		/* tiles queued from the old view that are still in the new one keep their place */
+		visibleLeft = left;
+		visibleTop = top;
+		visibleRight = right;
+		visibleBottom = bottom;
+
+		for (auto y = top; y < bottom; ++y) {
+			for (auto x = left; x < right; ++x) {
+				const auto key = makeKey(x, y);
+
+				if (auto found = tiles.find(key); found != tiles.end()) {
+					found->second.lastSeen = frame;
+					continue;
+				}
+
+				if (inFlight.count(key) != 0 || failed.count(key) != 0)
+					continue;
+
+				inFlight.insert(key);
+
+				workers.push([this, key, x, y] {
+					auto result = Decoded { key, nullptr, false };
+
+					if (isVisible(x, y)) {
+						const auto tileBytes = size(source->getTileWidth()) * source->getTileHeight() * 4;
+
+						/* zeroed so the padding of edge tiles is clear */
+						auto pixels = std::make_unique<u8[]>(tileBytes);
+
+						try {
+							source->decodeTile(x, y, pixels.get());
+							result.pixels = std::move(pixels);
+
+						} catch (std::exception&) {
+							result.failed = true;
+						}
+					}
+
+					auto lock = std::lock_guard(decodedMutex);
+					decoded.push_back(std::move(result));
+				});
+			}
+		}
+	}
+
+	auto TiledTexture::createTexture() -> GLuint {
+		if (!freeTextures.empty()) {
+			const auto texture = freeTextures.back();
+			freeTextures.pop_back();
+			return texture;
+		}
+
+		auto texture = GLuint();
+		glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+
+		glTextureParameteri(texture, GL_TEXTURE_WRAP_S, horzWrap);
+		glTextureParameteri(texture, GL_TEXTURE_WRAP_T, vertWrap);
+		glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, minFilter);
+		glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, magFilter);
+
+		glTextureStorage2D(texture, 1, GL_RGBA8, source->getTileWidth(), source->getTileHeight());
+
+		return texture;
+	}
+
+	auto TiledTexture::update() -> bool {
+		auto finished = std::vector<Decoded>();
+
+		{
+			auto lock = std::lock_guard(decodedMutex);
+			finished.swap(decoded);
+		}
+
+		auto arrived = false;
+
+		for (auto& [key, pixels, tileFailed] : finished) {
+			inFlight.erase(key);
+
+			/* a tile that failed to decode would only fail again */
+			if (tileFailed)
+				failed.insert(key);
+
+			/* cancelled ones have no pixels and can be asked for again */
+			if (pixels == nullptr)
+				continue;
+
+			const auto texture = createTexture();
+			glTextureSubImage2D(texture, 0, 0, 0, source->getTileWidth(), source->getTileHeight(), GL_RGBA, GL_UNSIGNED_BYTE, pixels.get());
+
+			tiles.insert_or_assign(key, Tile { texture, frame });
+			arrived = true;
+		}
+
+		evict();
+
+		return arrived;
+	}
+
+	auto TiledTexture::evict() -> void {
+		if (tiles.size() <= maxTiles)
+			return;
+
+		/* oldest first, but never what is on screen right now */
+		auto candidates = std::vector<std::pair<u64, u64>>();
+
+		for (const auto& [key, tile] : tiles)
+			if (tile.lastSeen != frame)
+				candidates.emplace_back(tile.lastSeen, key);
+
+		std::sort(candidates.begin(), candidates.end());
+
+		for (const auto& [lastSeen, key] : candidates) {
+			if (tiles.size() <= maxTiles)
+				break;
+
+			freeTextures.push_back(tiles[key].texture);
+			tiles.erase(key);
+		}
+	}
+
+	auto TiledTexture::bindTile(u32 x, u32 y) -> bool {
+		const auto found = tiles.find(makeKey(x, y));
+
+		if (found == tiles.end())
+			return false;
+
+		GLState::bindTexture(found->second.texture);
+
+		return true;
+	}
+
+	auto TiledTexture::getSource() const -> TileSource* {
+		return source.get();
+	}
+
+	TiledTexture::~TiledTexture() {
+		workers.clear();
+
+		for (const auto& [key, tile] : tiles)
+			GLState::deleteTextures(1, &tile.texture);
+
+		if (!freeTextures.empty())
+			GLState::deleteTextures(i32(freeTextures.size()), freeTextures.data());
+	}
+}
@@ -0,0 +1,91 @@
+
+#ifndef CNGE_TILED_TEXTURE
+#define CNGE_TILED_TEXTURE
+
+#include <GL/glew.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "types.h"
+#include "cnge/image/tileSource.h"
+#include "cnge/load/threadPool.h"
+#include "textureParams.h"
+
+namespace CNGE {
+	/// shows a tile source one texture per tile
+	/// only the tiles that were asked for get decoded, on worker threads,
+	/// and the least recently seen tiles are dropped once the cache is full
+	class TiledTexture {
+	private:
+		struct Tile {
+			GLuint texture;
+			u64 lastSeen;
+		};
+
+		struct Decoded {
+			u64 key;
+			std::unique_ptr<u8[]> pixels;
+			bool failed;
+		};
+
+		std::unique_ptr<TileSource> source;
+
+		u32 maxTiles;
+		i32 horzWrap, vertWrap, minFilter, magFilter;
+
+		std::unordered_map<u64, Tile> tiles;
+		std::vector<GLuint> freeTextures;
+
+		std::unordered_set<u64> inFlight;
+		std::unordered_set<u64> failed;
+
+		/* filled by the workers, emptied by update */
+		std::mutex decodedMutex;
+		std::vector<Decoded> decoded;
+
+		u64 frame;
+
+		/* the tiles in view, queued decodes that have scrolled out of it give up */
+		std::atomic<u32> visibleLeft, visibleTop, visibleRight, visibleBottom;
+
+		/* declared last so it joins before everything the jobs touch goes away */
+		ThreadPool workers;
+
+		static auto makeKey(u32, u32) -> u64;
+
+		/// whether a tile is still in the last requested range
+		auto isVisible(u32, u32) const -> bool;
+
+		auto createTexture() -> GLuint;
+		auto evict() -> void;
+
+	public:
+		/// the budget is how many bytes of tiles to keep on the gpu
+		TiledTexture(std::unique_ptr<TileSource>&&, size budget = 256_size << 20, u32 numWorkers = 0, TextureParams = TextureParams());
+
+		/* no copying the texture */
+		TiledTexture(const TiledTexture&) = delete;
+		auto operator=(const TiledTexture&) -> void = delete;
+
+		/// the range of tiles in view, right and bottom are exclusive
+		/// decodes anything in it that isn't loaded yet
+		auto request(u32 left, u32 top, u32 right, u32 bottom) -> void;
+
+		/// uploads finished tiles, returns whether any arrived
+		auto update() -> bool;
+
+		/// binds a tile if it is loaded
+		auto bindTile(u32, u32) -> bool;
+
+		[[nodiscard]] auto getSource() const -> TileSource*;
+
+		~TiledTexture();
+	};
+}
+
+#endif
@@ -1,31 +1,59 @@
-
 #include <iostream>
 
 #include "transform.h"
 
 namespace CNGE {
-	Matrix4f Transform::matrix{};
-
-	float Transform::defaultModel[16] {
-		1, 0, 0, 0,
-		0, 1, 0, 0,
-		0, 0, 1, 0,
-		0, 0, 0, 1
-	};
-
-	float Transform::defaultProjview[16] {
-		2, 0, 0, 0,
-		0, 2, 0, 0,
-		0, 0, 1, 0,
-		-1, -1, 0, 1
-	};
+	static_assert(Transform::defaultProjview.m[0] == 2 && Transform::defaultProjview.m[5] == 2 && Transform::defaultProjview.m[12] == -1 && Transform::defaultProjview.m[13] == -1, "the default projection maps 0..1 onto clip space");
 
 	/// default initialization
-	Transform::Transform() : translation(0.f, 0.f), scale(1.f, 1.f), rotation(0) {}
+	Transform::Transform() :
+		translation(0.f, 0.f), scale(1.f, 1.f), rotation(0),
+		version(1),
+		model(), modelVersion(0), modelZ(0),
+		affineModel(), affineModelVersion(0) {}
+
+	void Transform::setTranslation(f32 x, f32 y) {
+		translation = Vector2f(x, y);
+		++version;
+	}
+
+	void Transform::setTranslation(const Vector2f& translation) {
+		setTranslation(translation.x(), translation.y());
+	}
+
+	void Transform::setScale(f32 x, f32 y) {
+		scale = Vector2f(x, y);
+		++version;
+	}
+
+	void Transform::setScale(const Vector2f& scale) {
+		setScale(scale.x(), scale.y());
+	}
+
+	void Transform::setRotation(f32 rotation) {
+		this->rotation = rotation;
+		++version;
+	}
+
+	const Vector2f& Transform::getTranslation() const {
+		return translation;
+	}
+
+	const Vector2f& Transform::getScale() const {
+		return scale;
+	}
+
+	f32 Transform::getRotation() const {
+		return rotation;
+	}
+
+	u64 Transform::getVersion() const {
+		return version;
+	}
 
 	/// modifes a mat4 based on values passed in
 	void Transform::transform(Matrix4f& mat, f32 x, f32 y, f32 rotation, f32 width, f32 height) {
-		mat.setTranslate2D(x, y).rotate2D(rotation).scale2D(width, height);
+		mat.setTransform2D(x, y, rotation, width, height);
 	}
 
 	void Transform::transform(Matrix4f& mat, f32 x, f32 y, f32 z, f32 rotation, f32 width, f32 height) {
@@ -33,39 +61,62 @@ namespace CNGE {
 	}
 
 	/// returns the float values for a model matrix based on this transform
-	float* Transform::toModel() {
-		transform(matrix);
-
-		return matrix.m;
+	const f32* Transform::toModel() {
+		return toZModel(0);
 	}
 
-	float* Transform::toZModel(f32 z) {
-		transform(matrix, translation.x(), translation.y(), z, rotation, scale.x(), scale.y());
+	const f32* Transform::toZModel(f32 z) {
+		if (modelVersion != version || modelZ != z) {
+			transform(model, translation.x(), translation.y(), z, rotation, scale.x(), scale.y());
+			modelVersion = version;
+			modelZ = z;
+		}
 
-		return matrix.m;
+		return model.m;
 	}
 
-	/// returns the float values for a model matrix based on given params
+	/// returns a model matrix based on given params
 	/// no instance of a transform needed
-	float* Transform::toModel(f32 x, f32 y, f32 rotation, f32 width, f32 height) {
+	Matrix4f Transform::toModel(f32 x, f32 y, f32 rotation, f32 width, f32 height) {
+		auto matrix = Matrix4f();
 		transform(matrix, x, y, rotation, width, height);
 
-		return matrix.m;
+		return matrix;
 	}
 
-	float* Transform::toModelRC(f32 x, f32 y, f32 rotation, f32 width, f32 height) {
+	Matrix4f Transform::toModelRC(f32 x, f32 y, f32 rotation, f32 width, f32 height) {
+		auto matrix = Matrix4f();
 		matrix.setTranslate2D(x + width / 2, y + height / 2).rotate2D(rotation).translate2D(-width / 2, -height / 2).scale2D(width, height);
 
-		return matrix.m;
+		return matrix;
+	}
+
+	/// the model as a 2d affine transform for mat3x2 shaders
+	const Affine2f& Transform::toAffine() {
+		if (affineModelVersion != version) {
+			affineModel.setTransform(translation.x(), translation.y(), rotation, scale.x(), scale.y());
+			affineModelVersion = version;
+		}
+
+		return affineModel;
+	}
+
+	Affine2f Transform::toAffine(f32 x, f32 y, f32 rotation, f32 width, f32 height) {
+		return Affine2f::makeTransform(x, y, rotation, width, height);
 	}
 
 	/// modifies a mat4 based on this transform
-	void Transform::transform(Matrix4f& mat) {
+	void Transform::transform(Matrix4f& mat) const {
 		transform(mat, translation.x(), translation.y(), rotation, scale.x(), scale.y());
 	}
 
 	/// modify this matrix for the camera, everything is in reverse order and negative
-	void Transform::cameraTransform(Matrix4f& mat) {
+	void Transform::cameraTransform(Matrix4f& mat) const {
 		mat.setScale2D(scale).rotate2D(-rotation).translate2D(-translation);
 	}
+
+	void Transform::cameraTransform(Affine2f& affine) const {
+		affine = Affine2f::makeScale(scale.x(), scale.y());
+		affine.rotate(-rotation).translate(-translation.x(), -translation.y());
+	}
 }
@@ -2,46 +2,86 @@
 #pragma once
 
 #include "cnge/math/matrix4.h"
+#include "cnge/math/affine2.h"
 #include "cnge/math/vector2.h"
 
 namespace CNGE {
 	class Transform {
 	public:
 		/*
-		 * initializers for the default model and projection value arrays
+		 * the default model and projection, both worked out at compile time
 		 */
-		static float defaultModel[16];
-		static float defaultProjview[16];
+		static constexpr Matrix4f defaultModel = Matrix4f::makeIdentity();
+		static constexpr Matrix4f defaultProjview = Matrix4f::makeOrthographic(0.f, 1.f, 0.f, 1.f, -1.f, 1.f);
 
-		Vector2f translation;
-		Vector2f scale;
-		float rotation;
+		/*
+		 * the same for shaders that take mat3x2
+		 */
+		static constexpr Affine2f defaultAffineModel = Affine2f::makeIdentity();
+		static constexpr Affine2f defaultAffineProjview = Affine2f::makeOrthographic(0.f, 1.f, 0.f, 1.f);
 
 		/// default initialization
 		Transform();
 
+		/*
+		 * every change bumps the version, the cached model matrices
+		 * are only worked out again the next time they are asked for
+		 */
+
+		void setTranslation(f32 x, f32 y);
+		void setTranslation(const Vector2f&);
+		void setScale(f32 x, f32 y);
+		void setScale(const Vector2f&);
+		void setRotation(f32);
+
+		[[nodiscard]] const Vector2f& getTranslation() const;
+		[[nodiscard]] const Vector2f& getScale() const;
+		[[nodiscard]] f32 getRotation() const;
+
+		/// goes up by one for every change, so anything built
+		/// from this transform can tell if it is out of date
+		[[nodiscard]] u64 getVersion() const;
+
 		/// modifes a mat4 based on values passed in
 		static void transform(Matrix4f&, f32 x, f32 y, f32 rotation, f32 width, f32 height);
 		static void transform(Matrix4f&, f32 x, f32 y, f32 z, f32 rotation, f32 width, f32 height);
 
 		/// returns the float values for a model matrix based on this transform
-		float* toModel();
+		const f32* toModel();
 		/// return the float values for a model matrix that also has a depth
-		float* toZModel(f32 z);
+		const f32* toZModel(f32 z);
 
-		/// returns the float values for a model matrix based on given params
+		/// returns a model matrix based on given params
 		/// no instance of a transform needed
-		static float* toModel(f32 x, f32 y, f32 rotation, f32 width, f32 height);
-		static float* toModelRC(f32 x, f32 y, f32 rotation, f32 width, f32 height);
+		static Matrix4f toModel(f32 x, f32 y, f32 rotation, f32 width, f32 height);
+		static Matrix4f toModelRC(f32 x, f32 y, f32 rotation, f32 width, f32 height);
+
+		/// the model as a 2d affine transform for mat3x2 shaders
+		const Affine2f& toAffine();
+
+		/// no instance of a transform needed
+		static Affine2f toAffine(f32 x, f32 y, f32 rotation, f32 width, f32 height);
 
 		/// modifies a mat4 based on this transform's internal values
-		void transform(Matrix4f&);
+		void transform(Matrix4f&) const;
 
 		/// modify this matrix for the camera, everything is in reverse order and negative
-		void cameraTransform(Matrix4f&);
+		void cameraTransform(Matrix4f&) const;
+		void cameraTransform(Affine2f&) const;
 
 	private:
-		/// used for generating values
-		static Matrix4f matrix;
+		Vector2f translation;
+		Vector2f scale;
+		f32 rotation;
+
+		u64 version;
+
+		/* the versions these were made from, 0 for never */
+		Matrix4f model;
+		u64 modelVersion;
+		f32 modelZ;
+
+		Affine2f affineModel;
+		u64 affineModelVersion;
 	};
 }
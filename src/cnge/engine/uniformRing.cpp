@@ -0,0 +1,123 @@
+
+#include "uniformRing.h"
+#include "glState.h"
+
+namespace CNGE {
+	/* one second, in the nanoseconds fences are waited in */
+	constexpr static GLuint64 FENCE_TIMEOUT = 1000000000;
+
+	GLuint UniformRing::buffer = 0;
+	u8* UniformRing::mapped = nullptr;
+
+	u32 UniformRing::alignment = 256;
+
+	u32 UniformRing::segment = 0;
+	u32 UniformRing::head = 0;
+
+	GLsync UniformRing::fences[NUM_SEGMENTS] {};
+
+	auto UniformRing::create() -> void {
+		auto offsetAlignment = GLint();
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+
+		if (offsetAlignment > 0)
+			alignment = u32(offsetAlignment);
+
+		/* the mapping stays valid for the life of the buffer */
+		constexpr auto flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		glCreateBuffers(1, &buffer);
+		glNamedBufferStorage(buffer, SEGMENT_SIZE * NUM_SEGMENTS, nullptr, flags);
+
+		mapped = static_cast<u8*>(glMapNamedBufferRange(buffer, 0, SEGMENT_SIZE * NUM_SEGMENTS, flags));
+
+		if (mapped == nullptr) {
+			GLState::deleteBuffers(1, &buffer);
+			buffer = 0;
+
+			throw "could not map the uniform ring";
+		}
+
+		segment = 0;
+		head = 0;
+	}
+
+	auto UniformRing::advance() -> void {
+		fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		segment = (segment + 1) % NUM_SEGMENTS;
+		head = segment * SEGMENT_SIZE;
+
+		auto& fence = fences[segment];
+
+		/* wait until the gpu is done reading the last frame that used this segment, */
+		/* however long that takes, writing into it any earlier would change draws in flight */
+		if (fence != nullptr) {
+			while (true) {
+				const auto result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+
+				if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+					break;
+
+				/* the fence can't be waited on, so wait on everything */
+				if (result == GL_WAIT_FAILED) {
+					glFinish();
+					break;
+				}
+			}
+
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+
+	auto UniformRing::allocate(u32 bytes, u32& offset) -> u8* {
+		if (bytes > SEGMENT_SIZE)
+			throw "uniform block is larger than a ring segment";
+
+		if (mapped == nullptr)
+			create();
+
+		auto start = (head + alignment - 1) / alignment * alignment;
+
+		if (start + bytes > (segment + 1) * SEGMENT_SIZE) {
+			advance();
+			start = head;
+		}
+
+		head = start + bytes;
+		offset = start;
+
+		return mapped + start;
+	}
+
+	auto UniformRing::bind(u32 binding, u32 offset, u32 bytes) -> void {
+		GLState::bindUniformBufferRange(binding, buffer, offset, bytes);
+	}
+
+	auto UniformRing::endFrame() -> void {
+		/* nothing was drawn with blocks this frame */
+		if (mapped == nullptr || head == segment * SEGMENT_SIZE)
+			return;
+
+		advance();
+	}
+
+	auto UniformRing::release() -> void {
+		if (mapped == nullptr)
+			return;
+
+		for (auto& fence : fences) {
+			if (fence != nullptr) {
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+
+		glUnmapNamedBuffer(buffer);
+		mapped = nullptr;
+
+		GLState::deleteBuffers(1, &buffer);
+		buffer = 0;
+	}
+}
@@ -0,0 +1,55 @@
+#ifndef CNGE_UNIFORM_RING
+#define CNGE_UNIFORM_RING
+
+#include <GL/glew.h>
+
+#include "types.h"
+
+namespace CNGE {
+	/// one persistently mapped uniform buffer that per draw uniform blocks are carved out of,
+	/// split into segments that the gpu reads from while the cpu fills the next,
+	/// a segment is fenced when it is handed over and waited on before it is written again
+	class UniformRing {
+	public:
+		/// three so the cpu can be a frame ahead of a gpu still finishing the one before
+		constexpr static u32 NUM_SEGMENTS = 3;
+
+		/// room for a thousand draws a segment at the usual 256 byte alignment
+		constexpr static u32 SEGMENT_SIZE = 256 * 1024;
+
+		/// space for one block in the current segment, moving on to the next segment if it is full,
+		/// the memory is written directly and offset is where it starts in the buffer
+		static auto allocate(u32 bytes, u32& offset) -> u8*;
+
+		/// points a uniform block binding at an allocation
+		static auto bind(u32 binding, u32 offset, u32 bytes) -> void;
+
+		/// hands what was written this frame to the gpu,
+		/// the next frame starts in a fresh segment
+		static auto endFrame() -> void;
+
+		/// unmaps and deletes the buffer, call while the context is still current
+		static auto release() -> void;
+
+	private:
+		static GLuint buffer;
+		static u8* mapped;
+
+		/* GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT */
+		static u32 alignment;
+
+		static u32 segment;
+		static u32 head;
+
+		/* one fence per segment, set when the gpu is given the segment to read */
+		static GLsync fences[NUM_SEGMENTS];
+
+		/// makes the buffer on the first allocation, the context has to exist by then
+		static auto create() -> void;
+
+		/// fences the current segment and waits until the next one is free
+		static auto advance() -> void;
+	};
+}
+
+#endif
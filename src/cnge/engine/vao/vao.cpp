@@ -1,5 +1,6 @@
 
 #include "vao.h"
+#include "cnge/engine/glState.h"
 
 namespace CNGE {
 	/// constructs a vertex attribute
@@ -40,7 +41,7 @@ namespace CNGE {
 	void VAO::customProcess() {
 		// create this vao
 		glCreateVertexArrays(1, &vao);
-		glBindVertexArray(vao);
+		GLState::bindVertexArray(vao);
 
 		// the first attribute is of course vertices
 		vertexAttrib.genBuffers();
@@ -70,7 +71,7 @@ namespace CNGE {
 		glDeleteBuffers(1, &ibo);
 
 		// delete the whole thing
-		glDeleteVertexArrays(1, &vao);
+		GLState::deleteVertexArrays(1, &vao);
 	}
 	
 	VAO::~VAO() {
@@ -86,12 +87,12 @@ namespace CNGE {
 
 	/// actually draws this vao
 	void VAO::render() {
-		glBindVertexArray(vao);
+		GLState::bindVertexArray(vao);
 		glDrawElements(drawMode, indexCount, GL_UNSIGNED_INT, 0);
 	}
 
 	void VAO::render(i32) {
-		glBindVertexArray(vao);
+		GLState::bindVertexArray(vao);
 		glDrawElements(drawMode, indexCount, GL_UNSIGNED_INT, 0);
 	}
 
@@ -0,0 +1,181 @@
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+#include "archiveBook.h"
+
+namespace CNGE {
+	/// extensions of the formats the registry can decode from memory
+	static auto isPageName(const std::string& name) -> bool {
+		/* mac zips carry resource forks that look like images */
+		if (name.rfind("__MACOSX/", 0) == 0)
+			return false;
+
+		const auto dot = name.find_last_of('.');
+
+		if (dot == std::string::npos)
+			return false;
+
+		auto extension = name.substr(dot + 1);
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return char(std::tolower(u8(c))); });
+
+		return extension == "png" || extension == "jpg" || extension == "jpeg" || extension == "jpe";
+	}
+
+	/// page2 comes before page10
+	static auto naturalLess(const std::string& left, const std::string& right) -> bool {
+		auto i = 0_size, j = 0_size;
+
+		while (i < left.size() && j < right.size()) {
+			if (std::isdigit(u8(left[i])) && std::isdigit(u8(right[j]))) {
+				/* compare the runs of digits as numbers, skipping leading zeros */
+				while (i < left.size() && left[i] == '0') ++i;
+				while (j < right.size() && right[j] == '0') ++j;
+
+				auto endLeft = i, endRight = j;
+				while (endLeft < left.size() && std::isdigit(u8(left[endLeft]))) ++endLeft;
+				while (endRight < right.size() && std::isdigit(u8(right[endRight]))) ++endRight;
+
+				if (endLeft - i != endRight - j)
+					return endLeft - i < endRight - j;
+
+				const auto compare = left.compare(i, endLeft - i, right, j, endRight - j);
+
+				if (compare != 0)
+					return compare < 0;
+
+				i = endLeft;
+				j = endRight;
+
+			} else {
+				const auto a = std::tolower(u8(left[i])), b = std::tolower(u8(right[j]));
+
+				if (a != b)
+					return a < b;
+
+				++i;
+				++j;
+			}
+		}
+
+		return left.size() - i < right.size() - j;
+	}
+
+	ArchiveBook::ArchiveBook(const char* path, u32 numWorkers) : archive(path), pages(), mutex(), cache(), workers(numWorkers) {
+		const auto& entries = archive.getEntries();
+
+		for (auto i = 0_u32; i < entries.size(); ++i)
+			if (isPageName(entries[i].name))
+				pages.push_back(i);
+
+		if (pages.empty())
+			throw std::runtime_error("No images in archive");
+
+		std::sort(pages.begin(), pages.end(), [&entries](u32 left, u32 right) {
+			return naturalLess(entries[left].name, entries[right].name);
+		});
+	}
+
+	auto ArchiveBook::getNumPages() const -> u32 {
+		return u32(pages.size());
+	}
+
+	auto ArchiveBook::getPageName(u32 page) const -> const std::string& {
+		return archive.getEntries()[pages[page]].name;
+	}
+
+	/* expects the lock to be held */
+	auto ArchiveBook::startPage(u32 page) -> void {
+		if (cache.find(page) != cache.end())
+			return;
+
+		cache.emplace(page, Page { nullptr, std::string(), false });
+
+		workers.push([this, page] {
+			{
+				auto lock = std::lock_guard(mutex);
+
+				auto found = cache.find(page);
+
+				if (found == cache.end())
+					return;
+
+				found->second.running = true;
+			}
+
+			auto image = std::shared_ptr<const DecodedImage>();
+			auto error = std::string();
+
+			try {
+				/* each job inflates into its own buffer, stored pages are read straight from the mapping */
+				auto buffer = std::vector<u8>();
+				const auto& entry = archive.getEntries()[pages[page]];
+				const auto* bytes = archive.read(entry, buffer);
+
+				image = std::make_shared<const DecodedImage>(DecoderRegistry::decode(bytes, entry.size));
+
+			} catch (std::exception& ex) {
+				error = ex.what();
+			}
+
+			auto lock = std::lock_guard(mutex);
+
+			/* the page may have been forgotten while it decoded */
+			auto found = cache.find(page);
+
+			if (found != cache.end()) {
+				found->second.image = std::move(image);
+				found->second.error = std::move(error);
+			}
+		});
+	}
+
+	auto ArchiveBook::request(u32 page) -> void {
+		auto lock = std::lock_guard(mutex);
+
+		/* anything queued for pages we flipped away from is wasted work */
+		workers.clear();
+
+		const auto first = page > KEEP_BEHIND ? page - KEEP_BEHIND : 0;
+		const auto last = std::min(page + PREFETCH_AHEAD, getNumPages() - 1);
+
+		for (auto it = cache.begin(); it != cache.end();) {
+			const auto& [cached, entry] = *it;
+
+			/* out of range pages still decoding are dropped when they finish,
+			 * cleared jobs leave placeholders that would never be filled */
+			if (cached < first || cached > last || (!entry.running && entry.image == nullptr && entry.error.empty()))
+				it = cache.erase(it);
+			else
+				++it;
+		}
+
+		/* the page itself first, then ahead, then behind */
+		startPage(page);
+
+		for (auto i = page + 1; i <= last; ++i)
+			startPage(i);
+
+		for (auto i = first; i < page; ++i)
+			startPage(i);
+	}
+
+	auto ArchiveBook::take(u32 page) -> std::shared_ptr<const DecodedImage> {
+		auto lock = std::lock_guard(mutex);
+
+		auto found = cache.find(page);
+
+		if (found == cache.end())
+			return nullptr;
+
+		if (!found->second.error.empty())
+			throw std::runtime_error(getPageName(page) + ": " + found->second.error);
+
+		return found->second.image;
+	}
+
+	ArchiveBook::~ArchiveBook() {
+		workers.clear();
+	}
+}
@@ -0,0 +1,71 @@
+
+#ifndef CNGE_ARCHIVE_BOOK
+#define CNGE_ARCHIVE_BOOK
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.h"
+#include "zipArchive.h"
+#include "cnge/image/decoderRegistry.h"
+#include "cnge/load/threadPool.h"
+
+namespace CNGE {
+	/// the images in a zip or cbz as pages, in natural order
+	/// a page is only inflated and decoded once it is asked for or is near the one being shown,
+	/// so opening a book costs no more than reading its directory
+	class ArchiveBook {
+	public:
+		/// how many pages past the current one are decoded ahead of time
+		constexpr static u32 PREFETCH_AHEAD = 3;
+		/// how many pages before the current one are kept for flipping back
+		constexpr static u32 KEEP_BEHIND = 1;
+
+	private:
+		struct Page {
+			/// nullptr while decoding
+			std::shared_ptr<const DecodedImage> image;
+			std::string error;
+			/// whether a worker has picked the page up, queued ones can still be cancelled
+			bool running;
+		};
+
+		ZipArchive archive;
+
+		/// indices into the archive's entries
+		std::vector<u32> pages;
+
+		std::mutex mutex;
+		std::unordered_map<u32, Page> cache;
+
+		/* last so no job is still running when the rest goes */
+		ThreadPool workers;
+
+		auto startPage(u32) -> void;
+
+	public:
+		/// 0 workers means one per hardware thread
+		explicit ArchiveBook(const char*, u32 = 0);
+
+		/* no copying the book */
+		ArchiveBook(const ArchiveBook&) = delete;
+		auto operator=(const ArchiveBook&) -> void = delete;
+
+		[[nodiscard]] auto getNumPages() const -> u32;
+		[[nodiscard]] auto getPageName(u32) const -> const std::string&;
+
+		/// starts decoding the page and the ones around it, forgets pages far from it
+		auto request(u32) -> void;
+
+		/// the decoded page, nullptr if it is not done yet
+		/// throws if the page failed to decode
+		auto take(u32) -> std::shared_ptr<const DecodedImage>;
+
+		~ArchiveBook();
+	};
+}
+
+#endif
@@ -0,0 +1,199 @@
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include "zipArchive.h"
+
+namespace CNGE {
+	constexpr static u32
+		SIGNATURE_LOCAL = 0x04034b50,
+		SIGNATURE_CENTRAL = 0x02014b50,
+		SIGNATURE_END = 0x06054b50,
+		SIGNATURE_END_64 = 0x06064b50,
+		SIGNATURE_LOCATOR_64 = 0x07064b50;
+
+	constexpr static size END_SIZE = 22;
+	constexpr static size MAX_COMMENT = 0xffff;
+
+	template<typename T>
+	static auto readLittle(const u8* data) -> T {
+		auto value = T();
+		std::memcpy(&value, data, sizeof(T));
+		return value;
+	}
+
+	ZipArchive::ZipArchive(const char* path) : file(path), entries() {
+		readDirectory();
+	}
+
+	auto ZipArchive::isZip(const std::string& path) -> bool {
+		auto stream = std::ifstream(path, std::ios::binary);
+
+		u8 bytes[4] {};
+		stream.read(reinterpret_cast<char*>(bytes), 4);
+
+		const auto signature = readLittle<u32>(bytes);
+
+		return stream.gcount() == 4 && (signature == SIGNATURE_LOCAL || signature == SIGNATURE_END);
+	}
+
+	auto ZipArchive::readDirectory() -> void {
+		const auto* data = file.getData();
+		const auto length = file.getSize();
+
+		if (length < END_SIZE)
+			throw std::runtime_error("Zip is truncated");
+
+		/* the end record is somewhere in the last 64k, behind the comment */
+		auto end = length - END_SIZE;
+		const auto lowest = length > END_SIZE + MAX_COMMENT ? length - END_SIZE - MAX_COMMENT : 0;
+
+		while (readLittle<u32>(data + end) != SIGNATURE_END) {
+			if (end == lowest)
+				throw std::runtime_error("Zip has no central directory");
+
+			--end;
+		}
+
+		auto numEntries = u64(readLittle<u16>(data + end + 10));
+		auto directorySize = u64(readLittle<u32>(data + end + 12));
+		auto directoryOffset = u64(readLittle<u32>(data + end + 16));
+
+		/* zip64 keeps the real numbers in its own end record */
+		if (end >= 20 && readLittle<u32>(data + end - 20) == SIGNATURE_LOCATOR_64) {
+			const auto end64 = readLittle<u64>(data + end - 20 + 8);
+
+			if (end64 > length || length - end64 < 56 || readLittle<u32>(data + end64) != SIGNATURE_END_64)
+				throw std::runtime_error("Corrupt zip64 end record");
+
+			numEntries = readLittle<u64>(data + end64 + 32);
+			directorySize = readLittle<u64>(data + end64 + 40);
+			directoryOffset = readLittle<u64>(data + end64 + 48);
+		}
+
+		if (directoryOffset > length || directorySize > length - directoryOffset)
+			throw std::runtime_error("Zip central directory is truncated");
+
+		/* the count comes from the file, every entry takes at least 46 bytes */
+		entries.reserve(std::min(numEntries, directorySize / 46));
+
+		auto at = directoryOffset;
+		const auto directoryEnd = directoryOffset + directorySize;
+
+		for (auto i = 0_u64; i < numEntries; ++i) {
+			if (at + 46 > directoryEnd || readLittle<u32>(data + at) != SIGNATURE_CENTRAL)
+				throw std::runtime_error("Corrupt zip central directory");
+
+			const auto flags = readLittle<u16>(data + at + 8);
+			const auto nameLength = readLittle<u16>(data + at + 28);
+			const auto extraLength = readLittle<u16>(data + at + 30);
+			const auto commentLength = readLittle<u16>(data + at + 32);
+
+			if (at + 46 + nameLength + extraLength > directoryEnd)
+				throw std::runtime_error("Corrupt zip central directory");
+
+			auto entry = Entry {
+				std::string(reinterpret_cast<const char*>(data + at + 46), nameLength),
+				readLittle<u16>(data + at + 10),
+				readLittle<u32>(data + at + 20),
+				readLittle<u32>(data + at + 24),
+				readLittle<u32>(data + at + 42),
+			};
+
+			/* zip64 extra field, holding only the values that overflowed, in this order */
+			const auto* extra = data + at + 46 + nameLength;
+			const auto* extraEnd = extra + extraLength;
+
+			while (extra + 4 <= extraEnd) {
+				const auto id = readLittle<u16>(extra);
+				const auto fieldSize = readLittle<u16>(extra + 2);
+				const auto* field = extra + 4;
+
+				if (id == 0x0001) {
+					if (entry.size == 0xffffffff && field + 8 <= extra + 4 + fieldSize) { entry.size = readLittle<u64>(field); field += 8; }
+					if (entry.compressedSize == 0xffffffff && field + 8 <= extra + 4 + fieldSize) { entry.compressedSize = readLittle<u64>(field); field += 8; }
+					if (entry.localOffset == 0xffffffff && field + 8 <= extra + 4 + fieldSize) { entry.localOffset = readLittle<u64>(field); }
+				}
+
+				extra += 4 + fieldSize;
+			}
+
+			/* directories and encrypted members are nothing we can show */
+			if (!entry.name.empty() && entry.name.back() != '/' && !(flags & 1))
+				entries.push_back(std::move(entry));
+
+			at += 46 + nameLength + extraLength + commentLength;
+		}
+	}
+
+	auto ZipArchive::getEntries() const -> const std::vector<Entry>& {
+		return entries;
+	}
+
+	auto ZipArchive::read(const Entry& entry, std::vector<u8>& buffer) const -> const u8* {
+		const auto* data = file.getData();
+		const auto length = file.getSize();
+
+		if (entry.localOffset > length || length - entry.localOffset < 30 || readLittle<u32>(data + entry.localOffset) != SIGNATURE_LOCAL)
+			throw std::runtime_error("Corrupt zip member " + entry.name);
+
+		/* the local header can have a different extra field than the central one */
+		const auto start = entry.localOffset + 30 + readLittle<u16>(data + entry.localOffset + 26) + readLittle<u16>(data + entry.localOffset + 28);
+
+		if (start > length || entry.compressedSize > length - start)
+			throw std::runtime_error("Zip member " + entry.name + " is truncated");
+
+		if (entry.method == METHOD_STORED) {
+			if (entry.size != entry.compressedSize)
+				throw std::runtime_error("Corrupt zip member " + entry.name);
+
+			return data + start;
+		}
+
+		if (entry.method != METHOD_DEFLATED)
+			throw std::runtime_error("Zip member " + entry.name + " uses an unsupported compression");
+
+		buffer.resize(entry.size);
+
+		/* raw deflate, no zlib header */
+		auto stream = z_stream();
+		if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+			throw std::runtime_error("Could not start inflating " + entry.name);
+
+		stream.next_in = const_cast<u8*>(data + start);
+		stream.next_out = buffer.data();
+
+		/* the counts are only 32 bits, so huge members go through in pieces */
+		auto inputLeft = entry.compressedSize;
+		auto outputLeft = entry.size;
+		auto result = Z_OK;
+
+		while (result == Z_OK) {
+			if (stream.avail_in == 0) {
+				stream.avail_in = uInt(std::min<u64>(inputLeft, 1_u64 << 30));
+				inputLeft -= stream.avail_in;
+			}
+
+			if (stream.avail_out == 0) {
+				stream.avail_out = uInt(std::min<u64>(outputLeft, 1_u64 << 30));
+				outputLeft -= stream.avail_out;
+			}
+
+			result = inflate(&stream, Z_NO_FLUSH);
+
+			if (result == Z_BUF_ERROR && stream.avail_in == 0 && inputLeft == 0)
+				break;
+		}
+
+		inflateEnd(&stream);
+
+		if (result != Z_STREAM_END || stream.total_out != entry.size)
+			throw std::runtime_error("Corrupt zip member " + entry.name);
+
+		return buffer.data();
+	}
+}
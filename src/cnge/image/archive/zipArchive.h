@@ -0,0 +1,50 @@
+
+#ifndef CNGE_ZIP_ARCHIVE
+#define CNGE_ZIP_ARCHIVE
+
+#include <string>
+#include <vector>
+
+#include "types.h"
+#include "cnge/load/mappedFile.h"
+
+namespace CNGE {
+	/// a zip (or cbz) read in place from a mapped file
+	/// only the central directory is read up front, members are read when asked for
+	/// reading members is safe from several threads at once
+	class ZipArchive {
+	public:
+		struct Entry {
+			std::string name;
+			u16 method;
+			u64 compressedSize;
+			u64 size;
+			u64 localOffset;
+		};
+
+		constexpr static u16
+			METHOD_STORED = 0,
+			METHOD_DEFLATED = 8;
+
+	private:
+		MappedFile file;
+
+		std::vector<Entry> entries;
+
+		auto readDirectory() -> void;
+
+	public:
+		explicit ZipArchive(const char*);
+
+		/// whether a file starts like a zip
+		static auto isZip(const std::string&) -> bool;
+
+		[[nodiscard]] auto getEntries() const -> const std::vector<Entry>&;
+
+		/// the uncompressed bytes of a member, entry.size of them
+		/// stored members point straight into the mapping, deflated ones are inflated into the buffer
+		auto read(const Entry&, std::vector<u8>& buffer) const -> const u8*;
+	};
+}
+
+#endif
@@ -0,0 +1,125 @@
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <avif/avif.h>
+
+#include "avifImage.h"
+
+namespace CNGE {
+	struct DecoderDeleter {
+		auto operator()(avifDecoder* decoder) const -> void {
+			avifDecoderDestroy(decoder);
+		}
+	};
+
+	AvifImage::AvifImage(const char* path, u32 threads) : width(0), height(0), depth(8), format(Format::RGBA8), pixels() {
+		if (threads == 0)
+			threads = std::max(std::thread::hardware_concurrency(), 1_u32);
+
+		auto decoder = std::unique_ptr<avifDecoder, DecoderDeleter>(avifDecoderCreate());
+
+		if (decoder == nullptr)
+			throw std::runtime_error("Could not create AVIF decoder");
+
+		/* dav1d splits its threads between tiles and frames on its own */
+		decoder->codecChoice = AVIF_CODEC_CHOICE_DAV1D;
+		decoder->maxThreads = i32(threads);
+
+		auto check = [](avifResult result) {
+			if (result != AVIF_RESULT_OK)
+				throw std::runtime_error(std::string("AVIF: ") + avifResultToString(result));
+		};
+
+		check(avifDecoderSetIOFile(decoder.get(), path));
+		check(avifDecoderParse(decoder.get()));
+
+		/* the first image of sequences */
+		check(avifDecoderNextImage(decoder.get()));
+
+		const auto* image = decoder->image;
+
+		width = image->width;
+		height = image->height;
+		depth = image->depth;
+
+		const auto hasAlpha = image->alphaPlane != nullptr;
+
+		/* 10 bit color fits rgb10_a2 exactly, unless the alpha needs more than 2 bits */
+		if (depth == 8)
+			format = Format::RGBA8;
+		else if (depth == 10 && !hasAlpha)
+			format = Format::RGB10_A2;
+		else
+			format = Format::RGBA16;
+
+		auto rgb = avifRGBImage();
+		avifRGBImageSetDefaults(&rgb, image);
+
+		rgb.format = AVIF_RGB_FORMAT_RGBA;
+		rgb.depth = format == Format::RGBA8 ? 8 : format == Format::RGB10_A2 ? 10 : 16;
+		rgb.maxThreads = i32(threads);
+
+		check(avifRGBImageAllocatePixels(&rgb));
+
+		auto result = avifImageYUVToRGB(image, &rgb);
+
+		if (result != AVIF_RESULT_OK) {
+			avifRGBImageFreePixels(&rgb);
+			check(result);
+		}
+
+		const auto pixelBytes = format == Format::RGBA16 ? 8_size : 4_size;
+		const auto rowBytes = size(width) * pixelBytes;
+
+		pixels.resize(rowBytes * height);
+
+		for (auto y = 0_u32; y < height; ++y) {
+			const auto* row = rgb.pixels + size(y) * rgb.rowBytes;
+
+			if (format == Format::RGB10_A2) {
+				/* 10 bit samples come out in u16s, packed down to one u32 per pixel */
+				const auto* samples = reinterpret_cast<const u16*>(row);
+				auto* packed = reinterpret_cast<u32*>(pixels.data() + size(y) * rowBytes);
+
+				for (auto x = 0_u32; x < width; ++x, samples += 4)
+					packed[x] = u32(samples[0]) | u32(samples[1]) << 10 | u32(samples[2]) << 20 | u32(samples[3] >> 8) << 30;
+
+			} else {
+				std::memcpy(pixels.data() + size(y) * rowBytes, row, rowBytes);
+			}
+		}
+
+		avifRGBImageFreePixels(&rgb);
+	}
+
+	auto AvifImage::isAvif(const u8* bytes, size length) -> bool {
+		const auto data = avifROData { bytes, length };
+
+		return avifPeekCompatibleFileType(&data);
+	}
+
+	auto AvifImage::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto AvifImage::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto AvifImage::getDepth() const -> u32 {
+		return depth;
+	}
+
+	auto AvifImage::getFormat() const -> Format {
+		return format;
+	}
+
+	auto AvifImage::getPixels() const -> const u8* {
+		return pixels.data();
+	}
+}
@@ -0,0 +1,48 @@
+
+#ifndef CNGE_AVIF_IMAGE
+#define CNGE_AVIF_IMAGE
+
+#include <vector>
+
+#include "types.h"
+
+namespace CNGE {
+	/// an avif still decoded through libavif's av1 decoder on several threads
+	/// high bit depth images keep their precision instead of being squashed to 8 bits
+	class AvifImage {
+	public:
+		enum class Format {
+			/// 4 bytes a pixel
+			RGBA8,
+			/// one u32 a pixel, red in the low bits, as GL_UNSIGNED_INT_2_10_10_10_REV
+			RGB10_A2,
+			/// 4 u16 a pixel
+			RGBA16,
+		};
+
+	private:
+		u32 width, height;
+		u32 depth;
+		Format format;
+
+		std::vector<u8> pixels;
+
+	public:
+		/// 0 threads means one per hardware thread
+		explicit AvifImage(const char*, u32 threads = 0);
+
+		/// whether these first bytes of a file are something we can decode
+		static auto isAvif(const u8*, size) -> bool;
+
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+		/// bits per channel in the file, 8, 10 or 12
+		[[nodiscard]] auto getDepth() const -> u32;
+		[[nodiscard]] auto getFormat() const -> Format;
+
+		/// rows from the top, tightly packed
+		[[nodiscard]] auto getPixels() const -> const u8*;
+	};
+}
+
+#endif
@@ -0,0 +1,352 @@
+
+#include "GL/glew.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <zlib.h>
+#include <zstd.h>
+
+#include "compressedImage.h"
+#include "cnge/load/threadPool.h"
+
+namespace CNGE {
+	constexpr static u8 KTX2_MAGIC[12] { 0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n' };
+	constexpr static u8 DDS_MAGIC[4] { 'D', 'D', 'S', ' ' };
+
+	/* ktx2 supercompression schemes */
+	constexpr static u32
+		SUPERCOMPRESSION_NONE = 0,
+		SUPERCOMPRESSION_BASIS_LZ = 1,
+		SUPERCOMPRESSION_ZSTD = 2,
+		SUPERCOMPRESSION_ZLIB = 3;
+
+	/// the gl format of a vulkan block compressed format, 0 if we can't upload it
+	static auto vkToGl(u32 vkFormat) -> u32 {
+		/* astc comes in pairs of unorm and srgb from 4x4 to 12x12, in the same order as gl */
+		if (vkFormat >= 157 && vkFormat <= 184) {
+			const auto index = (vkFormat - 157) / 2;
+
+			return (vkFormat - 157) % 2 == 0
+				? GL_COMPRESSED_RGBA_ASTC_4x4_KHR + index
+				: GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR + index;
+		}
+
+		switch (vkFormat) {
+			case 131: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+			case 132: return GL_COMPRESSED_SRGB_S3TC_DXT1_EXT;
+			case 133: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+			case 134: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+			case 135: return GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+			case 136: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT;
+			case 137: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+			case 138: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+			case 139: return GL_COMPRESSED_RED_RGTC1;
+			case 140: return GL_COMPRESSED_SIGNED_RED_RGTC1;
+			case 141: return GL_COMPRESSED_RG_RGTC2;
+			case 142: return GL_COMPRESSED_SIGNED_RG_RGTC2;
+			case 143: return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+			case 144: return GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;
+			case 145: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+			case 146: return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+			case 147: return GL_COMPRESSED_RGB8_ETC2;
+			case 148: return GL_COMPRESSED_SRGB8_ETC2;
+			case 149: return GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2;
+			case 150: return GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2;
+			case 151: return GL_COMPRESSED_RGBA8_ETC2_EAC;
+			case 152: return GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC;
+			case 153: return GL_COMPRESSED_R11_EAC;
+			case 154: return GL_COMPRESSED_SIGNED_R11_EAC;
+			case 155: return GL_COMPRESSED_RG11_EAC;
+			case 156: return GL_COMPRESSED_SIGNED_RG11_EAC;
+			default: return 0;
+		}
+	}
+
+	/// the gl format of a dxgi block compressed format, 0 if we can't upload it
+	static auto dxgiToGl(u32 dxgiFormat) -> u32 {
+		switch (dxgiFormat) {
+			case 70: case 71: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+			case 72: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+			case 73: case 74: return GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+			case 75: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT;
+			case 76: case 77: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+			case 78: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+			case 79: case 80: return GL_COMPRESSED_RED_RGTC1;
+			case 81: return GL_COMPRESSED_SIGNED_RED_RGTC1;
+			case 82: case 83: return GL_COMPRESSED_RG_RGTC2;
+			case 84: return GL_COMPRESSED_SIGNED_RG_RGTC2;
+			case 94: case 95: return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+			case 96: return GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;
+			case 97: case 98: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+			case 99: return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+			default: return 0;
+		}
+	}
+
+	/// bigger than any texture gl takes, keeps the size math below from overflowing
+	constexpr static u32 MAX_DIMENSION = 65536;
+
+	/// how many mips a full chain down to 1x1 has
+	static auto maxLevels(u32 width, u32 height) -> u32 {
+		auto levels = 1_u32;
+
+		for (auto largest = std::max(width, height); largest > 1; largest >>= 1)
+			++levels;
+
+		return levels;
+	}
+
+	/// the most bytes a level of one image can take in any format we upload,
+	/// every one has blocks of at least 4x4 pixels and at most 16 bytes
+	static auto maxLevelBytes(u32 width, u32 height) -> u64 {
+		return u64((width + 3) / 4) * ((height + 3) / 4) * 16;
+	}
+
+	template<typename T>
+	static auto readLittle(const u8* data) -> T {
+		auto value = T();
+		std::memcpy(&value, data, sizeof(T));
+		return value;
+	}
+
+	CompressedImage::CompressedImage(const char* path, u32 workers) :
+		file(std::make_unique<MappedFile>(path)),
+		inflated(),
+		levels(),
+		format(0),
+		workers(workers)
+	{
+		const auto* data = file->getData();
+		const auto length = file->getSize();
+
+		if (length >= sizeof(KTX2_MAGIC) && std::memcmp(data, KTX2_MAGIC, sizeof(KTX2_MAGIC)) == 0)
+			readKtx2();
+		else if (length >= sizeof(DDS_MAGIC) && std::memcmp(data, DDS_MAGIC, sizeof(DDS_MAGIC)) == 0)
+			readDds();
+		else
+			throw std::runtime_error("Image not KTX2 or DDS");
+
+		if (levels.empty())
+			throw std::runtime_error("Compressed image has no levels");
+	}
+
+	auto CompressedImage::isCompressed(const u8* bytes, size length) -> bool {
+		return (length >= sizeof(KTX2_MAGIC) && std::memcmp(bytes, KTX2_MAGIC, sizeof(KTX2_MAGIC)) == 0)
+			|| (length >= sizeof(DDS_MAGIC) && std::memcmp(bytes, DDS_MAGIC, sizeof(DDS_MAGIC)) == 0);
+	}
+
+	auto CompressedImage::readKtx2() -> void {
+		constexpr auto HEADER_SIZE = 80_size;
+		constexpr auto LEVEL_INDEX_SIZE = 24_size;
+
+		const auto* data = file->getData();
+		const auto length = file->getSize();
+
+		if (length < HEADER_SIZE)
+			throw std::runtime_error("KTX2 header is truncated");
+
+		const auto vkFormat = readLittle<u32>(data + 12);
+		const auto width = readLittle<u32>(data + 20);
+		const auto height = readLittle<u32>(data + 24);
+		const auto depth = readLittle<u32>(data + 28);
+		const auto layerCount = std::max(readLittle<u32>(data + 32), 1_u32);
+		const auto faceCount = std::max(readLittle<u32>(data + 36), 1_u32);
+		const auto levelCount = std::max(readLittle<u32>(data + 40), 1_u32);
+		const auto scheme = readLittle<u32>(data + 44);
+
+		if (depth > 1)
+			throw std::runtime_error("3D KTX2 textures are not supported");
+
+		if (width == 0 || width > MAX_DIMENSION || height > MAX_DIMENSION)
+			throw std::runtime_error("KTX2 texture size is out of range");
+
+		/* the chain ends at 1x1, and shifting the size by 32 or more is undefined */
+		if (levelCount > maxLevels(width, std::max(height, 1_u32)))
+			throw std::runtime_error("KTX2 has more levels than its size allows");
+
+		if (scheme == SUPERCOMPRESSION_BASIS_LZ || vkFormat == 0)
+			throw std::runtime_error("Basis Universal KTX2 needs a transcoder, only BCn, ETC2 and ASTC payloads are supported");
+
+		if (scheme != SUPERCOMPRESSION_NONE && scheme != SUPERCOMPRESSION_ZSTD && scheme != SUPERCOMPRESSION_ZLIB)
+			throw std::runtime_error("Unknown KTX2 supercompression");
+
+		format = vkToGl(vkFormat);
+
+		if (format == 0)
+			throw std::runtime_error("KTX2 format is not block compressed");
+
+		if (length < HEADER_SIZE + LEVEL_INDEX_SIZE * levelCount)
+			throw std::runtime_error("KTX2 level index is truncated");
+
+		/* each level holds every layer and face, the first one of each comes first */
+		const auto images = size(layerCount) * faceCount;
+
+		levels.resize(levelCount);
+
+		for (auto i = 0_u32; i < levelCount; ++i) {
+			const auto* entry = data + HEADER_SIZE + LEVEL_INDEX_SIZE * i;
+
+			const auto offset = readLittle<u64>(entry);
+			const auto byteLength = readLittle<u64>(entry + 8);
+			const auto uncompressedLength = readLittle<u64>(entry + 16);
+
+			if (byteLength > length || offset > length - byteLength)
+				throw std::runtime_error("KTX2 level is truncated");
+
+			auto& level = levels[i];
+			level.width = std::max(width >> i, 1_u32);
+			level.height = std::max(height >> i, 1_u32);
+
+			/* the inflated size is only the file's word, it can't be more than the level could hold */
+			if (scheme != SUPERCOMPRESSION_NONE && uncompressedLength / images > maxLevelBytes(level.width, level.height))
+				throw std::runtime_error("KTX2 level is larger than its size allows");
+
+			if (scheme == SUPERCOMPRESSION_ZLIB && (uncompressedLength > std::numeric_limits<uLong>::max() || byteLength > std::numeric_limits<uLong>::max()))
+				throw std::runtime_error("KTX2 level is too big for zlib");
+
+			level.data = data + offset;
+			level.length = size(scheme == SUPERCOMPRESSION_NONE ? byteLength : uncompressedLength) / images;
+		}
+
+		if (scheme == SUPERCOMPRESSION_NONE)
+			return;
+
+		/* supercompressed levels are independent, so they inflate side by side */
+		inflated.resize(levelCount);
+
+		auto failed = std::atomic<bool>(false);
+
+		{
+			auto pool = ThreadPool(std::min(workers == 0 ? std::thread::hardware_concurrency() : workers, levelCount));
+
+			for (auto i = 0_u32; i < levelCount; ++i) {
+				pool.push([this, i, scheme, images, &failed, data] {
+					const auto* entry = data + HEADER_SIZE + LEVEL_INDEX_SIZE * i;
+
+					const auto* source = data + readLittle<u64>(entry);
+					const auto sourceLength = size(readLittle<u64>(entry + 8));
+					const auto fullLength = size(readLittle<u64>(entry + 16));
+
+					auto& out = inflated[i];
+					out.resize(fullLength);
+
+					if (scheme == SUPERCOMPRESSION_ZSTD) {
+						const auto result = ZSTD_decompress(out.data(), out.size(), source, sourceLength);
+
+						if (ZSTD_isError(result) || result != fullLength)
+							failed = true;
+
+					} else {
+						auto outLength = uLongf(fullLength);
+
+						if (uncompress(out.data(), &outLength, source, uLong(sourceLength)) != Z_OK || outLength != fullLength)
+							failed = true;
+					}
+
+					levels[i].data = out.data();
+					levels[i].length = fullLength / images;
+				});
+			}
+
+			/* rethrows if an inflate ran out of memory */
+			pool.wait();
+		}
+
+		if (failed)
+			throw std::runtime_error("Corrupt supercompressed KTX2 level");
+	}
+
+	auto CompressedImage::readDds() -> void {
+		constexpr auto HEADER_SIZE = 128_size;
+		constexpr auto DX10_HEADER_SIZE = 20_size;
+
+		constexpr auto FOURCC = [](const char* code) {
+			return u32(u8(code[0])) | u32(u8(code[1])) << 8 | u32(u8(code[2])) << 16 | u32(u8(code[3])) << 24;
+		};
+
+		const auto* data = file->getData();
+		const auto length = file->getSize();
+
+		if (length < HEADER_SIZE)
+			throw std::runtime_error("DDS header is truncated");
+
+		const auto height = readLittle<u32>(data + 12);
+		const auto width = readLittle<u32>(data + 16);
+		const auto mipCount = std::max(readLittle<u32>(data + 28), 1_u32);
+
+		if (width == 0 || height == 0 || width > MAX_DIMENSION || height > MAX_DIMENSION)
+			throw std::runtime_error("DDS texture size is out of range");
+		const auto fourCC = readLittle<u32>(data + 84);
+
+		auto start = HEADER_SIZE;
+
+		if (fourCC == FOURCC("DX10")) {
+			if (length < HEADER_SIZE + DX10_HEADER_SIZE)
+				throw std::runtime_error("DDS header is truncated");
+
+			format = dxgiToGl(readLittle<u32>(data + HEADER_SIZE));
+
+			/* resource dimension 3 is a 2d texture */
+			if (readLittle<u32>(data + HEADER_SIZE + 4) != 3)
+				throw std::runtime_error("Only 2D DDS textures are supported");
+
+			start += DX10_HEADER_SIZE;
+
+		} else if (fourCC == FOURCC("DXT1")) {
+			format = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+		} else if (fourCC == FOURCC("DXT2") || fourCC == FOURCC("DXT3")) {
+			format = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+		} else if (fourCC == FOURCC("DXT4") || fourCC == FOURCC("DXT5")) {
+			format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+		} else if (fourCC == FOURCC("ATI1") || fourCC == FOURCC("BC4U")) {
+			format = GL_COMPRESSED_RED_RGTC1;
+		} else if (fourCC == FOURCC("BC4S")) {
+			format = GL_COMPRESSED_SIGNED_RED_RGTC1;
+		} else if (fourCC == FOURCC("ATI2") || fourCC == FOURCC("BC5U")) {
+			format = GL_COMPRESSED_RG_RGTC2;
+		} else if (fourCC == FOURCC("BC5S")) {
+			format = GL_COMPRESSED_SIGNED_RG_RGTC2;
+		}
+
+		if (format == 0)
+			throw std::runtime_error("DDS format is not block compressed");
+
+		/* every dds format we take is 4x4 blocks, bc1 and bc4 at 8 bytes a block */
+		const auto blockBytes = (
+			format == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT ||
+			format == GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT ||
+			format == GL_COMPRESSED_RED_RGTC1 ||
+			format == GL_COMPRESSED_SIGNED_RED_RGTC1
+		) ? 8_size : 16_size;
+
+		/* the first surface's mips are stored one after another, */
+		/* any past the 1x1 one are not a real chain and are left off */
+		auto offset = start;
+
+		for (auto i = 0_u32; i < std::min(mipCount, maxLevels(width, height)); ++i) {
+			auto level = Level();
+			level.width = std::max(width >> i, 1_u32);
+			level.height = std::max(height >> i, 1_u32);
+			level.length = size((level.width + 3) / 4) * ((level.height + 3) / 4) * blockBytes;
+			level.data = data + offset;
+
+			if (level.length > length - offset)
+				throw std::runtime_error("DDS level is truncated");
+
+			levels.push_back(level);
+			offset += level.length;
+		}
+	}
+
+	auto CompressedImage::getFormat() const -> u32 {
+		return format;
+	}
+
+	auto CompressedImage::getLevels() const -> const std::vector<Level>& {
+		return levels;
+	}
+}
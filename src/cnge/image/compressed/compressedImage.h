@@ -0,0 +1,54 @@
+
+#ifndef CNGE_COMPRESSED_IMAGE
+#define CNGE_COMPRESSED_IMAGE
+
+#include <memory>
+#include <vector>
+
+#include "types.h"
+#include "cnge/load/mappedFile.h"
+
+namespace CNGE {
+	/// a gpu compressed image (bcn, etc2, eac, astc) with its mip chain, from a ktx2 or dds file
+	/// the blocks are never decoded, only located so they can go to glCompressedTexImage2D
+	/// for arrays and cube maps only the first layer and face is kept
+	class CompressedImage {
+	public:
+		struct Level {
+			u32 width;
+			u32 height;
+			const u8* data;
+			size length;
+		};
+
+	private:
+		std::unique_ptr<MappedFile> file;
+
+		/* supercompressed ktx2 levels are inflated into here, otherwise levels point into the file */
+		std::vector<std::vector<u8>> inflated;
+
+		std::vector<Level> levels;
+
+		/* a gl compressed internal format */
+		u32 format;
+
+		u32 workers;
+
+		auto readKtx2() -> void;
+		auto readDds() -> void;
+
+	public:
+		/// 0 workers for supercompressed levels means one per hardware thread
+		explicit CompressedImage(const char*, u32 workers = 0);
+
+		/// whether these first bytes of a file are something we can read
+		static auto isCompressed(const u8*, size) -> bool;
+
+		[[nodiscard]] auto getFormat() const -> u32;
+
+		/// level 0 is the full size image
+		[[nodiscard]] auto getLevels() const -> const std::vector<Level>&;
+	};
+}
+
+#endif
@@ -0,0 +1,298 @@
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "decoderRegistry.h"
+
+#include "cnge/image/png/pngImage.h"
+#include "cnge/image/png/pngRows.h"
+#include "cnge/image/tileRowSource.h"
+#include "cnge/image/jpeg/jpegImage.h"
+#include "cnge/image/tiff/tiffFile.h"
+#include "cnge/image/hdr/hdrImage.h"
+#include "cnge/image/hdr/half.h"
+#include "cnge/image/raw/rawImage.h"
+#include "cnge/image/compressed/compressedImage.h"
+#include "cnge/image/jxl/jxlImage.h"
+#include "cnge/image/avif/avifImage.h"
+#include "cnge/load/threadPool.h"
+
+namespace CNGE {
+	/*
+	 * rgba8 adapters for the formats that have their own image types
+	 */
+
+	static auto decodePng(const char* path) -> DecodedImage {
+		auto image = PngImage(path);
+
+		return { image.getWidth(), image.getHeight(), image.releasePixels() };
+	}
+
+	static auto decodePngMemory(const u8* data, size length) -> DecodedImage {
+		auto image = PngImage(data, length);
+
+		return { image.getWidth(), image.getHeight(), image.releasePixels() };
+	}
+
+	static auto decodeJpeg(const char* path) -> DecodedImage {
+		auto image = JpegImage(path);
+
+		return { image.getWidth(), image.getHeight(), image.releasePixels() };
+	}
+
+	static auto decodeJpegMemory(const u8* data, size length) -> DecodedImage {
+		auto image = JpegImage(data, length);
+
+		return { image.getWidth(), image.getHeight(), image.releasePixels() };
+	}
+
+	static auto decodeTiff(const char* path) -> DecodedImage {
+		const auto tiff = TiffFile(path);
+
+		const auto width = tiff.getWidth();
+		const auto height = tiff.getHeight();
+		const auto tileWidth = tiff.getTileWidth();
+		const auto tileHeight = tiff.getTileHeight();
+
+		auto decoded = DecodedImage { width, height, std::make_unique<u8[]>(size(width) * height * 4) };
+
+		auto failed = std::atomic<bool>(false);
+
+		{
+			auto pool = ThreadPool();
+
+			for (auto y = 0_u32; y < tiff.getTilesTall(); ++y) {
+				for (auto x = 0_u32; x < tiff.getTilesWide(); ++x) {
+					pool.push([&, x, y] {
+						auto tile = std::unique_ptr<u8[]>();
+
+						/* running out of memory for the tile is a failure like any other */
+						try {
+							tile = std::make_unique<u8[]>(size(tileWidth) * tileHeight * 4);
+							tiff.decodeTile(x, y, tile.get());
+						} catch (std::exception&) {
+							failed = true;
+							return;
+						}
+
+						/* edge tiles hang off the image */
+						const auto copyWidth = std::min(tileWidth, width - x * tileWidth);
+						const auto copyHeight = std::min(tileHeight, height - y * tileHeight);
+
+						for (auto row = 0_u32; row < copyHeight; ++row)
+							std::memcpy(
+								decoded.pixels.get() + ((size(y) * tileHeight + row) * width + size(x) * tileWidth) * 4,
+								tile.get() + size(row) * tileWidth * 4,
+								size(copyWidth) * 4
+							);
+					});
+				}
+			}
+		}
+
+		if (failed)
+			throw std::runtime_error("Corrupt TIFF tile");
+
+		return decoded;
+	}
+
+	static auto decodeHdr(const char* path) -> DecodedImage {
+		const auto image = HdrImage(path);
+
+		const auto count = size(image.getWidth()) * image.getHeight() * 4;
+		auto decoded = DecodedImage { u32(image.getWidth()), u32(image.getHeight()), std::make_unique<u8[]>(count) };
+
+		/* clipped at 1 and encoded as srgb, the same as the clamp tonemap */
+		for (auto i = 0_size; i < count; ++i) {
+			const auto linear = std::clamp(Half::toFloat(image.getPixels()[i]), 0.0f, 1.0f);
+
+			const auto encoded = (i % 4 == 3) ? linear
+				: linear <= 0.0031308f ? linear * 12.92f
+				: 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+
+			decoded.pixels[i] = u8(std::lround(encoded * 255.0f));
+		}
+
+		return decoded;
+	}
+
+	static auto decodeRaw(const char* path) -> DecodedImage {
+		const auto image = RawImage(path);
+
+		const auto width = image.getWidth();
+		const auto height = image.getHeight();
+		const auto channels = image.getChannels();
+		const auto sampleBytes = image.getBytesPerChannel();
+
+		/* the most significant byte of 16 bit samples, which is the first in netpbm */
+		const auto highByte = image.getBigEndian() ? 0 : sampleBytes - 1;
+
+		auto decoded = DecodedImage { width, height, std::make_unique<u8[]>(size(width) * height * 4) };
+
+		for (auto y = 0_u32; y < height; ++y) {
+			const auto* row = image.getPixels() + y * image.getRowBytes();
+			auto* out = decoded.pixels.get() + size(y) * width * 4;
+
+			for (auto x = 0_u32; x < width; ++x, out += 4) {
+				u8 samples[4] { 0, 0, 0, 255 };
+
+				for (auto c = 0_u32; c < channels; ++c)
+					samples[c] = row[(size(x) * channels + c) * sampleBytes + highByte];
+
+				/* gray and gray alpha spread to rgb */
+				if (channels <= 2) {
+					out[0] = out[1] = out[2] = samples[0];
+					out[3] = channels == 2 ? samples[1] : 255;
+				} else {
+					std::memcpy(out, samples, 4);
+				}
+			}
+		}
+
+		return decoded;
+	}
+
+	static auto decodeJxl(const char* path) -> DecodedImage {
+		auto pool = ThreadPool();
+		auto image = JxlImage(path, pool);
+
+		auto decoded = DecodedImage { image.getWidth(), image.getHeight(), std::make_unique<u8[]>(size(image.getWidth()) * image.getHeight() * 4) };
+
+		const auto stop = std::atomic<bool>(false);
+
+		image.decode([&](const u8* pixels, bool final) {
+			if (final)
+				std::memcpy(decoded.pixels.get(), pixels, size(decoded.width) * decoded.height * 4);
+		}, stop);
+
+		return decoded;
+	}
+
+	static auto decodeAvif(const char* path) -> DecodedImage {
+		const auto image = AvifImage(path);
+
+		const auto count = size(image.getWidth()) * image.getHeight();
+		auto decoded = DecodedImage { image.getWidth(), image.getHeight(), std::make_unique<u8[]>(count * 4) };
+
+		switch (image.getFormat()) {
+			case AvifImage::Format::RGBA8: {
+				std::memcpy(decoded.pixels.get(), image.getPixels(), count * 4);
+				break;
+			}
+			case AvifImage::Format::RGB10_A2: {
+				const auto* packed = reinterpret_cast<const u32*>(image.getPixels());
+
+				for (auto i = 0_size; i < count; ++i) {
+					decoded.pixels[i * 4 + 0] = u8((packed[i] >> 2) & 0xff);
+					decoded.pixels[i * 4 + 1] = u8((packed[i] >> 12) & 0xff);
+					decoded.pixels[i * 4 + 2] = u8((packed[i] >> 22) & 0xff);
+					decoded.pixels[i * 4 + 3] = u8((packed[i] >> 30) * 0x55);
+				}
+				break;
+			}
+			case AvifImage::Format::RGBA16: {
+				const auto* samples = reinterpret_cast<const u16*>(image.getPixels());
+
+				for (auto i = 0_size; i < count * 4; ++i)
+					decoded.pixels[i] = u8(samples[i] >> 8);
+				break;
+			}
+		}
+
+		return decoded;
+	}
+
+	/*
+	 * registry
+	 */
+
+	auto DecoderRegistry::getDecoders() -> std::vector<Decoder>& {
+		static auto decoders = std::vector<Decoder> {
+			{ "png", Decoder::STREAMING, PngImage::isPng, decodePng, decodePngMemory, nullptr, [](const char* path) -> std::unique_ptr<RowSource> {
+				return std::make_unique<PngRows>(path);
+			} },
+			{ "jpeg", 0, JpegImage::isJpeg, decodeJpeg, decodeJpegMemory, nullptr, nullptr },
+			{ "tiff", Decoder::REGION | Decoder::THREADED, TiffFile::isTiff, decodeTiff, nullptr, [](const char* path) -> std::unique_ptr<TileSource> {
+				return std::make_unique<TiffFile>(path);
+			}, nullptr },
+			{ "hdr", 0, HdrImage::isHdr, decodeHdr, nullptr, nullptr, nullptr },
+			{ "raw", 0, RawImage::isRaw, decodeRaw, nullptr, nullptr, nullptr },
+			{ "compressed", Decoder::THREADED, CompressedImage::isCompressed, nullptr, nullptr, nullptr, nullptr },
+			{ "jxl", Decoder::STREAMING | Decoder::PROGRESSIVE | Decoder::THREADED, JxlImage::isJxl, decodeJxl, nullptr, nullptr, nullptr },
+			{ "avif", Decoder::THREADED, AvifImage::isAvif, decodeAvif, nullptr, nullptr, nullptr },
+		};
+
+		return decoders;
+	}
+
+	auto DecoderRegistry::add(Decoder&& decoder) -> void {
+		auto& decoders = getDecoders();
+
+		decoders.insert(decoders.begin(), std::move(decoder));
+	}
+
+	auto DecoderRegistry::find(const u8* bytes, size length) -> const Decoder* {
+		for (const auto& decoder : getDecoders())
+			if (decoder.sniff(bytes, length))
+				return &decoder;
+
+		return nullptr;
+	}
+
+	auto DecoderRegistry::find(const char* path) -> const Decoder& {
+		auto file = std::ifstream(path, std::ios::binary);
+
+		if (!file.is_open())
+			throw std::runtime_error("File not found");
+
+		u8 bytes[SNIFF_SIZE] {};
+		file.read(reinterpret_cast<char*>(bytes), SNIFF_SIZE);
+
+		const auto* decoder = find(bytes, size(file.gcount()));
+
+		if (decoder == nullptr)
+			throw std::runtime_error("Unrecognized image format");
+
+		return *decoder;
+	}
+
+	auto DecoderRegistry::decode(const char* path) -> DecodedImage {
+		const auto& decoder = find(path);
+
+		if (!decoder.decode)
+			throw std::runtime_error(decoder.name + " images can only be loaded as textures");
+
+		return decoder.decode(path);
+	}
+
+	auto DecoderRegistry::decode(const u8* data, size length) -> DecodedImage {
+		const auto* decoder = find(data, std::min(length, SNIFF_SIZE));
+
+		if (decoder == nullptr)
+			throw std::runtime_error("Unrecognized image format");
+
+		if (!decoder->decodeMemory)
+			throw std::runtime_error(decoder->name + " images can't be decoded from memory");
+
+		return decoder->decodeMemory(data, length);
+	}
+
+	auto DecoderRegistry::openRows(const char* path) -> std::unique_ptr<RowSource> {
+		const auto& decoder = find(path);
+
+		if (decoder.openRows)
+			return decoder.openRows(path);
+
+		/* tiled formats go a strip of tiles at a time */
+		if (decoder.openTiles)
+			return std::make_unique<TileRowSource>(decoder.openTiles(path));
+
+		auto image = decode(path);
+
+		return std::make_unique<DecodedRowSource>(image.width, image.height, std::move(image.pixels));
+	}
+}
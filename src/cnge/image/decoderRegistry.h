@@ -0,0 +1,89 @@
+
+#ifndef CNGE_DECODER_REGISTRY
+#define CNGE_DECODER_REGISTRY
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.h"
+#include "tileSource.h"
+#include "rowSource.h"
+
+namespace CNGE {
+	/// a whole image as 8 bit rgba, rows from the top
+	struct DecodedImage {
+		u32 width;
+		u32 height;
+		std::unique_ptr<u8[]> pixels;
+	};
+
+	/// one image format, recognized by the first bytes of a file
+	struct Decoder {
+		/* what a decoder can do besides decoding the whole image at once */
+		constexpr static u32
+			/// can start before the whole file is read
+			STREAMING = 1 << 0,
+			/// can decode part of the image without the rest
+			REGION = 1 << 1,
+			/// gives coarse versions of the image before the final one
+			PROGRESSIVE = 1 << 3,
+			/// spreads one image's decode across threads
+			THREADED = 1 << 4;
+
+		std::string name;
+		u32 capabilities;
+
+		/// given the first bytes of a file, at most DecoderRegistry::SNIFF_SIZE
+		std::function<bool(const u8*, size)> sniff;
+
+		/// the whole image as rgba8, empty for formats that only load straight to the gpu
+		std::function<DecodedImage(const char*)> decode;
+
+		/// the same from a file already in memory, like an archive member, empty if unsupported
+		std::function<DecodedImage(const u8*, size)> decodeMemory;
+
+		/// set for REGION decoders
+		std::function<std::unique_ptr<TileSource>(const char*)> openTiles;
+
+		/// reads the image from the top without holding it whole, empty if the format can't
+		std::function<std::unique_ptr<RowSource>(const char*)> openRows;
+
+		[[nodiscard]] auto has(u32 capability) const -> bool {
+			return (capabilities & capability) == capability;
+		}
+	};
+
+	/// picks a decoder for a file by its signature, no trial decodes
+	/// the built in formats are there from the start, add others before loading anything
+	class DecoderRegistry {
+	private:
+		static auto getDecoders() -> std::vector<Decoder>&;
+
+	public:
+		/// how many bytes from the start of a file are given to sniff
+		constexpr static size SNIFF_SIZE = 64;
+
+		/// added decoders are asked before the built in ones
+		static auto add(Decoder&&) -> void;
+
+		/// nullptr if nothing recognizes the bytes
+		static auto find(const u8*, size) -> const Decoder*;
+
+		/// reads the start of the file, throws if it can't be opened or nothing recognizes it
+		static auto find(const char* path) -> const Decoder&;
+
+		/// finds the decoder and decodes the whole file as rgba8
+		static auto decode(const char* path) -> DecodedImage;
+
+		/// finds the decoder and decodes a whole file in memory as rgba8
+		static auto decode(const u8*, size) -> DecodedImage;
+
+		/// the file as rows from the top, through the decoder's row reader or its tiles
+		/// formats with neither are decoded whole and handed out from memory
+		static auto openRows(const char* path) -> std::unique_ptr<RowSource>;
+	};
+}
+
+#endif
@@ -0,0 +1,88 @@
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "streamExport.h"
+#include "cnge/image/decoderRegistry.h"
+#include "cnge/image/png/pngWriter.h"
+
+namespace CNGE {
+	auto StreamExport::run(RowSource& source, std::ostream& stream, const Options& options) -> void {
+		const auto cropWidth = options.cropWidth == 0 ? source.getWidth() - std::min(options.cropLeft, source.getWidth()) : options.cropWidth;
+		const auto cropHeight = options.cropHeight == 0 ? source.getHeight() - std::min(options.cropTop, source.getHeight()) : options.cropHeight;
+
+		/* subtracted rather than added so huge crops can't wrap around and pass */
+		if (options.cropLeft > source.getWidth() || options.cropTop > source.getHeight()
+			|| cropWidth == 0 || cropHeight == 0
+			|| cropWidth > source.getWidth() - options.cropLeft || cropHeight > source.getHeight() - options.cropTop)
+			throw std::runtime_error("Crop is outside the image");
+
+		auto width = options.width, height = options.height;
+
+		if (width == 0 && height == 0) {
+			width = cropWidth;
+			height = cropHeight;
+
+		} else if (width == 0) {
+			width = std::max(u32(f64(cropWidth) * height / cropHeight + 0.5), 1_u32);
+
+		} else if (height == 0) {
+			height = std::max(u32(f64(cropHeight) * width / cropWidth + 0.5), 1_u32);
+		}
+
+		const auto resampler = Resampler(cropWidth, cropHeight, width, height, options.filter, options.linear);
+		auto writer = PngWriter(stream, width, height, 4, options.level, options.threads);
+
+		const auto sourceRowBytes = size(cropWidth) * 4;
+
+		/* the crop rows the filter is currently over, windowFirst to windowEnd */
+		auto window = std::vector<u8>();
+		auto windowFirst = 0_u32, windowEnd = 0_u32;
+
+		auto band = std::vector<u8>(size(BAND_ROWS) * width * 4);
+
+		source.skipRows(options.cropTop);
+
+		for (auto top = 0_u32; top < height; top += BAND_ROWS) {
+			const auto bottom = std::min(top + BAND_ROWS, height);
+
+			auto first = 0_u32, end = 0_u32;
+			resampler.getSourceRows(top, bottom, first, end);
+
+			/* drop the rows the filter has passed, skipping any it never touches */
+			if (first >= windowEnd) {
+				source.skipRows(first - windowEnd);
+				windowFirst = windowEnd = first;
+
+			} else if (first > windowFirst) {
+				std::memmove(window.data(), window.data() + (first - windowFirst) * sourceRowBytes, (windowEnd - first) * sourceRowBytes);
+				windowFirst = first;
+			}
+
+			if (window.size() < (end - windowFirst) * sourceRowBytes)
+				window.resize((end - windowFirst) * sourceRowBytes);
+
+			source.readRows(end - windowEnd, options.cropLeft, cropWidth, window.data() + (windowEnd - windowFirst) * sourceRowBytes);
+			windowEnd = end;
+
+			resampler.runRows(window.data(), windowFirst, band.data(), top, bottom);
+
+			writer.writeRows(band.data(), bottom - top, size(width) * 4);
+		}
+	}
+
+	auto StreamExport::run(const char* input, const char* output, const Options& options) -> void {
+		auto source = DecoderRegistry::openRows(input);
+
+		auto file = std::ofstream(output, std::ios::binary);
+
+		if (!file)
+			throw std::runtime_error(std::string("Couldn't open ") + output + " for writing");
+
+		run(*source, file, options);
+	}
+}
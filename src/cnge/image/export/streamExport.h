@@ -0,0 +1,44 @@
+
+#ifndef CNGE_STREAM_EXPORT
+#define CNGE_STREAM_EXPORT
+
+#include <ostream>
+
+#include "types.h"
+#include "cnge/image/rowSource.h"
+#include "cnge/image/resample/resampler.h"
+
+namespace CNGE {
+	/// crops, scales and writes an image to png one band of rows at a time
+	/// source rows are read only as the filter reaches them and dropped once it has passed,
+	/// and each band goes to the encoder as soon as it is made,
+	/// so memory follows the band height and the image width, never the whole image
+	class StreamExport {
+	public:
+		/// output rows made and encoded together
+		constexpr static u32 BAND_ROWS = 64;
+
+		struct Options {
+			/* the part of the source to keep, a size of 0 keeps the rest of the image */
+			u32 cropLeft = 0, cropTop = 0;
+			u32 cropWidth = 0, cropHeight = 0;
+
+			/* the output size, 0 for both keeps the crop size, 0 for one keeps the aspect */
+			u32 width = 0, height = 0;
+
+			Resampler::Filter filter = Resampler::Filter::LANCZOS3;
+			bool linear = false;
+
+			i32 level = 6;
+			/// deflate workers, 0 means one per hardware thread
+			u32 threads = 0;
+		};
+
+		static auto run(RowSource&, std::ostream&, const Options&) -> void;
+
+		/// opens the input through the decoder registry
+		static auto run(const char* input, const char* output, const Options&) -> void;
+	};
+}
+
+#endif
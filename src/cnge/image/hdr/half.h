@@ -0,0 +1,94 @@
+
+#ifndef CNGE_HALF
+#define CNGE_HALF
+
+#include <cstring>
+
+#include "types.h"
+
+namespace CNGE::Half {
+	/// round to nearest even, overflow goes to infinity, nan stays nan
+	inline auto fromFloat(f32 value) -> u16 {
+		auto bits = 0_u32;
+		std::memcpy(&bits, &value, sizeof(bits));
+
+		const auto sign = u16((bits >> 16) & 0x8000);
+		const auto exponent = i32((bits >> 23) & 0xff);
+		auto mantissa = bits & 0x7fffff;
+
+		/* inf and nan */
+		if (exponent == 0xff)
+			return sign | 0x7c00 | (mantissa != 0 ? 0x200 : 0);
+
+		const auto halfExponent = exponent - 127 + 15;
+
+		if (halfExponent >= 0x1f)
+			return sign | 0x7c00;
+
+		/* too small even for a denormal */
+		if (halfExponent <= -10)
+			return sign;
+
+		/* denormals get the hidden bit shifted in */
+		if (halfExponent <= 0) {
+			mantissa |= 0x800000;
+
+			const auto shift = u32(14 - halfExponent);
+			auto half = mantissa >> shift;
+
+			const auto rest = mantissa & ((1 << shift) - 1);
+			const auto halfway = 1_u32 << (shift - 1);
+
+			if (rest > halfway || (rest == halfway && (half & 1)))
+				++half;
+
+			return sign | u16(half);
+		}
+
+		auto half = u32(halfExponent << 10) | (mantissa >> 13);
+
+		/* rounding may carry into the exponent, which is still right */
+		const auto rest = mantissa & 0x1fff;
+
+		if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+			++half;
+
+		return sign | u16(half);
+	}
+
+	inline auto toFloat(u16 half) -> f32 {
+		const auto sign = u32(half & 0x8000) << 16;
+		const auto exponent = u32(half >> 10) & 0x1f;
+		auto mantissa = u32(half & 0x3ff);
+
+		auto bits = 0_u32;
+
+		if (exponent == 0x1f) {
+			bits = sign | 0x7f800000 | (mantissa << 13);
+
+		} else if (exponent != 0) {
+			bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+
+		} else if (mantissa != 0) {
+			/* normalize the denormal */
+			auto shifted = 127 - 15 + 1_u32;
+
+			while ((mantissa & 0x400) == 0) {
+				mantissa <<= 1;
+				--shifted;
+			}
+
+			bits = sign | (shifted << 23) | ((mantissa & 0x3ff) << 13);
+
+		} else {
+			bits = sign;
+		}
+
+		auto value = 0.0f;
+		std::memcpy(&value, &bits, sizeof(value));
+
+		return value;
+	}
+}
+
+#endif
@@ -0,0 +1,436 @@
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include <zlib.h>
+
+#include "hdrImage.h"
+#include "half.h"
+
+namespace CNGE {
+	constexpr static u8 EXR_MAGIC[4] { 0x76, 0x2f, 0x31, 0x01 };
+
+	constexpr static u16 HALF_ONE = 0x3c00;
+
+	HdrImage::HdrImage(const char* path) : width(0), height(0), pixels() {
+		auto file = std::ifstream(path, std::ios::binary);
+
+		if (!file.is_open())
+			throw std::runtime_error("File not found");
+
+		u8 magic[4] {};
+		file.read(reinterpret_cast<char*>(magic), 4);
+		file.seekg(0);
+
+		if (std::memcmp(magic, EXR_MAGIC, 4) == 0)
+			readExr(file);
+		else if (magic[0] == '#' && magic[1] == '?')
+			readRadiance(file);
+		else
+			throw std::runtime_error("Image not HDR or EXR");
+	}
+
+	auto HdrImage::isHdr(const u8* bytes, size length) -> bool {
+		if (length >= 4 && std::memcmp(bytes, EXR_MAGIC, 4) == 0)
+			return true;
+
+		return length >= 2 && bytes[0] == '#' && bytes[1] == '?';
+	}
+
+	/*
+	 * radiance
+	 */
+
+	auto HdrImage::readRadiance(std::ifstream& file) -> void {
+		auto line = std::string();
+
+		/* header lines until the blank one */
+		while (std::getline(file, line) && !line.empty()) {
+			if (line.rfind("FORMAT=", 0) == 0 && line != "FORMAT=32-bit_rle_rgbe")
+				throw std::runtime_error("Only RGBE radiance files are supported");
+		}
+
+		std::getline(file, line);
+
+		if (std::sscanf(line.c_str(), "-Y %d +X %d", &height, &width) != 2 || width <= 0 || height <= 0)
+			throw std::runtime_error("Unsupported radiance orientation");
+
+		const auto data = std::vector<u8>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		auto at = 0_size;
+
+		auto next = [&]() -> u8 {
+			if (at >= data.size())
+				throw std::runtime_error("Unexpected end of radiance file");
+
+			return data[at++];
+		};
+
+		pixels = std::make_unique<u16[]>(size(width) * height * 4);
+
+		auto scanline = std::vector<u8>(size(width) * 4);
+
+		for (auto y = 0; y < height; ++y) {
+			u8 start[4] { next(), next(), next(), next() };
+
+			if (width >= 8 && width < 0x8000 && start[0] == 2 && start[1] == 2 && (start[2] << 8 | start[3]) == width) {
+				/* new style, each component run length encoded on its own */
+				for (auto component = 0; component < 4; ++component) {
+					auto x = 0;
+
+					while (x < width) {
+						auto count = i32(next());
+
+						if (count > 128) {
+							count -= 128;
+							const auto value = next();
+
+							for (auto i = 0; i < count && x < width; ++i)
+								scanline[(x++) * 4 + component] = value;
+
+						} else {
+							for (auto i = 0; i < count && x < width; ++i)
+								scanline[(x++) * 4 + component] = next();
+						}
+					}
+				}
+
+			} else {
+				/* flat pixels, with the old style repeat marker */
+				auto x = 0;
+				auto shift = 0;
+				u8 pixel[4] { start[0], start[1], start[2], start[3] };
+
+				while (true) {
+					if (pixel[0] == 1 && pixel[1] == 1 && pixel[2] == 1 && x > 0) {
+						const auto count = i32(pixel[3]) << shift;
+
+						for (auto i = 0; i < count && x < width; ++i, ++x)
+							std::memcpy(&scanline[x * 4], &scanline[(x - 1) * 4], 4);
+
+						shift += 8;
+
+					} else {
+						std::memcpy(&scanline[(x++) * 4], pixel, 4);
+						shift = 0;
+					}
+
+					if (x >= width)
+						break;
+
+					for (auto& component : pixel)
+						component = next();
+				}
+			}
+
+			auto* out = pixels.get() + size(y) * width * 4;
+
+			for (auto x = 0; x < width; ++x) {
+				const auto* rgbe = &scanline[x * 4];
+
+				/* the shared exponent, with the mantissas centered in their step */
+				const auto scale = rgbe[3] == 0 ? 0.0f : std::ldexp(1.0f, i32(rgbe[3]) - (128 + 8));
+
+				out[x * 4 + 0] = Half::fromFloat((rgbe[0] + 0.5f) * scale);
+				out[x * 4 + 1] = Half::fromFloat((rgbe[1] + 0.5f) * scale);
+				out[x * 4 + 2] = Half::fromFloat((rgbe[2] + 0.5f) * scale);
+				out[x * 4 + 3] = HALF_ONE;
+			}
+		}
+	}
+
+	/*
+	 * openexr
+	 */
+
+	auto HdrImage::readExr(std::ifstream& file) -> void {
+		constexpr i32
+			COMPRESSION_NONE = 0,
+			COMPRESSION_RLE = 1,
+			COMPRESSION_ZIPS = 2,
+			COMPRESSION_ZIP = 3;
+
+		/* the other type is uint */
+		constexpr i32
+			PIXEL_HALF = 1,
+			PIXEL_FLOAT = 2;
+
+		constexpr u32
+			FLAG_TILED = 0x200,
+			FLAG_DEEP = 0x800,
+			FLAG_MULTIPART = 0x1000;
+
+		struct Channel {
+			std::string name;
+			i32 type;
+			/* which rgba slot this lands in, -1 for ones we skip */
+			i32 target;
+		};
+
+		const auto data = std::vector<u8>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		auto at = 8_size;
+
+		/* at never goes past the end, so this can't wrap */
+		auto need = [&](size bytes) {
+			if (at > data.size() || bytes > data.size() - at)
+				throw std::runtime_error("Unexpected end of EXR file");
+		};
+
+		auto readI32 = [&]() -> i32 {
+			need(4);
+			auto value = i32();
+			std::memcpy(&value, &data[at], 4);
+			at += 4;
+			return value;
+		};
+
+		/* sizes are signed in the file, a negative one would wrap into a huge size_t */
+		auto readSize = [&]() -> size {
+			const auto value = readI32();
+
+			if (value < 0)
+				throw std::runtime_error("Corrupt EXR size");
+
+			return size(value);
+		};
+
+		auto readString = [&]() -> std::string {
+			auto string = std::string();
+
+			while (true) {
+				need(1);
+				const auto c = char(data[at++]);
+
+				if (c == '\0')
+					return string;
+
+				string += c;
+			}
+		};
+
+		if (data.size() < 8)
+			throw std::runtime_error("Unexpected end of EXR file");
+
+		auto flags = 0_u32;
+		std::memcpy(&flags, &data[4], 4);
+
+		if (flags & (FLAG_TILED | FLAG_DEEP | FLAG_MULTIPART))
+			throw std::runtime_error("Only single part scanline EXRs are supported");
+
+		auto channels = std::vector<Channel>();
+		auto compression = -1;
+		i32 window[4] { 0, 0, -1, -1 };
+
+		/* attributes until an empty name */
+		while (true) {
+			const auto name = readString();
+
+			if (name.empty())
+				break;
+
+			const auto type = readString();
+			const auto attributeSize = readSize();
+
+			need(attributeSize);
+			const auto end = at + attributeSize;
+
+			if (name == "channels" && type == "chlist") {
+				while (true) {
+					const auto channelName = readString();
+
+					if (channelName.empty())
+						break;
+
+					const auto pixelType = readI32();
+					need(4);
+					at += 4; /* pLinear and reserved */
+					const auto xSampling = readI32();
+					const auto ySampling = readI32();
+
+					if (xSampling != 1 || ySampling != 1)
+						throw std::runtime_error("Subsampled EXR channels are not supported");
+
+					auto target = -1;
+					if (channelName == "R" || channelName == "Y") target = 0;
+					else if (channelName == "G") target = 1;
+					else if (channelName == "B") target = 2;
+					else if (channelName == "A") target = 3;
+
+					channels.push_back({ channelName, pixelType, target });
+				}
+
+			} else if (name == "compression") {
+				if (attributeSize < 1)
+					throw std::runtime_error("Corrupt EXR compression");
+
+				compression = data[at];
+
+			} else if (name == "dataWindow") {
+				for (auto& corner : window)
+					corner = readI32();
+			}
+
+			/* what we read has to have been inside the attribute */
+			if (at > end)
+				throw std::runtime_error("Corrupt EXR attribute");
+
+			at = end;
+		}
+
+		width = window[2] - window[0] + 1;
+		height = window[3] - window[1] + 1;
+
+		if (width <= 0 || height <= 0 || channels.empty())
+			throw std::runtime_error("EXR has no pixels");
+
+		auto linesPerBlock = 0;
+
+		switch (compression) {
+			case COMPRESSION_NONE:
+			case COMPRESSION_RLE:
+			case COMPRESSION_ZIPS: linesPerBlock = 1; break;
+			case COMPRESSION_ZIP: linesPerBlock = 16; break;
+			default: throw std::runtime_error("Unsupported EXR compression");
+		}
+
+		/* luminance only files are gray */
+		const auto gray = std::none_of(channels.begin(), channels.end(), [](const Channel& channel) { return channel.name == "R"; })
+			&& std::any_of(channels.begin(), channels.end(), [](const Channel& channel) { return channel.name == "Y"; });
+
+		auto lineBytes = 0_size;
+		for (const auto& channel : channels)
+			lineBytes += size(width) * (channel.type == PIXEL_HALF ? 2 : 4);
+
+		pixels = std::make_unique<u16[]>(size(width) * height * 4);
+
+		for (auto i = 0_size; i < size(width) * height; ++i)
+			pixels[i * 4 + 3] = HALF_ONE;
+
+		const auto numBlocks = (height + linesPerBlock - 1) / linesPerBlock;
+		const auto tableStart = at;
+
+		auto unpacked = std::vector<u8>(lineBytes * linesPerBlock);
+		auto scratch = std::vector<u8>(unpacked.size());
+
+		for (auto block = 0; block < numBlocks; ++block) {
+			auto offset = 0_u64;
+			at = tableStart + size(block) * 8;
+			need(8);
+			std::memcpy(&offset, &data[at], 8);
+
+			/* blocks come after the whole offset table */
+			if (offset < tableStart + size(numBlocks) * 8 || offset >= data.size())
+				throw std::runtime_error("Corrupt EXR block offset");
+
+			at = size(offset);
+			const auto blockY = readI32() - window[1];
+			const auto packedSize = readSize();
+			need(packedSize);
+
+			if (blockY < 0 || blockY >= height)
+				throw std::runtime_error("Corrupt EXR block position");
+
+			const auto lines = std::min(linesPerBlock, height - blockY);
+			const auto unpackedSize = lineBytes * lines;
+
+			/* a block stored as is has to hold every line it claims */
+			if (compression == COMPRESSION_NONE && packedSize < unpackedSize)
+				throw std::runtime_error("Truncated EXR block");
+
+			const u8* lineData = &data[at];
+
+			/* blocks that would not shrink are stored as is */
+			if (compression != COMPRESSION_NONE && packedSize < unpackedSize) {
+				if (compression == COMPRESSION_RLE) {
+					auto in = 0_size, out = 0_size;
+
+					while (in < packedSize && out < unpackedSize) {
+						const auto count = i32(i8(lineData[in++]));
+
+						if (count < 0) {
+							for (auto i = 0; i < -count && in < packedSize && out < unpackedSize; ++i)
+								scratch[out++] = lineData[in++];
+
+						} else if (in < packedSize) {
+							const auto value = lineData[in++];
+
+							for (auto i = 0; i <= count && out < unpackedSize; ++i)
+								scratch[out++] = value;
+						}
+					}
+
+				} else {
+					auto scratchSize = uLongf(unpackedSize);
+
+					if (uncompress(scratch.data(), &scratchSize, lineData, uLong(packedSize)) != Z_OK)
+						throw std::runtime_error("Corrupt EXR zip block");
+				}
+
+				/* undo the byte delta */
+				for (auto i = 1_size; i < unpackedSize; ++i)
+					scratch[i] = u8(scratch[i - 1] + scratch[i] - 128);
+
+				/* the halves of the block were split into even and odd bytes */
+				const auto* first = scratch.data();
+				const auto* second = scratch.data() + (unpackedSize + 1) / 2;
+
+				for (auto i = 0_size; i < unpackedSize; ++i)
+					unpacked[i] = (i & 1) ? *second++ : *first++;
+
+				lineData = unpacked.data();
+			}
+
+			for (auto line = 0; line < lines; ++line) {
+				auto* out = pixels.get() + size(blockY + line) * width * 4;
+
+				for (const auto& channel : channels) {
+					const auto valueSize = channel.type == PIXEL_HALF ? 2 : 4;
+
+					if (channel.target != -1) {
+						for (auto x = 0; x < width; ++x) {
+							const auto* value = lineData + size(x) * valueSize;
+							auto half = u16();
+
+							if (channel.type == PIXEL_HALF) {
+								std::memcpy(&half, value, 2);
+
+							} else if (channel.type == PIXEL_FLOAT) {
+								auto single = 0.0f;
+								std::memcpy(&single, value, 4);
+								half = Half::fromFloat(single);
+
+							} else {
+								auto integer = 0_u32;
+								std::memcpy(&integer, value, 4);
+								half = Half::fromFloat(f32(integer));
+							}
+
+							out[x * 4 + channel.target] = half;
+
+							if (gray && channel.target == 0)
+								out[x * 4 + 1] = out[x * 4 + 2] = half;
+						}
+					}
+
+					lineData += size(width) * valueSize;
+				}
+			}
+		}
+	}
+
+	auto HdrImage::getWidth() const -> i32 {
+		return width;
+	}
+
+	auto HdrImage::getHeight() const -> i32 {
+		return height;
+	}
+
+	auto HdrImage::getPixels() const -> u16* {
+		return pixels.get();
+	}
+}
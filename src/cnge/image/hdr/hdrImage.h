@@ -0,0 +1,38 @@
+
+#ifndef CNGE_HDR_IMAGE
+#define CNGE_HDR_IMAGE
+
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "types.h"
+
+namespace CNGE {
+	/// a floating point image kept as rgba half floats
+	/// decodes radiance .hdr and scanline openexr (uncompressed, zip, zips)
+	class HdrImage {
+	private:
+		i32 width;
+		i32 height;
+
+		std::unique_ptr<u16[]> pixels;
+
+		auto readRadiance(std::ifstream&) -> void;
+		auto readExr(std::ifstream&) -> void;
+
+	public:
+		explicit HdrImage(const char*);
+
+		/// whether these first bytes of a file are something we can decode
+		static auto isHdr(const u8*, size) -> bool;
+
+		[[nodiscard]] auto getWidth() const -> i32;
+		[[nodiscard]] auto getHeight() const -> i32;
+
+		/// four halves per pixel, rows from the top
+		[[nodiscard]] auto getPixels() const -> u16*;
+	};
+}
+
+#endif
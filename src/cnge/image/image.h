@@ -2,20 +2,20 @@
 #ifndef CNGE_IMAGE
 #define CNGE_IMAGE
 
-#include <png.h>
+#include <memory>
+
 #include "types.h"
 
 namespace CNGE {
 
+	/// any image the decoder registry recognizes, as 8 bit rgba
 	class Image {
 	protected:
 		i32 width;
 		i32 height;
-		FILE* file;
-		png_struct* png;
-		png_info* info;
 
-		void endRead();
+		/// the whole image, taken over by the subclasses
+		std::unique_ptr<u8[]> decoded;
 	public:
 		Image(const char*);
 
@@ -0,0 +1,98 @@
+
+#include <csetjmp>
+#include <cstdio>
+#include <stdexcept>
+
+#include <jpeglib.h>
+
+#include "jpegImage.h"
+#include "cnge/load/mappedFile.h"
+
+namespace CNGE {
+	struct JpegError {
+		jpeg_error_mgr manager;
+		std::jmp_buf jump;
+	};
+
+	JpegImage::JpegImage(const u8* data, size length, u32 reduction) : width(0), height(0), pixels() {
+		decode(data, length, reduction);
+	}
+
+	JpegImage::JpegImage(const char* path, u32 reduction) : width(0), height(0), pixels() {
+		const auto file = MappedFile(path);
+
+		decode(file.getData(), file.getSize(), reduction);
+	}
+
+	auto JpegImage::decode(const u8* data, size length, u32 reduction) -> void {
+		auto info = jpeg_decompress_struct();
+		auto error = JpegError();
+
+		/* libjpeg exits the process on errors unless we jump out */
+		info.err = jpeg_std_error(&error.manager);
+		error.manager.error_exit = [](j_common_ptr common) {
+			std::longjmp(reinterpret_cast<JpegError*>(common->err)->jump, 1);
+		};
+
+		if (setjmp(error.jump)) {
+			jpeg_destroy_decompress(&info);
+			throw std::runtime_error("Corrupt JPEG data");
+		}
+
+		jpeg_create_decompress(&info);
+
+		jpeg_mem_src(&info, data, static_cast<unsigned long>(length));
+		jpeg_read_header(&info, true);
+
+		/* cmyk would need inverting on top, everything else libjpeg turns into rgb */
+		if (info.jpeg_color_space == JCS_CMYK || info.jpeg_color_space == JCS_YCCK) {
+			jpeg_destroy_decompress(&info);
+			throw std::runtime_error("CMYK JPEGs are not supported");
+		}
+
+		info.out_color_space = JCS_RGB;
+		info.scale_num = 1;
+		info.scale_denom = reduction;
+
+		jpeg_start_decompress(&info);
+
+		width = info.output_width;
+		height = info.output_height;
+
+		pixels = std::make_unique<u8[]>(size(width) * height * 4);
+
+		/* rgb rows go into the back of the rgba row, then spread forward into place */
+		while (info.output_scanline < info.output_height) {
+			auto* row = pixels.get() + size(info.output_scanline) * width * 4;
+			auto* rgb = row + size(width);
+
+			jpeg_read_scanlines(&info, &rgb, 1);
+
+			for (auto x = 0_u32; x < width; ++x) {
+				row[x * 4 + 0] = rgb[x * 3 + 0];
+				row[x * 4 + 1] = rgb[x * 3 + 1];
+				row[x * 4 + 2] = rgb[x * 3 + 2];
+				row[x * 4 + 3] = 255;
+			}
+		}
+
+		jpeg_finish_decompress(&info);
+		jpeg_destroy_decompress(&info);
+	}
+
+	auto JpegImage::isJpeg(const u8* bytes, size length) -> bool {
+		return length >= 3 && bytes[0] == 0xff && bytes[1] == 0xd8 && bytes[2] == 0xff;
+	}
+
+	auto JpegImage::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto JpegImage::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto JpegImage::releasePixels() -> std::unique_ptr<u8[]> {
+		return std::move(pixels);
+	}
+}
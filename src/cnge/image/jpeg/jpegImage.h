@@ -0,0 +1,36 @@
+
+#ifndef CNGE_JPEG_IMAGE
+#define CNGE_JPEG_IMAGE
+
+#include <memory>
+
+#include "types.h"
+
+namespace CNGE {
+	/// a jpeg decoded with libjpeg to 8 bit rgba
+	/// libjpeg can skip most of the idct for an image 1/2, 1/4 or 1/8 the size
+	class JpegImage {
+	private:
+		u32 width, height;
+
+		std::unique_ptr<u8[]> pixels;
+
+		auto decode(const u8*, size, u32) -> void;
+
+	public:
+		/// a reduction of 2, 4 or 8 decodes a smaller image for less work
+		JpegImage(const u8*, size, u32 reduction = 1);
+		explicit JpegImage(const char*, u32 reduction = 1);
+
+		/// whether these first bytes of a file are something we can decode
+		static auto isJpeg(const u8*, size) -> bool;
+
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+
+		/// gives up the pixels, rows from the top
+		auto releasePixels() -> std::unique_ptr<u8[]>;
+	};
+}
+
+#endif
@@ -0,0 +1,160 @@
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+
+#include "jxlImage.h"
+
+namespace CNGE {
+	constexpr static JxlPixelFormat FORMAT { 4, JXL_TYPE_UINT8, JXL_NATIVE_ENDIAN, 0 };
+
+	JxlImage::JxlImage(const char* path, ThreadPool& pool) :
+		file(path, std::ios::binary),
+		closed(false),
+		pool(pool),
+		decoder(JxlDecoderMake(nullptr)),
+		input(),
+		width(0), height(0),
+		pixels()
+	{
+		if (!file.is_open())
+			throw std::runtime_error("File not found");
+
+		if (
+			JxlDecoderSubscribeEvents(decoder.get(), JXL_DEC_BASIC_INFO | JXL_DEC_FRAME_PROGRESSION | JXL_DEC_FULL_IMAGE) != JXL_DEC_SUCCESS ||
+			JxlDecoderSetParallelRunner(decoder.get(), runParallel, &pool) != JXL_DEC_SUCCESS ||
+			JxlDecoderSetProgressiveDetail(decoder.get(), kPasses) != JXL_DEC_SUCCESS
+		)
+			throw std::runtime_error("Could not set up JPEG XL decoder");
+
+		while (true) {
+			const auto status = JxlDecoderProcessInput(decoder.get());
+
+			if (status == JXL_DEC_NEED_MORE_INPUT) {
+				feed();
+
+			} else if (status == JXL_DEC_BASIC_INFO) {
+				auto info = JxlBasicInfo();
+				JxlDecoderGetBasicInfo(decoder.get(), &info);
+
+				/* the decoder applies the orientation, the sizes are from before it */
+				width = info.orientation >= JXL_ORIENT_TRANSPOSE ? info.ysize : info.xsize;
+				height = info.orientation >= JXL_ORIENT_TRANSPOSE ? info.xsize : info.ysize;
+
+				return;
+
+			} else {
+				throw std::runtime_error("Corrupt JPEG XL header");
+			}
+		}
+	}
+
+	auto JxlImage::isJxl(const u8* bytes, size length) -> bool {
+		const auto signature = JxlSignatureCheck(bytes, length);
+
+		return signature == JXL_SIG_CODESTREAM || signature == JXL_SIG_CONTAINER;
+	}
+
+	auto JxlImage::feed() -> void {
+		if (closed)
+			throw std::runtime_error("JPEG XL file is truncated");
+
+		/* keep whatever the decoder didn't get to */
+		const auto remaining = JxlDecoderReleaseInput(decoder.get());
+		input.erase(input.begin(), input.end() - remaining);
+
+		const auto start = input.size();
+		input.resize(start + CHUNK_SIZE);
+		file.read(reinterpret_cast<char*>(input.data() + start), CHUNK_SIZE);
+		input.resize(start + size(file.gcount()));
+
+		JxlDecoderSetInput(decoder.get(), input.data(), input.size());
+
+		if (file.eof()) {
+			JxlDecoderCloseInput(decoder.get());
+			closed = true;
+		}
+	}
+
+	auto JxlImage::decode(const std::function<void(const u8*, bool)>& onPass, const std::atomic<bool>& stop) -> void {
+		while (!stop) {
+			const auto status = JxlDecoderProcessInput(decoder.get());
+
+			if (status == JXL_DEC_NEED_MORE_INPUT) {
+				feed();
+
+			} else if (status == JXL_DEC_NEED_IMAGE_OUT_BUFFER) {
+				auto bufferSize = size();
+				JxlDecoderImageOutBufferSize(decoder.get(), &FORMAT, &bufferSize);
+
+				pixels.resize(bufferSize);
+				JxlDecoderSetImageOutBuffer(decoder.get(), &FORMAT, pixels.data(), pixels.size());
+
+			} else if (status == JXL_DEC_FRAME_PROGRESSION) {
+				/* fills the whole buffer, upsampling what has been decoded so far */
+				if (JxlDecoderFlushImage(decoder.get()) == JXL_DEC_SUCCESS)
+					onPass(pixels.data(), false);
+
+			} else if (status == JXL_DEC_FULL_IMAGE) {
+				/* only the first frame of animations */
+				onPass(pixels.data(), true);
+				return;
+
+			} else if (status == JXL_DEC_SUCCESS) {
+				return;
+
+			} else {
+				throw std::runtime_error("Corrupt JPEG XL image");
+			}
+		}
+	}
+
+	/// splits a range of libjxl work across the pool and waits for all of it
+	auto JxlImage::runParallel(void* runnerOpaque, void* jxlOpaque, JxlParallelRunInit init, JxlParallelRunFunction function, u32 start, u32 end) -> JxlParallelRetCode {
+		auto& pool = *static_cast<ThreadPool*>(runnerOpaque);
+
+		const auto numThreads = std::max(std::min(pool.getNumWorkers(), end - start), 1_u32);
+
+		if (init(jxlOpaque, numThreads) != 0)
+			return JXL_PARALLEL_RET_RUNNER_ERROR;
+
+		if (numThreads == 1) {
+			for (auto value = start; value < end; ++value)
+				function(jxlOpaque, value, 0);
+
+			return JXL_PARALLEL_RET_SUCCESS;
+		}
+
+		auto next = std::atomic<u32>(start);
+
+		auto mutex = std::mutex();
+		auto condition = std::condition_variable();
+		auto running = numThreads;
+
+		for (auto thread = 0_u32; thread < numThreads; ++thread) {
+			pool.push([&, thread] {
+				for (auto value = next++; value < end; value = next++)
+					function(jxlOpaque, value, thread);
+
+				auto lock = std::lock_guard(mutex);
+
+				if (--running == 0)
+					condition.notify_one();
+			});
+		}
+
+		auto lock = std::unique_lock(mutex);
+		condition.wait(lock, [&] { return running == 0; });
+
+		return JXL_PARALLEL_RET_SUCCESS;
+	}
+
+	auto JxlImage::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto JxlImage::getHeight() const -> u32 {
+		return height;
+	}
+}
@@ -0,0 +1,62 @@
+
+#ifndef CNGE_JXL_IMAGE
+#define CNGE_JXL_IMAGE
+
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <vector>
+
+#include <jxl/decode.h>
+#include <jxl/decode_cxx.h>
+
+#include "types.h"
+#include "cnge/load/threadPool.h"
+
+namespace CNGE {
+	/// a jpeg xl file decoded a pass at a time as it is read
+	/// the file is fed to libjxl in chunks, so the first pass only waits on the bytes it needs
+	/// libjxl's parallel work runs on the thread pool given to it
+	class JxlImage {
+	private:
+		constexpr static size CHUNK_SIZE = 64_size << 10;
+
+		std::ifstream file;
+		bool closed;
+
+		ThreadPool& pool;
+		JxlDecoderPtr decoder;
+
+		/* bytes read but not yet used by the decoder */
+		std::vector<u8> input;
+
+		u32 width, height;
+
+		/* rgba8, full size even for the early passes */
+		std::vector<u8> pixels;
+
+		static auto runParallel(void*, void*, JxlParallelRunInit, JxlParallelRunFunction, u32, u32) -> JxlParallelRetCode;
+
+		auto feed() -> void;
+
+	public:
+		/// reads only as far as the basic info
+		JxlImage(const char*, ThreadPool&);
+
+		/* the decoder points back at this */
+		JxlImage(const JxlImage&) = delete;
+		auto operator=(const JxlImage&) -> void = delete;
+
+		/// whether these first bytes of a file are something we can decode
+		static auto isJxl(const u8*, size) -> bool;
+
+		/// decodes the first frame, calling back with rgba8 pixels after each progressive pass
+		/// the last call has final set, returns early if stop becomes true
+		auto decode(const std::function<void(const u8* pixels, bool final)>&, const std::atomic<bool>& stop) -> void;
+
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+	};
+}
+
+#endif
@@ -0,0 +1,15 @@
+
+#ifndef CNGE_PNG_COMMON
+#define CNGE_PNG_COMMON
+
+#include <png.h>
+
+#include "types.h"
+
+namespace CNGE {
+	/// after png_read_info, sets libpng up to give 8 bit rgba rows whatever the file holds
+	/// returns the number of interlace passes, call inside the caller's setjmp
+	auto expandPngToRgba(png_struct*, png_info*) -> i32;
+}
+
+#endif
@@ -0,0 +1,156 @@
+
+#include <csetjmp>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+#include <png.h>
+
+#include "pngImage.h"
+#include "pngCommon.h"
+
+namespace CNGE {
+	auto expandPngToRgba(png_struct* png, png_info* info) -> i32 {
+		auto colorType = png_get_color_type(png, info);
+		auto bitDepth = png_get_bit_depth(png, info);
+
+		// convert the image into 8 bit rgba
+
+		if (bitDepth == 16)
+			png_set_strip_16(png);
+
+		if (colorType == PNG_COLOR_TYPE_PALETTE)
+			png_set_palette_to_rgb(png);
+
+		if (colorType == PNG_COLOR_TYPE_GRAY && bitDepth < 8)
+			png_set_expand_gray_1_2_4_to_8(png);
+
+		if (png_get_valid(png, info, PNG_INFO_tRNS))
+			png_set_tRNS_to_alpha(png);
+
+		if (colorType == PNG_COLOR_TYPE_RGB || colorType == PNG_COLOR_TYPE_GRAY || colorType == PNG_COLOR_TYPE_PALETTE)
+			png_set_filler(png, 0xFF, PNG_FILLER_AFTER);
+
+		if (colorType == PNG_COLOR_TYPE_GRAY || colorType == PNG_COLOR_TYPE_GRAY_ALPHA)
+			png_set_gray_to_rgb(png);
+
+		/* interlaced images need every pass read over the same rows */
+		return png_set_interlace_handling(png);
+	}
+
+	/// reads everything after the signature as 8 bit rgba
+	/// false if libpng hit an error, pixels may be left half filled
+	static auto readPng(png_struct* png, png_info* info, u32& width, u32& height, std::unique_ptr<u8[]>& pixels) -> bool {
+		if (setjmp(png_jmpbuf(png)))
+			return false;
+
+		png_set_sig_bytes(png, 8);
+
+		png_read_info(png, info);
+
+		width = png_get_image_width(png, info);
+		height = png_get_image_height(png, info);
+
+		const auto passes = expandPngToRgba(png, info);
+
+		png_read_update_info(png, info);
+
+		auto rowBytes = png_get_rowbytes(png, info);
+
+		pixels = std::make_unique<u8[]>(rowBytes * height);
+
+		// read in all rows into a 1D array
+
+		for (auto pass = 0; pass < passes; ++pass) {
+			auto pixelsPtr = pixels.get();
+			for (auto i = 0_u32; i < height; ++i) {
+				png_read_row(png, pixelsPtr, nullptr);
+				pixelsPtr += rowBytes;
+			}
+		}
+
+		return true;
+	}
+
+	PngImage::PngImage(const char* path) : width(0), height(0), pixels() {
+		// open the file of the image
+		FILE* file = nullptr;
+		fopen_s(&file, path, "rb");
+
+		/* check if the file exists */
+		if (file == nullptr)
+			throw std::exception("File not found");
+
+		/* check if the file is a png */
+		u8 sig[8];
+		fread(sig, 1, 8, file);
+		if (png_sig_cmp(sig, 0, 8)) {
+			fclose(file);
+			throw std::exception("Image not a PNG");
+		}
+
+		// startLoading reading the file
+		auto* png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+		auto* info = png_create_info_struct(png);
+
+		png_init_io(png, file);
+
+		const auto read = readPng(png, info, width, height, pixels);
+
+		png_destroy_read_struct(&png, &info, nullptr);
+		fclose(file);
+
+		if (!read)
+			throw std::runtime_error("Corrupt PNG");
+	}
+
+	PngImage::PngImage(const u8* data, size length) : width(0), height(0), pixels() {
+		struct Source {
+			const u8* data;
+			size length;
+			size at;
+		};
+
+		if (!isPng(data, length))
+			throw std::runtime_error("Image not a PNG");
+
+		auto source = Source { data, length, 8 };
+
+		auto* png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+		auto* info = png_create_info_struct(png);
+
+		png_set_read_fn(png, &source, [](png_struct* png, png_byte* out, size_t count) {
+			auto* source = static_cast<Source*>(png_get_io_ptr(png));
+
+			if (source->at + count > source->length)
+				png_error(png, "Unexpected end of PNG data");
+
+			std::memcpy(out, source->data + source->at, count);
+			source->at += count;
+		});
+
+		const auto read = readPng(png, info, width, height, pixels);
+
+		png_destroy_read_struct(&png, &info, nullptr);
+
+		if (!read)
+			throw std::runtime_error("Corrupt PNG");
+	}
+
+	auto PngImage::isPng(const u8* bytes, size length) -> bool {
+		return length >= 8 && png_sig_cmp(bytes, 0, 8) == 0;
+	}
+
+	auto PngImage::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto PngImage::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto PngImage::releasePixels() -> std::unique_ptr<u8[]> {
+		return std::move(pixels);
+	}
+}
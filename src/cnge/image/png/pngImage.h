@@ -0,0 +1,33 @@
+
+#ifndef CNGE_PNG_IMAGE
+#define CNGE_PNG_IMAGE
+
+#include <memory>
+
+#include "types.h"
+
+namespace CNGE {
+	/// a png decoded with libpng, expanded to 8 bit rgba
+	class PngImage {
+	private:
+		u32 width, height;
+
+		std::unique_ptr<u8[]> pixels;
+
+	public:
+		explicit PngImage(const char*);
+		/// a whole png already in memory, signature included
+		PngImage(const u8*, size);
+
+		/// whether these first bytes of a file are something we can decode
+		static auto isPng(const u8*, size) -> bool;
+
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+
+		/// gives up the pixels, rows from the top
+		auto releasePixels() -> std::unique_ptr<u8[]>;
+	};
+}
+
+#endif
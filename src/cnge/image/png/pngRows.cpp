@@ -0,0 +1,93 @@
+
+#include <csetjmp>
+#include <cstring>
+#include <stdexcept>
+
+#include "pngRows.h"
+#include "pngCommon.h"
+
+namespace CNGE {
+	PngRows::PngRows(const char* path) : file(nullptr), png(nullptr), info(nullptr), width(0), height(0), nextRow(0), row(), whole() {
+		fopen_s(&file, path, "rb");
+
+		if (file == nullptr)
+			throw std::runtime_error("File not found");
+
+		u8 signature[8];
+
+		if (fread(signature, 1, 8, file) != 8 || png_sig_cmp(signature, 0, 8)) {
+			fclose(file);
+			throw std::runtime_error("Image not a PNG");
+		}
+
+		png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+		info = png_create_info_struct(png);
+
+		if (setjmp(png_jmpbuf(png))) {
+			png_destroy_read_struct(&png, &info, nullptr);
+			fclose(file);
+
+			throw std::runtime_error("Corrupt PNG");
+		}
+
+		png_init_io(png, file);
+		png_set_sig_bytes(png, 8);
+
+		png_read_info(png, info);
+
+		width = png_get_image_width(png, info);
+		height = png_get_image_height(png, info);
+
+		const auto passes = expandPngToRgba(png, info);
+
+		png_read_update_info(png, info);
+
+		row.resize(size(width) * 4);
+
+		/* every pass touches every row, so there is no reading it in order */
+		if (passes > 1) {
+			whole = std::make_unique<u8[]>(size(width) * height * 4);
+
+			for (auto pass = 0; pass < passes; ++pass)
+				for (auto y = 0_u32; y < height; ++y)
+					png_read_row(png, whole.get() + size(y) * width * 4, nullptr);
+		}
+	}
+
+	auto PngRows::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto PngRows::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto PngRows::readRow() -> const u8* {
+		if (nextRow >= height)
+			throw std::runtime_error("Read past the end of the PNG");
+
+		if (whole != nullptr)
+			return whole.get() + size(nextRow++) * width * 4;
+
+		if (setjmp(png_jmpbuf(png)))
+			throw std::runtime_error("Corrupt PNG");
+
+		png_read_row(png, row.data(), nullptr);
+		++nextRow;
+
+		return row.data();
+	}
+
+	auto PngRows::readRows(u32 count, u32 left, u32 columns, u8* pixels) -> void {
+		for (auto i = 0_u32; i < count; ++i) {
+			const auto* source = readRow();
+
+			std::memcpy(pixels + size(i) * columns * 4, source + size(left) * 4, size(columns) * 4);
+		}
+	}
+
+	PngRows::~PngRows() {
+		png_destroy_read_struct(&png, &info, nullptr);
+		fclose(file);
+	}
+}
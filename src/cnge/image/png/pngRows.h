@@ -0,0 +1,50 @@
+
+#ifndef CNGE_PNG_ROWS
+#define CNGE_PNG_ROWS
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "types.h"
+#include "cnge/image/rowSource.h"
+
+struct png_struct_def;
+struct png_info_def;
+
+namespace CNGE {
+	/// a png read a row at a time straight from the file with libpng, as 8 bit rgba
+	/// interlaced pngs can't be read in order, those are decoded whole up front
+	class PngRows : public RowSource {
+	private:
+		FILE* file;
+		png_struct_def* png;
+		png_info_def* info;
+
+		u32 width, height;
+		u32 nextRow;
+
+		std::vector<u8> row;
+
+		/// only for interlaced images
+		std::unique_ptr<u8[]> whole;
+
+		auto readRow() -> const u8*;
+
+	public:
+		explicit PngRows(const char*);
+
+		/* no copying the reader */
+		PngRows(const PngRows&) = delete;
+		auto operator=(const PngRows&) -> void = delete;
+
+		[[nodiscard]] auto getWidth() const -> u32 override;
+		[[nodiscard]] auto getHeight() const -> u32 override;
+
+		auto readRows(u32 count, u32 left, u32 width, u8* pixels) -> void override;
+
+		~PngRows() override;
+	};
+}
+
+#endif
@@ -0,0 +1,285 @@
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <csetjmp>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <png.h>
+
+#include "pngStream.h"
+
+namespace CNGE {
+	constexpr static size CHUNK_SIZE = 64_size << 10;
+
+	/* a gigabyte of rgba, anything bigger in a pipe is far more likely garbage */
+	constexpr static size MAX_PIXELS = 1_size << 28;
+
+	struct PngStream::State {
+		int descriptor = -1;
+		bool ownsDescriptor = false;
+
+		png_struct* png = nullptr;
+		png_info* info = nullptr;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+
+		u32 width = 0, height = 0;
+		std::unique_ptr<u8[]> pixels;
+
+		/* rows changed since the last take, top >= bottom when there are none */
+		u32 changedTop = 0, changedBottom = 0;
+
+		bool headerReady = false;
+		bool finished = false;
+		std::string error;
+
+		/* libpng's message, only touched by the reader thread */
+		std::string pngError;
+
+		std::atomic<bool> stopping = false;
+
+		static auto onError(png_struct*, const char*) -> void;
+		static auto onInfo(png_struct*, png_info*) -> void;
+		static auto onRow(png_struct*, png_byte*, png_uint_32, int) -> void;
+		static auto onEnd(png_struct*, png_info*) -> void;
+
+		auto readSome(u8*, size) const -> i64;
+		auto run() -> void;
+
+		~State();
+	};
+
+	auto PngStream::State::onError(png_struct* png, const char* message) -> void {
+		static_cast<State*>(png_get_error_ptr(png))->pngError = message;
+
+		png_longjmp(png, 1);
+	}
+
+	auto PngStream::State::onInfo(png_struct* png, png_info* info) -> void {
+		auto* state = static_cast<State*>(png_get_progressive_ptr(png));
+
+		const auto colorType = png_get_color_type(png, info);
+		const auto bitDepth = png_get_bit_depth(png, info);
+
+		/* the same expansion to 8 bit rgba as a whole file decode */
+		if (bitDepth == 16)
+			png_set_strip_16(png);
+
+		if (colorType == PNG_COLOR_TYPE_PALETTE)
+			png_set_palette_to_rgb(png);
+
+		if (colorType == PNG_COLOR_TYPE_GRAY && bitDepth < 8)
+			png_set_expand_gray_1_2_4_to_8(png);
+
+		if (png_get_valid(png, info, PNG_INFO_tRNS))
+			png_set_tRNS_to_alpha(png);
+
+		if (colorType == PNG_COLOR_TYPE_RGB || colorType == PNG_COLOR_TYPE_GRAY || colorType == PNG_COLOR_TYPE_PALETTE)
+			png_set_filler(png, 0xFF, PNG_FILLER_AFTER);
+
+		if (colorType == PNG_COLOR_TYPE_GRAY || colorType == PNG_COLOR_TYPE_GRAY_ALPHA)
+			png_set_gray_to_rgb(png);
+
+		png_set_interlace_handling(png);
+
+		png_read_update_info(png, info);
+
+		const auto width = png_get_image_width(png, info);
+		const auto height = png_get_image_height(png, info);
+
+		/* a throw can't get out through libpng, so failures go through its error path */
+		if (size(width) * height > MAX_PIXELS)
+			png_error(png, "PNG stream is too big");
+
+		auto* pixels = new (std::nothrow) u8[size(width) * height * 4];
+
+		if (pixels == nullptr)
+			png_error(png, "Out of memory for the PNG stream");
+
+		auto lock = std::lock_guard(state->mutex);
+
+		state->width = width;
+		state->height = height;
+		state->pixels.reset(pixels);
+		state->headerReady = true;
+
+		state->condition.notify_all();
+	}
+
+	auto PngStream::State::onRow(png_struct* png, png_byte* row, png_uint_32 rowIndex, int) -> void {
+		/* rows that don't change in this interlace pass come through as null */
+		if (row == nullptr)
+			return;
+
+		auto* state = static_cast<State*>(png_get_progressive_ptr(png));
+
+		auto lock = std::lock_guard(state->mutex);
+
+		/* merges with what earlier passes put in the row */
+		png_progressive_combine_row(png, state->pixels.get() + size(rowIndex) * state->width * 4, row);
+
+		if (state->changedTop >= state->changedBottom) {
+			state->changedTop = rowIndex;
+			state->changedBottom = rowIndex + 1;
+		} else {
+			state->changedTop = std::min(state->changedTop, u32(rowIndex));
+			state->changedBottom = std::max(state->changedBottom, u32(rowIndex + 1));
+		}
+	}
+
+	auto PngStream::State::onEnd(png_struct* png, png_info*) -> void {
+		auto* state = static_cast<State*>(png_get_progressive_ptr(png));
+
+		auto lock = std::lock_guard(state->mutex);
+		state->finished = true;
+	}
+
+	/// returns as soon as any bytes are there instead of waiting for a full chunk
+	auto PngStream::State::readSome(u8* buffer, size length) const -> i64 {
+#ifdef _WIN32
+		return _read(descriptor, buffer, u32(length));
+#else
+		return read(descriptor, buffer, length);
+#endif
+	}
+
+	auto PngStream::State::run() -> void {
+		auto buffer = std::vector<u8>(CHUNK_SIZE);
+
+		/* libpng errors land back here */
+		if (setjmp(png_jmpbuf(png))) {
+			auto lock = std::lock_guard(mutex);
+			error = pngError.empty() ? "Corrupt PNG stream" : pngError;
+			finished = true;
+			condition.notify_all();
+			return;
+		}
+
+		while (!stopping) {
+			const auto count = readSome(buffer.data(), buffer.size());
+
+			if (count <= 0)
+				break;
+
+			png_process_data(png, info, buffer.data(), size(count));
+
+			auto lock = std::lock_guard(mutex);
+			if (finished)
+				break;
+		}
+
+		auto lock = std::lock_guard(mutex);
+
+		if (!headerReady)
+			error = "PNG stream ended before its header";
+
+		finished = true;
+		condition.notify_all();
+	}
+
+	PngStream::State::~State() {
+		if (png != nullptr)
+			png_destroy_read_struct(&png, &info, nullptr);
+
+		if (ownsDescriptor) {
+#ifdef _WIN32
+			_close(descriptor);
+#else
+			close(descriptor);
+#endif
+		}
+	}
+
+	PngStream::PngStream(const std::string& path) : state(std::make_shared<State>()) {
+		if (path == "-") {
+#ifdef _WIN32
+			state->descriptor = _fileno(stdin);
+			_setmode(state->descriptor, _O_BINARY);
+#else
+			state->descriptor = STDIN_FILENO;
+#endif
+		} else {
+#ifdef _WIN32
+			state->descriptor = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+			state->descriptor = open(path.c_str(), O_RDONLY);
+#endif
+			state->ownsDescriptor = true;
+		}
+
+		if (state->descriptor == -1)
+			throw std::runtime_error("File not found");
+
+		state->png = png_create_read_struct(PNG_LIBPNG_VER_STRING, state.get(), State::onError, nullptr);
+		state->info = png_create_info_struct(state->png);
+
+		png_set_progressive_read_fn(state->png, state.get(), State::onInfo, State::onRow, State::onEnd);
+
+		std::thread([state = state] { state->run(); }).detach();
+
+		/* the size has to be known before a texture can be made */
+		auto lock = std::unique_lock(state->mutex);
+		state->condition.wait(lock, [this] { return state->headerReady || state->finished; });
+
+		if (!state->headerReady)
+			throw std::runtime_error(state->error);
+	}
+
+	auto PngStream::isStream(const std::string& path) -> bool {
+		if (path == "-")
+			return true;
+
+		auto error = std::error_code();
+		return std::filesystem::is_fifo(path, error);
+	}
+
+	auto PngStream::getWidth() const -> u32 {
+		return state->width;
+	}
+
+	auto PngStream::getHeight() const -> u32 {
+		return state->height;
+	}
+
+	auto PngStream::takeChanged(const std::function<void(const u8*, u32, u32)>& onChanged) -> bool {
+		auto lock = std::lock_guard(state->mutex);
+
+		if (state->changedTop >= state->changedBottom)
+			return false;
+
+		onChanged(state->pixels.get(), state->changedTop, state->changedBottom);
+
+		state->changedTop = state->changedBottom = 0;
+
+		return true;
+	}
+
+	auto PngStream::getFinished() const -> bool {
+		auto lock = std::lock_guard(state->mutex);
+
+		return state->finished;
+	}
+
+	auto PngStream::getError() const -> std::string {
+		auto lock = std::lock_guard(state->mutex);
+
+		return state->error;
+	}
+
+	PngStream::~PngStream() {
+		state->stopping = true;
+	}
+}
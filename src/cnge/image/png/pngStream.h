@@ -0,0 +1,54 @@
+
+#ifndef CNGE_PNG_STREAM
+#define CNGE_PNG_STREAM
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "types.h"
+
+namespace CNGE {
+	/// a png decoded as its bytes arrive, from stdin or a pipe
+	/// libpng's progressive reader runs on its own thread and fills in rows as they complete
+	/// interlaced images fill in a coarse version first and sharpen with each pass
+	class PngStream {
+	private:
+		struct State;
+
+		/* shared with the reader thread, which may outlive this if the pipe never closes */
+		std::shared_ptr<State> state;
+
+	public:
+		/// "-" reads stdin, anything else is opened as a file or fifo
+		/// blocks until the header has arrived
+		explicit PngStream(const std::string&);
+
+		/* the reader thread holds on to the state */
+		PngStream(const PngStream&) = delete;
+		auto operator=(const PngStream&) -> void = delete;
+
+		/// whether a path names something that has to be read as a stream
+		static auto isStream(const std::string&) -> bool;
+
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+
+		/// calls back with the rgba8 image and the range of rows that changed since the last call
+		/// the image is locked during the call, returns whether anything changed
+		auto takeChanged(const std::function<void(const u8* pixels, u32 top, u32 bottom)>&) -> bool;
+
+		/// whether the whole image has arrived, or the stream ended early
+		[[nodiscard]] auto getFinished() const -> bool;
+
+		/// why the stream ended early, empty if it hasn't
+		[[nodiscard]] auto getError() const -> std::string;
+
+		/// stops reading, the reader thread lets go when its current read returns
+		~PngStream();
+	};
+}
+
+#endif
@@ -0,0 +1,269 @@
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include "pngWriter.h"
+
+namespace CNGE {
+	constexpr static size WINDOW_SIZE = 32768;
+
+	static auto putBig(u8* bytes, u32 value) -> void {
+		bytes[0] = u8(value >> 24);
+		bytes[1] = u8(value >> 16);
+		bytes[2] = u8(value >> 8);
+		bytes[3] = u8(value);
+	}
+
+	static auto paeth(i32 left, i32 above, i32 aboveLeft) -> u8 {
+		const auto guess = left + above - aboveLeft;
+		const auto toLeft = std::abs(guess - left), toAbove = std::abs(guess - above), toAboveLeft = std::abs(guess - aboveLeft);
+
+		if (toLeft <= toAbove && toLeft <= toAboveLeft) return u8(left);
+		if (toAbove <= toAboveLeft) return u8(above);
+		return u8(aboveLeft);
+	}
+
+	/// filters one row into out, which starts with the filter type byte
+	/// tries all five filters and keeps the one with the smallest sum of signed bytes, like libpng does
+	static auto filterRow(const u8* row, const u8* above, size rowBytes, u32 bpp, u8* out, u8* scratch) -> void {
+		auto bestSum = ~0_u64;
+
+		auto tryFilter = [&](u8 type, auto predict) {
+			auto sum = 0_u64;
+
+			/* the first pixel has nothing to its left */
+			for (auto i = 0_size; i < std::min(size(bpp), rowBytes); ++i) {
+				scratch[i] = u8(row[i] - predict(0, above[i], 0));
+				sum += scratch[i] < 128 ? scratch[i] : 256 - scratch[i];
+			}
+
+			for (auto i = size(bpp); i < rowBytes; ++i) {
+				scratch[i] = u8(row[i] - predict(row[i - bpp], above[i], above[i - bpp]));
+				sum += scratch[i] < 128 ? scratch[i] : 256 - scratch[i];
+			}
+
+			if (sum < bestSum) {
+				bestSum = sum;
+				out[0] = type;
+				std::memcpy(out + 1, scratch, rowBytes);
+			}
+		};
+
+		tryFilter(0, [](i32, i32, i32) { return 0; });
+		tryFilter(1, [](i32 left, i32, i32) { return left; });
+		tryFilter(2, [](i32, i32 up, i32) { return up; });
+		tryFilter(3, [](i32 left, i32 up, i32) { return (left + up) >> 1; });
+		tryFilter(4, [](i32 left, i32 up, i32 upLeft) { return paeth(left, up, upLeft); });
+	}
+
+	PngWriter::PngWriter(std::ostream& stream, u32 width, u32 height, u32 channels, i32 level, u32 numWorkers) :
+		stream(stream),
+		width(width),
+		height(height),
+		channels(channels),
+		level(level),
+		rowBytes(size(width) * channels),
+		bandRows(),
+		windowRows(),
+		pending(),
+		keptRows(0),
+		pendingRows(0),
+		rowsReceived(0),
+		rowsSubmitted(0),
+		adler(u32(adler32(0, nullptr, 0))),
+		inFlight(),
+		workers(numWorkers)
+	{
+		if (width == 0 || height == 0)
+			throw std::runtime_error("Can't write an empty png");
+
+		if (channels < 1 || channels > 4)
+			throw std::runtime_error("Png channels must be 1 to 4");
+
+		bandRows = u32(std::max(BAND_BYTES / rowBytes, 1_size));
+		windowRows = u32((WINDOW_SIZE + rowBytes) / (rowBytes + 1));
+
+		/* signature */
+		const u8 signature[8] { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+		stream.write(reinterpret_cast<const char*>(signature), 8);
+
+		constexpr u8 colorTypes[5] { 0, 0, 4, 2, 6 };
+
+		u8 header[13] {};
+		putBig(header, width);
+		putBig(header + 4, height);
+		header[8] = 8;
+		header[9] = colorTypes[channels];
+
+		writeChunk("IHDR", header, 13);
+
+		/* zlib header, with the level hint the way zlib itself would write it */
+		const auto levelHint = level == Z_DEFAULT_COMPRESSION || level == 6 ? 2 : level < 2 ? 0 : level < 6 ? 1 : 3;
+		u8 zlibHeader[2] { 0x78, u8(levelHint << 6) };
+		zlibHeader[1] += u8(31 - (zlibHeader[0] * 256 + zlibHeader[1]) % 31);
+
+		writeChunk("IDAT", zlibHeader, 2);
+	}
+
+	auto PngWriter::writeChunk(const char* type, const u8* data, size length) -> void {
+		u8 bytes[4];
+
+		putBig(bytes, u32(length));
+		stream.write(reinterpret_cast<const char*>(bytes), 4);
+		stream.write(type, 4);
+		stream.write(reinterpret_cast<const char*>(data), std::streamsize(length));
+
+		auto crc = crc32(0, reinterpret_cast<const Bytef*>(type), 4);
+
+		/* zlib resets the crc when given no buffer */
+		if (length > 0)
+			crc = crc32_z(crc, data, length);
+
+		putBig(bytes, u32(crc));
+		stream.write(reinterpret_cast<const char*>(bytes), 4);
+
+		if (!stream)
+			throw std::runtime_error("Couldn't write png");
+	}
+
+	auto PngWriter::compressBand(std::vector<u8>&& raw, u32 windowRows, bool fromTop, size rowBytes, u32 channels, i32 level, bool last) -> Band {
+		const auto numRows = u32(raw.size() / rowBytes);
+		const auto filteredBytes = rowBytes + 1;
+
+		/* the first window row is only there to filter the second against, unless it is the top of the image */
+		const auto firstFiltered = fromTop ? 0_u32 : std::min(1_u32, windowRows);
+
+		auto filtered = std::vector<u8>(size(numRows - firstFiltered) * filteredBytes);
+		auto scratch = std::vector<u8>(rowBytes);
+		auto zeros = std::vector<u8>(rowBytes);
+
+		for (auto row = firstFiltered; row < numRows; ++row) {
+			const auto* above = row == 0 ? zeros.data() : raw.data() + (row - 1) * rowBytes;
+
+			filterRow(raw.data() + row * rowBytes, above, rowBytes, channels, filtered.data() + (row - firstFiltered) * filteredBytes, scratch.data());
+		}
+
+		raw = std::vector<u8>();
+
+		const auto* window = filtered.data();
+		const auto windowBytes = size(windowRows - firstFiltered) * filteredBytes;
+		const auto* data = window + windowBytes;
+		const auto length = filtered.size() - windowBytes;
+
+		auto zStream = z_stream();
+		deflateInit2(&zStream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+
+		/* matches may reach back into the band before, just as if it were one deflate run */
+		if (windowBytes > 0) {
+			const auto dictionary = std::min(windowBytes, WINDOW_SIZE);
+			deflateSetDictionary(&zStream, data - dictionary, uInt(dictionary));
+		}
+
+		auto band = Band { std::vector<u8>(deflateBound(&zStream, uLong(length)) + 16), u32(adler32_z(adler32(0, nullptr, 0), data, length)), length };
+
+		zStream.next_in = const_cast<u8*>(data);
+		zStream.avail_in = uInt(length);
+		zStream.next_out = band.deflated.data();
+		zStream.avail_out = uInt(band.deflated.size());
+
+		/* a sync flush ends the band on a byte without ending the stream */
+		const auto result = deflate(&zStream, last ? Z_FINISH : Z_SYNC_FLUSH);
+
+		band.deflated.resize(zStream.total_out);
+		deflateEnd(&zStream);
+
+		if (result != (last ? Z_STREAM_END : Z_OK))
+			throw std::runtime_error("Couldn't deflate png band");
+
+		return band;
+	}
+
+	auto PngWriter::submitBand() -> void {
+		const auto numRows = pendingRows - keptRows;
+		const auto last = rowsSubmitted + numRows == height;
+
+		/* the job gets its own copy of the band and the rows before it */
+		auto raw = std::vector<u8>(pending.begin(), pending.begin() + ptrdiff_t(size(pendingRows) * rowBytes));
+		const auto fromTop = rowsSubmitted == keptRows;
+
+		auto task = std::make_shared<std::packaged_task<Band()>>(
+			[raw = std::move(raw), windowRows = keptRows, fromTop, rowBytes = rowBytes, channels = channels, level = level, last]() mutable {
+				return compressBand(std::move(raw), windowRows, fromTop, rowBytes, channels, level, last);
+			}
+		);
+
+		inFlight.push_back(task->get_future());
+		workers.push([task] { (*task)(); });
+
+		rowsSubmitted += numRows;
+
+		/* keep the window rows for the next band, plus one to filter the first of them against */
+		const auto keep = std::min(pendingRows, windowRows + 1);
+		std::memmove(pending.data(), pending.data() + size(pendingRows - keep) * rowBytes, size(keep) * rowBytes);
+		keptRows = keep;
+		pendingRows = keep;
+
+		/* bands finish in any order but go out in order, so don't let the finished ones pile up */
+		while (inFlight.size() > workers.getNumWorkers() * 2_size)
+			writeBand();
+
+		if (last) {
+			while (!inFlight.empty())
+				writeBand();
+
+			u8 trailer[4];
+			putBig(trailer, adler);
+
+			writeChunk("IDAT", trailer, 4);
+			writeChunk("IEND", nullptr, 0);
+
+			stream.flush();
+		}
+	}
+
+	auto PngWriter::writeBand() -> void {
+		auto band = inFlight.front().get();
+		inFlight.pop_front();
+
+		adler = u32(adler32_combine(adler, band.adler, z_off_t(band.length)));
+
+		writeChunk("IDAT", band.deflated.data(), band.deflated.size());
+	}
+
+	auto PngWriter::writeRows(const u8* rows, u32 numRows, size stride) -> void {
+		if (rowsReceived + numRows > height)
+			throw std::runtime_error("Too many rows for png");
+
+		for (auto i = 0_u32; i < numRows; ++i) {
+			if (pending.size() < size(keptRows + bandRows) * rowBytes)
+				pending.resize(size(keptRows + bandRows) * rowBytes);
+
+			std::memcpy(pending.data() + size(pendingRows) * rowBytes, rows + i * stride, rowBytes);
+			++pendingRows;
+			++rowsReceived;
+
+			if (pendingRows - keptRows == bandRows || rowsReceived == height)
+				submitBand();
+		}
+	}
+
+	auto PngWriter::getFinished() const -> bool {
+		return rowsSubmitted == height;
+	}
+
+	auto PngWriter::write(const char* path, u32 width, u32 height, const u8* pixels, u32 channels, i32 level, u32 workers) -> void {
+		auto file = std::ofstream(path, std::ios::binary);
+
+		if (!file)
+			throw std::runtime_error(std::string("Couldn't open ") + path + " for writing");
+
+		auto writer = PngWriter(file, width, height, channels, level, workers);
+		writer.writeRows(pixels, height, size(width) * channels);
+	}
+}
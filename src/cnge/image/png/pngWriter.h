@@ -0,0 +1,81 @@
+
+#ifndef CNGE_PNG_WRITER
+#define CNGE_PNG_WRITER
+
+#include <deque>
+#include <future>
+#include <ostream>
+#include <vector>
+
+#include "types.h"
+#include "cnge/load/threadPool.h"
+
+namespace CNGE {
+	/// writes an 8 bit png, filtering and deflating bands of rows on several threads at once
+	/// each band is its own deflate run primed with the end of the band before it,
+	/// so the bands join into one zlib stream that any decoder reads as usual
+	/// rows can be handed over a few at a time, only the bands in flight are held in memory
+	class PngWriter {
+	public:
+		/// about how many bytes of pixels go in one band
+		constexpr static size BAND_BYTES = 512_size << 10;
+
+	private:
+		struct Band {
+			std::vector<u8> deflated;
+			u32 adler;
+			size length;
+		};
+
+		std::ostream& stream;
+
+		u32 width, height, channels;
+		i32 level;
+
+		size rowBytes;
+		u32 bandRows;
+		/// how many rows before a band fill the deflate window
+		u32 windowRows;
+
+		/// the window rows carried over from the band before, then the band being filled
+		std::vector<u8> pending;
+		u32 keptRows;
+		u32 pendingRows;
+		u32 rowsReceived;
+		u32 rowsSubmitted;
+
+		u32 adler;
+
+		std::deque<std::future<Band>> inFlight;
+
+		/* last so no job is still running when the rest goes */
+		ThreadPool workers;
+
+		auto submitBand() -> void;
+		auto writeBand() -> void;
+		auto writeChunk(const char*, const u8*, size) -> void;
+
+		static auto compressBand(std::vector<u8>&& raw, u32 windowRows, bool fromTop, size rowBytes, u32 channels, i32 level, bool last) -> Band;
+
+	public:
+		/// channels 1 gray, 2 gray alpha, 3 rgb, 4 rgba
+		/// level is zlib's, 0 workers means one per hardware thread
+		/// writes the header right away
+		PngWriter(std::ostream&, u32 width, u32 height, u32 channels = 4, i32 level = 6, u32 workers = 0);
+
+		/* no copying the writer */
+		PngWriter(const PngWriter&) = delete;
+		auto operator=(const PngWriter&) -> void = delete;
+
+		/// the next rows of the image from the top, stride bytes apart
+		/// the file is finished once the last row is given
+		auto writeRows(const u8*, u32 numRows, size stride) -> void;
+
+		[[nodiscard]] auto getFinished() const -> bool;
+
+		/// a whole image at once, tightly packed rows from the top
+		static auto write(const char* path, u32 width, u32 height, const u8* pixels, u32 channels = 4, i32 level = 6, u32 workers = 0) -> void;
+	};
+}
+
+#endif
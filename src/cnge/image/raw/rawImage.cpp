@@ -0,0 +1,181 @@
+
+#include <cctype>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "rawImage.h"
+
+namespace CNGE {
+	RawImage::RawImage(const char* path) :
+		file(path),
+		width(0), height(0),
+		channels(0), bytesPerChannel(1),
+		rowBytes(0), bigEndian(false),
+		pixels(nullptr)
+	{
+		if (file.getSize() >= RAW_RGBA_HEADER_SIZE && std::memcmp(file.getData(), RAW_RGBA_MAGIC, 4) == 0)
+			readRawRgba();
+		else
+			readNetpbm();
+
+		if (width == 0 || height == 0)
+			throw std::runtime_error("Raw image is truncated");
+
+		const auto pixelBytes = size(channels) * bytesPerChannel;
+		const auto packedRow = size(width) * pixelBytes;
+
+		if (rowBytes < packedRow)
+			throw std::runtime_error("Raw image stride is smaller than a row");
+
+		/* gl takes the sizes and the stride in pixels as ints */
+		if (width > INT_MAX || height > INT_MAX || rowBytes / pixelBytes > INT_MAX)
+			throw std::runtime_error("Raw image is too big");
+
+		/* the mapping has to hold every row we are going to hand to gl, */
+		/* checked by dividing so nothing from the header can wrap it */
+		const auto headerBytes = size(pixels - file.getData());
+
+		if (headerBytes > file.getSize())
+			throw std::runtime_error("Raw image is truncated");
+
+		const auto available = file.getSize() - headerBytes;
+
+		if (packedRow > available || size(height - 1) > (available - packedRow) / rowBytes)
+			throw std::runtime_error("Raw image is truncated");
+	}
+
+	auto RawImage::isRaw(const u8* bytes, size length) -> bool {
+		if (length >= 4 && std::memcmp(bytes, RAW_RGBA_MAGIC, 4) == 0)
+			return true;
+
+		return length >= 3 && bytes[0] == 'P' && (bytes[1] == '5' || bytes[1] == '6' || bytes[1] == '7') && std::isspace(bytes[2]);
+	}
+
+	auto RawImage::readRawRgba() -> void {
+		u32 header[3] {};
+		std::memcpy(header, file.getData() + 4, sizeof(header));
+
+		width = header[0];
+		height = header[1];
+		channels = 4;
+		rowBytes = header[2] == 0 ? size(width) * 4 : header[2];
+
+		pixels = file.getData() + RAW_RGBA_HEADER_SIZE;
+	}
+
+	auto RawImage::readNetpbm() -> void {
+		const auto* data = file.getData();
+		const auto length = file.getSize();
+		auto at = 2_size;
+
+		if (length < 3 || data[0] != 'P')
+			throw std::runtime_error("Image not raw");
+
+		const auto kind = data[1];
+
+		/* whitespace and comments between header fields */
+		auto skip = [&]() {
+			while (at < length) {
+				if (data[at] == '#') {
+					while (at < length && data[at] != '\n') ++at;
+				} else if (std::isspace(data[at])) {
+					++at;
+				} else {
+					break;
+				}
+			}
+		};
+
+		auto readWord = [&]() -> std::string {
+			skip();
+			auto word = std::string();
+
+			while (at < length && !std::isspace(data[at]))
+				word += char(data[at++]);
+
+			return word;
+		};
+
+		auto readNumber = [&]() -> u32 {
+			const auto word = readWord();
+
+			if (word.empty() || word.find_first_not_of("0123456789") != std::string::npos)
+				throw std::runtime_error("Bad netpbm header");
+
+			return u32(std::stoul(word));
+		};
+
+		auto maxValue = 0_u32;
+
+		if (kind == '5' || kind == '6') {
+			width = readNumber();
+			height = readNumber();
+			maxValue = readNumber();
+			channels = kind == '5' ? 1 : 3;
+
+		} else if (kind == '7') {
+			while (true) {
+				const auto key = readWord();
+
+				if (key == "ENDHDR") break;
+				else if (key == "WIDTH") width = readNumber();
+				else if (key == "HEIGHT") height = readNumber();
+				else if (key == "DEPTH") channels = readNumber();
+				else if (key == "MAXVAL") maxValue = readNumber();
+				else if (key == "TUPLTYPE") readWord();
+				else throw std::runtime_error("Bad pam header");
+			}
+
+		} else {
+			throw std::runtime_error("Only binary netpbm files are supported");
+		}
+
+		/* exactly one whitespace character before the samples */
+		++at;
+
+		if (channels < 1 || channels > 4)
+			throw std::runtime_error("Unsupported pam depth");
+
+		/* gl normalizes by the full range of the type, other maxvals would need a copy to rescale */
+		if (maxValue == 255)
+			bytesPerChannel = 1;
+		else if (maxValue == 65535)
+			bytesPerChannel = 2;
+		else
+			throw std::runtime_error("Only netpbm maxvals of 255 and 65535 are supported");
+
+		bigEndian = bytesPerChannel == 2;
+		rowBytes = size(width) * channels * bytesPerChannel;
+		pixels = data + at;
+	}
+
+	auto RawImage::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto RawImage::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto RawImage::getChannels() const -> u32 {
+		return channels;
+	}
+
+	auto RawImage::getBytesPerChannel() const -> u32 {
+		return bytesPerChannel;
+	}
+
+	auto RawImage::getRowBytes() const -> size {
+		return rowBytes;
+	}
+
+	auto RawImage::getBigEndian() const -> bool {
+		return bigEndian;
+	}
+
+	auto RawImage::getPixels() const -> const u8* {
+		return pixels;
+	}
+}
@@ -0,0 +1,55 @@
+
+#ifndef CNGE_RAW_IMAGE
+#define CNGE_RAW_IMAGE
+
+#include "types.h"
+#include "cnge/load/mappedFile.h"
+
+namespace CNGE {
+	/// an uncompressed image read in place from a mapped file
+	/// binary ppm (P6), pgm (P5), pam (P7) and the raw rgba dump format
+	/// the pixels are never copied, getPixels points into the mapping
+	class RawImage {
+	private:
+		MappedFile file;
+
+		u32 width, height;
+		u32 channels;
+		u32 bytesPerChannel;
+		size rowBytes;
+		bool bigEndian;
+
+		const u8* pixels;
+
+		auto readNetpbm() -> void;
+		auto readRawRgba() -> void;
+
+	public:
+		/// the raw rgba dump header, all little endian
+		/// 'R' 'G' 'B' 'A', u32 width, u32 height, u32 row stride in bytes (0 for packed)
+		/// followed by the rows from the top, 8 bits per channel
+		constexpr static u8 RAW_RGBA_MAGIC[4] { 'R', 'G', 'B', 'A' };
+		constexpr static size RAW_RGBA_HEADER_SIZE = 16;
+
+		explicit RawImage(const char*);
+
+		/// whether these first bytes of a file are something we can map
+		static auto isRaw(const u8*, size) -> bool;
+
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+
+		/// 1 gray, 2 gray alpha, 3 rgb, 4 rgba
+		[[nodiscard]] auto getChannels() const -> u32;
+		/// 1 or 2, netpbm files with a maxval of 65535 are 2
+		[[nodiscard]] auto getBytesPerChannel() const -> u32;
+		/// may be larger than width * channels * bytesPerChannel
+		[[nodiscard]] auto getRowBytes() const -> size;
+		/// 16 bit netpbm samples are stored most significant byte first
+		[[nodiscard]] auto getBigEndian() const -> bool;
+
+		[[nodiscard]] auto getPixels() const -> const u8*;
+	};
+}
+
+#endif
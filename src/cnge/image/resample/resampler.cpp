@@ -0,0 +1,386 @@
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include "resampler.h"
+#include "cnge/load/threadPool.h"
+#include "cnge/util/cpu.h"
+
+#if CNGE_X86
+	#include <immintrin.h>
+#endif
+
+namespace CNGE {
+	constexpr static f32 PI = 3.14159265358979f;
+
+	static auto sinc(f32 x) -> f32 {
+		if (x == 0.0f)
+			return 1.0f;
+
+		return std::sin(PI * x) / (PI * x);
+	}
+
+	/// how far the filter reaches from its center, in source pixels at a scale of 1
+	static auto getRadius(Resampler::Filter filter) -> f32 {
+		switch (filter) {
+			case Resampler::Filter::BOX: return 0.5f;
+			case Resampler::Filter::BILINEAR: return 1.0f;
+			default: return 3.0f;
+		}
+	}
+
+	static auto weigh(Resampler::Filter filter, f32 x) -> f32 {
+		switch (filter) {
+			case Resampler::Filter::BOX:
+				return x >= -0.5f && x < 0.5f ? 1.0f : 0.0f;
+
+			case Resampler::Filter::BILINEAR:
+				return std::max(1.0f - std::abs(x), 0.0f);
+
+			default:
+				return std::abs(x) < 3.0f ? sinc(x) * sinc(x / 3.0f) : 0.0f;
+		}
+	}
+
+	/* srgb to linear for every byte, and back from 4096 steps of linear, both on a 0 to 255 scale */
+	constexpr static u32 FROM_LINEAR_STEPS = 4096;
+
+	static auto getToLinear() -> const std::array<f32, 256>& {
+		static const auto table = [] {
+			auto table = std::array<f32, 256>();
+
+			for (auto i = 0; i < 256; ++i) {
+				const auto value = i / 255.0f;
+				table[i] = 255.0f * (value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f));
+			}
+
+			return table;
+		}();
+
+		return table;
+	}
+
+	static auto getFromLinear() -> const std::array<u8, FROM_LINEAR_STEPS>& {
+		static const auto table = [] {
+			auto table = std::array<u8, FROM_LINEAR_STEPS>();
+
+			for (auto i = 0_u32; i < FROM_LINEAR_STEPS; ++i) {
+				const auto value = f32(i) / (FROM_LINEAR_STEPS - 1);
+				const auto encoded = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+				table[i] = u8(std::clamp(encoded * 255.0f + 0.5f, 0.0f, 255.0f));
+			}
+
+			return table;
+		}();
+
+		return table;
+	}
+
+	/* plain passes */
+
+	static auto horizontalPass(const f32* row, f32* out, u32 width, u32 numTaps, const u32* starts, const f32* weights) -> void {
+		for (auto x = 0_u32; x < width; ++x) {
+			const auto* pixel = row + size(starts[x]) * 4;
+			const auto* pixelWeights = weights + size(x) * numTaps;
+
+			f32 sum[4] {};
+
+			for (auto t = 0_u32; t < numTaps; ++t)
+				for (auto c = 0; c < 4; ++c)
+					sum[c] += pixel[t * 4 + c] * pixelWeights[t];
+
+			for (auto c = 0; c < 4; ++c)
+				out[x * 4 + c] = sum[c];
+		}
+	}
+
+	static auto verticalPass(const f32* rows, size stride, u32 numTaps, const f32* weights, f32* out, size count) -> void {
+		for (auto i = 0_size; i < count; ++i) {
+			auto sum = 0.0f;
+
+			for (auto t = 0_u32; t < numTaps; ++t)
+				sum += rows[t * stride + i] * weights[t];
+
+			out[i] = sum;
+		}
+	}
+
+	static auto storeRow(const f32* row, u8* out, size count) -> void {
+		for (auto i = 0_size; i < count; ++i)
+			out[i] = u8(std::clamp(row[i] + 0.5f, 0.0f, 255.0f));
+	}
+
+#if CNGE_X86
+	/* avx2 passes */
+
+	CNGE_TARGET_AVX2
+	static auto horizontalPassAvx2(const f32* row, f32* out, u32 width, u32 numTaps, const u32* starts, const f32* weights) -> void {
+		for (auto x = 0_u32; x < width; ++x) {
+			const auto* pixel = row + size(starts[x]) * 4;
+			const auto* pixelWeights = weights + size(x) * numTaps;
+
+			/* two source pixels per step, each weight spread over its pixel's four channels */
+			auto sum = _mm256_setzero_ps();
+			auto t = 0_u32;
+
+			for (; t + 2 <= numTaps; t += 2) {
+				const auto pair = _mm256_set_m128(_mm_set1_ps(pixelWeights[t + 1]), _mm_set1_ps(pixelWeights[t]));
+				sum = _mm256_fmadd_ps(_mm256_loadu_ps(pixel + t * 4), pair, sum);
+			}
+
+			auto total = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+
+			if (t < numTaps)
+				total = _mm_fmadd_ps(_mm_loadu_ps(pixel + t * 4), _mm_set1_ps(pixelWeights[t]), total);
+
+			_mm_storeu_ps(out + size(x) * 4, total);
+		}
+	}
+
+	CNGE_TARGET_AVX2
+	static auto verticalPassAvx2(const f32* rows, size stride, u32 numTaps, const f32* weights, f32* out, size count) -> void {
+		auto i = 0_size;
+
+		for (; i + 8 <= count; i += 8) {
+			auto sum = _mm256_setzero_ps();
+
+			for (auto t = 0_u32; t < numTaps; ++t)
+				sum = _mm256_fmadd_ps(_mm256_loadu_ps(rows + t * stride + i), _mm256_set1_ps(weights[t]), sum);
+
+			_mm256_storeu_ps(out + i, sum);
+		}
+
+		verticalPass(rows + i, stride, numTaps, weights, out + i, count - i);
+	}
+
+	CNGE_TARGET_AVX2
+	static auto storeRowAvx2(const f32* row, u8* out, size count) -> void {
+		auto i = 0_size;
+
+		/* rounds to nearest and saturates on the way down to bytes */
+		for (; i + 16 <= count; i += 16) {
+			const auto low = _mm256_cvtps_epi32(_mm256_loadu_ps(row + i));
+			const auto high = _mm256_cvtps_epi32(_mm256_loadu_ps(row + i + 8));
+
+			const auto words = _mm256_packs_epi32(low, high);
+			const auto bytes = _mm256_packus_epi16(words, words);
+
+			/* the packs work within lanes, gather the two useful quarters together */
+			const auto ordered = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 0, 0, 0, 0));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_castsi256_si128(ordered));
+		}
+
+		storeRow(row + i, out + i, count - i);
+	}
+#endif
+
+	Resampler::Resampler(u32 sourceWidth, u32 sourceHeight, u32 width, u32 height, Filter filter, bool linear) :
+		sourceWidth(sourceWidth),
+		sourceHeight(sourceHeight),
+		width(width),
+		height(height),
+		horizontal(makeTaps(sourceWidth, width, filter)),
+		vertical(makeTaps(sourceHeight, height, filter)),
+		linear(linear)
+	{}
+
+	auto Resampler::makeTaps(u32 sourceSize, u32 size, Filter filter) -> Taps {
+		if (sourceSize == 0 || size == 0)
+			throw std::runtime_error("Can't resample an empty image");
+
+		const auto ratio = f32(sourceSize) / size;
+
+		/* shrinking stretches the filter over more source pixels so nothing is skipped */
+		const auto stretch = std::max(ratio, 1.0f);
+		const auto reach = getRadius(filter) * stretch;
+
+		/* weights for every output pixel over the source, edges clamped, before padding to the same count */
+		auto starts = std::vector<u32>(size);
+		auto counts = std::vector<u32>(size);
+		auto unpadded = std::vector<std::vector<f32>>(size);
+		auto numTaps = 1_u32;
+
+		for (auto i = 0_u32; i < size; ++i) {
+			const auto center = (i + 0.5f) * ratio - 0.5f;
+			const auto low = i32(std::floor(center - reach));
+			const auto high = i32(std::ceil(center + reach));
+
+			const auto first = u32(std::clamp(low, 0, i32(sourceSize) - 1));
+			const auto last = u32(std::clamp(high, 0, i32(sourceSize) - 1));
+
+			auto& weights = unpadded[i];
+			weights.assign(last - first + 1, 0.0f);
+
+			auto total = 0.0f;
+
+			for (auto j = low; j <= high; ++j) {
+				const auto weight = weigh(filter, (j - center) / stretch);
+
+				/* taps past the edge fall on the edge pixel */
+				weights[u32(std::clamp(j, i32(first), i32(last))) - first] += weight;
+				total += weight;
+			}
+
+			if (total != 0.0f)
+				for (auto& weight : weights)
+					weight /= total;
+
+			/* trim the zero weights off both ends */
+			auto begin = 0_u32, end = u32(weights.size());
+			while (end - begin > 1 && weights[begin] == 0.0f) ++begin;
+			while (end - begin > 1 && weights[end - 1] == 0.0f) --end;
+
+			weights = std::vector<f32>(weights.begin() + begin, weights.begin() + end);
+
+			starts[i] = first + begin;
+			counts[i] = end - begin;
+			numTaps = std::max(numTaps, counts[i]);
+		}
+
+		auto taps = Taps { numTaps, std::vector<u32>(size), std::vector<f32>(size_t(size) * numTaps, 0.0f) };
+
+		for (auto i = 0_u32; i < size; ++i) {
+			/* move the start back near the end so every tap stays inside the source */
+			const auto start = std::min(starts[i], sourceSize - numTaps);
+			const auto offset = starts[i] - start;
+
+			taps.starts[i] = start;
+			std::copy(unpadded[i].begin(), unpadded[i].end(), taps.weights.begin() + ptrdiff_t(size_t(i) * numTaps + offset));
+		}
+
+		return taps;
+	}
+
+	auto Resampler::parseFilter(const std::string& name) -> Filter {
+		if (name == "box") return Filter::BOX;
+		if (name == "bilinear") return Filter::BILINEAR;
+		if (name == "lanczos3") return Filter::LANCZOS3;
+
+		throw std::runtime_error("Unknown filter " + name);
+	}
+
+	auto Resampler::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto Resampler::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto Resampler::runBand(const u8* sourceRows, u32 firstSourceRow, u8* destination, u32 top, u32 bottom) const -> void {
+		const auto avx2 = Cpu::hasAvx2();
+
+		/* only the source rows this band's filters land on */
+		auto sourceTop = 0_u32, sourceBottom = 0_u32;
+		getSourceRows(top, bottom, sourceTop, sourceBottom);
+
+		const auto stride = size(width) * 4;
+
+		auto sourceRow = std::vector<f32>(size(sourceWidth) * 4);
+		auto between = std::vector<f32>((sourceBottom - sourceTop) * stride);
+		auto outRow = std::vector<f32>(stride);
+
+		const auto& toLinear = getToLinear();
+		const auto& fromLinear = getFromLinear();
+
+		for (auto y = sourceTop; y < sourceBottom; ++y) {
+			const auto* row = sourceRows + size(y - firstSourceRow) * sourceWidth * 4;
+
+			if (linear) {
+				for (auto i = 0_size; i < sourceRow.size(); i += 4) {
+					sourceRow[i] = toLinear[row[i]];
+					sourceRow[i + 1] = toLinear[row[i + 1]];
+					sourceRow[i + 2] = toLinear[row[i + 2]];
+					sourceRow[i + 3] = row[i + 3];
+				}
+
+			} else {
+				for (auto i = 0_size; i < sourceRow.size(); ++i)
+					sourceRow[i] = row[i];
+			}
+
+			auto* out = between.data() + (y - sourceTop) * stride;
+
+		#if CNGE_X86
+			if (avx2) {
+				horizontalPassAvx2(sourceRow.data(), out, width, horizontal.numTaps, horizontal.starts.data(), horizontal.weights.data());
+				continue;
+			}
+		#endif
+
+			horizontalPass(sourceRow.data(), out, width, horizontal.numTaps, horizontal.starts.data(), horizontal.weights.data());
+		}
+
+		for (auto y = top; y < bottom; ++y) {
+			const auto* rows = between.data() + (vertical.starts[y] - sourceTop) * stride;
+			const auto* weights = vertical.weights.data() + size(y) * vertical.numTaps;
+			auto* out = destination + size(y - top) * stride;
+
+		#if CNGE_X86
+			if (avx2)
+				verticalPassAvx2(rows, stride, vertical.numTaps, weights, outRow.data(), stride);
+			else
+		#endif
+				verticalPass(rows, stride, vertical.numTaps, weights, outRow.data(), stride);
+
+			if (linear) {
+				for (auto i = 0_size; i < stride; i += 4) {
+					for (auto c = 0; c < 3; ++c)
+						out[i + c] = fromLinear[u32(std::clamp(outRow[i + c] * ((FROM_LINEAR_STEPS - 1) / 255.0f) + 0.5f, 0.0f, f32(FROM_LINEAR_STEPS - 1)))];
+
+					out[i + 3] = u8(std::clamp(outRow[i + 3] + 0.5f, 0.0f, 255.0f));
+				}
+
+				continue;
+			}
+
+		#if CNGE_X86
+			if (avx2) {
+				storeRowAvx2(outRow.data(), out, stride);
+				continue;
+			}
+		#endif
+
+			storeRow(outRow.data(), out, stride);
+		}
+	}
+
+	auto Resampler::run(const u8* source, u8* destination, u32 threads) const -> void {
+		const auto numBands = (height + BAND_ROWS - 1) / BAND_ROWS;
+
+		if (threads == 1 || numBands == 1) {
+			for (auto band = 0_u32; band < numBands; ++band)
+				runBand(source, 0, destination + size(band) * BAND_ROWS * width * 4, band * BAND_ROWS, std::min((band + 1) * BAND_ROWS, height));
+
+			return;
+		}
+
+		/* the pool waits for every band before it goes */
+		auto workers = ThreadPool(threads);
+
+		for (auto band = 0_u32; band < numBands; ++band)
+			workers.push([this, source, destination, band] {
+				runBand(source, 0, destination + size(band) * BAND_ROWS * width * 4, band * BAND_ROWS, std::min((band + 1) * BAND_ROWS, height));
+			});
+	}
+
+	auto Resampler::run(Image1D& source, u8* destination, u32 threads) const -> void {
+		if (u32(source.getWidth()) != sourceWidth || u32(source.getHeight()) != sourceHeight)
+			throw std::runtime_error("Image is not the size the resampler was made for");
+
+		run(source.getPixels(), destination, threads);
+	}
+
+	auto Resampler::getSourceRows(u32 top, u32 bottom, u32& first, u32& end) const -> void {
+		first = vertical.starts[top];
+		end = vertical.starts[bottom - 1] + vertical.numTaps;
+	}
+
+	auto Resampler::runRows(const u8* sourceRows, u32 first, u8* destination, u32 top, u32 bottom) const -> void {
+		runBand(sourceRows, first, destination, top, bottom);
+	}
+}
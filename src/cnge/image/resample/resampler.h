@@ -0,0 +1,79 @@
+
+#ifndef CNGE_RESAMPLER
+#define CNGE_RESAMPLER
+
+#include <string>
+#include <vector>
+
+#include "types.h"
+#include "cnge/image/image.h"
+
+namespace CNGE {
+	/// scales rgba8 images with a separable filter, rows first then columns
+	/// the filter weights depend only on the sizes, so one resampler can be run over many images
+	/// output rows are made in bands, each band filtering just the source rows under it,
+	/// so bands can go to separate threads and the scratch memory stays small
+	/// both passes use avx2 when the processor has it
+	class Resampler {
+	public:
+		enum class Filter {
+			BOX,
+			BILINEAR,
+			LANCZOS3,
+		};
+
+	private:
+		/// the same number of taps for every output pixel along one axis, padded with zero weights
+		struct Taps {
+			u32 numTaps;
+			/// first source pixel of each output pixel
+			std::vector<u32> starts;
+			/// numTaps weights per output pixel, each set summing to 1
+			std::vector<f32> weights;
+		};
+
+		u32 sourceWidth, sourceHeight;
+		u32 width, height;
+
+		Taps horizontal;
+		Taps vertical;
+
+		/// filter in linear light instead of on the srgb values
+		bool linear;
+
+		static auto makeTaps(u32 sourceSize, u32 size, Filter) -> Taps;
+
+		auto runBand(const u8* sourceRows, u32 firstSourceRow, u8* destination, u32 top, u32 bottom) const -> void;
+
+	public:
+		/// rows of output made together, per thread
+		constexpr static u32 BAND_ROWS = 64;
+
+		/// linear converts the color channels out of srgb before filtering and back after,
+		/// which keeps bright detail from darkening when shrunk, alpha is always filtered as is
+		Resampler(u32 sourceWidth, u32 sourceHeight, u32 width, u32 height, Filter = Filter::LANCZOS3, bool linear = false);
+
+		/// "box", "bilinear" or "lanczos3", throws on anything else
+		static auto parseFilter(const std::string&) -> Filter;
+
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+
+		/// tightly packed rgba8 rows from the top, into a width * height * 4 destination
+		/// 0 threads means one per hardware thread
+		auto run(const u8* source, u8* destination, u32 threads = 1) const -> void;
+
+		/// the image must be the source size
+		auto run(Image1D& source, u8* destination, u32 threads = 1) const -> void;
+
+		/// the source rows first to end that output rows top to bottom are made from
+		/// both only move down as the output rows do
+		auto getSourceRows(u32 top, u32 bottom, u32& first, u32& end) const -> void;
+
+		/// makes output rows top to bottom into destination, which starts at row top,
+		/// from just the source rows getSourceRows asks for, which start at row first
+		auto runRows(const u8* sourceRows, u32 first, u8* destination, u32 top, u32 bottom) const -> void;
+	};
+}
+
+#endif
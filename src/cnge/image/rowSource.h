@@ -0,0 +1,32 @@
+
+#ifndef CNGE_ROW_SOURCE
+#define CNGE_ROW_SOURCE
+
+#include <vector>
+
+#include "types.h"
+
+namespace CNGE {
+	/// an image read from the top a few rows at a time, never held whole
+	/// unlike a tile source it only goes forward, and only from one thread
+	class RowSource {
+	public:
+		virtual ~RowSource() = default;
+
+		[[nodiscard]] virtual auto getWidth() const -> u32 = 0;
+		[[nodiscard]] virtual auto getHeight() const -> u32 = 0;
+
+		/// the next rows as rgba8, only the columns from left to left + width, packed together
+		virtual auto readRows(u32 count, u32 left, u32 width, u8* pixels) -> void = 0;
+
+		/// goes past rows without keeping them, sources that can skip cheaply override this
+		virtual auto skipRows(u32 count) -> void {
+			auto row = std::vector<u8>(size(getWidth()) * 4);
+
+			for (auto i = 0_u32; i < count; ++i)
+				readRows(1, 0, getWidth(), row.data());
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,78 @@
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <stdexcept>
+
+#include "imageSequence.h"
+
+namespace CNGE {
+	ImageSequence::ImageSequence(const std::string& path) : paths() {
+		const auto filePath = std::filesystem::path(path);
+
+		if (!std::filesystem::exists(filePath))
+			throw std::runtime_error("File not found");
+
+		/* split the file name into prefix, number, suffix */
+		/* around the last run of digits in the stem */
+		const auto stem = filePath.stem().string();
+		const auto extension = filePath.extension().string();
+
+		auto digitsEnd = stem.size();
+		while (digitsEnd > 0 && !std::isdigit(u8(stem[digitsEnd - 1])))
+			--digitsEnd;
+
+		auto digitsStart = digitsEnd;
+		while (digitsStart > 0 && std::isdigit(u8(stem[digitsStart - 1])))
+			--digitsStart;
+
+		/* not a numbered file, the clip is just this one frame */
+		if (digitsStart == digitsEnd) {
+			paths.push_back(path);
+			return;
+		}
+
+		const auto prefix = stem.substr(0, digitsStart);
+		const auto suffix = stem.substr(digitsEnd) + extension;
+
+		auto directory = filePath.parent_path();
+		if (directory.empty())
+			directory = ".";
+
+		auto numbered = std::vector<std::pair<u64, std::string>>();
+
+		for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+			if (!entry.is_regular_file())
+				continue;
+
+			const auto name = entry.path().filename().string();
+
+			if (name.size() <= prefix.size() + suffix.size())
+				continue;
+
+			if (name.compare(0, prefix.size(), prefix) != 0 || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0)
+				continue;
+
+			const auto number = name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+
+			if (!std::all_of(number.begin(), number.end(), [](char c) { return std::isdigit(u8(c)) != 0; }))
+				continue;
+
+			numbered.emplace_back(std::stoull(number), entry.path().string());
+		}
+
+		std::sort(numbered.begin(), numbered.end());
+
+		paths.reserve(numbered.size());
+		for (auto& [number, framePath] : numbered)
+			paths.push_back(std::move(framePath));
+	}
+
+	auto ImageSequence::getNumFrames() const -> u32 {
+		return u32(paths.size());
+	}
+
+	auto ImageSequence::getPath(u32 frame) const -> const std::string& {
+		return paths[frame];
+	}
+}
@@ -0,0 +1,28 @@
+
+#ifndef CNGE_IMAGE_SEQUENCE
+#define CNGE_IMAGE_SEQUENCE
+
+#include <string>
+#include <vector>
+
+#include "types.h"
+
+namespace CNGE {
+	/// a numbered run of files on disk treated as one clip
+	/// frame_0001.png, frame_0002.png ... are found from any one of them
+	class ImageSequence {
+	private:
+		std::vector<std::string> paths;
+
+	public:
+		/// finds every file next to this one that shares its
+		/// prefix and suffix around the last run of digits
+		explicit ImageSequence(const std::string&);
+
+		[[nodiscard]] auto getNumFrames() const -> u32;
+
+		[[nodiscard]] auto getPath(u32) const -> const std::string&;
+	};
+}
+
+#endif
@@ -0,0 +1,176 @@
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "sequencePlayer.h"
+
+namespace CNGE {
+	constexpr static u64 BILLION = 1000000000;
+
+	SequencePlayer::SequencePlayer(const std::string& path, u32 fps, u32 numSlots, u32 numDecoders) :
+		sequence(path),
+		fps(fps),
+		width(0),
+		height(0),
+		numSlots(std::max(1_u32, std::min(numSlots, sequence.getNumFrames()))),
+		slots(),
+		clock(0),
+		tick(0),
+		shownTick(-1),
+		started(false),
+		paused(false),
+		droppedDecode(0),
+		droppedPacing(0),
+		decoders(numDecoders)
+	{
+		if (sequence.getNumFrames() == 0)
+			throw std::runtime_error("Sequence has no frames");
+
+		if (fps == 0)
+			throw std::runtime_error("Sequence frame rate must be greater than 0");
+
+		slots = std::make_unique<Slot[]>(this->numSlots);
+
+		/* the first frame decides the size of the whole clip */
+		auto& first = getSlot(0);
+		first.image = std::make_unique<Image1D>(sequence.getPath(0).c_str());
+		first.tick = 0;
+		first.state = SLOT_READY;
+
+		width = first.image->getWidth();
+		height = first.image->getHeight();
+
+		schedule();
+	}
+
+	auto SequencePlayer::getSlot(u64 tick) -> Slot& {
+		return slots[tick % numSlots];
+	}
+
+	auto SequencePlayer::schedule() -> void {
+		const auto numFrames = sequence.getNumFrames();
+
+		for (auto i = 0_u32; i < numSlots; ++i) {
+			const auto slotTick = tick + i;
+			auto& slot = getSlot(slotTick);
+
+			/* already there or on its way */
+			if (slot.tick == i64(slotTick))
+				continue;
+
+			/* still busy with a frame we passed, pick it up next update */
+			if (slot.state.load(std::memory_order_acquire) == SLOT_DECODING)
+				continue;
+
+			slot.tick = slotTick;
+			slot.image = nullptr;
+			slot.state.store(SLOT_DECODING, std::memory_order_release);
+
+			const auto& framePath = sequence.getPath(u32(slotTick % numFrames));
+
+			decoders.push([this, &slot, &framePath] {
+				try {
+					auto image = std::make_unique<Image1D>(framePath.c_str());
+
+					/* every frame has to fit the same texture */
+					if (image->getWidth() != width || image->getHeight() != height) {
+						slot.state.store(SLOT_FAILED, std::memory_order_release);
+						return;
+					}
+
+					slot.image = std::move(image);
+					slot.state.store(SLOT_READY, std::memory_order_release);
+
+				} catch (std::exception&) {
+					slot.state.store(SLOT_FAILED, std::memory_order_release);
+				}
+			});
+		}
+	}
+
+	auto SequencePlayer::update(u64 delta) -> Image1D* {
+		/* the clock starts on the first update, not at construction */
+		if (started && !paused && sequence.getNumFrames() > 1) {
+			clock += delta;
+
+			const auto target = clock * fps / BILLION;
+
+			if (target > tick) {
+				/* the frame we are leaving never made it to the screen */
+				if (shownTick != i64(tick))
+					++droppedDecode;
+
+				/* frames that were due entirely between two updates */
+				droppedPacing += u32(target - tick - 1);
+
+				tick = target;
+			}
+		}
+
+		started = true;
+
+		schedule();
+
+		auto& slot = getSlot(tick);
+
+		if (shownTick != i64(tick) && slot.tick == i64(tick) && slot.state.load(std::memory_order_acquire) == SLOT_READY) {
+			shownTick = i64(tick);
+			return slot.image.get();
+		}
+
+		return nullptr;
+	}
+
+	auto SequencePlayer::setPaused(bool paused) -> void {
+		this->paused = paused;
+	}
+
+	auto SequencePlayer::step(i32 frames) -> void {
+		const auto numFrames = i64(sequence.getNumFrames());
+
+		/* ticks never go backwards, so a step back wraps forward around the clip */
+		auto offset = frames % numFrames;
+		if (offset < 0)
+			offset += numFrames;
+
+		tick += u64(offset);
+		clock = tick * BILLION / fps;
+	}
+
+	auto SequencePlayer::getPaused() const -> bool {
+		return paused;
+	}
+
+	auto SequencePlayer::getWidth() const -> i32 {
+		return width;
+	}
+
+	auto SequencePlayer::getHeight() const -> i32 {
+		return height;
+	}
+
+	auto SequencePlayer::getFPS() const -> u32 {
+		return fps;
+	}
+
+	auto SequencePlayer::getNumFrames() const -> u32 {
+		return sequence.getNumFrames();
+	}
+
+	auto SequencePlayer::getPlayhead() const -> u32 {
+		return u32(tick % sequence.getNumFrames());
+	}
+
+	auto SequencePlayer::getDroppedDecode() const -> u32 {
+		return droppedDecode;
+	}
+
+	auto SequencePlayer::getDroppedPacing() const -> u32 {
+		return droppedPacing;
+	}
+
+	SequencePlayer::~SequencePlayer() {
+		/* don't start any more frames, the pool joins on the ones in flight */
+		decoders.clear();
+	}
+}
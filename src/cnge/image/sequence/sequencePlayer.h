@@ -0,0 +1,89 @@
+
+#ifndef CNGE_SEQUENCE_PLAYER
+#define CNGE_SEQUENCE_PLAYER
+
+#include <atomic>
+#include <memory>
+
+#include "types.h"
+#include "cnge/image/image.h"
+#include "cnge/load/threadPool.h"
+#include "imageSequence.h"
+
+namespace CNGE {
+	/// plays an image sequence at a fixed frame rate
+	/// a pool of decode threads keeps a ring of frames ready ahead of the playhead
+	class SequencePlayer {
+	private:
+		constexpr static i32
+			SLOT_EMPTY = 0,
+			SLOT_DECODING = 1,
+			SLOT_READY = 2,
+			SLOT_FAILED = 3;
+
+		struct Slot {
+			i64 tick = -1;
+			std::atomic<i32> state = SLOT_EMPTY;
+			std::unique_ptr<Image1D> image;
+		};
+
+		ImageSequence sequence;
+
+		u32 fps;
+		i32 width, height;
+
+		/* one slot per frame we are allowed to be ahead */
+		u32 numSlots;
+		std::unique_ptr<Slot[]> slots;
+
+		/* time since the start of the clip */
+		/* ticks count frames without wrapping so the ring never collides */
+		u64 clock;
+		u64 tick;
+		i64 shownTick;
+		bool started;
+		bool paused;
+
+		u32 droppedDecode;
+		u32 droppedPacing;
+
+		/* declared last so it joins before the slots go away */
+		ThreadPool decoders;
+
+		auto getSlot(u64) -> Slot&;
+
+		/// queues decodes for every frame in the ring that isn't already there
+		auto schedule() -> void;
+
+	public:
+		/// decodes the first frame on the calling thread to learn the clip size
+		SequencePlayer(const std::string&, u32 fps, u32 numSlots = 8, u32 numDecoders = 0);
+
+		/* no copying the player */
+		SequencePlayer(const SequencePlayer&) = delete;
+		auto operator=(const SequencePlayer&) -> void = delete;
+
+		/// advances the playhead by delta nanoseconds
+		/// returns the frame to upload if it changed this update, otherwise nullptr
+		auto update(u64 delta) -> Image1D*;
+
+		auto setPaused(bool) -> void;
+		auto step(i32) -> void;
+
+		[[nodiscard]] auto getPaused() const -> bool;
+		[[nodiscard]] auto getWidth() const -> i32;
+		[[nodiscard]] auto getHeight() const -> i32;
+		[[nodiscard]] auto getFPS() const -> u32;
+		[[nodiscard]] auto getNumFrames() const -> u32;
+		[[nodiscard]] auto getPlayhead() const -> u32;
+
+		/// frames whose time came while their decode was not finished
+		[[nodiscard]] auto getDroppedDecode() const -> u32;
+		/// frames that were skipped because an update came too late for them
+		[[nodiscard]] auto getDroppedPacing() const -> u32;
+
+		~SequencePlayer();
+	};
+}
+
+#endif
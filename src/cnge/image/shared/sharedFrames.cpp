@@ -0,0 +1,277 @@
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <climits>
+#include <new>
+#include <stdexcept>
+
+#include "sharedFrames.h"
+
+namespace CNGE {
+	/* slots start on their own page */
+	constexpr static size HEADER_SIZE = 4096;
+
+	/*
+	 * region
+	 */
+
+#ifdef _WIN32
+	SharedRegion::SharedRegion(const std::string& name, size length) : name("Local\\" + name), owner(true), data(nullptr), length(length), mapping(nullptr), semaphore(nullptr) {
+		mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(u64(length) >> 32), DWORD(length), this->name.c_str());
+
+		if (mapping == nullptr)
+			throw std::runtime_error("Could not create shared memory");
+
+		data = static_cast<u8*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, length));
+		semaphore = CreateSemaphoreA(nullptr, 0, LONG_MAX, (this->name + ".ready").c_str());
+
+		if (data == nullptr || semaphore == nullptr)
+			throw std::runtime_error("Could not create shared memory");
+	}
+
+	SharedRegion::SharedRegion(const std::string& name) : name("Local\\" + name), owner(false), data(nullptr), length(0), mapping(nullptr), semaphore(nullptr) {
+		mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, this->name.c_str());
+
+		if (mapping == nullptr)
+			throw std::runtime_error("No shared memory named " + name);
+
+		data = static_cast<u8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		semaphore = OpenSemaphoreA(SYNCHRONIZE | SEMAPHORE_MODIFY_STATE, FALSE, (this->name + ".ready").c_str());
+
+		if (data == nullptr || semaphore == nullptr)
+			throw std::runtime_error("Could not open shared memory");
+
+		auto info = MEMORY_BASIC_INFORMATION();
+		VirtualQuery(data, &info, sizeof(info));
+		length = info.RegionSize;
+	}
+
+	auto SharedRegion::post() -> void {
+		ReleaseSemaphore(semaphore, 1, nullptr);
+	}
+
+	auto SharedRegion::drain() -> bool {
+		auto any = false;
+
+		while (WaitForSingleObject(semaphore, 0) == WAIT_OBJECT_0)
+			any = true;
+
+		return any;
+	}
+
+	SharedRegion::~SharedRegion() {
+		if (data != nullptr) UnmapViewOfFile(data);
+		if (mapping != nullptr) CloseHandle(mapping);
+		if (semaphore != nullptr) CloseHandle(semaphore);
+	}
+#else
+	SharedRegion::SharedRegion(const std::string& name, size length) : name("/" + name), owner(true), data(nullptr), length(length), mapping(nullptr), semaphore(nullptr) {
+		const auto descriptor = shm_open(this->name.c_str(), O_CREAT | O_RDWR, 0600);
+
+		if (descriptor == -1 || ftruncate(descriptor, off_t(length)) == -1)
+			throw std::runtime_error("Could not create shared memory");
+
+		mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+		close(descriptor);
+
+		/* a leftover semaphore from a crashed producer would hold stale posts */
+		sem_unlink((this->name + ".ready").c_str());
+		semaphore = sem_open((this->name + ".ready").c_str(), O_CREAT, 0600, 0);
+
+		if (mapping == MAP_FAILED || semaphore == SEM_FAILED)
+			throw std::runtime_error("Could not create shared memory");
+
+		data = static_cast<u8*>(mapping);
+	}
+
+	SharedRegion::SharedRegion(const std::string& name) : name("/" + name), owner(false), data(nullptr), length(0), mapping(nullptr), semaphore(nullptr) {
+		const auto descriptor = shm_open(this->name.c_str(), O_RDONLY, 0);
+
+		if (descriptor == -1)
+			throw std::runtime_error("No shared memory named " + name);
+
+		struct stat status {};
+		fstat(descriptor, &status);
+		length = size(status.st_size);
+
+		mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, descriptor, 0);
+		close(descriptor);
+
+		semaphore = sem_open((this->name + ".ready").c_str(), 0);
+
+		if (mapping == MAP_FAILED || semaphore == SEM_FAILED)
+			throw std::runtime_error("Could not open shared memory");
+
+		data = static_cast<u8*>(mapping);
+	}
+
+	auto SharedRegion::post() -> void {
+		sem_post(static_cast<sem_t*>(semaphore));
+	}
+
+	auto SharedRegion::drain() -> bool {
+		auto any = false;
+
+		while (sem_trywait(static_cast<sem_t*>(semaphore)) == 0)
+			any = true;
+
+		return any;
+	}
+
+	SharedRegion::~SharedRegion() {
+		if (data != nullptr) munmap(data, length);
+		if (semaphore != nullptr && semaphore != SEM_FAILED) sem_close(static_cast<sem_t*>(semaphore));
+
+		if (owner) {
+			shm_unlink(name.c_str());
+			sem_unlink((name + ".ready").c_str());
+		}
+	}
+#endif
+
+	auto SharedRegion::getData() const -> u8* {
+		return data;
+	}
+
+	auto SharedRegion::getSize() const -> size {
+		return length;
+	}
+
+	/*
+	 * writer
+	 */
+
+	SharedFrameWriter::SharedFrameWriter(const std::string& name, u32 width, u32 height, u32 numSlots) :
+		region(name, HEADER_SIZE + size(width) * height * 4 * numSlots),
+		header(nullptr),
+		writing(0)
+	{
+		if (numSlots < 2 || numSlots > SharedFrameHeader::MAX_SLOTS)
+			throw std::runtime_error("Shared frames need between 2 and 8 slots");
+
+		header = new (region.getData()) SharedFrameHeader {
+			SharedFrameHeader::MAGIC, SharedFrameHeader::VERSION,
+			width, height, numSlots, u32(HEADER_SIZE), size(width) * height * 4,
+			{}, {}
+		};
+	}
+
+	auto SharedFrameWriter::begin() -> u8* {
+		writing = header->latest.load(std::memory_order_relaxed) + 1;
+
+		const auto slot = u32((writing - 1) % header->numSlots);
+
+		/* odd while being written */
+		header->slotSequence[slot].store(writing * 2 - 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		return region.getData() + header->headerSize + header->slotSize * slot;
+	}
+
+	auto SharedFrameWriter::end() -> void {
+		const auto slot = u32((writing - 1) % header->numSlots);
+
+		header->slotSequence[slot].store(writing * 2, std::memory_order_release);
+		header->latest.store(writing, std::memory_order_release);
+
+		region.post();
+	}
+
+	/*
+	 * reader
+	 */
+
+	SharedFrameReader::SharedFrameReader(const std::string& name) :
+		region(name),
+		header(reinterpret_cast<const SharedFrameHeader*>(region.getData())),
+		width(0), height(0),
+		numSlots(0),
+		headerSize(0),
+		slotSize(0),
+		lastRead(0),
+		readingSlot(0),
+		readingSequence(0),
+		dropped(0),
+		torn(0)
+	{
+		if (region.getSize() < sizeof(SharedFrameHeader) || header->magic != SharedFrameHeader::MAGIC || header->version != SharedFrameHeader::VERSION)
+			throw std::runtime_error("Shared memory is not a frame ring");
+
+		width = header->width;
+		height = header->height;
+		numSlots = header->numSlots;
+		headerSize = header->headerSize;
+		slotSize = header->slotSize;
+
+		if (numSlots < 2 || numSlots > SharedFrameHeader::MAX_SLOTS)
+			throw std::runtime_error("Shared frame ring has a bad slot count");
+
+		/* every frame is copied out whole, so a slot has to hold one */
+		if (width == 0 || height == 0 || size(width) * height > slotSize / 4)
+			throw std::runtime_error("Shared frame slots are smaller than a frame");
+
+		/* divided rather than multiplied so nothing the producer wrote can wrap it */
+		if (headerSize < sizeof(SharedFrameHeader) || headerSize > region.getSize() || slotSize > (region.getSize() - headerSize) / numSlots)
+			throw std::runtime_error("Shared frame ring is bigger than its memory");
+	}
+
+	auto SharedFrameReader::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto SharedFrameReader::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto SharedFrameReader::acquire() -> const u8* {
+		/* the semaphore only wakes us, the header says what is newest */
+		region.drain();
+
+		const auto latest = header->latest.load(std::memory_order_acquire);
+
+		if (latest == lastRead)
+			return nullptr;
+
+		if (lastRead != 0 && latest > lastRead + 1)
+			dropped += latest - lastRead - 1;
+
+		lastRead = latest;
+		readingSlot = u32((latest - 1) % numSlots);
+		readingSequence = header->slotSequence[readingSlot].load(std::memory_order_acquire);
+
+		/* already being written over again */
+		if (readingSequence != latest * 2) {
+			++torn;
+			return nullptr;
+		}
+
+		return region.getData() + headerSize + slotSize * readingSlot;
+	}
+
+	auto SharedFrameReader::release() -> bool {
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (header->slotSequence[readingSlot].load(std::memory_order_relaxed) != readingSequence) {
+			++torn;
+			return false;
+		}
+
+		return true;
+	}
+
+	auto SharedFrameReader::getDropped() const -> u64 {
+		return dropped;
+	}
+
+	auto SharedFrameReader::getTorn() const -> u64 {
+		return torn;
+	}
+}
@@ -0,0 +1,123 @@
+
+#ifndef CNGE_SHARED_FRAMES
+#define CNGE_SHARED_FRAMES
+
+#include <atomic>
+#include <string>
+
+#include "types.h"
+
+namespace CNGE {
+	/// the start of a shared frame ring, written by the producer
+	/// frames are rgba8, rows from the top, each slot starts at headerSize + slot * slotSize
+	/// a slot's sequence is odd while the producer writes it and even once it's done,
+	/// so a reader can tell when its frame was overwritten under it
+	struct SharedFrameHeader {
+		constexpr static u32 MAGIC = 0x46534245; // EBSF
+		constexpr static u32 VERSION = 1;
+		constexpr static u32 MAX_SLOTS = 8;
+
+		u32 magic;
+		u32 version;
+		u32 width;
+		u32 height;
+		u32 numSlots;
+		u32 headerSize;
+		u64 slotSize;
+
+		/// how many frames have been finished, the newest is in slot (latest - 1) % numSlots
+		std::atomic<u64> latest;
+		std::atomic<u64> slotSequence[MAX_SLOTS];
+	};
+
+	static_assert(std::atomic<u64>::is_always_lock_free, "shared frame atomics have to work across processes");
+
+	/// a named shared memory block and the semaphore posted for every new frame
+	/// windows uses a named file mapping and semaphore, elsewhere posix shm_open and sem_open
+	class SharedRegion {
+	private:
+		std::string name;
+		bool owner;
+
+		u8* data;
+		size length;
+
+		void* mapping;
+		void* semaphore;
+
+	public:
+		/// creates the region, it goes away with its creator
+		SharedRegion(const std::string&, size);
+		/// opens a region another process created, read only
+		explicit SharedRegion(const std::string&);
+
+		SharedRegion(const SharedRegion&) = delete;
+		auto operator=(const SharedRegion&) -> void = delete;
+
+		[[nodiscard]] auto getData() const -> u8*;
+		[[nodiscard]] auto getSize() const -> size;
+
+		auto post() -> void;
+		/// takes every pending post without waiting, returns whether there were any
+		auto drain() -> bool;
+
+		~SharedRegion();
+	};
+
+	/// the producer side, for renderers that want to show frames in the viewer
+	class SharedFrameWriter {
+	private:
+		SharedRegion region;
+		SharedFrameHeader* header;
+
+		u64 writing;
+
+	public:
+		SharedFrameWriter(const std::string& name, u32 width, u32 height, u32 numSlots = 3);
+
+		/// the slot to write the next frame into
+		auto begin() -> u8*;
+		/// publishes the frame from begin
+		auto end() -> void;
+	};
+
+	/// the viewer side, reads frames in place in the shared memory
+	class SharedFrameReader {
+	private:
+		SharedRegion region;
+		const SharedFrameHeader* header;
+
+		/* the layout, copied once it checks out so the producer can't change it under us */
+		u32 width, height;
+		u32 numSlots;
+		size headerSize;
+		size slotSize;
+
+		u64 lastRead;
+		u32 readingSlot;
+		u64 readingSequence;
+
+		u64 dropped;
+		u64 torn;
+
+	public:
+		/// throws if the header doesn't describe a ring that fits in the memory
+		explicit SharedFrameReader(const std::string& name);
+
+		[[nodiscard]] auto getWidth() const -> u32;
+		[[nodiscard]] auto getHeight() const -> u32;
+
+		/// the newest finished frame if there is one that hasn't been read yet, nullptr otherwise
+		/// the pixels are only good until release
+		auto acquire() -> const u8*;
+		/// returns false if the producer wrote over the frame while it was being read
+		auto release() -> bool;
+
+		/// frames finished by the producer that were never acquired
+		[[nodiscard]] auto getDropped() const -> u64;
+		/// acquired frames that were overwritten while being read
+		[[nodiscard]] auto getTorn() const -> u64;
+	};
+}
+
+#endif
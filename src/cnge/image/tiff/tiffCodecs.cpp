@@ -0,0 +1,202 @@
+
+#include <csetjmp>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <zlib.h>
+#include <jpeglib.h>
+
+#include "tiffCodecs.h"
+
+namespace CNGE::TiffCodecs {
+	auto lzwDecode(const u8* input, size inputSize, u8* output, size outputSize) -> void {
+		constexpr u32 CLEAR = 256, END = 257, FIRST = 258, MAX_CODES = 4096;
+
+		/* every code is a previous code plus one byte */
+		u16 prefix[MAX_CODES];
+		u8 suffix[MAX_CODES];
+		u16 length[MAX_CODES];
+		u8 first[MAX_CODES];
+
+		for (auto i = 0_u32; i < 256; ++i) {
+			prefix[i] = 0;
+			suffix[i] = u8(i);
+			length[i] = 1;
+			first[i] = u8(i);
+		}
+
+		auto nextCode = FIRST;
+		auto codeWidth = 9_u32;
+		auto previous = -1_i32;
+
+		auto bitBuffer = 0_u32;
+		auto bitCount = 0_u32;
+		auto inputIndex = 0_size;
+		auto outputIndex = 0_size;
+
+		while (outputIndex < outputSize) {
+			/* pull in enough bits for the next code */
+			while (bitCount < codeWidth) {
+				if (inputIndex == inputSize)
+					return;
+
+				bitBuffer = (bitBuffer << 8) | input[inputIndex++];
+				bitCount += 8;
+			}
+
+			const auto code = (bitBuffer >> (bitCount - codeWidth)) & ((1 << codeWidth) - 1);
+			bitCount -= codeWidth;
+
+			if (code == END)
+				return;
+
+			if (code == CLEAR) {
+				nextCode = FIRST;
+				codeWidth = 9;
+				previous = -1;
+				continue;
+			}
+
+			if (code > nextCode || (code == nextCode && previous == -1))
+				throw std::runtime_error("Corrupt LZW data");
+
+			/* add the new string before writing, the KwKwK case needs it */
+			if (previous != -1 && nextCode < MAX_CODES) {
+				prefix[nextCode] = u16(previous);
+				length[nextCode] = length[previous] + 1;
+				first[nextCode] = first[previous];
+				suffix[nextCode] = (code == nextCode) ? first[previous] : first[code];
+				++nextCode;
+			}
+
+			/* strings are stored backwards, write them from the end */
+			const auto stringLength = length[code];
+			auto writeEnd = outputIndex + stringLength;
+			auto walk = code;
+
+			for (auto i = stringLength; i > 0; --i) {
+				if (outputIndex + i - 1 < outputSize)
+					output[outputIndex + i - 1] = suffix[walk];
+
+				walk = prefix[walk];
+			}
+
+			outputIndex = writeEnd;
+			previous = i32(code);
+
+			/* tiff grows the code one code early */
+			if (nextCode + 1 >= (1_u32 << codeWidth) && codeWidth < 12)
+				++codeWidth;
+		}
+	}
+
+	auto inflate(const u8* input, size inputSize, u8* output, size outputSize) -> void {
+		auto stream = z_stream();
+		std::memset(&stream, 0, sizeof(stream));
+
+		if (inflateInit(&stream) != Z_OK)
+			throw std::runtime_error("Could not start inflate");
+
+		stream.next_in = const_cast<u8*>(input);
+		stream.avail_in = uInt(inputSize);
+		stream.next_out = output;
+		stream.avail_out = uInt(outputSize);
+
+		const auto result = ::inflate(&stream, Z_FINISH);
+
+		inflateEnd(&stream);
+
+		/* a short stream still gives us the rows it had */
+		if (result != Z_STREAM_END && result != Z_OK && result != Z_BUF_ERROR)
+			throw std::runtime_error("Corrupt deflate data");
+	}
+
+	struct JpegError {
+		jpeg_error_mgr manager;
+		std::jmp_buf jump;
+	};
+
+	auto jpegDecode(const std::vector<u8>& tables, const u8* input, size inputSize, bool ycbcr, u8* output, u32 width, u32 height, u32 components) -> void {
+		auto info = jpeg_decompress_struct();
+		auto error = JpegError();
+
+		/* libjpeg exits the process on errors unless we jump out */
+		info.err = jpeg_std_error(&error.manager);
+		error.manager.error_exit = [](j_common_ptr common) {
+			std::longjmp(reinterpret_cast<JpegError*>(common->err)->jump, 1);
+		};
+
+		if (setjmp(error.jump)) {
+			jpeg_destroy_decompress(&info);
+			throw std::runtime_error("Corrupt JPEG data");
+		}
+
+		jpeg_create_decompress(&info);
+
+		/* the shared quantization and huffman tables come first as their own stream */
+		if (!tables.empty()) {
+			jpeg_mem_src(&info, tables.data(), u32(tables.size()));
+			jpeg_read_header(&info, false);
+		}
+
+		jpeg_mem_src(&info, input, u32(inputSize));
+		jpeg_read_header(&info, true);
+
+		if (components == 3) {
+			info.jpeg_color_space = ycbcr ? JCS_YCbCr : JCS_RGB;
+			info.out_color_space = JCS_RGB;
+		}
+
+		jpeg_start_decompress(&info);
+
+		const auto rowBytes = size(width) * components;
+		const auto decodedBytes = size(info.output_width) * info.output_components;
+
+		/* nothing that needs a destructor can live past the setjmp, */
+		/* so the row comes out of libjpeg's pool and goes with jpeg_destroy_decompress */
+		auto row = (*info.mem->alloc_sarray)(reinterpret_cast<j_common_ptr>(&info), JPOOL_IMAGE, JDIMENSION(decodedBytes), 1);
+
+		while (info.output_scanline < info.output_height && info.output_scanline < height) {
+			const auto y = info.output_scanline;
+
+			jpeg_read_scanlines(&info, row, 1);
+
+			std::memcpy(output + y * rowBytes, row[0], decodedBytes < rowBytes ? decodedBytes : rowBytes);
+		}
+
+		/* rows past the ones asked for are left in the stream */
+		if (info.output_scanline == info.output_height)
+			jpeg_finish_decompress(&info);
+
+		jpeg_destroy_decompress(&info);
+	}
+
+	auto undoPredictor(u8* data, u32 width, u32 height, u32 samples, u32 bytesPerSample, bool bigEndian) -> void {
+		const auto rowSamples = size(width) * samples;
+
+		for (auto y = 0_u32; y < height; ++y) {
+			if (bytesPerSample == 1) {
+				auto* row = data + y * rowSamples;
+
+				for (auto i = size(samples); i < rowSamples; ++i)
+					row[i] = u8(row[i] + row[i - samples]);
+
+			} else {
+				auto* row = data + y * rowSamples * 2;
+
+				auto read = [bigEndian](const u8* at) -> u16 {
+					return bigEndian ? u16(at[0] << 8 | at[1]) : u16(at[1] << 8 | at[0]);
+				};
+
+				auto write = [bigEndian](u8* at, u16 value) {
+					at[bigEndian ? 0 : 1] = u8(value >> 8);
+					at[bigEndian ? 1 : 0] = u8(value);
+				};
+
+				for (auto i = size(samples); i < rowSamples; ++i)
+					write(row + i * 2, u16(read(row + i * 2) + read(row + (i - samples) * 2)));
+			}
+		}
+	}
+}
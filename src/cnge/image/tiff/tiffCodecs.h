@@ -0,0 +1,26 @@
+
+#ifndef CNGE_TIFF_CODECS
+#define CNGE_TIFF_CODECS
+
+#include <vector>
+
+#include "types.h"
+
+namespace CNGE::TiffCodecs {
+	/// tiff flavored lzw, msb first codes with the early code width change
+	/// decodes until EOI or until the output is full
+	auto lzwDecode(const u8*, size, u8*, size) -> void;
+
+	/// zlib stream, used for both adobe deflate and the old deflate code
+	auto inflate(const u8*, size, u8*, size) -> void;
+
+	/// abbreviated jpeg stream, tables may come separately from the JPEGTables tag
+	/// writes width * height * components bytes, components is 1 or 3,
+	/// decoding stops after height rows even if the stream has more
+	auto jpegDecode(const std::vector<u8>& tables, const u8*, size, bool ycbcr, u8*, u32 width, u32 height, u32 components) -> void;
+
+	/// undoes horizontal differencing (predictor 2) in place
+	auto undoPredictor(u8*, u32 width, u32 height, u32 samples, u32 bytesPerSample, bool bigEndian) -> void;
+}
+
+#endif
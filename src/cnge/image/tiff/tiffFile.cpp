@@ -0,0 +1,465 @@
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "tiffFile.h"
+#include "tiffCodecs.h"
+
+namespace CNGE {
+	/* tags we look at */
+	constexpr static u16
+		TAG_IMAGE_WIDTH = 256,
+		TAG_IMAGE_LENGTH = 257,
+		TAG_BITS_PER_SAMPLE = 258,
+		TAG_COMPRESSION = 259,
+		TAG_PHOTOMETRIC = 262,
+		TAG_STRIP_OFFSETS = 273,
+		TAG_SAMPLES_PER_PIXEL = 277,
+		TAG_ROWS_PER_STRIP = 278,
+		TAG_STRIP_BYTE_COUNTS = 279,
+		TAG_PLANAR_CONFIG = 284,
+		TAG_PREDICTOR = 317,
+		TAG_COLOR_MAP = 320,
+		TAG_TILE_WIDTH = 322,
+		TAG_TILE_LENGTH = 323,
+		TAG_TILE_OFFSETS = 324,
+		TAG_TILE_BYTE_COUNTS = 325,
+		TAG_JPEG_TABLES = 347;
+
+	/// size in bytes of one value of each tiff field type
+	static auto typeSize(u16 type) -> u32 {
+		switch (type) {
+			case 1: case 2: case 6: case 7: return 1;
+			case 3: case 8: return 2;
+			case 4: case 9: case 11: case 13: return 4;
+			case 5: case 10: case 12: case 16: case 17: case 18: return 8;
+			default: return 0;
+		}
+	}
+
+	TiffFile::TiffFile(const std::string& path) :
+		file(path, std::ios::binary),
+		fileMutex(),
+		bigEndian(false),
+		bigTiff(false),
+		width(0), height(0),
+		tileWidth(0), tileHeight(0),
+		samples(1),
+		bitsPerSample(1),
+		compression(COMPRESSION_NONE),
+		photometric(PHOTOMETRIC_BLACK_IS_ZERO),
+		predictor(1),
+		offsets(),
+		byteCounts(),
+		jpegTables(),
+		colorMap(),
+		stripped(false),
+		stripRows(0),
+		stripMutex(),
+		stripCache()
+	{
+		if (!file.is_open())
+			throw std::runtime_error("File not found");
+
+		u8 header[16];
+		read(0, header, 8);
+
+		if (header[0] == 'I' && header[1] == 'I')
+			bigEndian = false;
+		else if (header[0] == 'M' && header[1] == 'M')
+			bigEndian = true;
+		else
+			throw std::runtime_error("Image not a TIFF");
+
+		const auto version = readU16(header + 2);
+		auto directory = 0_u64;
+
+		if (version == 42) {
+			directory = readU32(header + 4);
+
+		} else if (version == 43) {
+			bigTiff = true;
+			read(8, header + 8, 8);
+
+			if (readU16(header + 4) != 8)
+				throw std::runtime_error("Unsupported BigTIFF offset size");
+
+			directory = readU64(header + 8);
+
+		} else {
+			throw std::runtime_error("Image not a TIFF");
+		}
+
+		/* only the first directory, the full resolution image */
+		auto rowsPerStrip = 0_u64;
+		auto planarConfig = 1_u64;
+		auto hasTiles = false;
+
+		for (const auto& entry : readEntries(directory)) {
+			switch (entry.tag) {
+				case TAG_IMAGE_WIDTH: width = u32(readValues(entry)[0]); break;
+				case TAG_IMAGE_LENGTH: height = u32(readValues(entry)[0]); break;
+				case TAG_BITS_PER_SAMPLE: bitsPerSample = u32(readValues(entry)[0]); break;
+				case TAG_COMPRESSION: compression = u32(readValues(entry)[0]); break;
+				case TAG_PHOTOMETRIC: photometric = u32(readValues(entry)[0]); break;
+				case TAG_SAMPLES_PER_PIXEL: samples = u32(readValues(entry)[0]); break;
+				case TAG_ROWS_PER_STRIP: rowsPerStrip = readValues(entry)[0]; break;
+				case TAG_PLANAR_CONFIG: planarConfig = readValues(entry)[0]; break;
+				case TAG_PREDICTOR: predictor = u32(readValues(entry)[0]); break;
+				case TAG_TILE_WIDTH: tileWidth = u32(readValues(entry)[0]); hasTiles = true; break;
+				case TAG_TILE_LENGTH: tileHeight = u32(readValues(entry)[0]); break;
+				case TAG_JPEG_TABLES: jpegTables = readBytes(entry); break;
+
+				case TAG_COLOR_MAP: {
+					for (auto value : readValues(entry))
+						colorMap.push_back(u16(value));
+				} break;
+
+				case TAG_STRIP_OFFSETS:
+				case TAG_TILE_OFFSETS: offsets = readValues(entry); break;
+
+				case TAG_STRIP_BYTE_COUNTS:
+				case TAG_TILE_BYTE_COUNTS: byteCounts = readValues(entry); break;
+
+				default: break;
+			}
+		}
+
+		if (width == 0 || height == 0)
+			throw std::runtime_error("TIFF has no size");
+
+		/* strips can be as big as the whole image, so they are cut down to tiles */
+		if (!hasTiles) {
+			stripped = true;
+			stripRows = u32(std::min<u64>(rowsPerStrip == 0 ? height : rowsPerStrip, height));
+
+			tileWidth = std::min(width, MAX_STRIP_TILE);
+			tileHeight = std::min(stripRows, MAX_STRIP_TILE);
+		}
+
+		if (tileWidth == 0 || tileHeight == 0)
+			throw std::runtime_error("TIFF has no tile size");
+
+		if (tileWidth > MAX_TILE || tileHeight > MAX_TILE)
+			throw std::runtime_error("TIFF tiles are too big");
+
+		if (planarConfig != 1)
+			throw std::runtime_error("Planar TIFFs are not supported");
+
+		if (bitsPerSample != 8 && bitsPerSample != 16)
+			throw std::runtime_error("Only 8 and 16 bit TIFFs are supported");
+
+		if (compression != COMPRESSION_NONE && compression != COMPRESSION_LZW && compression != COMPRESSION_JPEG && compression != COMPRESSION_DEFLATE && compression != COMPRESSION_OLD_DEFLATE)
+			throw std::runtime_error("Unsupported TIFF compression");
+
+		if (compression == COMPRESSION_JPEG && (bitsPerSample != 8 || (samples != 1 && samples != 3)))
+			throw std::runtime_error("Unsupported JPEG TIFF layout");
+
+		if (photometric == PHOTOMETRIC_PALETTE && (bitsPerSample != 8 || colorMap.size() < 3 * 256))
+			throw std::runtime_error("Unsupported TIFF palette");
+
+		if (photometric == PHOTOMETRIC_YCBCR && compression != COMPRESSION_JPEG)
+			throw std::runtime_error("YCbCr TIFFs are only supported with JPEG compression");
+
+		const auto numBlocks = stripped
+			? size((height + stripRows - 1) / stripRows)
+			: size(getTilesWide()) * getTilesTall();
+
+		if (offsets.size() < numBlocks || byteCounts.size() < numBlocks)
+			throw std::runtime_error("TIFF is missing tile offsets");
+	}
+
+	/*
+	 * directory reading
+	 */
+
+	auto TiffFile::read(u64 offset, void* buffer, size length) const -> void {
+		auto lock = std::lock_guard(fileMutex);
+
+		file.clear();
+		file.seekg(std::streamoff(offset));
+		file.read(static_cast<char*>(buffer), std::streamsize(length));
+
+		if (size(file.gcount()) != length)
+			throw std::runtime_error("Unexpected end of TIFF");
+	}
+
+	auto TiffFile::readU16(const u8* at) const -> u16 {
+		return bigEndian
+			? u16(at[0] << 8 | at[1])
+			: u16(at[1] << 8 | at[0]);
+	}
+
+	auto TiffFile::readU32(const u8* at) const -> u32 {
+		return bigEndian
+			? u32(readU16(at)) << 16 | readU16(at + 2)
+			: u32(readU16(at + 2)) << 16 | readU16(at);
+	}
+
+	auto TiffFile::readU64(const u8* at) const -> u64 {
+		return bigEndian
+			? u64(readU32(at)) << 32 | readU32(at + 4)
+			: u64(readU32(at + 4)) << 32 | readU32(at);
+	}
+
+	auto TiffFile::readEntries(u64 directory) -> std::vector<Entry> {
+		u8 countBytes[8];
+		read(directory, countBytes, bigTiff ? 8 : 2);
+
+		const auto numEntries = bigTiff ? readU64(countBytes) : readU16(countBytes);
+		const auto entrySize = bigTiff ? 20_size : 12_size;
+		const auto valueSize = bigTiff ? 8_u64 : 4_u64;
+
+		const auto start = directory + (bigTiff ? 8 : 2);
+
+		auto raw = std::vector<u8>(numEntries * entrySize);
+		read(start, raw.data(), raw.size());
+
+		auto entries = std::vector<Entry>();
+		entries.reserve(numEntries);
+
+		for (auto i = 0_size; i < numEntries; ++i) {
+			const auto* at = raw.data() + i * entrySize;
+
+			auto entry = Entry();
+			entry.tag = readU16(at);
+			entry.type = readU16(at + 2);
+			entry.count = bigTiff ? readU64(at + 4) : readU32(at + 4);
+
+			const auto bytes = entry.count * typeSize(entry.type);
+			const auto valueAt = start + i * entrySize + (bigTiff ? 12 : 8);
+
+			/* small values sit in the entry itself, point at them there */
+			entry.inline_ = bytes <= valueSize;
+			entry.value = entry.inline_ ? valueAt : (bigTiff ? readU64(at + 12) : readU32(at + 8));
+
+			entries.push_back(entry);
+		}
+
+		return entries;
+	}
+
+	auto TiffFile::readValues(const Entry& entry) -> std::vector<u64> {
+		const auto bytesEach = typeSize(entry.type);
+
+		if (bytesEach == 0 || entry.count == 0)
+			throw std::runtime_error("Bad TIFF entry");
+
+		auto raw = std::vector<u8>(entry.count * bytesEach);
+		read(entry.value, raw.data(), raw.size());
+
+		auto values = std::vector<u64>(entry.count);
+
+		for (auto i = 0_size; i < entry.count; ++i) {
+			const auto* at = raw.data() + i * bytesEach;
+
+			switch (bytesEach) {
+				case 1: values[i] = at[0]; break;
+				case 2: values[i] = readU16(at); break;
+				case 4: values[i] = readU32(at); break;
+				default: values[i] = readU64(at); break;
+			}
+		}
+
+		return values;
+	}
+
+	auto TiffFile::readBytes(const Entry& entry) -> std::vector<u8> {
+		auto raw = std::vector<u8>(entry.count * typeSize(entry.type));
+		read(entry.value, raw.data(), raw.size());
+
+		return raw;
+	}
+
+	/*
+	 * decoding
+	 */
+
+	auto TiffFile::getBytesPerSample() const -> u32 {
+		return bitsPerSample / 8;
+	}
+
+	auto TiffFile::decodeBlock(size index, u32 blockWidth, u32 rows) const -> std::vector<u8> {
+		const auto rawSize = size(blockWidth) * rows * samples * getBytesPerSample();
+
+		auto raw = std::vector<u8>(rawSize);
+
+		/* uncompressed rows can be read on their own, past the ones we need is never touched */
+		if (compression == COMPRESSION_NONE) {
+			read(offsets[index], raw.data(), std::min<u64>(rawSize, byteCounts[index]));
+			return raw;
+		}
+
+		auto compressed = std::vector<u8>(byteCounts[index]);
+		read(offsets[index], compressed.data(), compressed.size());
+
+		/* each codec stops once the rows asked for are filled */
+		switch (compression) {
+			case COMPRESSION_LZW: {
+				TiffCodecs::lzwDecode(compressed.data(), compressed.size(), raw.data(), raw.size());
+			} break;
+
+			case COMPRESSION_DEFLATE:
+			case COMPRESSION_OLD_DEFLATE: {
+				TiffCodecs::inflate(compressed.data(), compressed.size(), raw.data(), raw.size());
+			} break;
+
+			case COMPRESSION_JPEG: {
+				TiffCodecs::jpegDecode(jpegTables, compressed.data(), compressed.size(), photometric == PHOTOMETRIC_YCBCR, raw.data(), blockWidth, rows, samples);
+			} break;
+
+			default: break;
+		}
+
+		if (predictor == 2)
+			TiffCodecs::undoPredictor(raw.data(), blockWidth, rows, samples, getBytesPerSample(), bigEndian);
+
+		return raw;
+	}
+
+	auto TiffFile::decodeStrip(u64 strip, u32 rows) const -> std::shared_ptr<const std::vector<u8>> {
+		auto promise = std::promise<std::shared_ptr<const std::vector<u8>>>();
+		auto raw = std::shared_future<std::shared_ptr<const std::vector<u8>>>();
+		auto found = false;
+
+		{
+			auto lock = std::lock_guard(stripMutex);
+
+			/* the tiles of one row all want the same strip, the first one decodes it */
+			for (const auto& cached : stripCache) {
+				if (cached.strip == strip && cached.rows >= rows) {
+					raw = cached.raw;
+					found = true;
+					break;
+				}
+			}
+
+			if (!found) {
+				raw = promise.get_future().share();
+
+				if (stripCache.size() == NUM_CACHED_STRIPS)
+					stripCache.pop_front();
+
+				stripCache.push_back(StripRows { strip, rows, raw });
+			}
+		}
+
+		if (!found) {
+			try {
+				promise.set_value(std::make_shared<const std::vector<u8>>(decodeBlock(size(strip), width, rows)));
+			} catch (...) {
+				promise.set_exception(std::current_exception());
+			}
+		}
+
+		/* rethrows for every tile that was waiting on a strip that failed */
+		return raw.get();
+	}
+
+	auto TiffFile::decodeTile(u32 x, u32 y, u8* pixels) const -> void {
+		const auto pixelBytes = size(samples) * getBytesPerSample();
+
+		if (!stripped) {
+			const auto index = size(y) * getTilesWide() + x;
+
+			/* tiles are always stored whole, the ones past the bottom only need their top */
+			const auto rows = std::min(tileHeight, height - y * tileHeight);
+
+			toRGBA(decodeBlock(index, tileWidth, rows).data(), size(tileWidth) * rows, pixels);
+			return;
+		}
+
+		const auto left = x * tileWidth;
+		const auto columns = std::min(tileWidth, width - left);
+
+		const auto top = y * tileHeight;
+		const auto bottom = std::min(top + tileHeight, height);
+
+		/* strips taller than MAX_STRIP_TILE don't split into whole tiles, so a tile can run into the next one */
+		for (auto row = top; row < bottom;) {
+			const auto strip = row / stripRows;
+			const auto stripTop = strip * stripRows;
+			const auto end = std::min(bottom, stripTop + stripRows);
+
+			const auto raw = decodeStrip(strip, end - stripTop);
+
+			for (; row < end; ++row)
+				toRGBA(raw->data() + ((size(row) - stripTop) * width + left) * pixelBytes, columns, pixels + size(row - top) * tileWidth * 4);
+		}
+	}
+
+	auto TiffFile::toRGBA(const u8* raw, size numPixels, u8* pixels) const -> void {
+		const auto bytesPerSample = getBytesPerSample();
+
+		/* 16 bit samples keep their high byte, in file order */
+		const auto highByte = (bytesPerSample == 2 && !bigEndian) ? 1_u32 : 0_u32;
+
+		auto sample = [&](size pixel, u32 channel) -> u8 {
+			return raw[(pixel * samples + channel) * bytesPerSample + highByte];
+		};
+
+		for (auto i = 0_size; i < numPixels; ++i) {
+			auto* out = pixels + i * 4;
+
+			switch (photometric) {
+				case PHOTOMETRIC_WHITE_IS_ZERO:
+				case PHOTOMETRIC_BLACK_IS_ZERO: {
+					auto gray = sample(i, 0);
+					if (photometric == PHOTOMETRIC_WHITE_IS_ZERO)
+						gray = 255 - gray;
+
+					out[0] = out[1] = out[2] = gray;
+					out[3] = samples > 1 ? sample(i, 1) : 255;
+				} break;
+
+				case PHOTOMETRIC_PALETTE: {
+					/* the map is all reds, then all greens, then all blues, in 16 bits */
+					const auto entry = sample(i, 0);
+
+					out[0] = u8(colorMap[entry] >> 8);
+					out[1] = u8(colorMap[256 + entry] >> 8);
+					out[2] = u8(colorMap[512 + entry] >> 8);
+					out[3] = 255;
+				} break;
+
+				default: {
+					out[0] = sample(i, 0);
+					out[1] = sample(i, samples > 1 ? 1 : 0);
+					out[2] = sample(i, samples > 2 ? 2 : 0);
+					out[3] = samples > 3 ? sample(i, 3) : 255;
+				} break;
+			}
+		}
+	}
+
+	/*
+	 * getters
+	 */
+
+	auto TiffFile::isTiff(const u8* bytes, size length) -> bool {
+		if (length < 4)
+			return false;
+
+		/* byte order, then 42 for classic or 43 for bigtiff */
+		const auto little = bytes[0] == 'I' && bytes[1] == 'I' && bytes[3] == 0 && (bytes[2] == 42 || bytes[2] == 43);
+		const auto big = bytes[0] == 'M' && bytes[1] == 'M' && bytes[2] == 0 && (bytes[3] == 42 || bytes[3] == 43);
+
+		return little || big;
+	}
+
+	auto TiffFile::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto TiffFile::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto TiffFile::getTileWidth() const -> u32 {
+		return tileWidth;
+	}
+
+	auto TiffFile::getTileHeight() const -> u32 {
+		return tileHeight;
+	}
+}
@@ -0,0 +1,131 @@
+
+#ifndef CNGE_TIFF_FILE
+#define CNGE_TIFF_FILE
+
+#include <deque>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.h"
+#include "cnge/image/tileSource.h"
+
+namespace CNGE {
+	/// classic tiff and bigtiff, read a tile or strip at a time
+	/// only the directory is read up front, pixel data is read when a tile is asked for
+	/// strips are cut into tiles of at most MAX_STRIP_TILE on a side,
+	/// which decode only as far into their strip as they reach
+	class TiffFile : public TileSource {
+	public:
+		/// the most a tile cut out of a strip spans in either direction
+		constexpr static u32 MAX_STRIP_TILE = 1024;
+
+		/// tiled files with bigger tiles than this are not opened,
+		/// a tile has to fit in one texture
+		constexpr static u32 MAX_TILE = 4096;
+
+	private:
+		/* compression codes */
+		constexpr static u32
+			COMPRESSION_NONE = 1,
+			COMPRESSION_LZW = 5,
+			COMPRESSION_OLD_JPEG = 6,
+			COMPRESSION_JPEG = 7,
+			COMPRESSION_DEFLATE = 8,
+			COMPRESSION_OLD_DEFLATE = 32946;
+
+		/* photometric interpretations */
+		constexpr static u32
+			PHOTOMETRIC_WHITE_IS_ZERO = 0,
+			PHOTOMETRIC_BLACK_IS_ZERO = 1,
+			PHOTOMETRIC_RGB = 2,
+			PHOTOMETRIC_PALETTE = 3,
+			PHOTOMETRIC_YCBCR = 6;
+
+		struct Entry {
+			u16 tag;
+			u16 type;
+			u64 count;
+			/* either the value itself or where to find it */
+			u64 value;
+			bool inline_;
+		};
+
+		mutable std::ifstream file;
+		mutable std::mutex fileMutex;
+
+		bool bigEndian;
+		bool bigTiff;
+
+		u32 width, height;
+		u32 tileWidth, tileHeight;
+
+		u32 samples;
+		u32 bitsPerSample;
+		u32 compression;
+		u32 photometric;
+		u32 predictor;
+
+		std::vector<u64> offsets;
+		std::vector<u64> byteCounts;
+
+		std::vector<u8> jpegTables;
+		std::vector<u16> colorMap;
+
+		/* strips instead of tiles, and how many rows each strip has */
+		bool stripped;
+		u32 stripRows;
+
+		/* the first rows of a strip, decoded, shared by the tiles cut from it */
+		struct StripRows {
+			u64 strip;
+			u32 rows;
+			std::shared_future<std::shared_ptr<const std::vector<u8>>> raw;
+		};
+
+		constexpr static u32 NUM_CACHED_STRIPS = 4;
+
+		mutable std::mutex stripMutex;
+		mutable std::deque<StripRows> stripCache;
+
+		/* reading the directory */
+		auto read(u64, void*, size) const -> void;
+		auto readU16(const u8*) const -> u16;
+		auto readU32(const u8*) const -> u32;
+		auto readU64(const u8*) const -> u64;
+
+		auto readEntries(u64) -> std::vector<Entry>;
+		auto readValues(const Entry&) -> std::vector<u64>;
+		auto readBytes(const Entry&) -> std::vector<u8>;
+
+		/* decoding */
+		auto getBytesPerSample() const -> u32;
+
+		/// the first rows of a tile or strip, as stored samples with the predictor undone
+		auto decodeBlock(size index, u32 blockWidth, u32 rows) const -> std::vector<u8>;
+
+		/// decodeBlock for strips, through the cache so neighboring tiles decode it once
+		auto decodeStrip(u64 strip, u32 rows) const -> std::shared_ptr<const std::vector<u8>>;
+
+		auto toRGBA(const u8*, size numPixels, u8*) const -> void;
+
+	public:
+		explicit TiffFile(const std::string&);
+
+		/// whether these first bytes of a file are something we can decode
+		static auto isTiff(const u8*, size) -> bool;
+
+		[[nodiscard]] auto getWidth() const -> u32 override;
+		[[nodiscard]] auto getHeight() const -> u32 override;
+
+		[[nodiscard]] auto getTileWidth() const -> u32 override;
+		[[nodiscard]] auto getTileHeight() const -> u32 override;
+
+		auto decodeTile(u32, u32, u8*) const -> void override;
+	};
+}
+
+#endif
@@ -0,0 +1,114 @@
+
+#include <cstring>
+#include <future>
+#include <stdexcept>
+
+#include "tileRowSource.h"
+
+namespace CNGE {
+	TileRowSource::TileRowSource(std::unique_ptr<TileSource>&& source, u32 numWorkers) :
+		source(std::move(source)),
+		nextRow(0),
+		stripRow(~0_u32),
+		stripLeft(0),
+		stripRight(0),
+		strip(),
+		workers(numWorkers)
+	{}
+
+	auto TileRowSource::getWidth() const -> u32 {
+		return source->getWidth();
+	}
+
+	auto TileRowSource::getHeight() const -> u32 {
+		return source->getHeight();
+	}
+
+	auto TileRowSource::decodeStrip(u32 tileRow, u32 tileLeft, u32 tileRight) -> void {
+		const auto tileSize = size(source->getTileWidth()) * source->getTileHeight() * 4;
+
+		strip.resize(tileRight - tileLeft);
+
+		auto done = std::vector<std::future<void>>();
+		done.reserve(strip.size());
+
+		for (auto x = tileLeft; x < tileRight; ++x) {
+			auto& tile = strip[x - tileLeft];
+			tile.resize(tileSize);
+
+			auto task = std::make_shared<std::packaged_task<void()>>([this, x, tileRow, &tile] {
+				source->decodeTile(x, tileRow, tile.data());
+			});
+
+			done.push_back(task->get_future());
+			workers.push([task] { (*task)(); });
+		}
+
+		/* get rethrows anything a tile threw */
+		for (auto& tile : done)
+			tile.get();
+
+		stripRow = tileRow;
+		stripLeft = tileLeft;
+		stripRight = tileRight;
+	}
+
+	auto TileRowSource::readRows(u32 count, u32 left, u32 columns, u8* pixels) -> void {
+		if (nextRow + count > getHeight() || left + columns > getWidth())
+			throw std::runtime_error("Read past the end of the image");
+
+		const auto tileWidth = source->getTileWidth();
+		const auto tileHeight = source->getTileHeight();
+
+		const auto tileLeft = left / tileWidth;
+		const auto tileRight = (left + columns + tileWidth - 1) / tileWidth;
+
+		for (auto i = 0_u32; i < count; ++i, ++nextRow) {
+			const auto tileRow = nextRow / tileHeight;
+
+			if (tileRow != stripRow || tileLeft < stripLeft || tileRight > stripRight)
+				decodeStrip(tileRow, tileLeft, tileRight);
+
+			const auto inTile = nextRow - tileRow * tileHeight;
+			auto* out = pixels + size(i) * columns * 4;
+
+			/* copy the part of each tile the columns cross */
+			for (auto x = left; x < left + columns;) {
+				const auto tile = x / tileWidth;
+				const auto end = std::min((tile + 1) * tileWidth, left + columns);
+
+				const auto& tilePixels = strip[tile - stripLeft];
+				std::memcpy(out + size(x - left) * 4, tilePixels.data() + (size(inTile) * tileWidth + (x - tile * tileWidth)) * 4, size(end - x) * 4);
+
+				x = end;
+			}
+		}
+	}
+
+	auto TileRowSource::skipRows(u32 count) -> void {
+		nextRow += count;
+	}
+
+	DecodedRowSource::DecodedRowSource(u32 width, u32 height, std::unique_ptr<u8[]>&& pixels) :
+		width(width), height(height), pixels(std::move(pixels)), nextRow(0) {}
+
+	auto DecodedRowSource::getWidth() const -> u32 {
+		return width;
+	}
+
+	auto DecodedRowSource::getHeight() const -> u32 {
+		return height;
+	}
+
+	auto DecodedRowSource::readRows(u32 count, u32 left, u32 columns, u8* out) -> void {
+		if (nextRow + count > height || left + columns > width)
+			throw std::runtime_error("Read past the end of the image");
+
+		for (auto i = 0_u32; i < count; ++i, ++nextRow)
+			std::memcpy(out + size(i) * columns * 4, pixels.get() + (size(nextRow) * width + left) * 4, size(columns) * 4);
+	}
+
+	auto DecodedRowSource::skipRows(u32 count) -> void {
+		nextRow += count;
+	}
+}
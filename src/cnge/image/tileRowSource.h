@@ -0,0 +1,64 @@
+
+#ifndef CNGE_TILE_ROW_SOURCE
+#define CNGE_TILE_ROW_SOURCE
+
+#include <memory>
+#include <vector>
+
+#include "types.h"
+#include "rowSource.h"
+#include "tileSource.h"
+#include "cnge/load/threadPool.h"
+
+namespace CNGE {
+	/// reads a tiled image in rows by decoding one strip of tiles at a time
+	/// only the tiles under the asked for columns are decoded, the tiles of a strip in parallel
+	class TileRowSource : public RowSource {
+	private:
+		std::unique_ptr<TileSource> source;
+
+		u32 nextRow;
+
+		/* the strip of tiles currently decoded, and the columns of tiles it covers */
+		u32 stripRow;
+		u32 stripLeft, stripRight;
+		std::vector<std::vector<u8>> strip;
+
+		/* last so no job is still running when the rest goes */
+		ThreadPool workers;
+
+		auto decodeStrip(u32 tileRow, u32 tileLeft, u32 tileRight) -> void;
+
+	public:
+		/// 0 workers means one per hardware thread
+		explicit TileRowSource(std::unique_ptr<TileSource>&&, u32 = 0);
+
+		[[nodiscard]] auto getWidth() const -> u32 override;
+		[[nodiscard]] auto getHeight() const -> u32 override;
+
+		auto readRows(u32 count, u32 left, u32 width, u8* pixels) -> void override;
+
+		/// tiles of skipped rows are never decoded
+		auto skipRows(u32 count) -> void override;
+	};
+
+	/// rows from an image that was decoded whole, for formats that can't do any better
+	class DecodedRowSource : public RowSource {
+	private:
+		u32 width, height;
+		std::unique_ptr<u8[]> pixels;
+
+		u32 nextRow;
+
+	public:
+		DecodedRowSource(u32 width, u32 height, std::unique_ptr<u8[]>&&);
+
+		[[nodiscard]] auto getWidth() const -> u32 override;
+		[[nodiscard]] auto getHeight() const -> u32 override;
+
+		auto readRows(u32 count, u32 left, u32 width, u8* pixels) -> void override;
+		auto skipRows(u32 count) -> void override;
+	};
+}
+
+#endif
@@ -0,0 +1,34 @@
+
+#ifndef CNGE_TILE_SOURCE
+#define CNGE_TILE_SOURCE
+
+#include "types.h"
+
+namespace CNGE {
+	/// an image too big to decode at once, read as a grid of tiles
+	/// decodeTile must be safe to call from several threads at the same time
+	class TileSource {
+	public:
+		virtual ~TileSource() = default;
+
+		[[nodiscard]] virtual auto getWidth() const -> u32 = 0;
+		[[nodiscard]] virtual auto getHeight() const -> u32 = 0;
+
+		[[nodiscard]] virtual auto getTileWidth() const -> u32 = 0;
+		[[nodiscard]] virtual auto getTileHeight() const -> u32 = 0;
+
+		[[nodiscard]] auto getTilesWide() const -> u32 {
+			return (getWidth() + getTileWidth() - 1) / getTileWidth();
+		}
+
+		[[nodiscard]] auto getTilesTall() const -> u32 {
+			return (getHeight() + getTileHeight() - 1) / getTileHeight();
+		}
+
+		/// decodes one tile as rgba8 into a buffer of tileWidth * tileHeight pixels
+		/// parts of edge tiles past the image are left as they were
+		virtual auto decodeTile(u32 x, u32 y, u8* pixels) const -> void = 0;
+	};
+}
+
+#endif
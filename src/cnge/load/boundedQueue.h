@@ -0,0 +1,83 @@
+
+#ifndef CNGE_BOUNDED_QUEUE
+#define CNGE_BOUNDED_QUEUE
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+#include "types.h"
+
+namespace CNGE {
+	/// hands items from one set of threads to another, holding at most a fixed number
+	/// pushing into a full queue waits, so a slow consumer holds back its producers
+	template<typename T>
+	class BoundedQueue {
+	private:
+		std::deque<T> items;
+		size capacity;
+
+		/// how many producers have not closed yet
+		u32 openProducers;
+
+		std::mutex mutex;
+		std::condition_variable notFull;
+		std::condition_variable notEmpty;
+
+	public:
+		explicit BoundedQueue(size capacity, u32 producers = 1) : items(), capacity(capacity), openProducers(producers), mutex(), notFull(), notEmpty() {}
+
+		/* no copying the queue */
+		BoundedQueue(const BoundedQueue&) = delete;
+		auto operator=(const BoundedQueue&) -> void = delete;
+
+		/// waits for room
+		auto push(T&& item) -> void {
+			{
+				auto lock = std::unique_lock(mutex);
+
+				notFull.wait(lock, [this] { return items.size() < capacity; });
+
+				items.push_back(std::move(item));
+			}
+
+			notEmpty.notify_one();
+		}
+
+		/// waits for an item, empty once every producer has closed and the queue is drained
+		auto pop() -> std::optional<T> {
+			auto item = std::optional<T>();
+
+			{
+				auto lock = std::unique_lock(mutex);
+
+				notEmpty.wait(lock, [this] { return !items.empty() || openProducers == 0; });
+
+				if (items.empty())
+					return item;
+
+				item.emplace(std::move(items.front()));
+				items.pop_front();
+			}
+
+			notFull.notify_one();
+
+			return item;
+		}
+
+		/// each producer calls this once when it has nothing more to push
+		auto close() -> void {
+			{
+				auto lock = std::lock_guard(mutex);
+
+				if (openProducers > 0)
+					--openProducers;
+			}
+
+			notEmpty.notify_all();
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,90 @@
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <stdexcept>
+
+#include "mappedFile.h"
+
+namespace CNGE {
+#ifdef _WIN32
+	MappedFile::MappedFile(const char* path) : data(nullptr), length(0), fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr) {
+		fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (fileHandle == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("File not found");
+
+		auto fileSize = LARGE_INTEGER();
+		GetFileSizeEx(fileHandle, &fileSize);
+		length = size(fileSize.QuadPart);
+
+		if (length == 0) {
+			CloseHandle(fileHandle);
+			throw std::runtime_error("File is empty");
+		}
+
+		mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (mappingHandle != nullptr)
+			data = static_cast<const u8*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+		if (data == nullptr) {
+			if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			throw std::runtime_error("Could not map file");
+		}
+	}
+
+	MappedFile::~MappedFile() {
+		UnmapViewOfFile(data);
+		CloseHandle(mappingHandle);
+		CloseHandle(fileHandle);
+	}
+#else
+	MappedFile::MappedFile(const char* path) : data(nullptr), length(0) {
+		const auto descriptor = open(path, O_RDONLY);
+
+		if (descriptor == -1)
+			throw std::runtime_error("File not found");
+
+		struct stat status {};
+		fstat(descriptor, &status);
+		length = size(status.st_size);
+
+		if (length == 0) {
+			close(descriptor);
+			throw std::runtime_error("File is empty");
+		}
+
+		auto* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+		/* the mapping keeps its own reference to the file */
+		close(descriptor);
+
+		if (mapping == MAP_FAILED)
+			throw std::runtime_error("Could not map file");
+
+		madvise(mapping, length, MADV_SEQUENTIAL);
+
+		data = static_cast<const u8*>(mapping);
+	}
+
+	MappedFile::~MappedFile() {
+		munmap(const_cast<u8*>(data), length);
+	}
+#endif
+
+	auto MappedFile::getData() const -> const u8* {
+		return data;
+	}
+
+	auto MappedFile::getSize() const -> size {
+		return length;
+	}
+}
@@ -0,0 +1,34 @@
+
+#ifndef CNGE_MAPPED_FILE
+#define CNGE_MAPPED_FILE
+
+#include "types.h"
+
+namespace CNGE {
+	/// a whole file mapped read only into memory
+	/// pages are only read from disk when they are touched
+	class MappedFile {
+	private:
+		const u8* data;
+		size length;
+
+#ifdef _WIN32
+		void* fileHandle;
+		void* mappingHandle;
+#endif
+
+	public:
+		explicit MappedFile(const char*);
+
+		/* the mapping belongs to one owner */
+		MappedFile(const MappedFile&) = delete;
+		auto operator=(const MappedFile&) -> void = delete;
+
+		[[nodiscard]] auto getData() const -> const u8*;
+		[[nodiscard]] auto getSize() const -> size;
+
+		~MappedFile();
+	};
+}
+
+#endif
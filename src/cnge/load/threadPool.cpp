@@ -0,0 +1,100 @@
+
+#include <utility>
+
+#include "threadPool.h"
+
+namespace CNGE {
+	ThreadPool::ThreadPool(u32 numWorkers) : workers(), jobs(), mutex(), condition(), finished(), running(0), error(), stopping(false) {
+		if (numWorkers == 0)
+			numWorkers = std::thread::hardware_concurrency();
+
+		/* hardware_concurrency is allowed to not know */
+		if (numWorkers == 0)
+			numWorkers = 1;
+
+		workers.reserve(numWorkers);
+
+		for (auto i = 0_u32; i < numWorkers; ++i)
+			workers.emplace_back([this] { work(); });
+	}
+
+	auto ThreadPool::work() -> void {
+		while (true) {
+			auto job = std::function<void()>();
+
+			{
+				auto lock = std::unique_lock(mutex);
+
+				condition.wait(lock, [this] { return stopping || !jobs.empty(); });
+
+				/* only quit once there is nothing left to do */
+				if (jobs.empty())
+					return;
+
+				job = std::move(jobs.front());
+				jobs.pop_front();
+
+				++running;
+			}
+
+			/* a job that throws must not take the worker, and the process, with it */
+			auto thrown = std::exception_ptr();
+
+			try {
+				job();
+			} catch (...) {
+				thrown = std::current_exception();
+			}
+
+			{
+				auto lock = std::lock_guard(mutex);
+
+				if (thrown != nullptr && error == nullptr)
+					error = thrown;
+
+				--running;
+			}
+
+			finished.notify_all();
+		}
+	}
+
+	auto ThreadPool::push(std::function<void()>&& job) -> void {
+		{
+			auto lock = std::lock_guard(mutex);
+			jobs.push_back(std::move(job));
+		}
+
+		condition.notify_one();
+	}
+
+	auto ThreadPool::clear() -> void {
+		auto lock = std::lock_guard(mutex);
+		jobs.clear();
+	}
+
+	auto ThreadPool::wait() -> void {
+		auto lock = std::unique_lock(mutex);
+
+		finished.wait(lock, [this] { return jobs.empty() && running == 0; });
+
+		if (error != nullptr)
+			std::rethrow_exception(std::exchange(error, nullptr));
+	}
+
+	auto ThreadPool::getNumWorkers() const -> u32 {
+		return u32(workers.size());
+	}
+
+	ThreadPool::~ThreadPool() {
+		{
+			auto lock = std::lock_guard(mutex);
+			stopping = true;
+		}
+
+		condition.notify_all();
+
+		for (auto& worker : workers)
+			worker.join();
+	}
+}
@@ -0,0 +1,62 @@
+
+#ifndef CNGE_THREAD_POOL
+#define CNGE_THREAD_POOL
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.h"
+
+namespace CNGE {
+	/// a fixed set of worker threads that run jobs in the order they are pushed
+	/// used by the loaders that need more than the single gather thread of a resource
+	class ThreadPool {
+	private:
+		std::vector<std::thread> workers;
+		std::deque<std::function<void()>> jobs;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+
+		/* signaled whenever a job finishes, for wait */
+		std::condition_variable finished;
+		u32 running;
+
+		/* the first exception a job let out, kept for whoever waits */
+		std::exception_ptr error;
+
+		bool stopping;
+
+		auto work() -> void;
+
+	public:
+		/// 0 workers means one per hardware thread
+		explicit ThreadPool(u32 = 0);
+
+		/* no copying the pool */
+		ThreadPool(const ThreadPool&) = delete;
+		auto operator=(const ThreadPool&) -> void = delete;
+
+		auto push(std::function<void()>&&) -> void;
+
+		/// drops every job that has not started yet
+		auto clear() -> void;
+
+		/// blocks until every pushed job has finished,
+		/// then rethrows the first exception one of them let out
+		auto wait() -> void;
+
+		[[nodiscard]] auto getNumWorkers() const -> u32;
+
+		/// finishes the running jobs and joins the workers,
+		/// an exception nobody waited for is dropped
+		~ThreadPool();
+	};
+}
+
+#endif
@@ -0,0 +1,263 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CNGE_AFFINE2
+#define CNGE_AFFINE2
+
+#include <ostream>
+#include <array>
+#include <cmath>
+
+#include "types.h"
+#include "vector2.h"
+#include "matrix4.h"
+
+/// a 2d scale, rotate and translate in 6 values instead of 16
+///
+/// stored column major like a glsl mat3x2, the first two columns
+/// are the linear part and the third is the translation, so
+///
+///   x' = m[0] * x + m[2] * y + m[4]
+///   y' = m[1] * x + m[3] * y + m[5]
+template <typename T>
+class Affine2 {
+	public:
+		T m[3 * 2];
+
+		static constexpr Affine2<T> makeIdentity() {
+			return std::array<T, 3 * 2> {
+				1, 0,
+				0, 1,
+				0, 0
+			};
+		}
+
+		/// z is dropped, so near and far are too
+		static constexpr Affine2<T> makeOrthographic(T left, T right, T bottom, T top) {
+			return std::array<T, 3 * 2> {
+				2 / (right - left), 0,
+				0, 2 / (top - bottom),
+				(left + right) / (left - right), (bottom + top) / (bottom - top)
+			};
+		}
+
+		static constexpr Affine2<T> makeTranslate(T translateX, T translateY) {
+			return std::array<T, 3 * 2> {
+				1, 0,
+				0, 1,
+				translateX, translateY
+			};
+		}
+
+		static constexpr Affine2<T> makeScale(T scaleX, T scaleY) {
+			return std::array<T, 3 * 2> {
+				scaleX, 0,
+				0, scaleY,
+				0, 0
+			};
+		}
+
+		static Affine2<T> makeRotate(T rotation) {
+			auto sinZ = sin(rotation);
+			auto cosZ = cos(rotation);
+			return std::array<T, 3 * 2> {
+				cosZ, sinZ,
+				-sinZ, cosZ,
+				0, 0
+			};
+		}
+
+		/// translate * rotate * scale, the same as Matrix4's setTransform2D
+		static Affine2<T> makeTransform(T translateX, T translateY, T rotation, T scaleX, T scaleY) {
+			return Affine2<T>().setTransform(translateX, translateY, rotation, scaleX, scaleY);
+		}
+
+		constexpr Affine2() :
+			m() {}
+
+		constexpr Affine2(const std::array<T, 3 * 2> & values) noexcept :
+			m { values[0], values[1], values[2], values[3], values[4], values[5] } {}
+
+		/// takes the values in reading order, row by row
+		constexpr Affine2(T a, T b, T c,
+		                  T d, T e, T f) :
+			m {
+				a, d,
+				b, e,
+				c, f
+			} {}
+
+		/// the xy part of a matrix that only works in the xy plane
+		constexpr explicit Affine2(const Matrix<4, 4, T> & matrix) :
+			m {
+				matrix.m[0 ], matrix.m[1 ],
+				matrix.m[4 ], matrix.m[5 ],
+				matrix.m[12], matrix.m[13]
+			} {}
+
+		template <typename T2>
+		constexpr Affine2(const Affine2<T2> & affine) :
+			m { (T) affine.m[0], (T) affine.m[1], (T) affine.m[2], (T) affine.m[3], (T) affine.m[4], (T) affine.m[5] } {}
+
+		constexpr Affine2(const Affine2<T> & affine) noexcept = default;
+
+		constexpr Affine2<T> & operator=(const Affine2<T> & affine) noexcept = default;
+
+		constexpr Affine2<T> & operator*=(const Affine2<T> & affine) {
+			return *this = *this * affine;
+		}
+
+		constexpr Matrix<4, 4, T> toMatrix4() const {
+			return std::array<T, 4 * 4> {
+				m[0], m[1], 0, 0,
+				m[2], m[3], 0, 0,
+				0, 0, 1, 0,
+				m[4], m[5], 0, 1
+			};
+		}
+
+		constexpr T det() const {
+			return m[0] * m[3] - m[2] * m[1];
+		}
+
+		/// a singular transform comes back full of infinities
+		constexpr Affine2<T> & invert() {
+			auto inverseDet = 1 / det();
+			T newM[] = {
+				 m[3] * inverseDet, -m[1] * inverseDet,
+				-m[2] * inverseDet,  m[0] * inverseDet,
+				0, 0
+			};
+			newM[4] = -(newM[0] * m[4] + newM[2] * m[5]);
+			newM[5] = -(newM[1] * m[4] + newM[3] * m[5]);
+			for (u32 i = 0; i < 3 * 2; ++i)
+				m[i] = newM[i];
+			return *this;
+		}
+
+		constexpr Affine2<T> & setIdentity() {
+			return *this = makeIdentity();
+		}
+
+		constexpr Affine2<T> & setOrthographic(T left, T right, T bottom, T top) {
+			return *this = makeOrthographic(left, right, bottom, top);
+		}
+
+		Affine2<T> & setTransform(T translateX, T translateY, T rotation, T scaleX, T scaleY) {
+			auto sinZ = sin(rotation);
+			auto cosZ = cos(rotation);
+			m[0] = cosZ * scaleX;
+			m[1] = sinZ * scaleX;
+			m[2] = -sinZ * scaleY;
+			m[3] = cosZ * scaleY;
+			m[4] = translateX;
+			m[5] = translateY;
+			return *this;
+		}
+
+		/* these apply on the right, so to the points before what is already here */
+
+		constexpr Affine2<T> & translate(T translateX, T translateY) {
+			m[4] += m[0] * translateX + m[2] * translateY;
+			m[5] += m[1] * translateX + m[3] * translateY;
+			return *this;
+		}
+
+		constexpr Affine2<T> & translate(const Vector<2, T> & translate) {
+			return this->translate(translate.v[0], translate.v[1]);
+		}
+
+		Affine2<T> & rotate(T rotation) {
+			auto sinZ = sin(rotation);
+			auto cosZ = cos(rotation);
+			for (u32 i = 0; i < 2; ++i) {
+				auto x = m[i];
+				auto y = m[i + 2];
+				m[i    ] = x *  cosZ + y * sinZ;
+				m[i + 2] = x * -sinZ + y * cosZ;
+			}
+			return *this;
+		}
+
+		constexpr Affine2<T> & scale(T scaleX, T scaleY) {
+			m[0] *= scaleX;
+			m[1] *= scaleX;
+			m[2] *= scaleY;
+			m[3] *= scaleY;
+			return *this;
+		}
+
+		constexpr Affine2<T> & scale(const Vector<2, T> & scale) {
+			return this->scale(scale.v[0], scale.v[1]);
+		}
+};
+
+/// left after right
+template <typename T>
+constexpr Affine2<T> operator*(const Affine2<T> & left, const Affine2<T> & right) {
+	return std::array<T, 3 * 2> {
+		left.m[0] * right.m[0] + left.m[2] * right.m[1],
+		left.m[1] * right.m[0] + left.m[3] * right.m[1],
+		left.m[0] * right.m[2] + left.m[2] * right.m[3],
+		left.m[1] * right.m[2] + left.m[3] * right.m[3],
+		left.m[0] * right.m[4] + left.m[2] * right.m[5] + left.m[4],
+		left.m[1] * right.m[4] + left.m[3] * right.m[5] + left.m[5]
+	};
+}
+
+/// transforms a point, translation included
+template <typename T>
+constexpr Vector<2, T> operator*(const Affine2<T> & left, const Vector<2, T> & right) {
+	return Vector<2, T>(
+		left.m[0] * right.v[0] + left.m[2] * right.v[1] + left.m[4],
+		left.m[1] * right.v[0] + left.m[3] * right.v[1] + left.m[5]
+	);
+}
+
+/// transforms a direction, translation left out
+template <typename T>
+constexpr Vector<2, T> transformDirection(const Affine2<T> & affine, const Vector<2, T> & direction) {
+	return Vector<2, T>(
+		affine.m[0] * direction.v[0] + affine.m[2] * direction.v[1],
+		affine.m[1] * direction.v[0] + affine.m[3] * direction.v[1]
+	);
+}
+
+template <typename T>
+constexpr Affine2<T> inverse(const Affine2<T> & affine) {
+	return Affine2<T>(affine).invert();
+}
+
+template <typename T>
+std::ostream & operator<<(std::ostream & stream, const Affine2<T> & affine) {
+	return stream << '[' << affine.m[0] << ", " << affine.m[2] << ", " << affine.m[4] << "]\n"
+	                 "[" << affine.m[1] << ", " << affine.m[3] << ", " << affine.m[5] << "]\n";
+}
+
+using Affine2f = Affine2<float >;
+using Affine2d = Affine2<double>;
+
+#endif // CNGE_AFFINE2
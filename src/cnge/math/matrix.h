@@ -39,33 +39,49 @@ class Vector;
 
 #include <ostream>
 #include <initializer_list>
+#include <array>
+#include <utility>
 
 #include "Vector.h"
+#include "vectorView.h"
+#include "matrixExpression.h"
+
+/// compile time unrolled kernels shared by every matrix size,
+/// the element loops are expanded over index sequences so that
+/// the products of constant matrices fold at compile time
+namespace MatrixUnroll {
+	template <u32 N, u32 M, u32 N2, typename T, size... K>
+	constexpr T productElement(const T * left, const T * right, u32 row, u32 column, std::index_sequence<K...>) {
+		return ((left[K * M + row] * right[column * N + K]) + ...);
+	}
+
+	template <u32 N, u32 M, u32 N2, typename T, size... I>
+	constexpr std::array<T, N2 * M> product(const T * left, const T * right, std::index_sequence<I...>) {
+		return { productElement<N, M, N2, T>(left, right, I % M, I / M, std::make_index_sequence<N>())... };
+	}
+
+	template <u32 N, u32 M, typename T, size... I>
+	constexpr std::array<T, M * N> transpose(const T * matrix, std::index_sequence<I...>) {
+		return { matrix[(I % N) * M + I / N]... };
+	}
+}
 
 template <u32 N, u32 M, typename T>
-class Matrix {
+class Matrix : public MatrixExpression<N, M, T, Matrix<N, M, T>> {
 
 	static_assert(N > 0 && M > 0, "Matrix dimensions must be greater than 0!");
 
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] m;
-		}
 	public:
-		T * m;
+		T m[N * M];
 
-		Matrix() :
-			m(new T[N * M]()) {}
+		constexpr Matrix() :
+			m() {}
 
-		Matrix(T * m, bool owner = true) noexcept :
-			owner(owner),
-			m(m) {}
+		constexpr Matrix(const std::array<T, N * M> & values) noexcept :
+			Matrix([&](u32 i) { return values[i]; }, std::make_index_sequence<N * M>()) {}
 		
-		Matrix(std::initializer_list<T> list) :
-			m(new T[N * M]) {
+		constexpr Matrix(std::initializer_list<T> list) :
+			m() {
 			auto min  = list.size() < N * M ? list.size() : N * M;
 			auto init = list.begin();
 			for (u32 i = 0; i < min; ++i)
@@ -73,105 +89,105 @@ class Matrix {
 		}
 
 		template <typename T2>
-		Matrix(const Matrix<N, M, T2> & matrix) :
-			m(new T[N * M]) {
-			for (u32 i = 0; i < N * M; ++i)
-				m[i] = (T) matrix.m[i];
-		}
+		constexpr Matrix(const Matrix<N, M, T2> & matrix) :
+			Matrix([&](u32 i) { return (T) matrix.m[i]; }, std::make_index_sequence<N * M>()) {}
 
-		Matrix(const Matrix<N, M, T> & matrix) :
-			m(new T[N * M]) {
-			for (u32 i = 0; i < N * M; ++i)
-				m[i] = matrix.m[i];
-		}
+		constexpr Matrix(const Matrix<N, M, T> & matrix) noexcept = default;
 
-		Matrix(Matrix<N, M, T> && matrix) noexcept :
-			owner(matrix.owner),
-			m(matrix.m) {
-			matrix.owner = false;
-		}
+		/// evaluates a chain of elementwise operators in one pass
+		template <typename E>
+		constexpr Matrix(const MatrixExpression<N, M, T, E> & expression) :
+			Matrix([&](u32 i) { return expression.get(i); }, std::make_index_sequence<N * M>()) {}
 
-		Matrix<N, M, T> & operator=(const Matrix<N, M, T> & matrix) {
-			for (u32 i = 0; i < N * M; ++i)
-				m[i] = matrix.m[i];
-			return *this;
-		}
+		constexpr Matrix<N, M, T> & operator=(const Matrix<N, M, T> & matrix) noexcept = default;
 
-		Matrix<N, M, T> & operator=(Matrix<N, M, T> && matrix) noexcept {
-			clean();
-			owner = matrix.owner;
-			m = matrix.m;
-			matrix.owner = false;
+		template <typename E>
+		constexpr Matrix<N, M, T> & operator=(const MatrixExpression<N, M, T, E> & expression) {
+			assign(expression, std::make_index_sequence<N * M>());
 			return *this;
 		}
 
-		Matrix<N, M, T> & operator+=(const Matrix<N, M, T> & matrix) {
+		template <typename E>
+		constexpr Matrix<N, M, T> & operator+=(const MatrixExpression<N, M, T, E> & matrix) {
 			for (u32 i = 0; i < N * M; ++i)
-				m[i] += matrix.m[i];
+				m[i] += matrix.get(i);
 			return *this;
 		}
 
-		Matrix<N, M, T> & operator-=(const Matrix<N, M, T> & matrix) {
+		template <typename E>
+		constexpr Matrix<N, M, T> & operator-=(const MatrixExpression<N, M, T, E> & matrix) {
 			for (u32 i = 0; i < N * M; ++i)
-				m[i] -= matrix.m[i];
+				m[i] -= matrix.get(i);
 			return *this;
 		}
 
-		Vector<M, T> operator[](u32 index) const noexcept {
-			return Vector<M, T>(index * M, false);
+		constexpr VectorView<M, T> operator[](u32 index) noexcept {
+			return VectorView<M, T>(m + index * M);
+		}
+
+		constexpr VectorView<M, const T> operator[](u32 index) const noexcept {
+			return VectorView<M, const T>(m + index * M);
 		}
 
-		~Matrix() {
-			clean();
+	private:
+		template <typename Element, size... I>
+		constexpr Matrix(Element element, std::index_sequence<I...>) :
+			m { element(I)... } {}
+
+		template <typename E, size... I>
+		constexpr void assign(const MatrixExpression<N, M, T, E> & expression, std::index_sequence<I...>) {
+			((m[I] = expression.get(I)), ...);
 		}
 };
 
-template <u32 N, u32 M, typename T>
-Matrix<N, M, T> operator+(const Matrix<N, M, T> & left, const Matrix<N, M, T> & right) {
-	auto sum = new T[N * M];
-	for (u32 i = 0; i < N * M; ++i)
-		sum[i] = left.m[i] + right.m[i];
-	return sum;
+template <u32 N, u32 M, typename T, typename L, typename R>
+constexpr MatrixBinary<N, M, T, L, R, std::plus<>> operator+(const MatrixExpression<N, M, T, L> & left, const MatrixExpression<N, M, T, R> & right) {
+	return MatrixBinary<N, M, T, L, R, std::plus<>>(static_cast<const L &>(left), static_cast<const R &>(right));
 }
 
-template <u32 N, u32 M, typename T>
-Matrix<N, M, T> operator-(const Matrix<N, M, T> & left, const Matrix<N, M, T> & right) {
-	auto difference = new T[N * M];
-	for (u32 i = 0; i < N * M; ++i)
-		difference[i] = left.m[i] - right.m[i];
-	return difference;
+template <u32 N, u32 M, typename T, typename L, typename R>
+constexpr MatrixBinary<N, M, T, L, R, std::minus<>> operator-(const MatrixExpression<N, M, T, L> & left, const MatrixExpression<N, M, T, R> & right) {
+	return MatrixBinary<N, M, T, L, R, std::minus<>>(static_cast<const L &>(left), static_cast<const R &>(right));
 }
 
-template <u32 N, u32 N2, u32 M, typename T>
-Matrix<N2, M, T> operator*(const Matrix<N, M, T> & left, const Matrix<N2, N, T> & right) {
-	auto product = new T[N2 * M];
-	for (u32 i = 0; i < M; ++i) {
-		for (u32 j = 0; j < N2; ++j) {
-			product[j * M + i] = 0;
-			for (u32 k = 0; k < N; ++k)
-				product[j * M + i] += left.m[k * M + i] * right.m[j * N + k];
-		}
-	}
-	return product;
+template <u32 N, u32 M, typename T, typename E>
+constexpr MatrixScalar<N, M, T, E, std::multiplies<>> operator*(const MatrixExpression<N, M, T, E> & left, T right) {
+	return MatrixScalar<N, M, T, E, std::multiplies<>>(static_cast<const E &>(left), right);
+}
+
+template <u32 N, u32 M, typename T, typename E>
+constexpr MatrixScalar<N, M, T, E, std::divides<>> operator/(const MatrixExpression<N, M, T, E> & left, T right) {
+	return MatrixScalar<N, M, T, E, std::divides<>>(static_cast<const E &>(left), right);
+}
+
+template <u32 N, u32 M, typename T, typename E>
+constexpr MatrixScalar<N, M, T, E, std::multiplies<>> operator*(T left, const MatrixExpression<N, M, T, E> & right) {
+	return MatrixScalar<N, M, T, E, std::multiplies<>>(static_cast<const E &>(right), left);
+}
+
+template <u32 N, u32 N2, u32 M, typename T, typename L, typename R>
+constexpr Matrix<N2, M, T> operator*(const MatrixExpression<N, M, T, L> & leftExpression, const MatrixExpression<N2, N, T, R> & rightExpression) {
+	const auto & left  = evaluate(leftExpression);
+	const auto & right = evaluate(rightExpression);
+	return MatrixUnroll::product<N, M, N2, T>(left.m, right.m, std::make_index_sequence<N2 * M>());
 }
 
 template <u32 N, u32 M, typename T>
-Vector<M, T> operator*(const Matrix<N, M, T> & left, const Vector<N, T> & right) {
-	auto product = new T[M];
-	for (u32 i = 0; i < M; ++i) {
-		product[i] = 0;
-		for (u32 j = 0; j < N; ++j) 
-			product[i] += left.m[j * M + i] * right.v[j];
-	}
-	return product;
+constexpr Vector<M, T> operator*(const Matrix<N, M, T> & left, const Vector<N, T> & right) {
+	return MatrixUnroll::product<N, M, 1, T>(left.m, right.v, std::make_index_sequence<M>());
 }
 
 template <u32 N, u32 M, typename T>
-std::ostream & operator<<(std::ostream & stream, const Matrix<N, M, T> & matrix) {
+constexpr Matrix<M, N, T> transpose(const Matrix<N, M, T> & matrix) {
+	return MatrixUnroll::transpose<N, M, T>(matrix.m, std::make_index_sequence<M * N>());
+}
+
+template <u32 N, u32 M, typename T, typename E>
+std::ostream & operator<<(std::ostream & stream, const MatrixExpression<N, M, T, E> & matrix) {
 	for (u32 i = 0; i < M; ++i) {
 		stream << '[';
 		for (u32 j = 0; j < N; ++j) {
-			stream << matrix.m[j * M + i];
+			stream << matrix.get(j * M + i);
 			if (j < N - 1)
 				stream << ", ";
 		}
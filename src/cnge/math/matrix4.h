@@ -79,26 +79,21 @@ class Matrix<N, N, T>;
 
 #include <ostream>
 #include <cmath>
+#include <array>
 
 #include "vector2.h"
 #include "vector3.h"
 #include "vector4.h"
 #include "matrixN.h"
+#include "vectorView.h"
 
 template <typename T>
 class Matrix<4, 4, T> {
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] m;
-		}
 	public:
-		T * m;
+		T m[4 * 4];
 
-		static Matrix<4, 4, T> makeIdentity() {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeIdentity() {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -106,8 +101,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeOrthographic(T left, T right, T bottom, T top, T near, T far) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeOrthographic(T left, T right, T bottom, T top, T near, T far) {
+			return std::array<T, 4 * 4> {
 				2 / (right - left), 0, 0, 0,
 				0, 2 / (top - bottom), 0, 0,
 				0, 0, 2 / (far  -  near), 0,
@@ -117,7 +112,7 @@ class Matrix<4, 4, T> {
 
 		static Matrix<4, 4, T> makePerspective(T fovY, T aspectRatio, T near, T far) {
 			auto vertical = 1 / tan(fovY / 2);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				vertical / aspectRatio, 0, 0, 0,
 				0, vertical, 0, 0,
 				0, 0, (near + far) / (near - far), -1,
@@ -129,7 +124,7 @@ class Matrix<4, 4, T> {
 			auto sinAxis = sin(axisAngle);
 			auto cosAxis = cos(axisAngle);
 			auto tanShear = tan(shearAngle);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				sinAxis * tanShear * cosAxis, -cosAxis * tanShear * cosAxis, 0, 0,
 				sinAxis * tanShear * sinAxis, -cosAxis * tanShear * sinAxis, 0, 0,
 				0, 0, 1, 0,
@@ -140,7 +135,7 @@ class Matrix<4, 4, T> {
 		static Matrix<4, 4, T> makeShear2D(const Vector<2, T> & axis, T shearAngle) {
 			auto unitAxis = normalize(axis); 
 			auto tanShear = tan(shearAngle);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				unitAxis.v[1] * tanShear * unitAxis.v[0], -unitAxis.v[0] * tanShear * unitAxis.v[0], 0, 0,
 				unitAxis.v[1] * tanShear * unitAxis.v[1], -unitAxis.v[0] * tanShear * unitAxis.v[1], 0, 0,
 				0, 0, 1, 0,
@@ -152,7 +147,7 @@ class Matrix<4, 4, T> {
 			auto sinAxis = sin(axisAngle);
 			auto cosAxis = cos(axisAngle);
 			auto tanShear = shear.v[1] / shear.v[0];
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				sinAxis * tanShear * cosAxis, -cosAxis * tanShear * cosAxis, 0, 0,
 				sinAxis * tanShear * sinAxis, -cosAxis * tanShear * sinAxis, 0, 0,
 				0, 0, 1, 0,
@@ -163,7 +158,7 @@ class Matrix<4, 4, T> {
 		static Matrix<4, 4, T> makeShear2D(const Vector<2, T> & axis, const Vector<2, T> & shear) {
 			auto unitAxis = normalize(axis);
 			auto tanShear = shear.v[1] / shear.v[0];
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				unitAxis.v[1] * tanShear * unitAxis.v[0], -unitAxis.v[0] * tanShear * unitAxis.v[0], 0, 0,
 				unitAxis.v[1] * tanShear * unitAxis.v[1], -unitAxis.v[0] * tanShear * unitAxis.v[1], 0, 0,
 				0, 0, 1, 0,
@@ -172,7 +167,7 @@ class Matrix<4, 4, T> {
 		}
 		
 		static Matrix<4, 4, T> makeShear2DX(T angle) {
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				1, -tan(angle), 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -180,8 +175,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 		
-		static Matrix<4, 4, T> makeShear2DX(const Vector<2, T> & shear) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeShear2DX(const Vector<2, T> & shear) {
+			return std::array<T, 4 * 4> {
 				1, -shear.v[1] / shear.v[0], 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -190,7 +185,7 @@ class Matrix<4, 4, T> {
 		}
 		
 		static Matrix<4, 4, T> makeShear2DY(T angle) {
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				tan(angle), 1, 0, 0,
 				0, 0, 1, 0,
@@ -198,8 +193,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 		
-		static Matrix<4, 4, T> makeShear2DY(const Vector<2, T> & shear) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeShear2DY(const Vector<2, T> & shear) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				shear.v[1] / shear.v[0], 1, 0, 0,
 				0, 0, 1, 0,
@@ -207,8 +202,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslate2D(T translateX, T translateY) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslate2D(T translateX, T translateY) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -216,8 +211,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslate2D(const Vector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslate2D(const Vector<2, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -225,8 +220,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslate(T translateX, T translateY, T translateZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslate(T translateX, T translateY, T translateZ) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -234,8 +229,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslate(const Vector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslate(const Vector<3, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -246,7 +241,7 @@ class Matrix<4, 4, T> {
 		static Matrix<4, 4, T> makeRotate2D(T rotation) {
 			auto sinZ = sin(rotation);
 			auto cosZ = cos(rotation);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ, sinZ, 0, 0,
 				-sinZ, cosZ, 0, 0,
 				0, 0, 1, 0,
@@ -254,8 +249,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScale2D(T scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScale2D(T scale) {
+			return std::array<T, 4 * 4> {
 				scale, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, 1, 0,
@@ -263,8 +258,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScale2D(T scaleX, T scaleY) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScale2D(T scaleX, T scaleY) {
+			return std::array<T, 4 * 4> {
 				scaleX, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, 1, 0,
@@ -272,8 +267,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScale2D(const Vector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScale2D(const Vector<2, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[0], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, 1, 0,
@@ -281,8 +276,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScale(T scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScale(T scale) {
+			return std::array<T, 4 * 4> {
 				scale, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, scale, 0,
@@ -290,8 +285,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScale(T scaleX, T scaleY, T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScale(T scaleX, T scaleY, T scaleZ) {
+			return std::array<T, 4 * 4> {
 				scaleX, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, scaleZ, 0,
@@ -299,8 +294,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScale(const Vector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScale(const Vector<3, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[0], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, scale.v[2], 0,
@@ -308,8 +303,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateX(T translateX) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateX(T translateX) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -317,8 +312,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateY(T translateY) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateY(T translateY) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -326,8 +321,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateZ(T translateZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateZ(T translateZ) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -335,8 +330,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateXY(T translateX, T translateY) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateXY(T translateX, T translateY) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -344,8 +339,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateXY(const Vector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateXY(const Vector<2, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -353,8 +348,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateXZ(T translateX, T translateZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateXZ(T translateX, T translateZ) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -362,8 +357,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateXZ(const Vector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateXZ(const Vector<2, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -371,8 +366,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateYX(const Vector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateYX(const Vector<2, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -380,8 +375,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateYZ(T translateY, T translateZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateYZ(T translateY, T translateZ) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -389,8 +384,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateYZ(const Vector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateYZ(const Vector<2, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -398,8 +393,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateZX(const Vector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateZX(const Vector<2, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -407,8 +402,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateZY(const Vector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateZY(const Vector<2, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -416,8 +411,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateXYZ(T translateX, T translateY, T translateZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateXYZ(T translateX, T translateY, T translateZ) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -425,8 +420,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateXYZ(const Vector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateXYZ(const Vector<3, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -434,8 +429,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateXZY(const Vector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateXZY(const Vector<3, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -443,8 +438,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateYXZ(const Vector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateYXZ(const Vector<3, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -452,8 +447,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateYZX(const Vector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateYZX(const Vector<3, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -461,8 +456,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateZXY(const Vector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateZXY(const Vector<3, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -470,8 +465,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeTranslateZYX(const Vector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeTranslateZYX(const Vector<3, T> & translate) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -482,7 +477,7 @@ class Matrix<4, 4, T> {
 		static Matrix<4, 4, T> makeRotateX(T rotateX) {
 			auto sinX = sin(rotateX);
 			auto cosX = cos(rotateX);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, cosX, sinX, 0,
 				0, -sinX, cosX, 0,
@@ -493,7 +488,7 @@ class Matrix<4, 4, T> {
 		static Matrix<4, 4, T> makeRotateY(T rotateY) {
 			auto sinY = sin(rotateY);
 			auto cosY = cos(rotateY);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosY, 0, -sinY, 0,
 				0, 1, 0, 0,
 				sinY, 0, cosY, 0,
@@ -504,7 +499,7 @@ class Matrix<4, 4, T> {
 		static Matrix<4, 4, T> makeRotateZ(T rotateZ) {
 			auto sinZ = sin(rotateZ);
 			auto cosZ = cos(rotateZ);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ, sinZ, 0, 0,
 				-sinZ, cosZ, 0, 0,
 				0, 0, 1, 0,
@@ -517,7 +512,7 @@ class Matrix<4, 4, T> {
 			auto cosX = cos(rotateX);
 			auto sinY = sin(rotateY);
 			auto cosY = cos(rotateY);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosY, 0, -sinY, 0,
 				sinY * sinX, cosX, cosY * sinX, 0,
 				sinY * cosX, -sinX, cosY * cosX, 0,
@@ -530,7 +525,7 @@ class Matrix<4, 4, T> {
 			auto cosX = cos(rotate.v[0]);
 			auto sinY = sin(rotate.v[1]);
 			auto cosY = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosY, 0, -sinY, 0,
 				sinY * sinX, cosX, cosY * sinX, 0,
 				sinY * cosX, -sinX, cosY * cosX, 0,
@@ -543,7 +538,7 @@ class Matrix<4, 4, T> {
 			auto cosX = cos(rotateX);
 			auto sinZ = sin(rotateZ);
 			auto cosZ = cos(rotateZ);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ, sinZ, 0, 0,
 				-sinZ * cosX, cosZ * cosX, sinX, 0,
 				sinZ * sinX, -cosZ * sinX, cosX, 0,
@@ -556,7 +551,7 @@ class Matrix<4, 4, T> {
 			auto cosX = cos(rotate.v[0]);
 			auto sinZ = sin(rotate.v[1]);
 			auto cosZ = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ, sinZ, 0, 0,
 				-sinZ * cosX, cosZ * cosX, sinX, 0,
 				sinZ * sinX, -cosZ * sinX, cosX, 0,
@@ -569,7 +564,7 @@ class Matrix<4, 4, T> {
 			auto cosX = cos(rotate.v[1]);
 			auto sinY = sin(rotate.v[0]);
 			auto cosY = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosY, sinX * sinY, -cosX * sinY, 0,
 				0, cosX, sinX, 0,
 				sinY, -sinX * cosY, cosX * cosY, 0,
@@ -582,7 +577,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotateY);
 			auto sinZ = sin(rotateZ);
 			auto cosZ = cos(rotateZ);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ * cosY, sinZ * cosY, -sinY, 0,
 				-sinZ, cosZ, 0, 0,
 				cosZ * sinY, sinZ * sinY, cosY, 0,
@@ -595,7 +590,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotate.v[0]);
 			auto sinZ = sin(rotate.v[1]);
 			auto cosZ = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ * cosY, sinZ * cosY, -sinY, 0,
 				-sinZ, cosZ, 0, 0,
 				cosZ * sinY, sinZ * sinY, cosY, 0,
@@ -608,7 +603,7 @@ class Matrix<4, 4, T> {
 			auto cosX = cos(rotate.v[1]);
 			auto sinZ = sin(rotate.v[0]);
 			auto cosZ = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ, cosX * sinZ, sinX * sinZ, 0,
 				-sinZ, cosX * cosZ, sinX * cosZ, 0,
 				0, -sinX, cosX, 0,
@@ -621,7 +616,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotate.v[1]);
 			auto sinZ = sin(rotate.v[0]);
 			auto cosZ = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosY * cosZ, sinZ, -sinY * cosZ, 0,
 				-cosY * sinZ, cosZ, sinY * sinZ, 0,
 				sinY, 0, cosY, 0,
@@ -636,7 +631,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotateY);
 			auto sinZ = sin(rotateZ);
 			auto cosZ = cos(rotateZ);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ * cosY, sinZ * cosY, -sinY, 0,
 				-sinZ * cosX + cosZ * sinY * sinX, cosZ * cosX + sinZ * sinY * sinX, cosY * sinX, 0,
 				sinZ * sinX + cosZ * sinY * cosX, -cosZ * sinX + sinZ * sinY * cosX, cosY * cosX, 0,
@@ -651,7 +646,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotate.v[1]);
 			auto sinZ = sin(rotate.v[2]);
 			auto cosZ = cos(rotate.v[2]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ * cosY, sinZ * cosY, -sinY, 0,
 				-sinZ * cosX + cosZ * sinY * sinX, cosZ * cosX + sinZ * sinY * sinX, cosY * sinX, 0,
 				sinZ * sinX + cosZ * sinY * cosX, -cosZ * sinX + sinZ * sinY * cosX, cosY * cosX, 0,
@@ -666,7 +661,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotate.v[2]);
 			auto sinZ = sin(rotate.v[1]);
 			auto cosZ = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosY * cosZ, sinZ, -sinY * cosZ, 0,
 				-cosY * sinZ * cosX + sinY * sinX, cosZ * cosX, sinY * sinZ * cosX + cosY * sinX, 0,
 				cosY * sinZ * sinX + sinY * cosX, -cosZ * sinX, -sinY * sinZ * sinX + cosY * cosX, 0,
@@ -681,7 +676,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotate.v[0]);
 			auto sinZ = sin(rotate.v[2]);
 			auto cosZ = cos(rotate.v[2]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ * cosY - sinZ * sinX * sinY, sinZ * cosY + cosZ * sinX * sinY, -cosX * sinY, 0,
 				-sinZ * cosX, cosZ * cosX, sinX, 0,
 				cosZ * sinY + sinZ * sinX * cosY, sinZ * sinY - cosZ * sinX * cosY, cosX * cosY, 0,
@@ -696,7 +691,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotate.v[0]);
 			auto sinZ = sin(rotate.v[1]);
 			auto cosZ = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosZ * cosY, cosX * sinZ * cosY + sinX * sinY, sinX * sinZ * cosY - cosX * sinY, 0,
 				-sinZ, cosX * cosZ, sinX * cosZ, 0,
 				cosZ * sinY, cosX * sinZ * sinY - sinX * cosY, sinX * sinZ * sinY + cosX * cosY, 0,
@@ -711,7 +706,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotate.v[2]);
 			auto sinZ = sin(rotate.v[0]);
 			auto cosZ = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosY * cosZ + sinY * sinX * sinZ, cosX * sinZ, -sinY * cosZ + cosY * sinX * sinZ, 0,
 				-cosY * sinZ + sinY * sinX * cosZ, cosX * cosZ, sinY * sinZ + cosY * sinX * cosZ, 0,
 				sinY * cosX, -sinX, cosY * cosX, 0,
@@ -726,7 +721,7 @@ class Matrix<4, 4, T> {
 			auto cosY = cos(rotate.v[1]);
 			auto sinZ = sin(rotate.v[0]);
 			auto cosZ = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			return std::array<T, 4 * 4> {
 				cosY * cosZ, sinX * sinY * cosZ + cosX * sinZ, -cosX * sinY * cosZ + sinX * sinZ, 0,
 				-cosY * sinZ, -sinX * sinY * sinZ + cosX * cosZ, cosX * sinY * sinZ + sinX * cosZ, 0,
 				sinY, -sinX * cosY, cosX * cosY, 0,
@@ -734,8 +729,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleX(T scaleX) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleX(T scaleX) {
+			return std::array<T, 4 * 4> {
 				scaleX, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
@@ -743,8 +738,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleY(T scaleY) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleY(T scaleY) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, 1, 0,
@@ -752,8 +747,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleZ(T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleZ(T scaleZ) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scaleZ, 0,
@@ -761,8 +756,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXY(T scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXY(T scale) {
+			return std::array<T, 4 * 4> {
 				scale, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, 1, 0,
@@ -770,8 +765,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXY(T scaleX, T scaleY) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXY(T scaleX, T scaleY) {
+			return std::array<T, 4 * 4> {
 				scaleX, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, 1, 0,
@@ -779,8 +774,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXY(const Vector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXY(const Vector<2, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[0], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, 1, 0,
@@ -788,8 +783,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXZ(T scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXZ(T scale) {
+			return std::array<T, 4 * 4> {
 				scale, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scale, 0,
@@ -797,8 +792,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXZ(T scaleX, T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXZ(T scaleX, T scaleZ) {
+			return std::array<T, 4 * 4> {
 				scaleX, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scaleZ, 0,
@@ -806,8 +801,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXZ(const Vector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXZ(const Vector<2, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[0], 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scale.v[1], 0,
@@ -815,8 +810,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleYX(const Vector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleYX(const Vector<2, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[1], 0, 0, 0,
 				0, scale.v[0], 0, 0,
 				0, 0, 1, 0,
@@ -824,8 +819,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleYZ(T scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleYZ(T scale) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, scale, 0,
@@ -833,8 +828,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleYZ(T scaleY, T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleYZ(T scaleY, T scaleZ) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, scaleZ, 0,
@@ -842,8 +837,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleYZ(const Vector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleYZ(const Vector<2, T> & scale) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, scale.v[0], 0, 0,
 				0, 0, scale.v[1], 0,
@@ -851,8 +846,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleZX(const Vector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleZX(const Vector<2, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[1], 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scale.v[0], 0,
@@ -860,8 +855,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleZY(const Vector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleZY(const Vector<2, T> & scale) {
+			return std::array<T, 4 * 4> {
 				1, 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, scale.v[0], 0,
@@ -869,8 +864,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXYZ(T scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXYZ(T scale) {
+			return std::array<T, 4 * 4> {
 				scale, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, scale, 0,
@@ -878,8 +873,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXYZ(T scaleX, T scaleY, T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXYZ(T scaleX, T scaleY, T scaleZ) {
+			return std::array<T, 4 * 4> {
 				scaleX, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, scaleZ, 0,
@@ -887,8 +882,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXYZ(const Vector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXYZ(const Vector<3, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[0], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, scale.v[2], 0,
@@ -896,8 +891,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleXZY(const Vector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleXZY(const Vector<3, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[0], 0, 0, 0,
 				0, scale.v[2], 0, 0,
 				0, 0, scale.v[1], 0,
@@ -905,8 +900,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleYXZ(const Vector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleYXZ(const Vector<3, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[1], 0, 0, 0,
 				0, scale.v[0], 0, 0,
 				0, 0, scale.v[2], 0,
@@ -914,8 +909,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleYZX(const Vector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleYZX(const Vector<3, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[2], 0, 0, 0,
 				0, scale.v[0], 0, 0,
 				0, 0, scale.v[1], 0,
@@ -923,8 +918,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleZXY(const Vector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleZXY(const Vector<3, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[1], 0, 0, 0,
 				0, scale.v[2], 0, 0,
 				0, 0, scale.v[0], 0,
@@ -932,8 +927,8 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		static Matrix<4, 4, T> makeScaleZYX(const Vector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr Matrix<4, 4, T> makeScaleZYX(const Vector<3, T> & scale) {
+			return std::array<T, 4 * 4> {
 				scale.v[2], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, scale.v[0], 0,
@@ -941,100 +936,37 @@ class Matrix<4, 4, T> {
 			};
 		}
 
-		Matrix() :
-			m(new T[4 * 4]()) {}
+		constexpr Matrix() :
+			m() {}
 
-		Matrix(T * m, bool owner = true) noexcept :
-			owner(owner),
-			m(m) {}
+		constexpr Matrix(const std::array<T, 4 * 4> & values) noexcept {
+			for (u32 i = 0; i < 4 * 4; ++i)
+				m[i] = values[i];
+		}
 		
-		Matrix(T a, T b, T c, T d,
+		constexpr Matrix(T a, T b, T c, T d,
 				   T e, T f, T g, T h,
 				   T i, T j, T k, T l,
 				   T m, T n, T o, T p) :
-			m(new T[4 * 4] {
+			m {
 				a, e, i, m,
 				b, f, j, n,
 				c, g, k, o,
 				d, h, l, p
-			}) {}
+			} {}
 
 		template <typename T2>
-		Matrix(const Matrix<4, 4, T2> & matrix) :
-			m(new T[4 * 4]) {
-			m[0 ] = (T) matrix.m[0 ];
-			m[1 ] = (T) matrix.m[1 ];
-			m[2 ] = (T) matrix.m[2 ];
-			m[3 ] = (T) matrix.m[3 ];
-			m[4 ] = (T) matrix.m[4 ];
-			m[5 ] = (T) matrix.m[5 ];
-			m[6 ] = (T) matrix.m[6 ];
-			m[7 ] = (T) matrix.m[7 ];
-			m[8 ] = (T) matrix.m[8 ];
-			m[9 ] = (T) matrix.m[9 ];
-			m[10] = (T) matrix.m[10];
-			m[11] = (T) matrix.m[11];
-			m[12] = (T) matrix.m[12];
-			m[13] = (T) matrix.m[13];
-			m[14] = (T) matrix.m[14];
-			m[15] = (T) matrix.m[15];
-		}
-
-		Matrix(const Matrix<4, 4, T> & matrix) :
-			m(new T[4 * 4]) {
-			m[0 ] = matrix.m[0 ];
-			m[1 ] = matrix.m[1 ];
-			m[2 ] = matrix.m[2 ];
-			m[3 ] = matrix.m[3 ];
-			m[4 ] = matrix.m[4 ];
-			m[5 ] = matrix.m[5 ];
-			m[6 ] = matrix.m[6 ];
-			m[7 ] = matrix.m[7 ];
-			m[8 ] = matrix.m[8 ];
-			m[9 ] = matrix.m[9 ];
-			m[10] = matrix.m[10];
-			m[11] = matrix.m[11];
-			m[12] = matrix.m[12];
-			m[13] = matrix.m[13];
-			m[14] = matrix.m[14];
-			m[15] = matrix.m[15];
-		}
-
-		Matrix(Matrix<4, 4, T> && matrix) noexcept :
-			owner(matrix.owner),
-			m(matrix.m) {
-			matrix.owner = false;
-		}
-
-		Matrix<4, 4, T> & operator=(const Matrix<4, 4, T> & matrix) {
-			m[0 ] = matrix.m[0 ];
-			m[1 ] = matrix.m[1 ];
-			m[2 ] = matrix.m[2 ];
-			m[3 ] = matrix.m[3 ];
-			m[4 ] = matrix.m[4 ];
-			m[5 ] = matrix.m[5 ];
-			m[6 ] = matrix.m[6 ];
-			m[7 ] = matrix.m[7 ];
-			m[8 ] = matrix.m[8 ];
-			m[9 ] = matrix.m[9 ];
-			m[10] = matrix.m[10];
-			m[11] = matrix.m[11];
-			m[12] = matrix.m[12];
-			m[13] = matrix.m[13];
-			m[14] = matrix.m[14];
-			m[15] = matrix.m[15];
-			return *this;
-		}
-
-		Matrix<4, 4, T> & operator=(Matrix<4, 4, T> && matrix) noexcept {
-			clean();
-			owner = matrix.owner;
-			m = matrix.m;
-			matrix.owner = false;
-			return *this;
-		}
-
-		Matrix<4, 4, T> & operator+=(const Matrix<4, 4, T> & matrix) {
+		constexpr Matrix(const Matrix<4, 4, T2> & matrix) :
+			m() {
+			for (u32 i = 0; i < 4 * 4; ++i)
+				m[i] = (T) matrix.m[i];
+		}
+
+		constexpr Matrix(const Matrix<4, 4, T> & matrix) noexcept = default;
+
+		constexpr Matrix<4, 4, T> & operator=(const Matrix<4, 4, T> & matrix) noexcept = default;
+
+		constexpr Matrix<4, 4, T> & operator+=(const Matrix<4, 4, T> & matrix) {
 			m[0 ] += matrix.m[0 ];
 			m[1 ] += matrix.m[1 ];
 			m[2 ] += matrix.m[2 ];
@@ -1054,7 +986,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & operator-=(const Matrix<4, 4, T> & matrix) {
+		constexpr Matrix<4, 4, T> & operator-=(const Matrix<4, 4, T> & matrix) {
 			m[0 ] -= matrix.m[0 ];
 			m[1 ] -= matrix.m[1 ];
 			m[2 ] -= matrix.m[2 ];
@@ -1074,15 +1006,58 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & operator*=(const Matrix<4, 4, T> & matrix) {
+		constexpr Matrix<4, 4, T> & operator*=(const Matrix<4, 4, T> & matrix) {
 			return *this = *this * matrix;
 		}
 
-		Vector<4, T> operator[](u32 index) const noexcept {
-			return Vector<4, T>(index * 4, false);
+		VectorView<4, T> operator[](u32 index) noexcept {
+			return VectorView<4, T>(m + index * 4);
+		}
+
+		VectorView<4, const T> operator[](u32 index) const noexcept {
+			return VectorView<4, const T>(m + index * 4);
 		}
 
-		Matrix<4, 4, T> & setIdentity() {
+		constexpr Matrix<4, 4, T> & transpose() {
+			T newM[] = {
+				m[0], m[4], m[8 ], m[12],
+				m[1], m[5], m[9 ], m[13],
+				m[2], m[6], m[10], m[14],
+				m[3], m[7], m[11], m[15],
+			};
+			for (u32 i = 0; i < 4 * 4; ++i)
+				m[i] = newM[i];
+			return *this;
+		}
+
+		/// a singular matrix comes back full of infinities,
+		/// check det first if that can happen
+		constexpr Matrix<4, 4, T> & invert() {
+			T newM[] = {
+				 m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10],
+				-m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10],
+				 m[1] * m[6 ] * m[15] - m[1] * m[7 ] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7 ] - m[13] * m[3] * m[6 ],
+				-m[1] * m[6 ] * m[11] + m[1] * m[7 ] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9 ] * m[2] * m[7 ] + m[9 ] * m[3] * m[6 ],
+				-m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10],
+				 m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10],
+				-m[0] * m[6 ] * m[15] + m[0] * m[7 ] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7 ] + m[12] * m[3] * m[6 ],
+				 m[0] * m[6 ] * m[11] - m[0] * m[7 ] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8 ] * m[2] * m[7 ] - m[8 ] * m[3] * m[6 ],
+				 m[4] * m[9 ] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9 ],
+				-m[0] * m[9 ] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9 ],
+				 m[0] * m[5 ] * m[15] - m[0] * m[7 ] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7 ] - m[12] * m[3] * m[5 ],
+				-m[0] * m[5 ] * m[11] + m[0] * m[7 ] * m[9 ] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9 ] - m[8 ] * m[1] * m[7 ] + m[8 ] * m[3] * m[5 ],
+				-m[4] * m[9 ] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9 ],
+				 m[0] * m[9 ] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9 ],
+				-m[0] * m[5 ] * m[14] + m[0] * m[6 ] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6 ] + m[12] * m[2] * m[5 ],
+				 m[0] * m[5 ] * m[10] - m[0] * m[6 ] * m[9 ] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9 ] + m[8 ] * m[1] * m[6 ] - m[8 ] * m[2] * m[5 ],
+			};
+			auto inverseDet = 1 / (m[0] * newM[0] + m[1] * newM[4] + m[2] * newM[8] + m[3] * newM[12]);
+			for (u32 i = 0; i < 4 * 4; ++i)
+				m[i] = newM[i] * inverseDet;
+			return *this;
+		}
+
+		constexpr Matrix<4, 4, T> & setIdentity() {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1102,7 +1077,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setOrthographic(T left, T right, T bottom, T top, T near, T far) {
+		constexpr Matrix<4, 4, T> & setOrthographic(T left, T right, T bottom, T top, T near, T far) {
 			m[0 ] = 2 / (right - left);
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1253,7 +1228,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 		
-		Matrix<4, 4, T> & setShear2DX(const Vector<2, T> & shear) {
+		constexpr Matrix<4, 4, T> & setShear2DX(const Vector<2, T> & shear) {
 			m[0 ] = 1;
 			m[1 ] = -shear.v[1] / shear.v[0];
 			m[2 ] = 0;
@@ -1293,7 +1268,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 		
-		Matrix<4, 4, T> & setShear2DY(const Vector<2, T> & shear) {
+		constexpr Matrix<4, 4, T> & setShear2DY(const Vector<2, T> & shear) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1313,7 +1288,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslate2D(T translateX, T translateY) {
+		constexpr Matrix<4, 4, T> & setTranslate2D(T translateX, T translateY) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1333,7 +1308,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslate2D(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslate2D(const Vector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1353,7 +1328,30 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslate(T translateX, T translateY, T translateZ) {
+		/// setTranslate2D(x, y).rotate2D(rotation).scale2D(width, height) in one go
+		Matrix<4, 4, T> & setTransform2D(T translateX, T translateY, T rotation, T scaleX, T scaleY) {
+			auto sinZ = sin(rotation);
+			auto cosZ = cos(rotation);
+			m[0 ] = cosZ * scaleX;
+			m[1 ] = sinZ * scaleX;
+			m[2 ] = 0;
+			m[3 ] = 0;
+			m[4 ] = -sinZ * scaleY;
+			m[5 ] = cosZ * scaleY;
+			m[6 ] = 0;
+			m[7 ] = 0;
+			m[8 ] = 0;
+			m[9 ] = 0;
+			m[10] = 1;
+			m[11] = 0;
+			m[12] = translateX;
+			m[13] = translateY;
+			m[14] = 0;
+			m[15] = 1;
+			return *this;
+		}
+
+		constexpr Matrix<4, 4, T> & setTranslate(T translateX, T translateY, T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1373,7 +1371,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslate(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslate(const Vector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1415,7 +1413,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScale2D(T scale) {
+		constexpr Matrix<4, 4, T> & setScale2D(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1435,7 +1433,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScale2D(T scaleX, T scaleY) {
+		constexpr Matrix<4, 4, T> & setScale2D(T scaleX, T scaleY) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1455,7 +1453,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScale2D(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScale2D(const Vector<2, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1475,7 +1473,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScale(T scale) {
+		constexpr Matrix<4, 4, T> & setScale(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1495,7 +1493,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScale(T scaleX, T scaleY, T scaleZ) {
+		constexpr Matrix<4, 4, T> & setScale(T scaleX, T scaleY, T scaleZ) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1515,7 +1513,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScale(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScale(const Vector<3, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1535,7 +1533,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateX(T translateX) {
+		constexpr Matrix<4, 4, T> & setTranslateX(T translateX) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1555,7 +1553,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateY(T translateY) {
+		constexpr Matrix<4, 4, T> & setTranslateY(T translateY) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1575,7 +1573,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateZ(T translateZ) {
+		constexpr Matrix<4, 4, T> & setTranslateZ(T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1595,7 +1593,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateXY(T translateX, T translateY) {
+		constexpr Matrix<4, 4, T> & setTranslateXY(T translateX, T translateY) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1615,7 +1613,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateXY(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateXY(const Vector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1635,7 +1633,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateXZ(T translateX, T translateZ) {
+		constexpr Matrix<4, 4, T> & setTranslateXZ(T translateX, T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1655,7 +1653,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateXZ(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateXZ(const Vector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1675,7 +1673,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateYX(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateYX(const Vector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1695,7 +1693,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateYZ(T translateY, T translateZ) {
+		constexpr Matrix<4, 4, T> & setTranslateYZ(T translateY, T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1715,7 +1713,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateYZ(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateYZ(const Vector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1735,7 +1733,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateZX(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateZX(const Vector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1755,7 +1753,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateZY(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateZY(const Vector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1775,7 +1773,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateXYZ(T translateX, T translateY, T translateZ) {
+		constexpr Matrix<4, 4, T> & setTranslateXYZ(T translateX, T translateY, T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1795,7 +1793,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateXYZ(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateXYZ(const Vector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1815,7 +1813,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateXZY(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateXZY(const Vector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1835,7 +1833,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateYXZ(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateYXZ(const Vector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1855,7 +1853,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateYZX(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateYZX(const Vector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1875,7 +1873,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateZXY(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateZXY(const Vector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1895,7 +1893,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setTranslateZYX(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & setTranslateZYX(const Vector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2379,7 +2377,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleX(T scaleX) {
+		constexpr Matrix<4, 4, T> & setScaleX(T scaleX) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2399,7 +2397,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleY(T scaleY) {
+		constexpr Matrix<4, 4, T> & setScaleY(T scaleY) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2419,7 +2417,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleZ(T scaleZ) {
+		constexpr Matrix<4, 4, T> & setScaleZ(T scaleZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2439,7 +2437,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXY(T scale) {
+		constexpr Matrix<4, 4, T> & setScaleXY(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2459,7 +2457,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXY(T scaleX, T scaleY) {
+		constexpr Matrix<4, 4, T> & setScaleXY(T scaleX, T scaleY) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2479,7 +2477,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXY(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleXY(const Vector<2, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2499,7 +2497,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXZ(T scale) {
+		constexpr Matrix<4, 4, T> & setScaleXZ(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2519,7 +2517,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXZ(T scaleX, T scaleZ) {
+		constexpr Matrix<4, 4, T> & setScaleXZ(T scaleX, T scaleZ) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2539,7 +2537,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXZ(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleXZ(const Vector<2, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2559,7 +2557,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleYX(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleYX(const Vector<2, T> & scale) {
 			m[0 ] = scale.v[1];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2579,7 +2577,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleYZ(T scale) {
+		constexpr Matrix<4, 4, T> & setScaleYZ(T scale) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2599,7 +2597,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleYZ(T scaleY, T scaleZ) {
+		constexpr Matrix<4, 4, T> & setScaleYZ(T scaleY, T scaleZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2619,7 +2617,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleYZ(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleYZ(const Vector<2, T> & scale) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2639,7 +2637,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleZX(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleZX(const Vector<2, T> & scale) {
 			m[0 ] = scale.v[1];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2659,7 +2657,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleZY(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleZY(const Vector<2, T> & scale) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2679,7 +2677,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXYZ(T scale) {
+		constexpr Matrix<4, 4, T> & setScaleXYZ(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2699,7 +2697,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXYZ(T scaleX, T scaleY, T scaleZ) {
+		constexpr Matrix<4, 4, T> & setScaleXYZ(T scaleX, T scaleY, T scaleZ) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2719,7 +2717,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXYZ(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleXYZ(const Vector<3, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2739,7 +2737,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleXZY(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleXZY(const Vector<3, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2759,7 +2757,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleYXZ(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleYXZ(const Vector<3, T> & scale) {
 			m[0 ] = scale.v[1];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2779,7 +2777,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleYZX(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleYZX(const Vector<3, T> & scale) {
 			m[0 ] = scale.v[2];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2799,7 +2797,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleZXY(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleZXY(const Vector<3, T> & scale) {
 			m[0 ] = scale.v[1];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2819,7 +2817,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & setScaleZYX(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & setScaleZYX(const Vector<3, T> & scale) {
 			m[0 ] = scale.v[2];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2839,7 +2837,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & projectOrthographic(T left, T right, T bottom, T top, T near, T far) {
+		constexpr Matrix<4, 4, T> & projectOrthographic(T left, T right, T bottom, T top, T near, T far) {
 			auto m0  = 2 / (right -   left);
 			auto m5  = 2 / (top   - bottom);
 			auto m10 = 2 / (far   -   near);
@@ -3014,7 +3012,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & shear2DX(const Vector<2, T> & shear) {
+		constexpr Matrix<4, 4, T> & shear2DX(const Vector<2, T> & shear) {
 			auto m1  = -shear.v[1] / shear.v[0];
 			T newM[] = {
 				m[0] + m[4] * m1,
@@ -3044,7 +3042,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & shear2DY(const Vector<2, T> & shear) {
+		constexpr Matrix<4, 4, T> & shear2DY(const Vector<2, T> & shear) {
 			auto m4  = shear.v[1] / shear.v[0];
 			T newM[] = {
 				m[0] * m4 + m[4],
@@ -3059,7 +3057,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translate2D(T translateX, T translateY) {
+		constexpr Matrix<4, 4, T> & translate2D(T translateX, T translateY) {
 			T newM[] = {
 				m[0] * translateX + m[4] * translateY + m[12],
 				m[1] * translateX + m[5] * translateY + m[13],
@@ -3073,7 +3071,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translate2D(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & translate2D(const Vector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[1] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[1] + m[13],
@@ -3087,7 +3085,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translate(T translateX, T translateY, T translateZ) {
+		constexpr Matrix<4, 4, T> & translate(T translateX, T translateY, T translateZ) {
 			T newM[] = {
 				m[0] * translateX + m[4] * translateY + m[8] * translateZ + m[12],
 				m[1] * translateX + m[5] * translateY + m[9] * translateZ + m[13],
@@ -3101,7 +3099,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translate(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & translate(const Vector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[1] + m[8] * translate.v[2] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[1] + m[9] * translate.v[2] + m[13],
@@ -3135,7 +3133,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scale2D(T scale) {
+		constexpr Matrix<4, 4, T> & scale2D(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -3153,7 +3151,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scale2D(T scaleX, T scaleY) {
+		constexpr Matrix<4, 4, T> & scale2D(T scaleX, T scaleY) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -3171,7 +3169,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scale2D(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & scale2D(const Vector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -3189,7 +3187,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scale(T scale) {
+		constexpr Matrix<4, 4, T> & scale(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -3211,7 +3209,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scale(T scaleX, T scaleY, T scaleZ) {
+		constexpr Matrix<4, 4, T> & scale(T scaleX, T scaleY, T scaleZ) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -3233,7 +3231,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scale(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & scale(const Vector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -3255,7 +3253,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateX(T translateX) {
+		constexpr Matrix<4, 4, T> & translateX(T translateX) {
 			T newM[] = {
 				m[0] * translateX + m[12],
 				m[1] * translateX + m[13],
@@ -3269,7 +3267,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateY(T translateY) {
+		constexpr Matrix<4, 4, T> & translateY(T translateY) {
 			T newM[] = {
 				m[4] * translateY + m[12],
 				m[5] * translateY + m[13],
@@ -3283,7 +3281,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateZ(T translateZ) {
+		constexpr Matrix<4, 4, T> & translateZ(T translateZ) {
 			T newM[] = {
 				m[8] * translateZ + m[12],
 				m[9] * translateZ + m[13],
@@ -3297,7 +3295,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateXY(T translateX, T translateY) {
+		constexpr Matrix<4, 4, T> & translateXY(T translateX, T translateY) {
 			T newM[] = {
 				m[0] * translateX + m[4] * translateY + m[12],
 				m[1] * translateX + m[5] * translateY + m[13],
@@ -3311,7 +3309,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateXY(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateXY(const Vector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[1] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[1] + m[13],
@@ -3325,7 +3323,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateXZ(T translateX, T translateZ) {
+		constexpr Matrix<4, 4, T> & translateXZ(T translateX, T translateZ) {
 			T newM[] = {
 				m[0] * translateX + m[8] * translateZ + m[12],
 				m[1] * translateX + m[9] * translateZ + m[13],
@@ -3339,7 +3337,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateXZ(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateXZ(const Vector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[8] * translate.v[1] + m[12],
 				m[1] * translate.v[0] + m[9] * translate.v[1] + m[13],
@@ -3353,7 +3351,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateYX(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateYX(const Vector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[1] + m[4] * translate.v[0] + m[12],
 				m[1] * translate.v[1] + m[5] * translate.v[0] + m[13],
@@ -3367,7 +3365,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateYZ(T translateY, T translateZ) {
+		constexpr Matrix<4, 4, T> & translateYZ(T translateY, T translateZ) {
 			T newM[] = {
 				m[4] * translateY + m[8] * translateZ + m[12],
 				m[5] * translateY + m[9] * translateZ + m[13],
@@ -3381,7 +3379,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateYZ(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateYZ(const Vector<2, T> & translate) {
 			T newM[] = {
 				m[4] * translate.v[0] + m[8] * translate.v[1] + m[12],
 				m[5] * translate.v[0] + m[9] * translate.v[1] + m[13],
@@ -3395,7 +3393,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateZX(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateZX(const Vector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[1] + m[8] * translate.v[0] + m[12],
 				m[1] * translate.v[1] + m[9] * translate.v[0] + m[13],
@@ -3409,7 +3407,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateZY(const Vector<2, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateZY(const Vector<2, T> & translate) {
 			T newM[] = {
 				m[4] * translate.v[1] + m[8] * translate.v[0] + m[12],
 				m[5] * translate.v[1] + m[9] * translate.v[0] + m[13],
@@ -3423,7 +3421,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateXYZ(T translateX, T translateY, T translateZ) {
+		constexpr Matrix<4, 4, T> & translateXYZ(T translateX, T translateY, T translateZ) {
 			T newM[] = {
 				m[0] * translateX + m[4] * translateY + m[8] * translateZ + m[12],
 				m[1] * translateX + m[5] * translateY + m[9] * translateZ + m[13],
@@ -3437,7 +3435,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateXYZ(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateXYZ(const Vector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[1] + m[8] * translate.v[2] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[1] + m[9] * translate.v[2] + m[13],
@@ -3451,7 +3449,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateXZY(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateXZY(const Vector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[2] + m[8] * translate.v[1] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[2] + m[9] * translate.v[1] + m[13],
@@ -3465,7 +3463,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateYXZ(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateYXZ(const Vector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[1] + m[4] * translate.v[0] + m[8] * translate.v[2] + m[12],
 				m[1] * translate.v[1] + m[5] * translate.v[0] + m[9] * translate.v[2] + m[13],
@@ -3479,7 +3477,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateYZX(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateYZX(const Vector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[2] + m[4] * translate.v[0] + m[8] * translate.v[1] + m[12],
 				m[1] * translate.v[2] + m[5] * translate.v[0] + m[9] * translate.v[1] + m[13],
@@ -3493,7 +3491,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateZXY(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateZXY(const Vector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[1] + m[4] * translate.v[2] + m[8] * translate.v[0] + m[12],
 				m[1] * translate.v[1] + m[5] * translate.v[2] + m[9] * translate.v[0] + m[13],
@@ -3507,7 +3505,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & translateZYX(const Vector<3, T> & translate) {
+		constexpr Matrix<4, 4, T> & translateZYX(const Vector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[2] + m[4] * translate.v[1] + m[8] * translate.v[0] + m[12],
 				m[1] * translate.v[2] + m[5] * translate.v[1] + m[9] * translate.v[0] + m[13],
@@ -4103,7 +4101,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleX(T scaleX) {
+		constexpr Matrix<4, 4, T> & scaleX(T scaleX) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -4117,7 +4115,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleY(T scaleY) {
+		constexpr Matrix<4, 4, T> & scaleY(T scaleY) {
 			T newM[] = {
 				m[4] * scaleY,
 				m[5] * scaleY,
@@ -4131,7 +4129,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleZ(T scaleZ) {
+		constexpr Matrix<4, 4, T> & scaleZ(T scaleZ) {
 			T newM[] = {
 				m[8] * scaleZ,
 				m[9] * scaleZ,
@@ -4145,7 +4143,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXY(T scale) {
+		constexpr Matrix<4, 4, T> & scaleXY(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -4163,7 +4161,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXY(T scaleX, T scaleY) {
+		constexpr Matrix<4, 4, T> & scaleXY(T scaleX, T scaleY) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -4181,7 +4179,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXY(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleXY(const Vector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -4199,7 +4197,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXZ(T scale) {
+		constexpr Matrix<4, 4, T> & scaleXZ(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -4217,7 +4215,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXZ(T scaleX, T scaleZ) {
+		constexpr Matrix<4, 4, T> & scaleXZ(T scaleX, T scaleZ) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -4235,7 +4233,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXZ(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleXZ(const Vector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -4253,7 +4251,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleYX(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleYX(const Vector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[1],
 				m[1] * scale.v[1],
@@ -4271,7 +4269,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleYZ(T scale) {
+		constexpr Matrix<4, 4, T> & scaleYZ(T scale) {
 			T newM[] = {
 				m[4] * scale,
 				m[5] * scale,
@@ -4289,7 +4287,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleYZ(T scaleY, T scaleZ) {
+		constexpr Matrix<4, 4, T> & scaleYZ(T scaleY, T scaleZ) {
 			T newM[] = {
 				m[4] * scaleY,
 				m[5] * scaleY,
@@ -4307,7 +4305,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleYZ(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleYZ(const Vector<2, T> & scale) {
 			T newM[] = {
 				m[4] * scale.v[0],
 				m[5] * scale.v[0],
@@ -4325,7 +4323,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleZX(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleZX(const Vector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[1],
 				m[1] * scale.v[1],
@@ -4343,7 +4341,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleZY(const Vector<2, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleZY(const Vector<2, T> & scale) {
 			T newM[] = {
 				m[4] * scale.v[1],
 				m[5] * scale.v[1],
@@ -4361,7 +4359,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXYZ(T scale) {
+		constexpr Matrix<4, 4, T> & scaleXYZ(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -4383,7 +4381,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
+		constexpr Matrix<4, 4, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -4405,7 +4403,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXYZ(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleXYZ(const Vector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -4427,7 +4425,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleXZY(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleXZY(const Vector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -4449,7 +4447,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleYXZ(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleYXZ(const Vector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[1],
 				m[1] * scale.v[1],
@@ -4471,7 +4469,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleYZX(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleYZX(const Vector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[2],
 				m[1] * scale.v[2],
@@ -4493,7 +4491,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleZXY(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleZXY(const Vector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[1],
 				m[1] * scale.v[1],
@@ -4515,7 +4513,7 @@ class Matrix<4, 4, T> {
 			return *this;
 		}
 
-		Matrix<4, 4, T> & scaleZYX(const Vector<3, T> & scale) {
+		constexpr Matrix<4, 4, T> & scaleZYX(const Vector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[2],
 				m[1] * scale.v[2],
@@ -4536,15 +4534,11 @@ class Matrix<4, 4, T> {
 			/**** m[12] ****/ /**** m[13] ****/ /**** m[14] ****/ /**** m[15] ****/
 			return *this;
 		}
-
-		~Matrix() {
-			clean();
-		}
 };
 
 template <typename T>
-Matrix<4, 4, T> operator+(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> & right) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> operator+(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> & right) {
+	return std::array<T, 4 * 4> {
 		left.m[0 ] + right.m[0 ], left.m[1 ] + right.m[1 ], left.m[2 ] + right.m[2 ], left.m[3 ] + right.m[3 ],
 		left.m[4 ] + right.m[4 ], left.m[5 ] + right.m[5 ], left.m[6 ] + right.m[6 ], left.m[7 ] + right.m[7 ],
 		left.m[8 ] + right.m[8 ], left.m[9 ] + right.m[9 ], left.m[10] + right.m[10], left.m[11] + right.m[11],
@@ -4553,8 +4547,8 @@ Matrix<4, 4, T> operator+(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> operator-(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> & right) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> operator-(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> & right) {
+	return std::array<T, 4 * 4> {
 		left.m[0 ] - right.m[0 ], left.m[1 ] - right.m[1 ], left.m[2 ] - right.m[2 ], left.m[3 ] - right.m[3 ],
 		left.m[4 ] - right.m[4 ], left.m[5 ] - right.m[5 ], left.m[6 ] - right.m[6 ], left.m[7 ] - right.m[7 ],
 		left.m[8 ] - right.m[8 ], left.m[9 ] - right.m[9 ], left.m[10] - right.m[10], left.m[11] - right.m[11],
@@ -4563,8 +4557,8 @@ Matrix<4, 4, T> operator-(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> operator*(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> & right) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> operator*(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> & right) {
+	return std::array<T, 4 * 4> {
 		left.m[0] * right.m[0 ] + left.m[4] * right.m[1 ] + left.m[8 ] * right.m[2 ] + left.m[12] * right.m[3 ],
 		left.m[1] * right.m[0 ] + left.m[5] * right.m[1 ] + left.m[9 ] * right.m[2 ] + left.m[13] * right.m[3 ],
 		left.m[2] * right.m[0 ] + left.m[6] * right.m[1 ] + left.m[10] * right.m[2 ] + left.m[14] * right.m[3 ],
@@ -4585,14 +4579,24 @@ Matrix<4, 4, T> operator*(const Matrix<4, 4, T> & left, const Matrix<4, 4, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> projectOrthographic(const Matrix<4, 4, T> & matrix, T left, T right, T bottom, T top, T near, T far) {
+constexpr Matrix<4, 4, T> transpose(const Matrix<4, 4, T> & matrix) {
+	return Matrix<4, 4, T>(matrix).transpose();
+}
+
+template <typename T>
+constexpr Matrix<4, 4, T> inverse(const Matrix<4, 4, T> & matrix) {
+	return Matrix<4, 4, T>(matrix).invert();
+}
+
+template <typename T>
+constexpr Matrix<4, 4, T> projectOrthographic(const Matrix<4, 4, T> & matrix, T left, T right, T bottom, T top, T near, T far) {
 	auto m0  = 2 / (right -   left);
 	auto m5  = 2 / (top   - bottom);
 	auto m10 = 2 / (far   -   near);
 	auto m12 = (left   + right) / (left   - right);
 	auto m13 = (bottom +   top) / (bottom -   top);
 	auto m14 = (near   +   far) / (near   -   far);
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0 ] * m0,
 		matrix.m[1 ] * m0,
 		matrix.m[2 ] * m0,
@@ -4613,7 +4617,7 @@ Matrix<4, 4, T> projectOrthographic(const Matrix<4, 4, T> & matrix, T left, T ri
 }
 
 template <typename T>
-Matrix<4, 4, T> & projectOrthographic(const Matrix<4, 4, T> & matrix, T left, T right, T bottom, T top, T near, T far, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & projectOrthographic(const Matrix<4, 4, T> & matrix, T left, T right, T bottom, T top, T near, T far, Matrix<4, 4, T> & target) {
 	auto m0  = 2 / (right -   left);
 	auto m5  = 2 / (top   - bottom);
 	auto m10 = 2 / (far   -   near);
@@ -4645,7 +4649,7 @@ Matrix<4, 4, T> projectPerspective(const Matrix<4, 4, T> & matrix, T fovY, T asp
 	auto m0  = vertical / aspectRatio;
 	auto m10 = (near + far) / (near - far);
 	auto m14 = (2 * far * near) / (near - far);
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0 ] * m0,
 		matrix.m[1 ] * m0,
 		matrix.m[2 ] * m0,
@@ -4699,7 +4703,7 @@ Matrix<4, 4, T> shear2D(const Matrix<4, 4, T> & matrix, T axisAngle, T shearAngl
 	auto m1  = -cosAxis * tanShear * cosAxis;
 	auto m4  = sinAxis * tanShear * sinAxis;
 	auto m5  = -cosAxis * tanShear * sinAxis;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1,
 		matrix.m[1] * m0 + matrix.m[5] * m1,
 		matrix.m[2] * m0 + matrix.m[6] * m1,
@@ -4727,7 +4731,7 @@ Matrix<4, 4, T> shear2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & axi
 	auto m1  = -unitAxis.v[0] * tanShear * unitAxis.v[0];
 	auto m4  = unitAxis.v[1] * tanShear * unitAxis.v[1];
 	auto m5  = -unitAxis.v[0] * tanShear * unitAxis.v[1];
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1,
 		matrix.m[1] * m0 + matrix.m[5] * m1,
 		matrix.m[2] * m0 + matrix.m[6] * m1,
@@ -4756,7 +4760,7 @@ Matrix<4, 4, T> shear2D(const Matrix<4, 4, T> & matrix, T axisAngle,const Vector
 	auto m1  = -cosAxis * tanShear * cosAxis;
 	auto m4  = sinAxis * tanShear * sinAxis;
 	auto m5  = -cosAxis * tanShear * sinAxis;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1,
 		matrix.m[1] * m0 + matrix.m[5] * m1,
 		matrix.m[2] * m0 + matrix.m[6] * m1,
@@ -4784,7 +4788,7 @@ Matrix<4, 4, T> shear2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & axi
 	auto m1  = -unitAxis.v[0] * tanShear * unitAxis.v[0];
 	auto m4  = unitAxis.v[1] * tanShear * unitAxis.v[1];
 	auto m5  = -unitAxis.v[0] * tanShear * unitAxis.v[1];
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1,
 		matrix.m[1] * m0 + matrix.m[5] * m1,
 		matrix.m[2] * m0 + matrix.m[6] * m1,
@@ -4807,7 +4811,7 @@ Matrix<4, 4, T> shear2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & axi
 template <typename T>
 Matrix<4, 4, T> shear2DX(const Matrix<4, 4, T> & matrix, T angle) {
 	auto m1  = -tan(angle);
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] + matrix.m[4] * m1,
 		matrix.m[1] + matrix.m[5] * m1,
 		matrix.m[2] + matrix.m[6] * m1,
@@ -4828,9 +4832,9 @@ Matrix<4, 4, T> shear2DX(const Matrix<4, 4, T> & matrix, T angle) {
 }
 
 template <typename T>
-Matrix<4, 4, T> shear2DX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & shear) {
+constexpr Matrix<4, 4, T> shear2DX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & shear) {
 	auto m1  = -shear.v[1] / shear.v[0];
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] + matrix.m[4] * m1,
 		matrix.m[1] + matrix.m[5] * m1,
 		matrix.m[2] + matrix.m[6] * m1,
@@ -4853,7 +4857,7 @@ Matrix<4, 4, T> shear2DX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & sh
 template <typename T>
 Matrix<4, 4, T> shear2DY(const Matrix<4, 4, T> & matrix, T angle) {
 	auto m4  = tan(angle);
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -4874,9 +4878,9 @@ Matrix<4, 4, T> shear2DY(const Matrix<4, 4, T> & matrix, T angle) {
 }
 
 template <typename T>
-Matrix<4, 4, T> shear2DY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & shear) {
+constexpr Matrix<4, 4, T> shear2DY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & shear) {
 	auto m4  = shear.v[1] / shear.v[0];
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5029,7 +5033,7 @@ Matrix<4, 4, T> & shear2DX(const Matrix<4, 4, T> & matrix, T angle, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & shear2DX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & shear, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & shear2DX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & shear, Matrix<4, 4, T> & target) {
 	auto m1  = -shear.v[1] / shear.v[0];
 	target.m[0] = matrix.m[0] + matrix.m[4] * m1;
 	target.m[1] = matrix.m[1] + matrix.m[5] * m1;
@@ -5073,7 +5077,7 @@ Matrix<4, 4, T> & shear2DY(const Matrix<4, 4, T> & matrix, T angle, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & shear2DY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & shear, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & shear2DY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & shear, Matrix<4, 4, T> & target) {
 	auto m4  = shear.v[1] / shear.v[0];
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
@@ -5095,8 +5099,8 @@ Matrix<4, 4, T> & shear2DY(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> translate2D(const Matrix<4, 4, T> & matrix, T translateX, T translateY) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translate2D(const Matrix<4, 4, T> & matrix, T translateX, T translateY) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5117,8 +5121,8 @@ Matrix<4, 4, T> translate2D(const Matrix<4, 4, T> & matrix, T translateX, T tran
 }
 
 template <typename T>
-Matrix<4, 4, T> translate2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translate2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5139,7 +5143,7 @@ Matrix<4, 4, T> translate2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> & translate2D(const Matrix<4, 4, T> & matrix, T translateX, T translateY, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translate2D(const Matrix<4, 4, T> & matrix, T translateX, T translateY, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5160,7 +5164,7 @@ Matrix<4, 4, T> & translate2D(const Matrix<4, 4, T> & matrix, T translateX, T tr
 }
 
 template <typename T>
-Matrix<4, 4, T> & translate2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translate2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5181,8 +5185,8 @@ Matrix<4, 4, T> & translate2D(const Matrix<4, 4, T> & matrix, const Vector<2, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> translate(const Matrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translate(const Matrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5203,8 +5207,8 @@ Matrix<4, 4, T> translate(const Matrix<4, 4, T> & matrix, T translateX, T transl
 }
 
 template <typename T>
-Matrix<4, 4, T> translate(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translate(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5225,7 +5229,7 @@ Matrix<4, 4, T> translate(const Matrix<4, 4, T> & matrix, const Vector<3, T> & t
 }
 
 template <typename T>
-Matrix<4, 4, T> & translate(const Matrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translate(const Matrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5246,7 +5250,7 @@ Matrix<4, 4, T> & translate(const Matrix<4, 4, T> & matrix, T translateX, T tran
 }
 
 template <typename T>
-Matrix<4, 4, T> & translate(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translate(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5270,7 +5274,7 @@ template <typename T>
 Matrix<4, 4, T> rotate2D(const Matrix<4, 4, T> & matrix, T rotateZ) {
 	auto sinZ = sin(rotateZ);
 	auto cosZ = cos(rotateZ);
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosZ + matrix.m[4] * sinZ,
 		matrix.m[1] * cosZ + matrix.m[5] * sinZ,
 		matrix.m[2] * cosZ + matrix.m[6] * sinZ,
@@ -5314,8 +5318,8 @@ Matrix<4, 4, T> & rotate2D(const Matrix<4, 4, T> & matrix, T rotateZ, Matrix<4,
 }
 
 template <typename T>
-Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, T scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -5336,8 +5340,8 @@ Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, T scale) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -5358,8 +5362,8 @@ Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -5380,7 +5384,7 @@ Matrix<4, 4, T> scale2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & sca
 }
 
 template <typename T>
-Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -5401,7 +5405,7 @@ Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -5422,7 +5426,7 @@ Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, Ma
 }
 
 template <typename T>
-Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -5443,8 +5447,8 @@ Matrix<4, 4, T> & scale2D(const Matrix<4, 4, T> & matrix, const Vector<2, T> & s
 }
 
 template <typename T>
-Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, T scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -5465,8 +5469,8 @@ Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, T scale) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -5487,8 +5491,8 @@ Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scal
 }
 
 template <typename T>
-Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -5509,7 +5513,7 @@ Matrix<4, 4, T> scale(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale
 }
 
 template <typename T>
-Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -5530,7 +5534,7 @@ Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -5551,7 +5555,7 @@ Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T sc
 }
 
 template <typename T>
-Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -5572,8 +5576,8 @@ Matrix<4, 4, T> & scale(const Matrix<4, 4, T> & matrix, const Vector<3, T> & sca
 }
 
 template <typename T>
-Matrix<4, 4, T> translateX(const Matrix<4, 4, T> & matrix, T translateX) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateX(const Matrix<4, 4, T> & matrix, T translateX) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5594,8 +5598,8 @@ Matrix<4, 4, T> translateX(const Matrix<4, 4, T> & matrix, T translateX) {
 }
 
 template <typename T>
-Matrix<4, 4, T> translateY(const Matrix<4, 4, T> & matrix, T translateY) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateY(const Matrix<4, 4, T> & matrix, T translateY) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5616,8 +5620,8 @@ Matrix<4, 4, T> translateY(const Matrix<4, 4, T> & matrix, T translateY) {
 }
 
 template <typename T>
-Matrix<4, 4, T> translateZ(const Matrix<4, 4, T> & matrix, T translateZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateZ(const Matrix<4, 4, T> & matrix, T translateZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5638,8 +5642,8 @@ Matrix<4, 4, T> translateZ(const Matrix<4, 4, T> & matrix, T translateZ) {
 }
 
 template <typename T>
-Matrix<4, 4, T> translateXY(const Matrix<4, 4, T> & matrix, T translateX, T translateY) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateXY(const Matrix<4, 4, T> & matrix, T translateX, T translateY) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5660,8 +5664,8 @@ Matrix<4, 4, T> translateXY(const Matrix<4, 4, T> & matrix, T translateX, T tran
 }
 
 template <typename T>
-Matrix<4, 4, T> translateXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5682,8 +5686,8 @@ Matrix<4, 4, T> translateXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> translateXZ(const Matrix<4, 4, T> & matrix, T translateX, T translateZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateXZ(const Matrix<4, 4, T> & matrix, T translateX, T translateZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5704,8 +5708,8 @@ Matrix<4, 4, T> translateXZ(const Matrix<4, 4, T> & matrix, T translateX, T tran
 }
 
 template <typename T>
-Matrix<4, 4, T> translateXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5726,8 +5730,8 @@ Matrix<4, 4, T> translateXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> translateYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5748,8 +5752,8 @@ Matrix<4, 4, T> translateYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> translateYZ(const Matrix<4, 4, T> & matrix, T translateY, T translateZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateYZ(const Matrix<4, 4, T> & matrix, T translateY, T translateZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5770,8 +5774,8 @@ Matrix<4, 4, T> translateYZ(const Matrix<4, 4, T> & matrix, T translateY, T tran
 }
 
 template <typename T>
-Matrix<4, 4, T> translateYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5792,8 +5796,8 @@ Matrix<4, 4, T> translateYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> translateZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5814,8 +5818,8 @@ Matrix<4, 4, T> translateZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> translateZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5836,8 +5840,8 @@ Matrix<4, 4, T> translateZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> translateXYZ(const Matrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateXYZ(const Matrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5858,8 +5862,8 @@ Matrix<4, 4, T> translateXYZ(const Matrix<4, 4, T> & matrix, T translateX, T tra
 }
 
 template <typename T>
-Matrix<4, 4, T> translateXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5880,8 +5884,8 @@ Matrix<4, 4, T> translateXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> translateXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5902,8 +5906,8 @@ Matrix<4, 4, T> translateXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> translateYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5924,8 +5928,8 @@ Matrix<4, 4, T> translateYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> translateYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5946,8 +5950,8 @@ Matrix<4, 4, T> translateYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> translateZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5968,8 +5972,8 @@ Matrix<4, 4, T> translateZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> translateZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> translateZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5990,7 +5994,7 @@ Matrix<4, 4, T> translateZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateX(const Matrix<4, 4, T> & matrix, T translateX, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateX(const Matrix<4, 4, T> & matrix, T translateX, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6011,7 +6015,7 @@ Matrix<4, 4, T> & translateX(const Matrix<4, 4, T> & matrix, T translateX, Matri
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateY(const Matrix<4, 4, T> & matrix, T translateY, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateY(const Matrix<4, 4, T> & matrix, T translateY, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6032,7 +6036,7 @@ Matrix<4, 4, T> & translateY(const Matrix<4, 4, T> & matrix, T translateY, Matri
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateZ(const Matrix<4, 4, T> & matrix, T translateZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateZ(const Matrix<4, 4, T> & matrix, T translateZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6053,7 +6057,7 @@ Matrix<4, 4, T> & translateZ(const Matrix<4, 4, T> & matrix, T translateZ, Matri
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateXY(const Matrix<4, 4, T> & matrix, T translateX, T translateY, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateXY(const Matrix<4, 4, T> & matrix, T translateX, T translateY, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6074,7 +6078,7 @@ Matrix<4, 4, T> & translateXY(const Matrix<4, 4, T> & matrix, T translateX, T tr
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6095,7 +6099,7 @@ Matrix<4, 4, T> & translateXY(const Matrix<4, 4, T> & matrix, const Vector<2, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateXZ(const Matrix<4, 4, T> & matrix, T translateX, T translateZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateXZ(const Matrix<4, 4, T> & matrix, T translateX, T translateZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6116,7 +6120,7 @@ Matrix<4, 4, T> & translateXZ(const Matrix<4, 4, T> & matrix, T translateX, T tr
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6137,7 +6141,7 @@ Matrix<4, 4, T> & translateXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6158,7 +6162,7 @@ Matrix<4, 4, T> & translateYX(const Matrix<4, 4, T> & matrix, const Vector<2, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateYZ(const Matrix<4, 4, T> & matrix, T translateY, T translateZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateYZ(const Matrix<4, 4, T> & matrix, T translateY, T translateZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6179,7 +6183,7 @@ Matrix<4, 4, T> & translateYZ(const Matrix<4, 4, T> & matrix, T translateY, T tr
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6200,7 +6204,7 @@ Matrix<4, 4, T> & translateYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6221,7 +6225,7 @@ Matrix<4, 4, T> & translateZX(const Matrix<4, 4, T> & matrix, const Vector<2, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6242,7 +6246,7 @@ Matrix<4, 4, T> & translateZY(const Matrix<4, 4, T> & matrix, const Vector<2, T>
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateXYZ(const Matrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateXYZ(const Matrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6263,7 +6267,7 @@ Matrix<4, 4, T> & translateXYZ(const Matrix<4, 4, T> & matrix, T translateX, T t
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6284,7 +6288,7 @@ Matrix<4, 4, T> & translateXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6305,7 +6309,7 @@ Matrix<4, 4, T> & translateXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6326,7 +6330,7 @@ Matrix<4, 4, T> & translateYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6347,7 +6351,7 @@ Matrix<4, 4, T> & translateYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6368,7 +6372,7 @@ Matrix<4, 4, T> & translateZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T
 }
 
 template <typename T>
-Matrix<4, 4, T> & translateZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & translateZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & translate, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6392,7 +6396,7 @@ template <typename T>
 Matrix<4, 4, T> rotateX(const Matrix<4, 4, T> & matrix, T rotateX) {
 	auto sinX = sin(rotateX);
 	auto cosX = cos(rotateX);
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -6416,7 +6420,7 @@ template <typename T>
 Matrix<4, 4, T> rotateY(const Matrix<4, 4, T> & matrix, T rotateY) {
 	auto sinY = sin(rotateY);
 	auto cosY = cos(rotateY);
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosY + matrix.m[8] * -sinY,
 		matrix.m[1] * cosY + matrix.m[9] * -sinY,
 		matrix.m[2] * cosY + matrix.m[10] * -sinY,
@@ -6440,7 +6444,7 @@ template <typename T>
 Matrix<4, 4, T> rotateZ(const Matrix<4, 4, T> & matrix, T rotateZ) {
 	auto sinZ = sin(rotateZ);
 	auto cosZ = cos(rotateZ);
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosZ + matrix.m[4] * sinZ,
 		matrix.m[1] * cosZ + matrix.m[5] * sinZ,
 		matrix.m[2] * cosZ + matrix.m[6] * sinZ,
@@ -6470,7 +6474,7 @@ Matrix<4, 4, T> rotateXY(const Matrix<4, 4, T> & matrix, T rotateX, T rotateY) {
 	auto m6  = cosY * sinX;
 	auto m8  = sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosY + matrix.m[8] * -sinY,
 		matrix.m[1] * cosY + matrix.m[9] * -sinY,
 		matrix.m[2] * cosY + matrix.m[10] * -sinY,
@@ -6500,7 +6504,7 @@ Matrix<4, 4, T> & rotateXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 	auto m6  = cosY * sinX;
 	auto m8  = sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosY + matrix.m[8] * -sinY,
 		matrix.m[1] * cosY + matrix.m[9] * -sinY,
 		matrix.m[2] * cosY + matrix.m[10] * -sinY,
@@ -6530,7 +6534,7 @@ Matrix<4, 4, T> rotateXZ(const Matrix<4, 4, T> & matrix, T rotateX, T rotateZ) {
 	auto m5  = cosZ * cosX;
 	auto m8  = sinZ * sinX;
 	auto m9  = -cosZ * sinX;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosZ + matrix.m[4] * sinZ,
 		matrix.m[1] * cosZ + matrix.m[5] * sinZ,
 		matrix.m[2] * cosZ + matrix.m[6] * sinZ,
@@ -6560,7 +6564,7 @@ Matrix<4, 4, T> & rotateXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 	auto m5  = cosZ * cosX;
 	auto m8  = sinZ * sinX;
 	auto m9  = -cosZ * sinX;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosZ + matrix.m[4] * sinZ,
 		matrix.m[1] * cosZ + matrix.m[5] * sinZ,
 		matrix.m[2] * cosZ + matrix.m[6] * sinZ,
@@ -6590,7 +6594,7 @@ Matrix<4, 4, T> & rotateYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 	auto m2  = -cosX * sinY;
 	auto m9  = -sinX * cosY;
 	auto m10 = cosX * cosY;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosY + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * cosY + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * cosY + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6620,7 +6624,7 @@ Matrix<4, 4, T> rotateYZ(const Matrix<4, 4, T> & matrix, T rotateY, T rotateZ) {
 	auto m1  = sinZ * cosY;
 	auto m8  = cosZ * sinY;
 	auto m9  = sinZ * sinY;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * -sinY,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * -sinY,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * -sinY,
@@ -6650,7 +6654,7 @@ Matrix<4, 4, T> & rotateYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 	auto m1  = sinZ * cosY;
 	auto m8  = cosZ * sinY;
 	auto m9  = sinZ * sinY;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * -sinY,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * -sinY,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * -sinY,
@@ -6680,7 +6684,7 @@ Matrix<4, 4, T> & rotateZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 	auto m2  = sinX * sinZ;
 	auto m5  = cosX * cosZ;
 	auto m6  = sinX * cosZ;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * cosZ + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * cosZ + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * cosZ + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6710,7 +6714,7 @@ Matrix<4, 4, T> & rotateZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> &
 	auto m2  = -sinY * cosZ;
 	auto m4  = -cosY * sinZ;
 	auto m6  = sinY * sinZ;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * sinZ + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * sinZ + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * sinZ + matrix.m[10] * m2,
@@ -6746,7 +6750,7 @@ Matrix<4, 4, T> rotateXYZ(const Matrix<4, 4, T> & matrix, T rotateX, T rotateY,
 	auto m8  = sinZ * sinX + cosZ * sinY * cosX;
 	auto m9  = -cosZ * sinX + sinZ * sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * -sinY,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * -sinY,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * -sinY,
@@ -6782,7 +6786,7 @@ Matrix<4, 4, T> & rotateXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 	auto m8  = sinZ * sinX + cosZ * sinY * cosX;
 	auto m9  = -cosZ * sinX + sinZ * sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * -sinY,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * -sinY,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * -sinY,
@@ -6818,7 +6822,7 @@ Matrix<4, 4, T> & rotateXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 	auto m8  = cosY * sinZ * sinX + sinY * cosX;
 	auto m9  = -cosZ * sinX;
 	auto m10 = -sinY * sinZ * sinX + cosY * cosX;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * sinZ + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * sinZ + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * sinZ + matrix.m[10] * m2,
@@ -6854,7 +6858,7 @@ Matrix<4, 4, T> & rotateYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 	auto m8  = cosZ * sinY + sinZ * sinX * cosY;
 	auto m9  = sinZ * sinY - cosZ * sinX * cosY;
 	auto m10 = cosX * cosY;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6890,7 +6894,7 @@ Matrix<4, 4, T> & rotateYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 	auto m8  = cosZ * sinY;
 	auto m9  = cosX * sinZ * sinY - sinX * cosY;
 	auto m10 = sinX * sinZ * sinY + cosX * cosY;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6926,7 +6930,7 @@ Matrix<4, 4, T> & rotateZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 	auto m6  = sinY * sinZ + cosY * sinX * cosZ;
 	auto m8  = sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6962,7 +6966,7 @@ Matrix<4, 4, T> & rotateZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 	auto m6  = cosX * sinY * sinZ + sinX * cosZ;
 	auto m9  = -sinX * cosY;
 	auto m10 = cosX * cosY;
-	return new T[4 * 4] {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -7558,8 +7562,8 @@ Matrix<4, 4, T> & rotateZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleX(const Matrix<4, 4, T> & matrix, T scaleX) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleX(const Matrix<4, 4, T> & matrix, T scaleX) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -7580,8 +7584,8 @@ Matrix<4, 4, T> scaleX(const Matrix<4, 4, T> & matrix, T scaleX) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleY(const Matrix<4, 4, T> & matrix, T scaleY) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleY(const Matrix<4, 4, T> & matrix, T scaleY) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7602,8 +7606,8 @@ Matrix<4, 4, T> scaleY(const Matrix<4, 4, T> & matrix, T scaleY) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleZ(const Matrix<4, 4, T> & matrix, T scaleZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleZ(const Matrix<4, 4, T> & matrix, T scaleZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7624,8 +7628,8 @@ Matrix<4, 4, T> scaleZ(const Matrix<4, 4, T> & matrix, T scaleZ) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, T scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -7646,8 +7650,8 @@ Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, T scale) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -7668,8 +7672,8 @@ Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -7690,8 +7694,8 @@ Matrix<4, 4, T> scaleXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & sca
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, T scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -7712,8 +7716,8 @@ Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, T scale) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -7734,8 +7738,8 @@ Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleZ) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -7756,8 +7760,8 @@ Matrix<4, 4, T> scaleXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & sca
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[1],
 		matrix.m[1] * scale.v[1],
 		matrix.m[2] * scale.v[1],
@@ -7778,8 +7782,8 @@ Matrix<4, 4, T> scaleYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & sca
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, T scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7800,8 +7804,8 @@ Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, T scale) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, T scaleY, T scaleZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, T scaleY, T scaleZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7822,8 +7826,8 @@ Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, T scaleY, T scaleZ) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7844,8 +7848,8 @@ Matrix<4, 4, T> scaleYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & sca
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[1],
 		matrix.m[1] * scale.v[1],
 		matrix.m[2] * scale.v[1],
@@ -7866,8 +7870,8 @@ Matrix<4, 4, T> scaleZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & sca
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7888,8 +7892,8 @@ Matrix<4, 4, T> scaleZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & sca
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, T scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -7910,8 +7914,8 @@ Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, T scale) {
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -7932,8 +7936,8 @@ Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T s
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -7954,8 +7958,8 @@ Matrix<4, 4, T> scaleXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & sc
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -7976,8 +7980,8 @@ Matrix<4, 4, T> scaleXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & sc
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[1],
 		matrix.m[1] * scale.v[1],
 		matrix.m[2] * scale.v[1],
@@ -7998,8 +8002,8 @@ Matrix<4, 4, T> scaleYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & sc
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[2],
 		matrix.m[1] * scale.v[2],
 		matrix.m[2] * scale.v[2],
@@ -8020,8 +8024,8 @@ Matrix<4, 4, T> scaleYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & sc
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[1],
 		matrix.m[1] * scale.v[1],
 		matrix.m[2] * scale.v[1],
@@ -8042,8 +8046,8 @@ Matrix<4, 4, T> scaleZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & sc
 }
 
 template <typename T>
-Matrix<4, 4, T> scaleZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr Matrix<4, 4, T> scaleZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale) {
+	return std::array<T, 4 * 4> {
 		matrix.m[0] * scale.v[2],
 		matrix.m[1] * scale.v[2],
 		matrix.m[2] * scale.v[2],
@@ -8064,7 +8068,7 @@ Matrix<4, 4, T> scaleZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & sc
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleX(const Matrix<4, 4, T> & matrix, T scaleX, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleX(const Matrix<4, 4, T> & matrix, T scaleX, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -8085,7 +8089,7 @@ Matrix<4, 4, T> & scaleX(const Matrix<4, 4, T> & matrix, T scaleX, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleY(const Matrix<4, 4, T> & matrix, T scaleY, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleY(const Matrix<4, 4, T> & matrix, T scaleY, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8106,7 +8110,7 @@ Matrix<4, 4, T> & scaleY(const Matrix<4, 4, T> & matrix, T scaleY, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleZ(const Matrix<4, 4, T> & matrix, T scaleZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleZ(const Matrix<4, 4, T> & matrix, T scaleZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8127,7 +8131,7 @@ Matrix<4, 4, T> & scaleZ(const Matrix<4, 4, T> & matrix, T scaleZ, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -8148,7 +8152,7 @@ Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -8169,7 +8173,7 @@ Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, Ma
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -8190,7 +8194,7 @@ Matrix<4, 4, T> & scaleXY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & s
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -8211,7 +8215,7 @@ Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -8232,7 +8236,7 @@ Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleZ, Ma
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -8253,7 +8257,7 @@ Matrix<4, 4, T> & scaleXZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & s
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[1];
 	target.m[1] = matrix.m[1] * scale.v[1];
 	target.m[2] = matrix.m[2] * scale.v[1];
@@ -8274,7 +8278,7 @@ Matrix<4, 4, T> & scaleYX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & s
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8295,7 +8299,7 @@ Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, T scaleY, T scaleZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, T scaleY, T scaleZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8316,7 +8320,7 @@ Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, T scaleY, T scaleZ, Ma
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8337,7 +8341,7 @@ Matrix<4, 4, T> & scaleYZ(const Matrix<4, 4, T> & matrix, const Vector<2, T> & s
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[1];
 	target.m[1] = matrix.m[1] * scale.v[1];
 	target.m[2] = matrix.m[2] * scale.v[1];
@@ -8358,7 +8362,7 @@ Matrix<4, 4, T> & scaleZX(const Matrix<4, 4, T> & matrix, const Vector<2, T> & s
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8379,7 +8383,7 @@ Matrix<4, 4, T> & scaleZY(const Matrix<4, 4, T> & matrix, const Vector<2, T> & s
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -8400,7 +8404,7 @@ Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, T scale, Matrix<4, 4,
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -8421,7 +8425,7 @@ Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, T scaleX, T scaleY, T
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -8442,7 +8446,7 @@ Matrix<4, 4, T> & scaleXYZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -8463,7 +8467,7 @@ Matrix<4, 4, T> & scaleXZY(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[1];
 	target.m[1] = matrix.m[1] * scale.v[1];
 	target.m[2] = matrix.m[2] * scale.v[1];
@@ -8484,7 +8488,7 @@ Matrix<4, 4, T> & scaleYXZ(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[2];
 	target.m[1] = matrix.m[1] * scale.v[2];
 	target.m[2] = matrix.m[2] * scale.v[2];
@@ -8505,7 +8509,7 @@ Matrix<4, 4, T> & scaleYZX(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[1];
 	target.m[1] = matrix.m[1] * scale.v[1];
 	target.m[2] = matrix.m[2] * scale.v[1];
@@ -8526,7 +8530,7 @@ Matrix<4, 4, T> & scaleZXY(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 }
 
 template <typename T>
-Matrix<4, 4, T> & scaleZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
+constexpr Matrix<4, 4, T> & scaleZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> & scale, Matrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[2];
 	target.m[1] = matrix.m[1] * scale.v[2];
 	target.m[2] = matrix.m[2] * scale.v[2];
@@ -8547,8 +8551,8 @@ Matrix<4, 4, T> & scaleZYX(const Matrix<4, 4, T> & matrix, const Vector<3, T> &
 }
 
 template <typename T>
-Vector<4, T> operator*(const Matrix<4, 4, T> & left, const Vector<4, T> & right) {
-	return new T[4] {
+constexpr Vector<4, T> operator*(const Matrix<4, 4, T> & left, const Vector<4, T> & right) {
+	return {
 		left.m[0] * right.v[0] + left.m[4] * right.v[1] + left.m[8 ] * right.v[2] + left.m[12] * right.v[3],
 		left.m[1] * right.v[0] + left.m[5] * right.v[1] + left.m[9 ] * right.v[2] + left.m[13] * right.v[3],
 		left.m[2] * right.v[0] + left.m[6] * right.v[1] + left.m[10] * right.v[2] + left.m[14] * right.v[3],
@@ -8576,4 +8580,7 @@ using Matrix4f  = Matrix<4, 4, float >;
 using Matrix4d  = Matrix<4, 4, double>;
 
 #define CNGE_MATRIX4_FORWARD
+
+#include "matrix4Kernels.h"
+
 #endif // CNGE_MATRIX4
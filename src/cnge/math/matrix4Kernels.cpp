@@ -0,0 +1,66 @@
+
+#include "matrix4Kernels.h"
+
+namespace Matrix4Kernels {
+#if CNGE_MATH_SSE
+	/* two columns per register, each 128 bit lane holds one column */
+	CNGE_TARGET_AVX2
+	static void multiplyBatchAvx2(const Matrix<4, 4, f32> & left, const Matrix<4, 4, f32> * rights, Matrix<4, 4, f32> * out, size count) {
+		auto column0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(left.m));
+		auto column1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(left.m + 4));
+		auto column2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(left.m + 8));
+		auto column3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(left.m + 12));
+
+		for (auto i = 0_size; i < count; ++i) {
+			for (u32 half = 0; half < 2; ++half) {
+				auto right = _mm256_loadu_ps(rights[i].m + half * 8);
+				auto sum = _mm256_mul_ps(column0, _mm256_permute_ps(right, 0x00));
+				sum = _mm256_fmadd_ps(column1, _mm256_permute_ps(right, 0x55), sum);
+				sum = _mm256_fmadd_ps(column2, _mm256_permute_ps(right, 0xaa), sum);
+				sum = _mm256_fmadd_ps(column3, _mm256_permute_ps(right, 0xff), sum);
+				_mm256_storeu_ps(out[i].m + half * 8, sum);
+			}
+		}
+	}
+
+	/* two vectors per register */
+	CNGE_TARGET_AVX2
+	static void multiplyVectorBatchAvx2(const Matrix<4, 4, f32> & matrix, const Vector<4, f32> * vectors, Vector<4, f32> * out, size count) {
+		auto column0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(matrix.m));
+		auto column1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(matrix.m + 4));
+		auto column2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(matrix.m + 8));
+		auto column3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(matrix.m + 12));
+
+		auto i = 0_size;
+		for (; i + 2 <= count; i += 2) {
+			auto pair = _mm256_setr_m128(_mm_loadu_ps(vectors[i].v), _mm_loadu_ps(vectors[i + 1].v));
+			auto sum = _mm256_mul_ps(column0, _mm256_permute_ps(pair, 0x00));
+			sum = _mm256_fmadd_ps(column1, _mm256_permute_ps(pair, 0x55), sum);
+			sum = _mm256_fmadd_ps(column2, _mm256_permute_ps(pair, 0xaa), sum);
+			sum = _mm256_fmadd_ps(column3, _mm256_permute_ps(pair, 0xff), sum);
+			_mm_storeu_ps(out[i].v, _mm256_castps256_ps128(sum));
+			_mm_storeu_ps(out[i + 1].v, _mm256_extractf128_ps(sum, 1));
+		}
+		if (i < count)
+			Sse::multiplyVector(matrix, vectors[i], out[i]);
+	}
+#endif
+
+	void multiplyBatch(const Matrix<4, 4, f32> & left, const Matrix<4, 4, f32> * rights, Matrix<4, 4, f32> * out, size count) {
+	#if CNGE_MATH_SSE
+		if (CNGE::Cpu::hasAvx2())
+			return multiplyBatchAvx2(left, rights, out, count);
+	#endif
+		for (auto i = 0_size; i < count; ++i)
+			multiply(left, rights[i], out[i]);
+	}
+
+	void multiplyVectorBatch(const Matrix<4, 4, f32> & matrix, const Vector<4, f32> * vectors, Vector<4, f32> * out, size count) {
+	#if CNGE_MATH_SSE
+		if (CNGE::Cpu::hasAvx2())
+			return multiplyVectorBatchAvx2(matrix, vectors, out, count);
+	#endif
+		for (auto i = 0_size; i < count; ++i)
+			multiplyVector(matrix, vectors[i], out[i]);
+	}
+}
@@ -0,0 +1,286 @@
+
+#ifndef CNGE_MATRIX4_KERNELS
+#define CNGE_MATRIX4_KERNELS
+
+#include <cmath>
+#include <type_traits>
+
+#include "types.h"
+#include "cnge/util/cpu.h"
+#include "matrix4.h"
+
+/* sse2 is always there on x64, define CNGE_MATH_SCALAR to build without it */
+#if CNGE_X86 && !defined(CNGE_MATH_SCALAR)
+	#define CNGE_MATH_SSE 1
+	#include <immintrin.h>
+#else
+	#define CNGE_MATH_SSE 0
+#endif
+
+/// the float 4x4 operations Matrix4f hands off to
+///
+/// Scalar is the plain version and is always built so the simd
+/// versions have something to be checked against, the unqualified
+/// functions pick the best one compiled in
+namespace Matrix4Kernels {
+	namespace Scalar {
+		inline void multiply(const Matrix<4, 4, f32> & left, const Matrix<4, 4, f32> & right, Matrix<4, 4, f32> & out) {
+			out = operator*<f32>(left, right);
+		}
+
+		inline void multiplyVector(const Matrix<4, 4, f32> & left, const Vector<4, f32> & right, Vector<4, f32> & out) {
+			out = operator*<f32>(left, right);
+		}
+
+		inline void transpose(const Matrix<4, 4, f32> & matrix, Matrix<4, 4, f32> & out) {
+			out = matrix;
+			out.transpose();
+		}
+
+		inline void invert(const Matrix<4, 4, f32> & matrix, Matrix<4, 4, f32> & out) {
+			out = matrix;
+			out.invert();
+		}
+
+		inline void rotate2D(Matrix<4, 4, f32> & matrix, f32 rotation) {
+			auto sinZ = std::sin(rotation);
+			auto cosZ = std::cos(rotation);
+			for (u32 i = 0; i < 4; ++i) {
+				auto x = matrix.m[i];
+				auto y = matrix.m[i + 4];
+				matrix.m[i    ] = x *  cosZ + y * sinZ;
+				matrix.m[i + 4] = x * -sinZ + y * cosZ;
+			}
+		}
+
+		inline void scale2D(Matrix<4, 4, f32> & matrix, f32 scaleX, f32 scaleY) {
+			for (u32 i = 0; i < 4; ++i) {
+				matrix.m[i    ] *= scaleX;
+				matrix.m[i + 4] *= scaleY;
+			}
+		}
+
+		inline void transform2D(Matrix<4, 4, f32> & matrix, f32 translateX, f32 translateY, f32 rotation, f32 scaleX, f32 scaleY) {
+			auto sinZ = std::sin(rotation);
+			auto cosZ = std::cos(rotation);
+			matrix = Matrix<4, 4, f32>(
+				cosZ * scaleX, -sinZ * scaleY, 0, translateX,
+				sinZ * scaleX,  cosZ * scaleY, 0, translateY,
+				0, 0, 1, 0,
+				0, 0, 0, 1
+			);
+		}
+	}
+
+#if CNGE_MATH_SSE
+	namespace Sse {
+		template <int X, int Y, int Z, int W>
+		inline __m128 shuffle(__m128 left, __m128 right) {
+			return _mm_shuffle_ps(left, right, _MM_SHUFFLE(W, Z, Y, X));
+		}
+
+		template <int X, int Y, int Z, int W>
+		inline __m128 swizzle(__m128 vector) {
+			return shuffle<X, Y, Z, W>(vector, vector);
+		}
+
+		/* 2x2 blocks packed as (a, b, c, d), for the inverse */
+		inline __m128 multiply2x2(__m128 left, __m128 right) {
+			return _mm_add_ps(
+				_mm_mul_ps(left, swizzle<0, 3, 0, 3>(right)),
+				_mm_mul_ps(swizzle<1, 0, 3, 2>(left), swizzle<2, 1, 2, 1>(right))
+			);
+		}
+
+		/* adjugate(left) * right */
+		inline __m128 adjugateMultiply2x2(__m128 left, __m128 right) {
+			return _mm_sub_ps(
+				_mm_mul_ps(swizzle<3, 3, 0, 0>(left), right),
+				_mm_mul_ps(swizzle<1, 1, 2, 2>(left), swizzle<2, 3, 0, 1>(right))
+			);
+		}
+
+		/* left * adjugate(right) */
+		inline __m128 multiplyAdjugate2x2(__m128 left, __m128 right) {
+			return _mm_sub_ps(
+				_mm_mul_ps(left, swizzle<3, 0, 3, 0>(right)),
+				_mm_mul_ps(swizzle<1, 0, 3, 2>(left), swizzle<2, 1, 2, 1>(right))
+			);
+		}
+
+		inline __m128 combine(__m128 column0, __m128 column1, __m128 column2, __m128 column3, const f32 * vector) {
+			auto sum = _mm_mul_ps(column0, _mm_set1_ps(vector[0]));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_set1_ps(vector[1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_set1_ps(vector[2])));
+			return _mm_add_ps(sum, _mm_mul_ps(column3, _mm_set1_ps(vector[3])));
+		}
+
+		inline void multiply(const Matrix<4, 4, f32> & left, const Matrix<4, 4, f32> & right, Matrix<4, 4, f32> & out) {
+			auto column0 = _mm_loadu_ps(left.m);
+			auto column1 = _mm_loadu_ps(left.m + 4);
+			auto column2 = _mm_loadu_ps(left.m + 8);
+			auto column3 = _mm_loadu_ps(left.m + 12);
+			/* each column of right is read before the same column of out is written, so out can be right */
+			for (u32 i = 0; i < 4; ++i)
+				_mm_storeu_ps(out.m + i * 4, combine(column0, column1, column2, column3, right.m + i * 4));
+		}
+
+		inline void multiplyVector(const Matrix<4, 4, f32> & left, const Vector<4, f32> & right, Vector<4, f32> & out) {
+			auto product = combine(_mm_loadu_ps(left.m), _mm_loadu_ps(left.m + 4), _mm_loadu_ps(left.m + 8), _mm_loadu_ps(left.m + 12), right.v);
+			_mm_storeu_ps(out.v, product);
+		}
+
+		inline void transpose(const Matrix<4, 4, f32> & matrix, Matrix<4, 4, f32> & out) {
+			auto column0 = _mm_loadu_ps(matrix.m);
+			auto column1 = _mm_loadu_ps(matrix.m + 4);
+			auto column2 = _mm_loadu_ps(matrix.m + 8);
+			auto column3 = _mm_loadu_ps(matrix.m + 12);
+			_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+			_mm_storeu_ps(out.m,      column0);
+			_mm_storeu_ps(out.m + 4,  column1);
+			_mm_storeu_ps(out.m + 8,  column2);
+			_mm_storeu_ps(out.m + 12, column3);
+		}
+
+		/// block inverse over the four 2x2 corners,
+		/// inverting the transpose gives the transposed inverse so column major works as is
+		inline void invert(const Matrix<4, 4, f32> & matrix, Matrix<4, 4, f32> & out) {
+			auto column0 = _mm_loadu_ps(matrix.m);
+			auto column1 = _mm_loadu_ps(matrix.m + 4);
+			auto column2 = _mm_loadu_ps(matrix.m + 8);
+			auto column3 = _mm_loadu_ps(matrix.m + 12);
+
+			auto a = _mm_movelh_ps(column0, column1);
+			auto b = _mm_movehl_ps(column1, column0);
+			auto c = _mm_movelh_ps(column2, column3);
+			auto d = _mm_movehl_ps(column3, column2);
+
+			/* (det a, det b, det c, det d) */
+			auto subDets = _mm_sub_ps(
+				_mm_mul_ps(shuffle<0, 2, 0, 2>(column0, column2), shuffle<1, 3, 1, 3>(column1, column3)),
+				_mm_mul_ps(shuffle<1, 3, 1, 3>(column0, column2), shuffle<0, 2, 0, 2>(column1, column3))
+			);
+			auto detA = swizzle<0, 0, 0, 0>(subDets);
+			auto detB = swizzle<1, 1, 1, 1>(subDets);
+			auto detC = swizzle<2, 2, 2, 2>(subDets);
+			auto detD = swizzle<3, 3, 3, 3>(subDets);
+
+			auto dc = adjugateMultiply2x2(d, c);
+			auto ab = adjugateMultiply2x2(a, b);
+
+			auto x = _mm_sub_ps(_mm_mul_ps(detD, a), multiply2x2(b, dc));
+			auto w = _mm_sub_ps(_mm_mul_ps(detA, d), multiply2x2(c, ab));
+			auto y = _mm_sub_ps(_mm_mul_ps(detB, c), multiplyAdjugate2x2(d, ab));
+			auto z = _mm_sub_ps(_mm_mul_ps(detC, b), multiplyAdjugate2x2(a, dc));
+
+			/* det = det a * det d + det b * det c - trace(ab * dc) */
+			auto trace = _mm_mul_ps(ab, swizzle<0, 2, 1, 3>(dc));
+			trace = _mm_add_ps(trace, swizzle<2, 3, 0, 1>(trace));
+			trace = _mm_add_ps(trace, swizzle<1, 0, 3, 2>(trace));
+			auto det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+			auto inverseDet = _mm_div_ps(_mm_setr_ps(1, -1, -1, 1), det);
+			x = _mm_mul_ps(x, inverseDet);
+			y = _mm_mul_ps(y, inverseDet);
+			z = _mm_mul_ps(z, inverseDet);
+			w = _mm_mul_ps(w, inverseDet);
+
+			_mm_storeu_ps(out.m,      shuffle<3, 1, 3, 1>(x, y));
+			_mm_storeu_ps(out.m + 4,  shuffle<2, 0, 2, 0>(x, y));
+			_mm_storeu_ps(out.m + 8,  shuffle<3, 1, 3, 1>(z, w));
+			_mm_storeu_ps(out.m + 12, shuffle<2, 0, 2, 0>(z, w));
+		}
+
+		inline void rotate2D(Matrix<4, 4, f32> & matrix, f32 rotation) {
+			auto sinZ = _mm_set1_ps(std::sin(rotation));
+			auto cosZ = _mm_set1_ps(std::cos(rotation));
+			auto column0 = _mm_loadu_ps(matrix.m);
+			auto column1 = _mm_loadu_ps(matrix.m + 4);
+			_mm_storeu_ps(matrix.m,     _mm_add_ps(_mm_mul_ps(column0, cosZ), _mm_mul_ps(column1, sinZ)));
+			_mm_storeu_ps(matrix.m + 4, _mm_sub_ps(_mm_mul_ps(column1, cosZ), _mm_mul_ps(column0, sinZ)));
+		}
+
+		inline void scale2D(Matrix<4, 4, f32> & matrix, f32 scaleX, f32 scaleY) {
+			_mm_storeu_ps(matrix.m,     _mm_mul_ps(_mm_loadu_ps(matrix.m),     _mm_set1_ps(scaleX)));
+			_mm_storeu_ps(matrix.m + 4, _mm_mul_ps(_mm_loadu_ps(matrix.m + 4), _mm_set1_ps(scaleY)));
+		}
+
+		inline void transform2D(Matrix<4, 4, f32> & matrix, f32 translateX, f32 translateY, f32 rotation, f32 scaleX, f32 scaleY) {
+			auto sinZ = std::sin(rotation);
+			auto cosZ = std::cos(rotation);
+			auto zero = _mm_setzero_ps();
+			/* (cos x, sin x, -sin y, cos y) split into the first two columns */
+			auto scaled = _mm_mul_ps(_mm_setr_ps(cosZ, sinZ, -sinZ, cosZ), _mm_setr_ps(scaleX, scaleX, scaleY, scaleY));
+			_mm_storeu_ps(matrix.m,      _mm_movelh_ps(scaled, zero));
+			_mm_storeu_ps(matrix.m + 4,  _mm_movehl_ps(zero, scaled));
+			_mm_storeu_ps(matrix.m + 8,  _mm_setr_ps(0, 0, 1, 0));
+			_mm_storeu_ps(matrix.m + 12, _mm_setr_ps(translateX, translateY, 0, 1));
+		}
+	}
+
+	using namespace Sse;
+#else
+	using namespace Scalar;
+#endif
+
+	/// left * rights[i] for a run of matrices, e.g. one projview against every model
+	/// uses avx2 when the processor has it, out may be rights
+	void multiplyBatch(const Matrix<4, 4, f32> & left, const Matrix<4, 4, f32> * rights, Matrix<4, 4, f32> * out, size count);
+
+	/// matrix * vectors[i] for a run of vectors, out may be vectors
+	void multiplyVectorBatch(const Matrix<4, 4, f32> & matrix, const Vector<4, f32> * vectors, Vector<4, f32> * out, size count);
+}
+
+/* constant expressions take the generic templates, the intrinsics can't be evaluated at compile time */
+constexpr Matrix<4, 4, f32> operator*(const Matrix<4, 4, f32> & left, const Matrix<4, 4, f32> & right) {
+	if (std::is_constant_evaluated())
+		return operator*<f32>(left, right);
+
+	Matrix<4, 4, f32> product;
+	Matrix4Kernels::multiply(left, right, product);
+	return product;
+}
+
+constexpr Vector<4, f32> operator*(const Matrix<4, 4, f32> & left, const Vector<4, f32> & right) {
+	if (std::is_constant_evaluated())
+		return operator*<f32>(left, right);
+
+	Vector<4, f32> product;
+	Matrix4Kernels::multiplyVector(left, right, product);
+	return product;
+}
+
+constexpr Matrix<4, 4, f32> transpose(const Matrix<4, 4, f32> & matrix) {
+	if (std::is_constant_evaluated())
+		return Matrix<4, 4, f32>(matrix).transpose();
+
+	Matrix<4, 4, f32> transposed;
+	Matrix4Kernels::transpose(matrix, transposed);
+	return transposed;
+}
+
+inline Matrix<4, 4, f32> inverse(const Matrix<4, 4, f32> & matrix) {
+	Matrix<4, 4, f32> inverted;
+	Matrix4Kernels::invert(matrix, inverted);
+	return inverted;
+}
+
+template <>
+inline Matrix<4, 4, f32> & Matrix<4, 4, f32>::rotate2D(f32 rotation) {
+	Matrix4Kernels::rotate2D(*this, rotation);
+	return *this;
+}
+
+template <>
+inline Matrix<4, 4, f32> & Matrix<4, 4, f32>::scale2D(f32 scaleX, f32 scaleY) {
+	Matrix4Kernels::scale2D(*this, scaleX, scaleY);
+	return *this;
+}
+
+template <>
+inline Matrix<4, 4, f32> & Matrix<4, 4, f32>::setTransform2D(f32 translateX, f32 translateY, f32 rotation, f32 scaleX, f32 scaleY) {
+	Matrix4Kernels::transform2D(*this, translateX, translateY, rotation, scaleX, scaleY);
+	return *this;
+}
+
+#endif
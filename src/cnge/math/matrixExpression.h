@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CNGE_MATRIX_EXPRESSION
+#define CNGE_MATRIX_EXPRESSION
+
+#include <type_traits>
+#include <functional>
+
+#include "types.h"
+
+template <u32 N, u32 M, typename T>
+class Matrix;
+
+/// the elementwise matrix operators build these instead of matrices,
+/// see VectorExpression, indices are into the column major m array
+template <u32 N, u32 M, typename T, typename E>
+class MatrixExpression {
+	public:
+		constexpr T get(u32 index) const {
+			if constexpr (std::is_same_v<E, Matrix<N, M, T>>)
+				return static_cast<const E &>(*this).m[index];
+			else
+				return static_cast<const E &>(*this).get(index);
+		}
+};
+
+template <u32 N, u32 M, typename T, typename E>
+using MatrixOperand = std::conditional_t<std::is_same_v<E, Matrix<N, M, T>>, const E &, E>;
+
+template <u32 N, u32 M, typename T, typename L, typename R, typename Op>
+class MatrixBinary : public MatrixExpression<N, M, T, MatrixBinary<N, M, T, L, R, Op>> {
+	public:
+		constexpr MatrixBinary(const L & left, const R & right) :
+			left(left),
+			right(right) {}
+
+		constexpr T get(u32 index) const {
+			return T(Op()(left.get(index), right.get(index)));
+		}
+
+	private:
+		MatrixOperand<N, M, T, L> left;
+		MatrixOperand<N, M, T, R> right;
+};
+
+template <u32 N, u32 M, typename T, typename E, typename Op>
+class MatrixScalar : public MatrixExpression<N, M, T, MatrixScalar<N, M, T, E, Op>> {
+	public:
+		constexpr MatrixScalar(const E & expression, T scalar) :
+			expression(expression),
+			scalar(scalar) {}
+
+		constexpr T get(u32 index) const {
+			return T(Op()(expression.get(index), scalar));
+		}
+
+	private:
+		MatrixOperand<N, M, T, E> expression;
+		T scalar;
+};
+
+/// products can't be fused elementwise, so an expression on either
+/// side of one is worked out into a matrix first
+template <u32 N, u32 M, typename T, typename E>
+constexpr decltype(auto) evaluate(const MatrixExpression<N, M, T, E> & expression) {
+	if constexpr (std::is_same_v<E, Matrix<N, M, T>>)
+		return static_cast<const Matrix<N, M, T> &>(expression);
+	else
+		return Matrix<N, M, T>(expression);
+}
+
+#endif // CNGE_MATRIX_EXPRESSION
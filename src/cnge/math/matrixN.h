@@ -30,7 +30,7 @@
 #define CNGE_VECTOR_FORWARD
 
 template <u32 N, typename T>
-class Vector<N, T>;
+class Vector;
 
 #endif // CNGE_VECTOR_FORWARD
 
@@ -46,27 +46,24 @@ class Matrix;
 #define CNGE_MATRIXN
 
 #include <ostream>
+#include <array>
+#include <utility>
 
 #include "Vector.h"
 #include "Matrix.h"
+#include "vectorView.h"
+#include "matrixExpression.h"
 
 template <u32 N, typename T>
-class Matrix<N, N, T> {
+class Matrix<N, N, T> : public MatrixExpression<N, N, T, Matrix<N, N, T>> {
 
 	static_assert(N > 0 && N > 0, "Matrix dimensions must be greater than 0!");
 
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] m;
-		}
 	public:
-		T * m;
+		T m[N * N];
 
-		static Matrix<N, N, T> makeIdentity() {
-			auto identity = new T[N * N];
+		static constexpr Matrix<N, N, T> makeIdentity() {
+			auto identity = std::array<T, N * N>();
 			for (u32 i = 0; i < N * N; ++i) {
 				if (i % N == i / N)
 					identity[i] = 1;
@@ -76,15 +73,14 @@ class Matrix<N, N, T> {
 			return identity;
 		}
 
-		Matrix() :
-			m(new T[N * N]()) {}
+		constexpr Matrix() :
+			m() {}
 
-		Matrix(T * m, bool owner = true) noexcept :
-			owner(owner),
-			m(m) {}
+		constexpr Matrix(const std::array<T, N * N> & values) noexcept :
+			Matrix([&](u32 i) { return values[i]; }, std::make_index_sequence<N * N>()) {}
 		
-		Matrix(std::initializer_list<T> list) :
-			m(new T[N * N]) {
+		constexpr Matrix(std::initializer_list<T> list) :
+			m() {
 			auto min  = list.size() < N * N ? list.size() : N * N;
 			auto init = list.begin();
 			for (u32 i = 0; i < min; ++i)
@@ -92,59 +88,51 @@ class Matrix<N, N, T> {
 		}
 
 		template <typename T2>
-		Matrix(const Matrix<N, N, T2> & matrix) :
-			m(new T[N * N]) {
-			for (u32 i = 0; i < N * N; ++i)
-				m[i] = (T) matrix.m[i];
-		}
+		constexpr Matrix(const Matrix<N, N, T2> & matrix) :
+			Matrix([&](u32 i) { return (T) matrix.m[i]; }, std::make_index_sequence<N * N>()) {}
 
-		Matrix(const Matrix<N, N, T> & matrix) :
-			m(new T[N * N]) {
-			for (u32 i = 0; i < N * N; ++i)
-				m[i] = matrix.m[i];
-		}
+		constexpr Matrix(const Matrix<N, N, T> & matrix) noexcept = default;
 
-		Matrix(Matrix<N, N, T> && matrix) noexcept :
-			owner(matrix.owner),
-			m(matrix.m) {
-			matrix.owner = false;
-		}
+		/// evaluates a chain of elementwise operators in one pass
+		template <typename E>
+		constexpr Matrix(const MatrixExpression<N, N, T, E> & expression) :
+			Matrix([&](u32 i) { return expression.get(i); }, std::make_index_sequence<N * N>()) {}
 
-		Matrix<N, N, T> & operator=(const Matrix<N, N, T> & matrix) {
-			for (u32 i = 0; i < N * N; ++i)
-				m[i] = matrix.m[i];
-			return *this;
-		}
+		constexpr Matrix<N, N, T> & operator=(const Matrix<N, N, T> & matrix) noexcept = default;
 
-		Matrix<N, N, T> & operator=(Matrix<N, N, T> && matrix) noexcept {
-			clean();
-			owner = matrix.owner;
-			m = matrix.m;
-			matrix.owner = false;
+		template <typename E>
+		constexpr Matrix<N, N, T> & operator=(const MatrixExpression<N, N, T, E> & expression) {
+			assign(expression, std::make_index_sequence<N * N>());
 			return *this;
 		}
 
-		Matrix<N, N, T> & operator+=(const Matrix<N, N, T> & matrix) {
+		template <typename E>
+		constexpr Matrix<N, N, T> & operator+=(const MatrixExpression<N, N, T, E> & matrix) {
 			for (u32 i = 0; i < N * N; ++i)
-				m[i] += matrix.m[i];
+				m[i] += matrix.get(i);
 			return *this;
 		}
 
-		Matrix<N, N, T> & operator-=(const Matrix<N, N, T> & matrix) {
+		template <typename E>
+		constexpr Matrix<N, N, T> & operator-=(const MatrixExpression<N, N, T, E> & matrix) {
 			for (u32 i = 0; i < N * N; ++i)
-				m[i] -= matrix.m[i];
+				m[i] -= matrix.get(i);
 			return *this;
 		}
 
-		Matrix<N, N, T> & operator*=(const Matrix<N, N, T> & matrix) {
+		constexpr Matrix<N, N, T> & operator*=(const Matrix<N, N, T> & matrix) {
 			return *this = *this * matrix;
 		}
 
-		Vector<N, T> operator[](u32 index) const noexcept {
-			return Vector<N, T>(index * N, false);
+		constexpr VectorView<N, T> operator[](u32 index) noexcept {
+			return VectorView<N, T>(m + index * N);
 		}
 
-		Matrix<N, N, T> & setIdentity() {
+		constexpr VectorView<N, const T> operator[](u32 index) const noexcept {
+			return VectorView<N, const T>(m + index * N);
+		}
+
+		constexpr Matrix<N, N, T> & setIdentity() {
 			for (u32 i = 0; i < N * N; ++i) {
 				if (i % N == i / N)
 					m[i] = 1;
@@ -154,34 +142,45 @@ class Matrix<N, N, T> {
 			return *this;
 		}
 
-		~Matrix() {
-			clean();
+	private:
+		template <typename Element, size... I>
+		constexpr Matrix(Element element, std::index_sequence<I...>) :
+			m { element(I)... } {}
+
+		template <typename E, size... I>
+		constexpr void assign(const MatrixExpression<N, N, T, E> & expression, std::index_sequence<I...>) {
+			((m[I] = expression.get(I)), ...);
 		}
 };
 
-template <u32 N, typename T>
-T det(const Matrix<N, N, T> & matrix) {
-	auto ret    = T{ 0 };
-	auto sign   = T{ 1 };
-	Matrix<N - 1, N - 1, T> storage;
-	for (u32 i = 0; i < N; ++i) {
-		auto offset = u32( -1 );
-		for (u32 j = 0; j < N * N; ++j)
-			if (j % N != 0 && j / N != i)
-				storage.m[++offset] = matrix.m[j];
-		ret  += sign * matrix.m[i * N] * det(storage);
-		sign *= -1;
+namespace MatrixUnroll {
+	/* the matrix without its first row and the given column */
+	template <u32 N, typename T, size... I>
+	constexpr Matrix<N - 1, N - 1, T> minorOf(const T * matrix, u32 column, std::index_sequence<I...>) {
+		return std::array<T, (N - 1) * (N - 1)> {
+			matrix[(I / (N - 1) < column ? I / (N - 1) : I / (N - 1) + 1) * N + I % (N - 1) + 1]...
+		};
 	}
-	return ret;
+
+	/* laplace expansion along the first row */
+	template <u32 N, typename T, size... I>
+	constexpr T cofactorExpansion(const Matrix<N, N, T> & matrix, std::index_sequence<I...>) {
+		return ((T(I % 2 == 0 ? 1 : -1) * matrix.m[I * N] * det(minorOf<N, T>(matrix.m, I, std::make_index_sequence<(N - 1) * (N - 1)>()))) + ...);
+	}
+}
+
+template <u32 N, typename T>
+constexpr T det(const Matrix<N, N, T> & matrix) {
+	return MatrixUnroll::cofactorExpansion(matrix, std::make_index_sequence<N>());
 }
 
 template <typename T>
-T det(const Matrix<2, 2, T> & matrix) {
+constexpr T det(const Matrix<2, 2, T> & matrix) {
 	return matrix.m[0] * matrix.m[3] - matrix.m[2] * matrix.m[1];
 }
 
 template <typename T>
-T det(const Matrix<1, 1, T> & matrix) {
+constexpr T det(const Matrix<1, 1, T> & matrix) {
 	return matrix.m[0];
 }
 
@@ -30,49 +30,36 @@
 #include <ostream>
 #include <cmath>
 #include <initializer_list>
+#include <array>
+#include <utility>
 
 #include "types.h"
+#include "vectorExpression.h"
 
 template <u32 N, typename T>
-class Vector {
+class Vector : public VectorExpression<N, T, Vector<N, T>> {
 
 	static_assert(N > 0, "Vector dimensions must be greater than 0!");
 
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] v;
-		}
-
 	public:
+		/// elements are stored back to back, so a VectorView can walk the whole array
 		static Vector<N, T> * newArray(u32 length) {
-			T * v = new T[N * length];
-			Vector<N, T> * ret = new Vector<N, T>[length];
-			ret[0] = Vector<N, T>(v);
-			for (u32 i = 1; i < length; ++i)
-				ret[i] = Vector<N, T>(v + i * N, false);
-			return ret;
+			return new Vector<N, T>[length];
 		}
 
-		T * v;
+		T v[N];
 
-		Vector() :
-			v(new T[N]()) {}
+		constexpr Vector() :
+			v() {}
 
-		Vector(T * v, bool owner = true) noexcept :
-			owner(owner),
-			v(v) {}
+		constexpr Vector(const std::array<T, N> & values) noexcept :
+			Vector([&](u32 i) { return values[i]; }, std::make_index_sequence<N>()) {}
 		
-		explicit Vector(T value) :
-			v(new T[N]) {
-			for (u32 i = 0; i < N; ++i)
-				v[i] = value;
-		}
+		constexpr explicit Vector(T value) :
+			Vector([&](u32) { return value; }, std::make_index_sequence<N>()) {}
 
-		Vector(std::initializer_list<T> list) :
-			v(new T[N]) {
+		constexpr Vector(std::initializer_list<T> list) :
+			v() {
 			auto min  = list.size() < N ? list.size() : N;
 			auto init = list.begin();
 			for (u32 i = 0; i < min; ++i)
@@ -80,83 +67,71 @@ class Vector {
 		}
 
 		template <typename T2>
-		Vector(const Vector<N, T2> & vector) :
-			v(new T[N]) {
-			for (u32 i = 0; i < N; ++i)
-				v[i] = (T) vector.v[i];
-		}
-		
-		Vector(const Vector<N, T> & vector) :
-			v(new T[N]) {
-			for (u32 i = 0; i < N; ++i)
-				v[i] = vector.v[i];
-		}
+		constexpr Vector(const Vector<N, T2> & vector) :
+			Vector([&](u32 i) { return (T) vector.v[i]; }, std::make_index_sequence<N>()) {}
 		
-		Vector(Vector<N, T> && vector) noexcept :
-			owner(vector.owner),
-			v(vector.v) {
-			vector.owner = false;
-		}
+		constexpr Vector(const Vector<N, T> & vector) noexcept = default;
 
-		Vector<N, T> & operator=(const Vector<N, T> & vector) {
-			for (u32 i = 0; i < N; ++i)
-				v[i] = vector.v[i];
+		/// evaluates a chain of operators in one pass
+		template <typename E>
+		constexpr Vector(const VectorExpression<N, T, E> & expression) :
+			Vector([&](u32 i) { return expression.get(i); }, std::make_index_sequence<N>()) {}
+
+		constexpr Vector<N, T> & operator=(const Vector<N, T> & vector) noexcept = default;
+
+		/// every element of the expression only reads the same element of its
+		/// operands, so assigning `a = b + a` is safe
+		template <typename E>
+		constexpr Vector<N, T> & operator=(const VectorExpression<N, T, E> & expression) {
+			assign(expression, std::make_index_sequence<N>());
 			return *this;
 		}
 		
-		Vector<N, T> & operator=(Vector<N, T> && vector) noexcept {
-			if (owner) {
-				clean();
-				owner = vector.owner;
-				v = vector.v;
-				vector.owner = false;
-			}
-			else for (u32 i = 0; i < N; ++i)
-				v[i] = vector.v[i];
-			return *this;
-		}
-
-		Vector<N, T> & operator+=(const Vector<N, T> & vector) {
+		template <typename E>
+		constexpr Vector<N, T> & operator+=(const VectorExpression<N, T, E> & vector) {
 			for (u32 i = 0; i < N; ++i)
-				v[i] += vector.v[i];
+				v[i] += vector.get(i);
 			return *this;
 		}
 
-		Vector<N, T> & operator-=(const Vector<N, T> & vector) {
+		template <typename E>
+		constexpr Vector<N, T> & operator-=(const VectorExpression<N, T, E> & vector) {
 			for (u32 i = 0; i < N; ++i)
-				v[i] -= vector.v[i];
+				v[i] -= vector.get(i);
 			return *this;
 		}
 
-		Vector<N, T> & operator*=(T scalar) {
+		constexpr Vector<N, T> & operator*=(T scalar) {
 			for (u32 i = 0; i < N; ++i)
 				v[i] *= scalar;
 			return *this;
 		}
 
-		Vector<N, T> & operator*=(const Vector<N, T> & vector) {
+		template <typename E>
+		constexpr Vector<N, T> & operator*=(const VectorExpression<N, T, E> & vector) {
 			for (u32 i = 0; i < N; ++i)
-				v[i] *= vector.v[i];
+				v[i] *= vector.get(i);
 			return *this;
 		}
 
-		Vector<N, T> & operator/=(T scalar) {
+		constexpr Vector<N, T> & operator/=(T scalar) {
 			for (u32 i = 0; i < N; ++i)
 				v[i] /= scalar;
 			return *this;
 		}
 
-		Vector<N, T> & operator/=(const Vector<N, T> & vector) {
+		template <typename E>
+		constexpr Vector<N, T> & operator/=(const VectorExpression<N, T, E> & vector) {
 			for (u32 i = 0; i < N; ++i)
-				v[i] /= vector.v[i];
+				v[i] /= vector.get(i);
 			return *this;
 		}
 
-		T & operator[](u32 index) noexcept {
+		constexpr T & operator[](u32 index) noexcept {
 			return v[index];
 		}
 
-		const T & operator[](u32 index) const noexcept {
+		constexpr const T & operator[](u32 index) const noexcept {
 			return v[index];
 		}
 		
@@ -167,8 +142,8 @@ class Vector {
 			return sqrt(lengthSquared);
 		}
 
-		T getLengthSquared() const {
-			auto lengthSquared = 0;
+		constexpr T getLengthSquared() const {
+			auto lengthSquared = T();
 			for (u32 i = 0; i < N; ++i)
 				lengthSquared += v[i] * v[i];
 			return lengthSquared;
@@ -188,116 +163,98 @@ class Vector {
 			return *this;
 		}
 
-		Vector<N, T> & negate() {
+		constexpr Vector<N, T> & negate() {
 			for (u32 i = 0; i < N; ++i)
 				v[i] = -v[i];
 			return *this;
 		}
 
-		Vector<N, T> & project(const Vector<N, T> & projection) {
+		constexpr Vector<N, T> & project(const Vector<N, T> & projection) {
 			auto scalar = dot(*this, projection) / projection.getLengthSquared();
 			for (u32 i = 0; i < N; ++i)
 				v[i] = scalar * projection.v[i];
 			return *this;
 		}
 
-		Vector<N, T> & set(const Vector<N, T> & set) {
+		constexpr Vector<N, T> & set(const Vector<N, T> & set) {
 			for (u32 i = 0; i < N; ++i)
 				v[i] = set.v[i];
 			return *this;
 		}
 
-		Vector<N, T> & translate(const Vector<N, T> & translate) {
+		constexpr Vector<N, T> & translate(const Vector<N, T> & translate) {
 			for (u32 i = 0; i < N; ++i)
 				v[i] += translate.v[i];
 			return *this;
 		}
 
-		Vector<N, T> & scale(T scale) {
+		constexpr Vector<N, T> & scale(T scale) {
 			for (u32 i = 0; i < N; ++i)
 				v[i] *= scale;
 			return *this;
 		}
 
-		Vector<N, T> & scale(const Vector<N, T> & scale) {
+		constexpr Vector<N, T> & scale(const Vector<N, T> & scale) {
 			for (u32 i = 0; i < N; ++i)
 				v[i] *= scale.v[i];
 			return *this;
 		}
 
-		virtual ~Vector() noexcept {
-			clean();
+	private:
+		template <typename Element, size... I>
+		constexpr Vector(Element element, std::index_sequence<I...>) :
+			v { element(I)... } {}
+
+		template <typename E, size... I>
+		constexpr void assign(const VectorExpression<N, T, E> & expression, std::index_sequence<I...>) {
+			((v[I] = expression.get(I)), ...);
 		}
 };
 
-template <u32 N, typename T>
-Vector<N, T> operator-(const Vector<N, T> & vector) {
-	auto newV = new T[N];
-	for (u32 i = 0; i < N; ++i)
-		newV[i] = -vector.v[i];
-	return newV;
+template <u32 N, typename T, typename E>
+constexpr VectorUnary<N, T, E, std::negate<>> operator-(const VectorExpression<N, T, E> & vector) {
+	return VectorUnary<N, T, E, std::negate<>>(static_cast<const E &>(vector));
 }
 
-template <u32 N, typename T>
-Vector<N, T> operator+(const Vector<N, T> & left, const Vector<N, T> & right) {
-	auto newV = new T[N];
-	for (u32 i = 0; i < N; ++i)
-		newV[i] = left.v[i] + right.v[i];
-	return newV;
+template <u32 N, typename T, typename L, typename R>
+constexpr VectorBinary<N, T, L, R, std::plus<>> operator+(const VectorExpression<N, T, L> & left, const VectorExpression<N, T, R> & right) {
+	return VectorBinary<N, T, L, R, std::plus<>>(static_cast<const L &>(left), static_cast<const R &>(right));
 }
 
-template <u32 N, typename T>
-Vector<N, T> operator-(const Vector<N, T> & left, const Vector<N, T> & right) {
-	auto newV = new T[N];
-	for (u32 i = 0; i < N; ++i)
-		newV[i] = left.v[i] - right.v[i];
-	return newV;
+template <u32 N, typename T, typename L, typename R>
+constexpr VectorBinary<N, T, L, R, std::minus<>> operator-(const VectorExpression<N, T, L> & left, const VectorExpression<N, T, R> & right) {
+	return VectorBinary<N, T, L, R, std::minus<>>(static_cast<const L &>(left), static_cast<const R &>(right));
 }
 
-template <u32 N, typename T>
-Vector<N, T> operator*(const Vector<N, T> & left, T right) {
-	auto newV = new T[N];
-	for (u32 i = 0; i < N; ++i)
-		newV[i] = left.v[i] * right;
-	return newV;
+template <u32 N, typename T, typename L, typename R>
+constexpr VectorBinary<N, T, L, R, std::multiplies<>> operator*(const VectorExpression<N, T, L> & left, const VectorExpression<N, T, R> & right) {
+	return VectorBinary<N, T, L, R, std::multiplies<>>(static_cast<const L &>(left), static_cast<const R &>(right));
 }
 
-template <u32 N, typename T>
-Vector<N, T> operator*(T left, const Vector<N, T> & right) {
-	auto newV = new T[N];
-	for (u32 i = 0; i < N; ++i)
-		newV[i] = left * right.v[i];
-	return newV;
+template <u32 N, typename T, typename L, typename R>
+constexpr VectorBinary<N, T, L, R, std::divides<>> operator/(const VectorExpression<N, T, L> & left, const VectorExpression<N, T, R> & right) {
+	return VectorBinary<N, T, L, R, std::divides<>>(static_cast<const L &>(left), static_cast<const R &>(right));
 }
 
-template <u32 N, typename T>
-Vector<N, T> operator*(const Vector<N, T> & left, const Vector<N, T> & right) {
-	auto newV = new T[N];
-	for (u32 i = 0; i < N; ++i)
-		newV[i] = left.v[i] * right.v[i];
-	return newV;
+template <u32 N, typename T, typename E>
+constexpr VectorScalar<N, T, E, std::multiplies<>, false> operator*(const VectorExpression<N, T, E> & left, T right) {
+	return VectorScalar<N, T, E, std::multiplies<>, false>(static_cast<const E &>(left), right);
 }
 
-template <u32 N, typename T>
-Vector<N, T> operator/(const Vector<N, T> & left, T right) {
-	auto newV = new T[N];
-	for (u32 i = 0; i < N; ++i)
-		newV[i] = left.v[i] / right;
-	return newV;
+template <u32 N, typename T, typename E>
+constexpr VectorScalar<N, T, E, std::multiplies<>, true> operator*(T left, const VectorExpression<N, T, E> & right) {
+	return VectorScalar<N, T, E, std::multiplies<>, true>(static_cast<const E &>(right), left);
 }
 
-template <u32 N, typename T>
-Vector<N, T> operator/(const Vector<N, T> & left, const Vector<N, T> & right) {
-	auto newV = new T[N];
-	for (u32 i = 0; i < N; ++i)
-		newV[i] = left.v[i] / right.v[i];
-	return newV;
+template <u32 N, typename T, typename E>
+constexpr VectorScalar<N, T, E, std::divides<>, false> operator/(const VectorExpression<N, T, E> & left, T right) {
+	return VectorScalar<N, T, E, std::divides<>, false>(static_cast<const E &>(left), right);
 }
 
 template <u32 N, typename T>
 Vector<N + 1, T> operator|(const Vector<N, T> & left, T right) {
-	auto newV = new T[N + 1];
-	for (u32 i = 0; i < N + 1; ++i)
+	auto newV = std::array<T, N + 1>();
+	for (u32 i = 0; i < N; ++i)
 		newV[i] = left.v[i];
 	newV[N] = right;
 	return newV;
@@ -305,17 +262,17 @@ Vector<N + 1, T> operator|(const Vector<N, T> & left, T right) {
 
 template <u32 N, typename T>
 Vector<N + 1, T> operator|(T left, const Vector<N, T> & right) {
-	auto newV = new T[N + 1];
+	auto newV = std::array<T, N + 1>();
 	newV[0] = left;
-	for (u32 i = 0; i < N + 1; ++i)
+	for (u32 i = 0; i < N; ++i)
 		newV[i + 1] = right.v[i];
 	return newV;
 }
 
 template <u32 N, u32 N2, typename T>
 Vector<N + N2, T> operator|(const Vector<N, T> & left, const Vector<N2, T> & right) {
-	auto newV = new T[N + N2];
-	auto vRight = newV + N;
+	auto newV = std::array<T, N + N2>();
+	auto vRight = newV.data() + N;
 	for (u32 i = 0; i < N; ++i)
 		newV[i] = left.v[i];
 	for (u32 i = 0; i < N2; ++i)
@@ -326,14 +283,14 @@ Vector<N + N2, T> operator|(const Vector<N, T> & left, const Vector<N2, T> & rig
 template <u32 N, typename T>
 Vector<N, T> setLength(const Vector<N, T> & vector, T length) {
 	auto scalar = length / vector.getLength();
-	auto newV = new T[N];
+	auto newV = std::array<T, N>();
 	for (u32 i = 0; i < N; ++i)
 		newV[i] = vector.v[i] * scalar;
 	return newV;
 }
 
 template <u32 N, typename T>
-Vector<N, T> & setLength(const Vector<N, T> & vector, T length, const Vector<N, T> & target) {
+Vector<N, T> & setLength(const Vector<N, T> & vector, T length, Vector<N, T> & target) {
 	auto scalar = length / vector.getLength();
 	for (u32 i = 0; i < N; ++i)
 		target.v[i] = vector.v[i] * scalar;
@@ -343,14 +300,14 @@ Vector<N, T> & setLength(const Vector<N, T> & vector, T length, const Vector<N,
 template <u32 N, typename T>
 Vector<N, T> normalize(const Vector<N, T> & vector) {
 	auto scalar = 1 / vector.getLength();
-	auto newV = new T[N];
+	auto newV = std::array<T, N>();
 	for (u32 i = 0; i < N; ++i)
 		newV[i] = vector.v[i] * scalar;
 	return newV;
 }
 
 template <u32 N, typename T>
-Vector<N, T> & normalize(const Vector<N, T> & vector, const Vector<N, T> & target) {
+Vector<N, T> & normalize(const Vector<N, T> & vector, Vector<N, T> & target) {
 	auto scalar = 1 / vector.getLength();
 	for (u32 i = 0; i < N; ++i)
 		target.v[i] = vector.v[i] * scalar;
@@ -358,22 +315,22 @@ Vector<N, T> & normalize(const Vector<N, T> & vector, const Vector<N, T> & targe
 }
 
 template <u32 N, typename T>
-Vector<N, T> negate(const Vector<N, T> & vector) {
-	auto newV = new T[N];
+constexpr Vector<N, T> negate(const Vector<N, T> & vector) {
+	auto newV = std::array<T, N>();
 	for (u32 i = 0; i < N; ++i)
 		newV[i] = -vector.v[i];
 	return newV;
 }
 
 template <u32 N, typename T>
-Vector<N, T> & negate(const Vector<N, T> & vector, Vector<N, T> & target) {
+constexpr Vector<N, T> & negate(const Vector<N, T> & vector, Vector<N, T> & target) {
 	for (u32 i = 0; i < N; ++i)
 		target.v[i] = -vector.v[i];
 	return target;
 }
 
 template <u32 N, typename T>
-T dot(const Vector<N, T> & left, const Vector<N, T> & right) {
+constexpr T dot(const Vector<N, T> & left, const Vector<N, T> & right) {
 	auto product = T();
 	for (u32 i = 0; i < N; ++i)
 		product += left.v[i] * right.v[i];
@@ -381,16 +338,16 @@ T dot(const Vector<N, T> & left, const Vector<N, T> & right) {
 }
 
 template <u32 N, typename T>
-Vector<N, T> project(const Vector<N, T> & vector, const Vector<N, T> & projection) {
+constexpr Vector<N, T> project(const Vector<N, T> & vector, const Vector<N, T> & projection) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
-	auto newV = new T[N];
+	auto newV = std::array<T, N>();
 	for (u32 i = 0; i < N; ++i)
 		newV[i] = scalar * projection.v[i];
 	return newV;
 }
 
 template <u32 N, typename T>
-Vector<N, T> & project(const Vector<N, T> & vector, const Vector<N, T> & projection, Vector<N, T> & target) {
+constexpr Vector<N, T> & project(const Vector<N, T> & vector, const Vector<N, T> & projection, Vector<N, T> & target) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	for (u32 i = 0; i < N; ++i)
 		target.v[i] = scalar * projection.v[i];
@@ -403,8 +360,8 @@ T angleBetween(const Vector<N, T> & vector1, const Vector<N, T> & vector2) {
 }
 
 template <u32 N, typename T>
-Vector<N, T> & translate(const Vector<N, T> & vector, const Vector<N, T> & translate) {
-	auto newV = new T[N];
+constexpr Vector<N, T> translate(const Vector<N, T> & vector, const Vector<N, T> & translate) {
+	auto newV = std::array<T, N>();
 	for (u32 i = 0; i < N; ++i)
 		newV[i] = vector.v[i] + translate.v[i];
 	return newV;
@@ -412,15 +369,15 @@ Vector<N, T> & translate(const Vector<N, T> & vector, const Vector<N, T> & trans
 
 
 template <u32 N, typename T>
-Vector<N, T> & translate(const Vector<N, T> & vector, const Vector<N, T> & translate, Vector<N, T> & target) {
+constexpr Vector<N, T> & translate(const Vector<N, T> & vector, const Vector<N, T> & translate, Vector<N, T> & target) {
 	for (u32 i = 0; i < N; ++i)
 		target.v[i] = vector.v[i] + translate.v[i];
 	return target;
 }
 
 template <u32 N, typename T>
-Vector<N, T> & scale(const Vector<N, T> & vector, T scale) {
-	auto newV = new T[N];
+constexpr Vector<N, T> scale(const Vector<N, T> & vector, T scale) {
+	auto newV = std::array<T, N>();
 	for (u32 i = 0; i < N; ++i)
 		newV[i] = vector.v[i] * scale;
 	return newV;
@@ -428,15 +385,15 @@ Vector<N, T> & scale(const Vector<N, T> & vector, T scale) {
 
 
 template <u32 N, typename T>
-Vector<N, T> & scale(const Vector<N, T> & vector, T scale, Vector<N, T> & target) {
+constexpr Vector<N, T> & scale(const Vector<N, T> & vector, T scale, Vector<N, T> & target) {
 	for (u32 i = 0; i < N; ++i)
 		target.v[i] = vector.v[i] * scale;
 	return target;
 }
 
 template <u32 N, typename T>
-Vector<N, T> & scale(const Vector<N, T> & vector, const Vector<N, T> & scale) {
-	auto newV = new T[N];
+constexpr Vector<N, T> scale(const Vector<N, T> & vector, const Vector<N, T> & scale) {
+	auto newV = std::array<T, N>();
 	for (u32 i = 0; i < N; ++i)
 		newV[i] = vector.v[i] * scale.v[i];
 	return newV;
@@ -444,17 +401,17 @@ Vector<N, T> & scale(const Vector<N, T> & vector, const Vector<N, T> & scale) {
 
 
 template <u32 N, typename T>
-Vector<N, T> & scale(const Vector<N, T> & vector, const Vector<N, T> & scale, Vector<N, T> & target) {
+constexpr Vector<N, T> & scale(const Vector<N, T> & vector, const Vector<N, T> & scale, Vector<N, T> & target) {
 	for (u32 i = 0; i < N; ++i)
 		target.v[i] = vector.v[i] * scale.v[i];
 	return target;
 }
 
-template <u32 N, typename T>
-std::ostream & operator<<(std::ostream & stream, const Vector<N, T> & vector) {
+template <u32 N, typename T, typename E>
+std::ostream & operator<<(std::ostream & stream, const VectorExpression<N, T, E> & vector) {
 	stream << '<';
 	for (u32 i = 0; i < N; ++i) {
-		stream << vector.v[i];
+		stream << vector.get(i);
 		if (i < N - 1)
 			stream << ", ";
 	}
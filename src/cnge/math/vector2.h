@@ -70,109 +70,68 @@ namespace VectorDimensions {
 
 template <typename T>
 class Vector<2, T> {
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] v;
-		}
-
 	public:
+		/// elements are stored back to back, so a VectorView can walk the whole array
 		static Vector<2, T> * newArray(u32 length) {
-			T * v = new T[2 * length];
-			Vector<2, T> * ret = new Vector<2, T>[length];
-			ret[0] = Vector<2, T>(v);
-			for (u32 i = 1; i < length; ++i)
-				ret[i] = Vector<2, T>(v + i * 2, false);
-			return ret;
+			return new Vector<2, T>[length];
 		}
 
-		T * v;
+		T v[2];
 		
-		Vector() :
-			v(new T[2]()) {}
+		constexpr Vector() :
+			v() {}
 
-		Vector(T * v, bool owner = true) noexcept :
-			owner(owner),
-			v(v) {}
+		constexpr Vector(const std::array<T, 2> & values) noexcept :
+			v { values[0], values[1] } {}
 
-		explicit Vector(T value) :
-			v(new T[2] { value, value }) {}
+		constexpr explicit Vector(T value) :
+			v { value, value } {}
 
-		Vector(T x, T y) :
-			v(new T[2] { x, y }) {}
+		constexpr Vector(T x, T y) :
+			v { x, y } {}
 
 		template <typename T2>
-		Vector(const Vector<2, T2> & vector) :
-			v(new T[2] {
+		constexpr Vector(const Vector<2, T2> & vector) :
+			v {
 				(T) vector.v[0],
 				(T) vector.v[1]
-			}) {}
-
-		Vector(const Vector<2, T> & vector) :
-			v(new T[2] {
-				vector.v[0],
-				vector.v[1]
-			}) {}
-
-		Vector(Vector<2, T> && vector) noexcept :
-			owner(vector.owner),
-			v(vector.v) {
-			vector.owner = false;
-		}
+			} {}
 
-		Vector<2, T> & operator=(const Vector<2, T> & vector) {
-			v[0] = vector.v[0];
-			v[1] = vector.v[1];
-			return *this;
-		}
+		constexpr Vector(const Vector<2, T> & vector) noexcept = default;
 
-		Vector<2, T> & operator=(Vector<2, T> && vector) noexcept {
-			if (owner) {
-				clean();
-				owner = vector.owner;
-				v = vector.v;
-				vector.owner = false;
-			}
-			else {
-				v[0] = vector.v[0];
-				v[1] = vector.v[1];
-			}
-			return *this;
-		}
+		constexpr Vector<2, T> & operator=(const Vector<2, T> & vector) noexcept = default;
 
-		Vector<2, T> & operator+=(const Vector<2, T> & vector) {
+		constexpr Vector<2, T> & operator+=(const Vector<2, T> & vector) {
 			v[0] += vector.v[0];
 			v[1] += vector.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & operator-=(const Vector<2, T> & vector) {
+		constexpr Vector<2, T> & operator-=(const Vector<2, T> & vector) {
 			v[0] -= vector.v[0];
 			v[1] -= vector.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & operator*=(T scalar) {
+		constexpr Vector<2, T> & operator*=(T scalar) {
 			v[0] *= scalar;
 			v[1] *= scalar;
 			return *this;
 		}
 
-		Vector<2, T> & operator*=(const Vector<2, T> & vector) {
+		constexpr Vector<2, T> & operator*=(const Vector<2, T> & vector) {
 			v[0] *= vector.v[0];
 			v[1] *= vector.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & operator/=(T scalar) {
+		constexpr Vector<2, T> & operator/=(T scalar) {
 			v[0] /= scalar;
 			v[1] /= scalar;
 			return *this;
 		}
 
-		Vector<2, T> & operator/=(const Vector<2, T> & vector) {
+		constexpr Vector<2, T> & operator/=(const Vector<2, T> & vector) {
 			v[0] /= vector.v[0];
 			v[1] /= vector.v[1];
 			return *this;
@@ -202,19 +161,19 @@ class Vector<2, T> {
 			return v[VectorDimensions::VectorDimension<N>::dimension];
 		}
 
-		T & x() noexcept {
+		constexpr T & x() noexcept {
 			return v[0];
 		}
 
-		const T & x() const noexcept {
+		constexpr const T & x() const noexcept {
 			return v[0];
 		}
 
-		T & y() noexcept {
+		constexpr T & y() noexcept {
 			return v[1];
 		}
 
-		const T & y() const noexcept {
+		constexpr const T & y() const noexcept {
 			return v[1];
 		}
 
@@ -225,7 +184,7 @@ class Vector<2, T> {
 			);
 		}
 
-		T getLengthSquared() const {
+		constexpr T getLengthSquared() const {
 			return (
 				v[0] * v[0] +
 				v[1] * v[1]
@@ -266,13 +225,13 @@ class Vector<2, T> {
 			return *this;
 		}
 
-		Vector<2, T> & negate() {
+		constexpr Vector<2, T> & negate() {
 			v[0] = -v[0];
 			v[1] = -v[1];
 			return *this;
 		}
 
-		Vector<2, T> & project(const Vector<2, T> & projection) {
+		constexpr Vector<2, T> & project(const Vector<2, T> & projection) {
 			auto scalar = dot(*this, projection) / projection.getLengthSquared();
 			v[0] /= scalar;
 			v[1] /= scalar;
@@ -322,7 +281,7 @@ class Vector<2, T> {
 			return *this;
 		}
 
-		Vector<2, T> & shearX(const Vector<2, T> & shear) {
+		constexpr Vector<2, T> & shearX(const Vector<2, T> & shear) {
 			v[0] -= v[1] * shear.v[1] / shear.v[0];
 			return *this;
 		}
@@ -332,246 +291,242 @@ class Vector<2, T> {
 			return *this;
 		}
 
-		Vector<2, T> & shearY(const Vector<2, T> & shear) {
+		constexpr Vector<2, T> & shearY(const Vector<2, T> & shear) {
 			v[1] += v[0] * shear.v[1] / shear.v[0];
 			return *this;
 		}
 
-		Vector<2, T> & set(const Vector<2, T> & set) {
+		constexpr Vector<2, T> & set(const Vector<2, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & translate(const Vector<2, T> & translate) {
+		constexpr Vector<2, T> & translate(const Vector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & scale(T scale) {
+		constexpr Vector<2, T> & scale(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			return *this;
 		}
 
-		Vector<2, T> & scale(const Vector<2, T> & scale) {
+		constexpr Vector<2, T> & scale(const Vector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & setX(T x) {
+		constexpr Vector<2, T> & setX(T x) {
 			v[0] = x;
 			return *this;
 		}
 
-		Vector<2, T> & setY(T y) {
+		constexpr Vector<2, T> & setY(T y) {
 			v[1] = y;
 			return *this;
 		}
 
-		Vector<2, T> & setXY(T x, T y) {
+		constexpr Vector<2, T> & setXY(T x, T y) {
 			v[0] = x;
 			v[1] = y;
 			return *this;
 		}
 
-		Vector<2, T> & setXY(const Vector<2, T> & set) {
+		constexpr Vector<2, T> & setXY(const Vector<2, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & setYX(const Vector<2, T> & set) {
+		constexpr Vector<2, T> & setYX(const Vector<2, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & translateX(T translateX) {
+		constexpr Vector<2, T> & translateX(T translateX) {
 			v[0] += translateX;
 			return *this;
 		}
 
-		Vector<2, T> & translateY(T translateY) {
+		constexpr Vector<2, T> & translateY(T translateY) {
 			v[1] += translateY;
 			return *this;
 		}
 
-		Vector<2, T> & translateXY(T translateX, T translateY) {
+		constexpr Vector<2, T> & translateXY(T translateX, T translateY) {
 			v[0] += translateX;
 			v[1] += translateY;
 			return *this;
 		}
 
-		Vector<2, T> & translateXY(const Vector<2, T> & translate) {
+		constexpr Vector<2, T> & translateXY(const Vector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & translateYX(const Vector<2, T> & translate) {
+		constexpr Vector<2, T> & translateYX(const Vector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			return *this;
 		}
 
-		Vector<2, T> & scaleX(T scaleX) {
+		constexpr Vector<2, T> & scaleX(T scaleX) {
 			v[0] *= scaleX;
 		}
 
-		Vector<2, T> & scaleY(T scaleY) {
+		constexpr Vector<2, T> & scaleY(T scaleY) {
 			v[1] *= scaleY;
 		}
 
-		Vector<2, T> & scaleXY(T scale) {
+		constexpr Vector<2, T> & scaleXY(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 		}
 
-		Vector<2, T> & scaleXY(T scaleX, T scaleY) {
+		constexpr Vector<2, T> & scaleXY(T scaleX, T scaleY) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 		}
 
-		Vector<2, T> & scaleXY(const Vector<2, T> & scale) {
+		constexpr Vector<2, T> & scaleXY(const Vector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 		}
 
-		Vector<2, T> & scaleYX(const Vector<2, T> & scale) {
+		constexpr Vector<2, T> & scaleYX(const Vector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 		}
 
-		T getX() const {
+		constexpr T getX() const {
 			return v[0];
 		}
 
-		T getY() const {
+		constexpr T getY() const {
 			return v[1];
 		}
 
-		Vector<2, T> getXX() const {
+		constexpr Vector<2, T> getXX() const {
 			return { v[0], v[0] };
 		}
 
-		Vector<2, T> getXY() const {
+		constexpr Vector<2, T> getXY() const {
 			return { v[0], v[1] };
 		}
 
-		Vector<2, T> getYX() const {
+		constexpr Vector<2, T> getYX() const {
 			return { v[1], v[0] };
 		}
 
-		Vector<2, T> getYY() const {
+		constexpr Vector<2, T> getYY() const {
 			return { v[1], v[1] };
 		}
 
-		Vector<3, T> getXXX() const {
+		constexpr Vector<3, T> getXXX() const {
 			return { v[0], v[0], v[0] };
 		}
 
-		Vector<3, T> getXXY() const {
+		constexpr Vector<3, T> getXXY() const {
 			return { v[0], v[0], v[1] };
 		}
 
-		Vector<3, T> getXYX() const {
+		constexpr Vector<3, T> getXYX() const {
 			return { v[0], v[1], v[0] };
 		}
 
-		Vector<3, T> getXYY() const {
+		constexpr Vector<3, T> getXYY() const {
 			return { v[0], v[1], v[1] };
 		}
 
-		Vector<3, T> getYXX() const {
+		constexpr Vector<3, T> getYXX() const {
 			return { v[1], v[0], v[0] };
 		}
 
-		Vector<3, T> getYXY() const {
+		constexpr Vector<3, T> getYXY() const {
 			return { v[1], v[0], v[1] };
 		}
 
-		Vector<3, T> getYYX() const {
+		constexpr Vector<3, T> getYYX() const {
 			return { v[1], v[1], v[0] };
 		}
 
-		Vector<3, T> getYYY() const {
+		constexpr Vector<3, T> getYYY() const {
 			return { v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getXXXX() const {
+		constexpr Vector<4, T> getXXXX() const {
 			return { v[0], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getXXXY() const {
+		constexpr Vector<4, T> getXXXY() const {
 			return { v[0], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getXXYX() const {
+		constexpr Vector<4, T> getXXYX() const {
 			return { v[0], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getXXYY() const {
+		constexpr Vector<4, T> getXXYY() const {
 			return { v[0], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getXYXX() const {
+		constexpr Vector<4, T> getXYXX() const {
 			return { v[0], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getXYXY() const {
+		constexpr Vector<4, T> getXYXY() const {
 			return { v[0], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getXYYX() const {
+		constexpr Vector<4, T> getXYYX() const {
 			return { v[0], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getXYYY() const {
+		constexpr Vector<4, T> getXYYY() const {
 			return { v[0], v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getYXXX() const {
+		constexpr Vector<4, T> getYXXX() const {
 			return { v[1], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getYXXY() const {
+		constexpr Vector<4, T> getYXXY() const {
 			return { v[1], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getYXYX() const {
+		constexpr Vector<4, T> getYXYX() const {
 			return { v[1], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getYXYY() const {
+		constexpr Vector<4, T> getYXYY() const {
 			return { v[1], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getYYXX() const {
+		constexpr Vector<4, T> getYYXX() const {
 			return { v[1], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getYYXY() const {
+		constexpr Vector<4, T> getYYXY() const {
 			return { v[1], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getYYYX() const {
+		constexpr Vector<4, T> getYYYX() const {
 			return { v[1], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getYYYY() const {
+		constexpr Vector<4, T> getYYYY() const {
 			return { v[1], v[1], v[1], v[1] };
 		}
-
-		virtual ~Vector() noexcept {
-			clean();
-		}
 };
 
 template <typename T>
-Vector<2, T> operator-(const Vector<2, T> & vector) {
+constexpr Vector<2, T> operator-(const Vector<2, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1]
@@ -579,7 +534,7 @@ Vector<2, T> operator-(const Vector<2, T> & vector) {
 }
 
 template <typename T>
-Vector<2, T> operator+(const Vector<2, T> & left, const Vector<2, T> & right) {
+constexpr Vector<2, T> operator+(const Vector<2, T> & left, const Vector<2, T> & right) {
 	return {
 		left.v[0] + right.v[0],
 		left.v[1] + right.v[1]
@@ -587,7 +542,7 @@ Vector<2, T> operator+(const Vector<2, T> & left, const Vector<2, T> & right) {
 }
 
 template <typename T>
-Vector<2, T> operator-(const Vector<2, T> & left, const Vector<2, T> & right) {
+constexpr Vector<2, T> operator-(const Vector<2, T> & left, const Vector<2, T> & right) {
 	return {
 		left.v[0] - right.v[0],
 		left.v[1] - right.v[1]
@@ -595,7 +550,7 @@ Vector<2, T> operator-(const Vector<2, T> & left, const Vector<2, T> & right) {
 }
 
 template <typename T>
-Vector<2, T> operator*(T left, const Vector<2, T> & right) {
+constexpr Vector<2, T> operator*(T left, const Vector<2, T> & right) {
 	return {
 		left * right.v[0],
 		left * right.v[1]
@@ -603,7 +558,7 @@ Vector<2, T> operator*(T left, const Vector<2, T> & right) {
 }
 
 template <typename T>
-Vector<2, T> operator*(const Vector<2, T> & left, T right) {
+constexpr Vector<2, T> operator*(const Vector<2, T> & left, T right) {
 	return {
 		left.v[0] * right,
 		left.v[1] * right
@@ -611,7 +566,7 @@ Vector<2, T> operator*(const Vector<2, T> & left, T right) {
 }
 
 template <typename T>
-Vector<2, T> operator*(const Vector<2, T> & left, const Vector<2, T> & right) {
+constexpr Vector<2, T> operator*(const Vector<2, T> & left, const Vector<2, T> & right) {
 	return {
 		left.v[0] * right.v[0],
 		left.v[1] * right.v[1]
@@ -619,7 +574,7 @@ Vector<2, T> operator*(const Vector<2, T> & left, const Vector<2, T> & right) {
 }
 
 template <typename T>
-Vector<2, T> operator/(const Vector<2, T> & left, T right) {
+constexpr Vector<2, T> operator/(const Vector<2, T> & left, T right) {
 	return {
 		left.v[0] / right,
 		left.v[1] / right
@@ -627,7 +582,7 @@ Vector<2, T> operator/(const Vector<2, T> & left, T right) {
 }
 
 template <typename T>
-Vector<2, T> operator/(const Vector<2, T> & left, const Vector<2, T> & right) {
+constexpr Vector<2, T> operator/(const Vector<2, T> & left, const Vector<2, T> & right) {
 	return {
 		left.v[0] / right.v[0],
 		left.v[1] / right.v[1]
@@ -733,7 +688,7 @@ Vector<2, T> & rotate(const Vector<2, T> & vector, T angle, Vector<2, T> & targe
 }
 
 template <typename T>
-Vector<2, T> negate(const Vector<2, T> & vector) {
+constexpr Vector<2, T> negate(const Vector<2, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1]
@@ -741,14 +696,14 @@ Vector<2, T> negate(const Vector<2, T> & vector) {
 }
 
 template <typename T>
-Vector<2, T> & negate(const Vector<2, T> & vector, Vector<2, T> & target) {
+constexpr Vector<2, T> & negate(const Vector<2, T> & vector, Vector<2, T> & target) {
 	target.v[0] = -vector.v[0];
 	target.v[1] = -vector.v[1];
 	return target;
 }
 
 template <typename T>
-T dot(const Vector<2, T> & left, const Vector<2, T> & right) {
+constexpr T dot(const Vector<2, T> & left, const Vector<2, T> & right) {
 	return (
 		left.v[0] * right.v[0] +
 		left.v[1] * right.v[1]
@@ -756,7 +711,7 @@ T dot(const Vector<2, T> & left, const Vector<2, T> & right) {
 }
 
 template <typename T>
-Vector<2, T> project(const Vector<2, T> & vector, const Vector<2, T> & projection) {
+constexpr Vector<2, T> project(const Vector<2, T> & vector, const Vector<2, T> & projection) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	return {
 		scalar * projection.v[0],
@@ -765,7 +720,7 @@ Vector<2, T> project(const Vector<2, T> & vector, const Vector<2, T> & projectio
 }
 
 template <typename T>
-Vector<2, T> & project(const Vector<2, T> & vector, const Vector<2, T> & projection, Vector<2, T> & target) {
+constexpr Vector<2, T> & project(const Vector<2, T> & vector, const Vector<2, T> & projection, Vector<2, T> & target) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	target.v[0] = scalar * projection.v[0];
 	target.v[1] = scalar * projection.v[1];
@@ -826,7 +781,7 @@ Vector<2, T> & shearY(const Vector<2, T> & vector, T angle, Vector<2, T> & targe
 }
 
 template <typename T>
-Vector<2, T> translate(const Vector<2, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<2, T> translate(const Vector<2, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0]	+ translate.v[0],
 		vector.v[1] + translate.v[1]
@@ -834,14 +789,14 @@ Vector<2, T> translate(const Vector<2, T> & vector, const Vector<2, T> & transla
 }
 
 template <typename T>
-Vector<2, T> & translate(const Vector<2, T> & vector, const Vector<2, T> & translate, Vector<2, T> & target) {
+constexpr Vector<2, T> & translate(const Vector<2, T> & vector, const Vector<2, T> & translate, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	return target;
 }
 
 template <typename T>
-Vector<2, T> scale(const Vector<2, T> & vector, T scale) {
+constexpr Vector<2, T> scale(const Vector<2, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale
@@ -849,14 +804,14 @@ Vector<2, T> scale(const Vector<2, T> & vector, T scale) {
 }
 
 template <typename T>
-Vector<2, T> & scale(const Vector<2, T> & vector, T scale, Vector<2, T> & target) {
+constexpr Vector<2, T> & scale(const Vector<2, T> & vector, T scale, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	return target;
 }
 
 template <typename T>
-Vector<2, T> scale(const Vector<2, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<2, T> scale(const Vector<2, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1]
@@ -864,14 +819,14 @@ Vector<2, T> scale(const Vector<2, T> & vector, const Vector<2, T> & scale) {
 }
 
 template <typename T>
-Vector<2, T> & scale(const Vector<2, T> & vector, const Vector<2, T> & scale, Vector<2, T> & target) {
+constexpr Vector<2, T> & scale(const Vector<2, T> & vector, const Vector<2, T> & scale, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	return target;
 }
 
 template<typename T>
-Vector<2, T> setX(const Vector<2, T> & vector, T x) {
+constexpr Vector<2, T> setX(const Vector<2, T> & vector, T x) {
 	return {
 		x,
 		vector.v[1]
@@ -879,7 +834,7 @@ Vector<2, T> setX(const Vector<2, T> & vector, T x) {
 }
 
 template<typename T>
-Vector<2, T> setY(const Vector<2, T> & vector, T y) {
+constexpr Vector<2, T> setY(const Vector<2, T> & vector, T y) {
 	return {
 		vector.v[0],
 		y
@@ -887,21 +842,21 @@ Vector<2, T> setY(const Vector<2, T> & vector, T y) {
 }
 
 template<typename T>
-Vector<2, T> setX(const Vector<2, T> & vector, T x, Vector<2, T> & target) {
+constexpr Vector<2, T> setX(const Vector<2, T> & vector, T x, Vector<2, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	return target;
 }
 
 template<typename T>
-Vector<2, T> setY(const Vector<2, T> & vector, T y, Vector<2, T> & target) {
+constexpr Vector<2, T> setY(const Vector<2, T> & vector, T y, Vector<2, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	return target;
 }
 
 template<typename T>
-Vector<2, T> translateX(const Vector<2, T> & vector, T translateX) {
+constexpr Vector<2, T> translateX(const Vector<2, T> & vector, T translateX) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1]
@@ -909,7 +864,7 @@ Vector<2, T> translateX(const Vector<2, T> & vector, T translateX) {
 }
 
 template<typename T>
-Vector<2, T> translateY(const Vector<2, T> & vector, T translateY) {
+constexpr Vector<2, T> translateY(const Vector<2, T> & vector, T translateY) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY
@@ -917,7 +872,7 @@ Vector<2, T> translateY(const Vector<2, T> & vector, T translateY) {
 }
 
 template<typename T>
-Vector<2, T> translateXY(const Vector<2, T> & vector, T translateX, T translateY) {
+constexpr Vector<2, T> translateXY(const Vector<2, T> & vector, T translateX, T translateY) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY
@@ -925,7 +880,7 @@ Vector<2, T> translateXY(const Vector<2, T> & vector, T translateX, T translateY
 }
 
 template<typename T>
-Vector<2, T> translateXY(const Vector<2, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<2, T> translateXY(const Vector<2, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1]
@@ -933,7 +888,7 @@ Vector<2, T> translateXY(const Vector<2, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<2, T> translateYX(const Vector<2, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<2, T> translateYX(const Vector<2, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0]
@@ -941,42 +896,42 @@ Vector<2, T> translateYX(const Vector<2, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<2, T> translateX(const Vector<2, T> & vector, T translateX, Vector<2, T> & target) {
+constexpr Vector<2, T> translateX(const Vector<2, T> & vector, T translateX, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	return target;
 }
 
 template<typename T>
-Vector<2, T> translateY(const Vector<2, T> & vector, T translateY, Vector<2, T> & target) {
+constexpr Vector<2, T> translateY(const Vector<2, T> & vector, T translateY, Vector<2, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	return target;
 }
 
 template<typename T>
-Vector<2, T> translateXY(const Vector<2, T> & vector, T translateX, T translateY, Vector<2, T> & target) {
+constexpr Vector<2, T> translateXY(const Vector<2, T> & vector, T translateX, T translateY, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	return target;
 }
 
 template<typename T>
-Vector<2, T> translateXY(const Vector<2, T> & vector, const Vector<2, T> & translate, Vector<2, T> & target) {
+constexpr Vector<2, T> translateXY(const Vector<2, T> & vector, const Vector<2, T> & translate, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	return target;
 }
 
 template<typename T>
-Vector<2, T> translateYX(const Vector<2, T> & vector, const Vector<2, T> & translate, Vector<2, T> & target) {
+constexpr Vector<2, T> translateYX(const Vector<2, T> & vector, const Vector<2, T> & translate, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	return target;
 }
 
 template<typename T>
-Vector<2, T> scaleX(const Vector<2, T> & vector, T scaleX) {
+constexpr Vector<2, T> scaleX(const Vector<2, T> & vector, T scaleX) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1]
@@ -984,7 +939,7 @@ Vector<2, T> scaleX(const Vector<2, T> & vector, T scaleX) {
 }
 
 template<typename T>
-Vector<2, T> scaleY(const Vector<2, T> & vector, T scaleY) {
+constexpr Vector<2, T> scaleY(const Vector<2, T> & vector, T scaleY) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY
@@ -992,7 +947,7 @@ Vector<2, T> scaleY(const Vector<2, T> & vector, T scaleY) {
 }
 
 template<typename T>
-Vector<2, T> scaleXY(const Vector<2, T> & vector, T scale) {
+constexpr Vector<2, T> scaleXY(const Vector<2, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale
@@ -1000,7 +955,7 @@ Vector<2, T> scaleXY(const Vector<2, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<2, T> scaleXY(const Vector<2, T> & vector, T scaleX, T scaleY) {
+constexpr Vector<2, T> scaleXY(const Vector<2, T> & vector, T scaleX, T scaleY) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY
@@ -1008,7 +963,7 @@ Vector<2, T> scaleXY(const Vector<2, T> & vector, T scaleX, T scaleY) {
 }
 
 template<typename T>
-Vector<2, T> scaleXY(const Vector<2, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<2, T> scaleXY(const Vector<2, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1]
@@ -1016,7 +971,7 @@ Vector<2, T> scaleXY(const Vector<2, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<2, T> scaleYX(const Vector<2, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<2, T> scaleYX(const Vector<2, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0]
@@ -1024,42 +979,42 @@ Vector<2, T> scaleYX(const Vector<2, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<2, T> scaleX(const Vector<2, T> & vector, T scaleX, const Vector<2, T> & target) {
+constexpr Vector<2, T> scaleX(const Vector<2, T> & vector, T scaleX, const Vector<2, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	return target;
 }
 
 template<typename T>
-Vector<2, T> scaleY(const Vector<2, T> & vector, T scaleY, const Vector<2, T> & target) {
+constexpr Vector<2, T> scaleY(const Vector<2, T> & vector, T scaleY, const Vector<2, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	return target;
 }
 
 template<typename T>
-Vector<2, T> scaleXY(const Vector<2, T> & vector, T scale, Vector<2, T> & target) {
+constexpr Vector<2, T> scaleXY(const Vector<2, T> & vector, T scale, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	return target;
 }
 
 template<typename T>
-Vector<2, T> scaleXY(const Vector<2, T> & vector, T scaleX, T scaleY, const Vector<2, T> & target) {
+constexpr Vector<2, T> scaleXY(const Vector<2, T> & vector, T scaleX, T scaleY, const Vector<2, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	return target;
 }
 
 template<typename T>
-Vector<2, T> scaleXY(const Vector<2, T> & vector, const Vector<2, T> & scale, Vector<2, T> & target) {
+constexpr Vector<2, T> scaleXY(const Vector<2, T> & vector, const Vector<2, T> & scale, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	return target;
 }
 
 template<typename T>
-Vector<2, T> scaleYX(const Vector<2, T> & vector, const Vector<2, T> & scale, Vector<2, T> & target) {
+constexpr Vector<2, T> scaleYX(const Vector<2, T> & vector, const Vector<2, T> & scale, Vector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	return target;
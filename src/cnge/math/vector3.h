@@ -67,118 +67,74 @@ namespace VectorDimensions {
 
 template <typename T>
 class Vector<3, T> {
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] v;
-		}
-
 	public:
+		/// elements are stored back to back, so a VectorView can walk the whole array
 		static Vector<3, T> * newArray(u32 length) {
-			T * v = new T[3 * length];
-			Vector<3, T> * ret = new Vector<3, T>[length];
-			ret[0] = Vector<3, T>(v);
-			for (u32 i = 1; i < length; ++i)
-				ret[i] = Vector<3, T>(v + i * 3, false);
-			return ret;
+			return new Vector<3, T>[length];
 		}
 
-		T * v;
+		T v[3];
 
-		Vector() :
-			v(new T[3]()) {}
+		constexpr Vector() :
+			v() {}
 		
-		Vector(T * v, bool owner = true) noexcept :
-			owner(owner),
-			v(v) {}
+		constexpr Vector(const std::array<T, 3> & values) noexcept :
+			v { values[0], values[1], values[2] } {}
 		
-		explicit Vector(T value) :
-			v(new T[3] { value, value, value }) {}
+		constexpr explicit Vector(T value) :
+			v { value, value, value } {}
 
-		Vector(T x, T y, T z) :
-			v(new T[3] { x, y, z }) {}
+		constexpr Vector(T x, T y, T z) :
+			v { x, y, z } {}
 
 		template <typename T2>
-		Vector(const Vector<3, T2> & vector) :
-			v(new T[3] {
+		constexpr Vector(const Vector<3, T2> & vector) :
+			v {
 				(T) vector.v[0],
 				(T) vector.v[1],
 				(T) vector.v[2]
-			}) {}
-
-		Vector(const Vector<3, T> & vector) :
-			v(new T[3] {
-				vector.v[0],
-				vector.v[1],
-				vector.v[2]
-			}) {}
-
-		Vector(Vector<3, T> && vector) :
-			owner(vector.owner),
-			v(vector.v) {
-			vector.owner = false;
-		}
+			} {}
 
-		Vector<3, T> & operator=(const Vector<3, T> & vector) {
-			v[0] = vector.v[0];
-			v[1] = vector.v[1];
-			v[2] = vector.v[2];
-			return *this;
-		}
+		constexpr Vector(const Vector<3, T> & vector) noexcept = default;
 
-		Vector<3, T> & operator=(Vector<3, T> && vector) {
-			if (owner) {
-				clean();
-				owner = vector.owner;
-				v = vector.v;
-				vector.owner = false;
-			}
-			else {
-				v[0] = vector.v[0];
-				v[1] = vector.v[1];
-				v[2] = vector.v[2];
-			}
-			return *this;
-		}
+		constexpr Vector<3, T> & operator=(const Vector<3, T> & vector) noexcept = default;
 
-		Vector<3, T> & operator+=(const Vector<3, T> & vector) {
+		constexpr Vector<3, T> & operator+=(const Vector<3, T> & vector) {
 			v[0] += vector.v[0];
 			v[1] += vector.v[1];
 			v[2] += vector.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & operator-=(const Vector<3, T> & vector) {
+		constexpr Vector<3, T> & operator-=(const Vector<3, T> & vector) {
 			v[0] -= vector.v[0];
 			v[1] -= vector.v[1];
 			v[2] -= vector.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & operator*=(T scalar) {
+		constexpr Vector<3, T> & operator*=(T scalar) {
 			v[0] *= scalar;
 			v[1] *= scalar;
 			v[2] *= scalar;
 			return *this;
 		}
 
-		Vector<3, T> & operator*=(const Vector<3, T> & vector) {
+		constexpr Vector<3, T> & operator*=(const Vector<3, T> & vector) {
 			v[0] *= vector.v[0];
 			v[1] *= vector.v[1];
 			v[2] *= vector.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & operator/=(T scalar) {
+		constexpr Vector<3, T> & operator/=(T scalar) {
 			v[0] /= scalar;
 			v[1] /= scalar;
 			v[2] /= scalar;
 			return *this;
 		}
 
-		Vector<3, T> & operator/=(const Vector<3, T> & vector) {
+		constexpr Vector<3, T> & operator/=(const Vector<3, T> & vector) {
 			v[0] /= vector.v[0];
 			v[1] /= vector.v[1];
 			v[2] /= vector.v[2];
@@ -207,27 +163,27 @@ class Vector<3, T> {
 			return v[VectorDimensions::VectorDimension<N>::dimension];
 		}
 
-		T & x() noexcept {
+		constexpr T & x() noexcept {
 			return v[0];
 		}
 
-		const T & x() const noexcept {
+		constexpr const T & x() const noexcept {
 			return v[0];
 		}
 
-		T & y() noexcept {
+		constexpr T & y() noexcept {
 			return v[1];
 		}
 
-		const T & y() const noexcept {
+		constexpr const T & y() const noexcept {
 			return v[1];
 		}
 
-		T & z() noexcept {
+		constexpr T & z() noexcept {
 			return v[2];
 		}
 
-		const T & z() const noexcept {
+		constexpr const T & z() const noexcept {
 			return v[2];
 		}
 
@@ -239,7 +195,7 @@ class Vector<3, T> {
 			);
 		}
 
-		T getLengthSquared() const {
+		constexpr T getLengthSquared() const {
 			return (
 				v[0] * v[0] +
 				v[1] * v[1] +
@@ -263,14 +219,14 @@ class Vector<3, T> {
 			return *this;
 		}
 		
-		Vector<3, T> & negate() {
+		constexpr Vector<3, T> & negate() {
 			v[0] = -v[0];
 			v[1] = -v[1];
 			v[2] = -v[2];
 			return *this;
 		}
 
-		Vector<3, T> & project(const Vector<3, T> & projection) {
+		constexpr Vector<3, T> & project(const Vector<3, T> & projection) {
 			auto scalar = dot(*this, projection) / projection.getLengthSquared();
 			v[0] /= scalar;
 			v[1] /= scalar;
@@ -278,7 +234,7 @@ class Vector<3, T> {
 			return *this;
 		}
 
-		Vector<3, T> & cross(const Vector<3, T> & cross) {
+		constexpr Vector<3, T> & cross(const Vector<3, T> & cross) {
 			T v0 = v[1] * cross.v[2] - v[2] * cross.v[1];
 			T v1 = v[2] * cross.v[0] - v[0] * cross.v[2];
 			v[2] = v[0] * cross.v[1] - v[1] * cross.v[0];
@@ -287,246 +243,246 @@ class Vector<3, T> {
 			return *this;
 		}
 
-		Vector<3, T> & set(const Vector<3, T> & set) {
+		constexpr Vector<3, T> & set(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & translate(const Vector<3, T> & translate) {
+		constexpr Vector<3, T> & translate(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 			return *this;
 		}
 		
-		Vector<3, T> & scale(T scale) {
+		constexpr Vector<3, T> & scale(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
 			return *this;
 		}
 		
-		Vector<3, T> & scale(const Vector<3, T> & scale) {
+		constexpr Vector<3, T> & scale(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & setX(T x) {
+		constexpr Vector<3, T> & setX(T x) {
 			v[0] = x;
 			return *this;
 		}
 
-		Vector<3, T> & setY(T y) {
+		constexpr Vector<3, T> & setY(T y) {
 			v[1] = y;
 			return *this;
 		}
 
-		Vector<3, T> & setZ(T z) {
+		constexpr Vector<3, T> & setZ(T z) {
 			v[2] = z;
 			return *this;
 		}
 
-		Vector<3, T> & setXY(T x, T y) {
+		constexpr Vector<3, T> & setXY(T x, T y) {
 			v[0] = x;
 			v[1] = y;
 			return *this;
 		}
 
-		Vector<3, T> & setXY(const Vector<2, T> & set) {
+		constexpr Vector<3, T> & setXY(const Vector<2, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		Vector<3, T> & setXZ(T x, T z) {
+		constexpr Vector<3, T> & setXZ(T x, T z) {
 			v[0] = x;
 			v[2] = z;
 			return *this;
 		}
 
-		Vector<3, T> & setXZ(const Vector<2, T> & set) {
+		constexpr Vector<3, T> & setXZ(const Vector<2, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		Vector<3, T> & setYX(const Vector<2, T> & set) {
+		constexpr Vector<3, T> & setYX(const Vector<2, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		Vector<3, T> & setYZ(T y, T z) {
+		constexpr Vector<3, T> & setYZ(T y, T z) {
 			v[1] = y;
 			v[2] = z;
 			return *this;
 		}
 
-		Vector<3, T> & setYZ(const Vector<2, T> & set) {
+		constexpr Vector<3, T> & setYZ(const Vector<2, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		Vector<3, T> & setZX(const Vector<2, T> & set) {
+		constexpr Vector<3, T> & setZX(const Vector<2, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		Vector<3, T> & setZY(const Vector<2, T> & set) {
+		constexpr Vector<3, T> & setZY(const Vector<2, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		Vector<3, T> & setXYZ(T x, T y, T z) {
+		constexpr Vector<3, T> & setXYZ(T x, T y, T z) {
 			v[0] = x;
 			v[1] = y;
 			v[2] = z;
 			return *this;
 		}
 
-		Vector<3, T> & setXYZ(const Vector<3, T> & set) {
+		constexpr Vector<3, T> & setXYZ(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & setXZY(const Vector<3, T> & set) {
+		constexpr Vector<3, T> & setXZY(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & setYXZ(const Vector<3, T> & set) {
+		constexpr Vector<3, T> & setYXZ(const Vector<3, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & setYZX(const Vector<3, T> & set) {
+		constexpr Vector<3, T> & setYZX(const Vector<3, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & setZXY(const Vector<3, T> & set) {
+		constexpr Vector<3, T> & setZXY(const Vector<3, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & setZYX(const Vector<3, T> & set) {
+		constexpr Vector<3, T> & setZYX(const Vector<3, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		Vector<3, T> & translateX(T translateX) {
+		constexpr Vector<3, T> & translateX(T translateX) {
 			v[0] += translateX;
 		}
 
-		Vector<3, T> & translateY(T translateY) {
+		constexpr Vector<3, T> & translateY(T translateY) {
 			v[1] += translateY;
 		}
 
-		Vector<3, T> & translateZ(T translateZ) {
+		constexpr Vector<3, T> & translateZ(T translateZ) {
 			v[2] += translateZ;
 		}
 
-		Vector<3, T> & translateXY(T translateX, T translateY) {
+		constexpr Vector<3, T> & translateXY(T translateX, T translateY) {
 			v[0] += translateX;
 			v[1] += translateY;
 		}
 
-		Vector<3, T> & translateXY(const Vector<2, T> & translate) {
+		constexpr Vector<3, T> & translateXY(const Vector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 		}
 
-		Vector<3, T> & translateXZ(T translateX, T translateZ) {
+		constexpr Vector<3, T> & translateXZ(T translateX, T translateZ) {
 			v[0] += translateX;
 			v[2] += translateZ;
 		}
 
-		Vector<3, T> & translateXZ(const Vector<2, T> & translate) {
+		constexpr Vector<3, T> & translateXZ(const Vector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 		}
 
-		Vector<3, T> & translateYX(const Vector<2, T> & translate) {
+		constexpr Vector<3, T> & translateYX(const Vector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 		}
 
-		Vector<3, T> & translateYZ(T translateY, T translateZ) {
+		constexpr Vector<3, T> & translateYZ(T translateY, T translateZ) {
 			v[1] += translateY;
 			v[2] += translateZ;
 		}
 
-		Vector<3, T> & translateYZ(const Vector<2, T> & translate) {
+		constexpr Vector<3, T> & translateYZ(const Vector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 		}
 
-		Vector<3, T> & translateZX(const Vector<2, T> & translate) {
+		constexpr Vector<3, T> & translateZX(const Vector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 		}
 
-		Vector<3, T> & translateZY(const Vector<2, T> & translate) {
+		constexpr Vector<3, T> & translateZY(const Vector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 		}
 
-		Vector<3, T> & translateXYZ(T translateX, T translateY, T translateZ) {
+		constexpr Vector<3, T> & translateXYZ(T translateX, T translateY, T translateZ) {
 			v[0] += translateX;
 			v[1] += translateY;
 			v[2] += translateZ;
 		}
 
-		Vector<3, T> & translateXYZ(const Vector<3, T> & translate) {
+		constexpr Vector<3, T> & translateXYZ(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 		}
 
-		Vector<3, T> & translateXZY(const Vector<3, T> & translate) {
+		constexpr Vector<3, T> & translateXZY(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
 		}
 
-		Vector<3, T> & translateYXZ(const Vector<3, T> & translate) {
+		constexpr Vector<3, T> & translateYXZ(const Vector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
 		}
 
-		Vector<3, T> & translateYZX(const Vector<3, T> & translate) {
+		constexpr Vector<3, T> & translateYZX(const Vector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
 		}
 
-		Vector<3, T> & translateZXY(const Vector<3, T> & translate) {
+		constexpr Vector<3, T> & translateZXY(const Vector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
 		}
 
-		Vector<3, T> & translateZYX(const Vector<3, T> & translate) {
+		constexpr Vector<3, T> & translateZYX(const Vector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
@@ -800,613 +756,609 @@ class Vector<3, T> {
 			return *this;
 		}
 
-		Vector<3, T> & scaleX(T scaleX) {
+		constexpr Vector<3, T> & scaleX(T scaleX) {
 			v[0] *= scaleX;
 		}
 
-		Vector<3, T> & scaleY(T scaleY) {
+		constexpr Vector<3, T> & scaleY(T scaleY) {
 			v[1] *= scaleY;
 		}
 
-		Vector<3, T> & scaleZ(T scaleZ) {
+		constexpr Vector<3, T> & scaleZ(T scaleZ) {
 			v[2] *= scaleZ;
 		}
 
-		Vector<3, T> & scaleXY(T scale) {
+		constexpr Vector<3, T> & scaleXY(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 		}
 
-		Vector<3, T> & scaleXY(T scaleX, T scaleY) {
+		constexpr Vector<3, T> & scaleXY(T scaleX, T scaleY) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 		}
 
-		Vector<3, T> & scaleXY(const Vector<2, T> & scale) {
+		constexpr Vector<3, T> & scaleXY(const Vector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 		}
 
-		Vector<3, T> & scaleXZ(T scale) {
+		constexpr Vector<3, T> & scaleXZ(T scale) {
 			v[0] *= scale;
 			v[2] *= scale;
 		}
 
-		Vector<3, T> & scaleXZ(T scaleX, T scaleZ) {
+		constexpr Vector<3, T> & scaleXZ(T scaleX, T scaleZ) {
 			v[0] *= scaleX;
 			v[2] *= scaleZ;
 		}
 
-		Vector<3, T> & scaleXZ(const Vector<2, T> & scale) {
+		constexpr Vector<3, T> & scaleXZ(const Vector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 		}
 
-		Vector<3, T> & scaleYX(const Vector<2, T> & scale) {
+		constexpr Vector<3, T> & scaleYX(const Vector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 		}
 
-		Vector<3, T> & scaleYZ(T scale) {
+		constexpr Vector<3, T> & scaleYZ(T scale) {
 			v[1] *= scale;
 			v[2] *= scale;
 		}
 
-		Vector<3, T> & scaleYZ(T scaleY, T scaleZ) {
+		constexpr Vector<3, T> & scaleYZ(T scaleY, T scaleZ) {
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
 		}
 
-		Vector<3, T> & scaleYZ(const Vector<2, T> & scale) {
+		constexpr Vector<3, T> & scaleYZ(const Vector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 		}
 
-		Vector<3, T> & scaleZX(const Vector<2, T> & scale) {
+		constexpr Vector<3, T> & scaleZX(const Vector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 		}
 
-		Vector<3, T> & scaleZY(const Vector<2, T> & scale) {
+		constexpr Vector<3, T> & scaleZY(const Vector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 		}
 
-		Vector<3, T> & scaleXYZ(T scale) {
+		constexpr Vector<3, T> & scaleXYZ(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
 		}
 
-		Vector<3, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
+		constexpr Vector<3, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
 		}
 
-		Vector<3, T> & scaleXYZ(const Vector<3, T> & scale) {
+		constexpr Vector<3, T> & scaleXYZ(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 		}
 
-		Vector<3, T> & scaleXZY(const Vector<3, T> & scale) {
+		constexpr Vector<3, T> & scaleXZY(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
 		}
 
-		Vector<3, T> & scaleYXZ(const Vector<3, T> & scale) {
+		constexpr Vector<3, T> & scaleYXZ(const Vector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
 		}
 
-		Vector<3, T> & scaleYZX(const Vector<3, T> & scale) {
+		constexpr Vector<3, T> & scaleYZX(const Vector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
 		}
 
-		Vector<3, T> & scaleZXY(const Vector<3, T> & scale) {
+		constexpr Vector<3, T> & scaleZXY(const Vector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
 		}
 
-		Vector<3, T> & scaleZYX(const Vector<3, T> & scale) {
+		constexpr Vector<3, T> & scaleZYX(const Vector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
 		}
 
-		T getX() const {
+		constexpr T getX() const {
 			return v[0];
 		}
 
-		T getY() const {
+		constexpr T getY() const {
 			return v[1];
 		}
 
-		T getZ() const {
+		constexpr T getZ() const {
 			return v[2];
 		}
 
-		Vector<2, T> getXX() const {
+		constexpr Vector<2, T> getXX() const {
 			return { v[0], v[0] };
 		}
 
-		Vector<2, T> getXY() const {
+		constexpr Vector<2, T> getXY() const {
 			return { v[0], v[1] };
 		}
 
-		Vector<2, T> getXZ() const {
+		constexpr Vector<2, T> getXZ() const {
 			return { v[0], v[2] };
 		}
 
-		Vector<2, T> getYX() const {
+		constexpr Vector<2, T> getYX() const {
 			return { v[1], v[0] };
 		}
 
-		Vector<2, T> getYY() const {
+		constexpr Vector<2, T> getYY() const {
 			return { v[1], v[1] };
 		}
 
-		Vector<2, T> getYZ() const {
+		constexpr Vector<2, T> getYZ() const {
 			return { v[1], v[2] };
 		}
 
-		Vector<2, T> getZX() const {
+		constexpr Vector<2, T> getZX() const {
 			return { v[2], v[0] };
 		}
 
-		Vector<2, T> getZY() const {
+		constexpr Vector<2, T> getZY() const {
 			return { v[2], v[1] };
 		}
 
-		Vector<2, T> getZZ() const {
+		constexpr Vector<2, T> getZZ() const {
 			return { v[2], v[2] };
 		}
 
-		Vector<3, T> getXXX() const {
+		constexpr Vector<3, T> getXXX() const {
 			return { v[0], v[0], v[0] };
 		}
 
-		Vector<3, T> getXXY() const {
+		constexpr Vector<3, T> getXXY() const {
 			return { v[0], v[0], v[1] };
 		}
 
-		Vector<3, T> getXXZ() const {
+		constexpr Vector<3, T> getXXZ() const {
 			return { v[0], v[0], v[2] };
 		}
 
-		Vector<3, T> getXYX() const {
+		constexpr Vector<3, T> getXYX() const {
 			return { v[0], v[1], v[0] };
 		}
 
-		Vector<3, T> getXYY() const {
+		constexpr Vector<3, T> getXYY() const {
 			return { v[0], v[1], v[1] };
 		}
 
-		Vector<3, T> getXYZ() const {
+		constexpr Vector<3, T> getXYZ() const {
 			return { v[0], v[1], v[2] };
 		}
 
-		Vector<3, T> getXZX() const {
+		constexpr Vector<3, T> getXZX() const {
 			return { v[0], v[2], v[0] };
 		}
 
-		Vector<3, T> getXZY() const {
+		constexpr Vector<3, T> getXZY() const {
 			return { v[0], v[2], v[1] };
 		}
 
-		Vector<3, T> getXZZ() const {
+		constexpr Vector<3, T> getXZZ() const {
 			return { v[0], v[2], v[2] };
 		}
 
-		Vector<3, T> getYXX() const {
+		constexpr Vector<3, T> getYXX() const {
 			return { v[1], v[0], v[0] };
 		}
 
-		Vector<3, T> getYXY() const {
+		constexpr Vector<3, T> getYXY() const {
 			return { v[1], v[0], v[1] };
 		}
 
-		Vector<3, T> getYXZ() const {
+		constexpr Vector<3, T> getYXZ() const {
 			return { v[1], v[0], v[2] };
 		}
 
-		Vector<3, T> getYYX() const {
+		constexpr Vector<3, T> getYYX() const {
 			return { v[1], v[1], v[0] };
 		}
 
-		Vector<3, T> getYYY() const {
+		constexpr Vector<3, T> getYYY() const {
 			return { v[1], v[1], v[1] };
 		}
 
-		Vector<3, T> getYYZ() const {
+		constexpr Vector<3, T> getYYZ() const {
 			return { v[1], v[1], v[2] };
 		}
 
-		Vector<3, T> getYZX() const {
+		constexpr Vector<3, T> getYZX() const {
 			return { v[1], v[2], v[0] };
 		}
 
-		Vector<3, T> getYZY() const {
+		constexpr Vector<3, T> getYZY() const {
 			return { v[1], v[2], v[1] };
 		}
 
-		Vector<3, T> getYZZ() const {
+		constexpr Vector<3, T> getYZZ() const {
 			return { v[1], v[2], v[2] };
 		}
 
-		Vector<3, T> getZXX() const {
+		constexpr Vector<3, T> getZXX() const {
 			return { v[2], v[0], v[0] };
 		}
 
-		Vector<3, T> getZXY() const {
+		constexpr Vector<3, T> getZXY() const {
 			return { v[2], v[0], v[1] };
 		}
 
-		Vector<3, T> getZXZ() const {
+		constexpr Vector<3, T> getZXZ() const {
 			return { v[2], v[0], v[2] };
 		}
 
-		Vector<3, T> getZYX() const {
+		constexpr Vector<3, T> getZYX() const {
 			return { v[2], v[1], v[0] };
 		}
 
-		Vector<3, T> getZYY() const {
+		constexpr Vector<3, T> getZYY() const {
 			return { v[2], v[1], v[1] };
 		}
 
-		Vector<3, T> getZYZ() const {
+		constexpr Vector<3, T> getZYZ() const {
 			return { v[2], v[1], v[2] };
 		}
 
-		Vector<3, T> getZZX() const {
+		constexpr Vector<3, T> getZZX() const {
 			return { v[2], v[2], v[0] };
 		}
 
-		Vector<3, T> getZZY() const {
+		constexpr Vector<3, T> getZZY() const {
 			return { v[2], v[2], v[1] };
 		}
 
-		Vector<3, T> getZZZ() const {
+		constexpr Vector<3, T> getZZZ() const {
 			return { v[2], v[2], v[2] };
 		}
 
-		Vector<4, T> getXXXX() const {
+		constexpr Vector<4, T> getXXXX() const {
 			return { v[0], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getXXXY() const {
+		constexpr Vector<4, T> getXXXY() const {
 			return { v[0], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getXXXZ() const {
+		constexpr Vector<4, T> getXXXZ() const {
 			return { v[0], v[0], v[0], v[2] };
 		}
 
-		Vector<4, T> getXXYX() const {
+		constexpr Vector<4, T> getXXYX() const {
 			return { v[0], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getXXYY() const {
+		constexpr Vector<4, T> getXXYY() const {
 			return { v[0], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getXXYZ() const {
+		constexpr Vector<4, T> getXXYZ() const {
 			return { v[0], v[0], v[1], v[2] };
 		}
 
-		Vector<4, T> getXXZX() const {
+		constexpr Vector<4, T> getXXZX() const {
 			return { v[0], v[0], v[2], v[0] };
 		}
 
-		Vector<4, T> getXXZY() const {
+		constexpr Vector<4, T> getXXZY() const {
 			return { v[0], v[0], v[2], v[1] };
 		}
 
-		Vector<4, T> getXXZZ() const {
+		constexpr Vector<4, T> getXXZZ() const {
 			return { v[0], v[0], v[2], v[2] };
 		}
 
-		Vector<4, T> getXYXX() const {
+		constexpr Vector<4, T> getXYXX() const {
 			return { v[0], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getXYXY() const {
+		constexpr Vector<4, T> getXYXY() const {
 			return { v[0], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getXYXZ() const {
+		constexpr Vector<4, T> getXYXZ() const {
 			return { v[0], v[1], v[0], v[2] };
 		}
 
-		Vector<4, T> getXYYX() const {
+		constexpr Vector<4, T> getXYYX() const {
 			return { v[0], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getXYYY() const {
+		constexpr Vector<4, T> getXYYY() const {
 			return { v[0], v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getXYYZ() const {
+		constexpr Vector<4, T> getXYYZ() const {
 			return { v[0], v[1], v[1], v[2] };
 		}
 
-		Vector<4, T> getXYZX() const {
+		constexpr Vector<4, T> getXYZX() const {
 			return { v[0], v[1], v[2], v[0] };
 		}
 
-		Vector<4, T> getXYZY() const {
+		constexpr Vector<4, T> getXYZY() const {
 			return { v[0], v[1], v[2], v[1] };
 		}
 
-		Vector<4, T> getXYZZ() const {
+		constexpr Vector<4, T> getXYZZ() const {
 			return { v[0], v[1], v[2], v[2] };
 		}
 
-		Vector<4, T> getXZXX() const {
+		constexpr Vector<4, T> getXZXX() const {
 			return { v[0], v[2], v[0], v[0] };
 		}
 
-		Vector<4, T> getXZXY() const {
+		constexpr Vector<4, T> getXZXY() const {
 			return { v[0], v[2], v[0], v[1] };
 		}
 
-		Vector<4, T> getXZXZ() const {
+		constexpr Vector<4, T> getXZXZ() const {
 			return { v[0], v[2], v[0], v[2] };
 		}
 
-		Vector<4, T> getXZYX() const {
+		constexpr Vector<4, T> getXZYX() const {
 			return { v[0], v[2], v[1], v[0] };
 		}
 
-		Vector<4, T> getXZYY() const {
+		constexpr Vector<4, T> getXZYY() const {
 			return { v[0], v[2], v[1], v[1] };
 		}
 
-		Vector<4, T> getXZYZ() const {
+		constexpr Vector<4, T> getXZYZ() const {
 			return { v[0], v[2], v[1], v[2] };
 		}
 
-		Vector<4, T> getXZZX() const {
+		constexpr Vector<4, T> getXZZX() const {
 			return { v[0], v[2], v[2], v[0] };
 		}
 
-		Vector<4, T> getXZZY() const {
+		constexpr Vector<4, T> getXZZY() const {
 			return { v[0], v[2], v[2], v[1] };
 		}
 
-		Vector<4, T> getXZZZ() const {
+		constexpr Vector<4, T> getXZZZ() const {
 			return { v[0], v[2], v[2], v[2] };
 		}
 
-		Vector<4, T> getYXXX() const {
+		constexpr Vector<4, T> getYXXX() const {
 			return { v[1], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getYXXY() const {
+		constexpr Vector<4, T> getYXXY() const {
 			return { v[1], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getYXXZ() const {
+		constexpr Vector<4, T> getYXXZ() const {
 			return { v[1], v[0], v[0], v[2] };
 		}
 
-		Vector<4, T> getYXYX() const {
+		constexpr Vector<4, T> getYXYX() const {
 			return { v[1], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getYXYY() const {
+		constexpr Vector<4, T> getYXYY() const {
 			return { v[1], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getYXYZ() const {
+		constexpr Vector<4, T> getYXYZ() const {
 			return { v[1], v[0], v[1], v[2] };
 		}
 
-		Vector<4, T> getYXZX() const {
+		constexpr Vector<4, T> getYXZX() const {
 			return { v[1], v[0], v[2], v[0] };
 		}
 
-		Vector<4, T> getYXZY() const {
+		constexpr Vector<4, T> getYXZY() const {
 			return { v[1], v[0], v[2], v[1] };
 		}
 
-		Vector<4, T> getYXZZ() const {
+		constexpr Vector<4, T> getYXZZ() const {
 			return { v[1], v[0], v[2], v[2] };
 		}
 
-		Vector<4, T> getYYXX() const {
+		constexpr Vector<4, T> getYYXX() const {
 			return { v[1], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getYYXY() const {
+		constexpr Vector<4, T> getYYXY() const {
 			return { v[1], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getYYXZ() const {
+		constexpr Vector<4, T> getYYXZ() const {
 			return { v[1], v[1], v[0], v[2] };
 		}
 
-		Vector<4, T> getYYYX() const {
+		constexpr Vector<4, T> getYYYX() const {
 			return { v[1], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getYYYY() const {
+		constexpr Vector<4, T> getYYYY() const {
 			return { v[1], v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getYYYZ() const {
+		constexpr Vector<4, T> getYYYZ() const {
 			return { v[1], v[1], v[1], v[2] };
 		}
 
-		Vector<4, T> getYYZX() const {
+		constexpr Vector<4, T> getYYZX() const {
 			return { v[1], v[1], v[2], v[0] };
 		}
 
-		Vector<4, T> getYYZY() const {
+		constexpr Vector<4, T> getYYZY() const {
 			return { v[1], v[1], v[2], v[1] };
 		}
 
-		Vector<4, T> getYYZZ() const {
+		constexpr Vector<4, T> getYYZZ() const {
 			return { v[1], v[1], v[2], v[2] };
 		}
 
-		Vector<4, T> getYZXX() const {
+		constexpr Vector<4, T> getYZXX() const {
 			return { v[1], v[2], v[0], v[0] };
 		}
 
-		Vector<4, T> getYZXY() const {
+		constexpr Vector<4, T> getYZXY() const {
 			return { v[1], v[2], v[0], v[1] };
 		}
 
-		Vector<4, T> getYZXZ() const {
+		constexpr Vector<4, T> getYZXZ() const {
 			return { v[1], v[2], v[0], v[2] };
 		}
 
-		Vector<4, T> getYZYX() const {
+		constexpr Vector<4, T> getYZYX() const {
 			return { v[1], v[2], v[1], v[0] };
 		}
 
-		Vector<4, T> getYZYY() const {
+		constexpr Vector<4, T> getYZYY() const {
 			return { v[1], v[2], v[1], v[1] };
 		}
 
-		Vector<4, T> getYZYZ() const {
+		constexpr Vector<4, T> getYZYZ() const {
 			return { v[1], v[2], v[1], v[2] };
 		}
 
-		Vector<4, T> getYZZX() const {
+		constexpr Vector<4, T> getYZZX() const {
 			return { v[1], v[2], v[2], v[0] };
 		}
 
-		Vector<4, T> getYZZY() const {
+		constexpr Vector<4, T> getYZZY() const {
 			return { v[1], v[2], v[2], v[1] };
 		}
 
-		Vector<4, T> getYZZZ() const {
+		constexpr Vector<4, T> getYZZZ() const {
 			return { v[1], v[2], v[2], v[2] };
 		}
 
-		Vector<4, T> getZXXX() const {
+		constexpr Vector<4, T> getZXXX() const {
 			return { v[2], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getZXXY() const {
+		constexpr Vector<4, T> getZXXY() const {
 			return { v[2], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getZXXZ() const {
+		constexpr Vector<4, T> getZXXZ() const {
 			return { v[2], v[0], v[0], v[2] };
 		}
 
-		Vector<4, T> getZXYX() const {
+		constexpr Vector<4, T> getZXYX() const {
 			return { v[2], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getZXYY() const {
+		constexpr Vector<4, T> getZXYY() const {
 			return { v[2], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getZXYZ() const {
+		constexpr Vector<4, T> getZXYZ() const {
 			return { v[2], v[0], v[1], v[2] };
 		}
 
-		Vector<4, T> getZXZX() const {
+		constexpr Vector<4, T> getZXZX() const {
 			return { v[2], v[0], v[2], v[0] };
 		}
 
-		Vector<4, T> getZXZY() const {
+		constexpr Vector<4, T> getZXZY() const {
 			return { v[2], v[0], v[2], v[1] };
 		}
 
-		Vector<4, T> getZXZZ() const {
+		constexpr Vector<4, T> getZXZZ() const {
 			return { v[2], v[0], v[2], v[2] };
 		}
 
-		Vector<4, T> getZYXX() const {
+		constexpr Vector<4, T> getZYXX() const {
 			return { v[2], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getZYXY() const {
+		constexpr Vector<4, T> getZYXY() const {
 			return { v[2], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getZYXZ() const {
+		constexpr Vector<4, T> getZYXZ() const {
 			return { v[2], v[1], v[0], v[2] };
 		}
 
-		Vector<4, T> getZYYX() const {
+		constexpr Vector<4, T> getZYYX() const {
 			return { v[2], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getZYYY() const {
+		constexpr Vector<4, T> getZYYY() const {
 			return { v[2], v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getZYYZ() const {
+		constexpr Vector<4, T> getZYYZ() const {
 			return { v[2], v[1], v[1], v[2] };
 		}
 
-		Vector<4, T> getZYZX() const {
+		constexpr Vector<4, T> getZYZX() const {
 			return { v[2], v[1], v[2], v[0] };
 		}
 
-		Vector<4, T> getZYZY() const {
+		constexpr Vector<4, T> getZYZY() const {
 			return { v[2], v[1], v[2], v[1] };
 		}
 
-		Vector<4, T> getZYZZ() const {
+		constexpr Vector<4, T> getZYZZ() const {
 			return { v[2], v[1], v[2], v[2] };
 		}
 
-		Vector<4, T> getZZXX() const {
+		constexpr Vector<4, T> getZZXX() const {
 			return { v[2], v[2], v[0], v[0] };
 		}
 
-		Vector<4, T> getZZXY() const {
+		constexpr Vector<4, T> getZZXY() const {
 			return { v[2], v[2], v[0], v[1] };
 		}
 
-		Vector<4, T> getZZXZ() const {
+		constexpr Vector<4, T> getZZXZ() const {
 			return { v[2], v[2], v[0], v[2] };
 		}
 
-		Vector<4, T> getZZYX() const {
+		constexpr Vector<4, T> getZZYX() const {
 			return { v[2], v[2], v[1], v[0] };
 		}
 
-		Vector<4, T> getZZYY() const {
+		constexpr Vector<4, T> getZZYY() const {
 			return { v[2], v[2], v[1], v[1] };
 		}
 
-		Vector<4, T> getZZYZ() const {
+		constexpr Vector<4, T> getZZYZ() const {
 			return { v[2], v[2], v[1], v[2] };
 		}
 
-		Vector<4, T> getZZZX() const {
+		constexpr Vector<4, T> getZZZX() const {
 			return { v[2], v[2], v[2], v[0] };
 		}
 
-		Vector<4, T> getZZZY() const {
+		constexpr Vector<4, T> getZZZY() const {
 			return { v[2], v[2], v[2], v[1] };
 		}
 
-		Vector<4, T> getZZZZ() const {
+		constexpr Vector<4, T> getZZZZ() const {
 			return { v[2], v[2], v[2], v[2] };
 		}
-
-		virtual ~Vector() noexcept {
-			clean();
-		}
 };
 
 template <typename T>
-Vector<3, T> operator-(const Vector<3, T> & vector) {
+constexpr Vector<3, T> operator-(const Vector<3, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1],
@@ -1415,7 +1367,7 @@ Vector<3, T> operator-(const Vector<3, T> & vector) {
 }
 
 template <typename T>
-Vector<3, T> operator+(const Vector<3, T> & left, const Vector<3, T> & right) {
+constexpr Vector<3, T> operator+(const Vector<3, T> & left, const Vector<3, T> & right) {
 	return {
 		left.v[0] + right.v[0],
 		left.v[1] + right.v[1],
@@ -1424,7 +1376,7 @@ Vector<3, T> operator+(const Vector<3, T> & left, const Vector<3, T> & right) {
 }
 
 template <typename T>
-Vector<3, T> operator-(const Vector<3, T> & left, const Vector<3, T> & right) {
+constexpr Vector<3, T> operator-(const Vector<3, T> & left, const Vector<3, T> & right) {
 	return {
 		left.v[0] - right.v[0],
 		left.v[1] - right.v[1],
@@ -1433,7 +1385,7 @@ Vector<3, T> operator-(const Vector<3, T> & left, const Vector<3, T> & right) {
 }
 
 template <typename T>
-Vector<3, T> operator*(T left, const Vector<3, T> & right) {
+constexpr Vector<3, T> operator*(T left, const Vector<3, T> & right) {
 	return {
 		left * right.v[0],
 		left * right.v[1],
@@ -1442,7 +1394,7 @@ Vector<3, T> operator*(T left, const Vector<3, T> & right) {
 }
 
 template <typename T>
-Vector<3, T> operator*(const Vector<3, T> & left, T right) {
+constexpr Vector<3, T> operator*(const Vector<3, T> & left, T right) {
 	return {
 		left.v[0] * right,
 		left.v[1] * right,
@@ -1451,7 +1403,7 @@ Vector<3, T> operator*(const Vector<3, T> & left, T right) {
 }
 
 template <typename T>
-Vector<3, T> operator*(const Vector<3, T> & left, const Vector<3, T> & right) {
+constexpr Vector<3, T> operator*(const Vector<3, T> & left, const Vector<3, T> & right) {
 	return {
 		left.v[0] * right.v[0],
 		left.v[1] * right.v[1],
@@ -1460,7 +1412,7 @@ Vector<3, T> operator*(const Vector<3, T> & left, const Vector<3, T> & right) {
 }
 
 template <typename T>
-Vector<3, T> operator/(const Vector<3, T> & left, T right) {
+constexpr Vector<3, T> operator/(const Vector<3, T> & left, T right) {
 	return {
 		left.v[0] / right,
 		left.v[1] / right,
@@ -1469,7 +1421,7 @@ Vector<3, T> operator/(const Vector<3, T> & left, T right) {
 }
 
 template <typename T>
-Vector<3, T> operator/(const Vector<3, T> & left, const Vector<3, T> & right) {
+constexpr Vector<3, T> operator/(const Vector<3, T> & left, const Vector<3, T> & right) {
 	return {
 		left.v[0] / right.v[0],
 		left.v[1] / right.v[1],
@@ -1536,7 +1488,7 @@ Vector<3, T> & normalize(const Vector<3, T> & vector, Vector<3, T> & target) {
 }
 
 template <typename T>
-Vector<3, T> negate(const Vector<3, T> & vector) {
+constexpr Vector<3, T> negate(const Vector<3, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1],
@@ -1545,7 +1497,7 @@ Vector<3, T> negate(const Vector<3, T> & vector) {
 }
 
 template <typename T>
-Vector<3, T> & negate(const Vector<3, T> & vector, Vector<3, T> & target) {
+constexpr Vector<3, T> & negate(const Vector<3, T> & vector, Vector<3, T> & target) {
 	target.v[0] = -vector.v[0];
 	target.v[1] = -vector.v[1];
 	target.v[2] = -vector.v[2];
@@ -1553,7 +1505,7 @@ Vector<3, T> & negate(const Vector<3, T> & vector, Vector<3, T> & target) {
 }
 
 template <typename T>
-T dot(const Vector<3, T> & left, const Vector<3, T> & right) {
+constexpr T dot(const Vector<3, T> & left, const Vector<3, T> & right) {
 	return (
 		left.v[0] * right.v[0] +
 		left.v[1] * right.v[1] +
@@ -1562,7 +1514,7 @@ T dot(const Vector<3, T> & left, const Vector<3, T> & right) {
 }
 
 template <typename T>
-Vector<3, T> project(const Vector<3, T> & vector, const Vector<3, T> & projection) {
+constexpr Vector<3, T> project(const Vector<3, T> & vector, const Vector<3, T> & projection) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	return {
 		scalar * projection.v[0],
@@ -1572,7 +1524,7 @@ Vector<3, T> project(const Vector<3, T> & vector, const Vector<3, T> & projectio
 }
 
 template <typename T>
-Vector<3, T> & project(const Vector<3, T> & vector, const Vector<3, T> & projection, Vector<3, T> & target) {
+constexpr Vector<3, T> & project(const Vector<3, T> & vector, const Vector<3, T> & projection, Vector<3, T> & target) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	target.v[0] = scalar * projection.v[0];
 	target.v[1] = scalar * projection.v[1];
@@ -1581,7 +1533,7 @@ Vector<3, T> & project(const Vector<3, T> & vector, const Vector<3, T> & project
 }
 
 template <typename T>
-Vector<3, T> cross(const Vector<3, T> & vector, const Vector<3, T> & cross) {
+constexpr Vector<3, T> cross(const Vector<3, T> & vector, const Vector<3, T> & cross) {
 	return {
 		vector.v[1] * cross.v[2] - vector.v[2] * cross.v[1],
 		vector.v[2] * cross.v[0] - vector.v[0] * cross.v[2],
@@ -1590,7 +1542,7 @@ Vector<3, T> cross(const Vector<3, T> & vector, const Vector<3, T> & cross) {
 }
 
 template <typename T>
-Vector<3, T> & cross(const Vector<3, T> & vector, const Vector<3, T> & cross, Vector<3, T> & target) {
+constexpr Vector<3, T> & cross(const Vector<3, T> & vector, const Vector<3, T> & cross, Vector<3, T> & target) {
 	target.v[0] = vector.v[1] * cross.v[2] - vector.v[2] * cross.v[1];
 	target.v[1] = vector.v[2] * cross.v[0] - vector.v[0] * cross.v[2];
 	target.v[2] = vector.v[0] * cross.v[1] - vector.v[1] * cross.v[0];
@@ -1598,7 +1550,7 @@ Vector<3, T> & cross(const Vector<3, T> & vector, const Vector<3, T> & cross, Ve
 }
 
 template <typename T>
-Vector<3, T> translate(const Vector<3, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<3, T> translate(const Vector<3, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0]	+ translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -1607,7 +1559,7 @@ Vector<3, T> translate(const Vector<3, T> & vector, const Vector<3, T> & transla
 }
 
 template <typename T>
-Vector<3, T> & translate(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> & translate(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -1615,7 +1567,7 @@ Vector<3, T> & translate(const Vector<3, T> & vector, const Vector<3, T> & trans
 }
 
 template <typename T>
-Vector<3, T> scale(const Vector<3, T> & vector, T scale) {
+constexpr Vector<3, T> scale(const Vector<3, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -1624,7 +1576,7 @@ Vector<3, T> scale(const Vector<3, T> & vector, T scale) {
 }
 
 template <typename T>
-Vector<3, T> & scale(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
+constexpr Vector<3, T> & scale(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -1632,7 +1584,7 @@ Vector<3, T> & scale(const Vector<3, T> & vector, T scale, Vector<3, T> & target
 }
 
 template <typename T>
-Vector<3, T> scale(const Vector<3, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<3, T> scale(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -1641,7 +1593,7 @@ Vector<3, T> scale(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 }
 
 template <typename T>
-Vector<3, T> & scale(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> & scale(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -1649,7 +1601,7 @@ Vector<3, T> & scale(const Vector<3, T> & vector, const Vector<3, T> & scale, Ve
 }
 
 template<typename T>
-Vector<3, T> setX(const Vector<3, T> & vector, T x) {
+constexpr Vector<3, T> setX(const Vector<3, T> & vector, T x) {
 	return {
 		x,
 		vector.v[1],
@@ -1658,7 +1610,7 @@ Vector<3, T> setX(const Vector<3, T> & vector, T x) {
 }
 
 template<typename T>
-Vector<3, T> setY(const Vector<3, T> & vector, T y) {
+constexpr Vector<3, T> setY(const Vector<3, T> & vector, T y) {
 	return {
 		vector.v[0],
 		y,
@@ -1667,7 +1619,7 @@ Vector<3, T> setY(const Vector<3, T> & vector, T y) {
 }
 
 template<typename T>
-Vector<3, T> setZ(const Vector<3, T> & vector, T z) {
+constexpr Vector<3, T> setZ(const Vector<3, T> & vector, T z) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -1676,7 +1628,7 @@ Vector<3, T> setZ(const Vector<3, T> & vector, T z) {
 }
 
 template<typename T>
-Vector<3, T> setXY(const Vector<3, T> & vector, T x, T y) {
+constexpr Vector<3, T> setXY(const Vector<3, T> & vector, T x, T y) {
 	return {
 		x,
 		y,
@@ -1685,7 +1637,7 @@ Vector<3, T> setXY(const Vector<3, T> & vector, T x, T y) {
 }
 
 template<typename T>
-Vector<3, T> setXY(const Vector<3, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<3, T> setXY(const Vector<3, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[1],
@@ -1694,7 +1646,7 @@ Vector<3, T> setXY(const Vector<3, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<3, T> setXZ(const Vector<3, T> & vector, T x, T z) {
+constexpr Vector<3, T> setXZ(const Vector<3, T> & vector, T x, T z) {
 	return {
 		x,
 		vector.v[1],
@@ -1703,7 +1655,7 @@ Vector<3, T> setXZ(const Vector<3, T> & vector, T x, T z) {
 }
 
 template<typename T>
-Vector<3, T> setXZ(const Vector<3, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<3, T> setXZ(const Vector<3, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -1712,7 +1664,7 @@ Vector<3, T> setXZ(const Vector<3, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<3, T> setYX(const Vector<3, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<3, T> setYX(const Vector<3, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[0],
@@ -1721,7 +1673,7 @@ Vector<3, T> setYX(const Vector<3, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<3, T> setYZ(const Vector<3, T> & vector, T y, T z) {
+constexpr Vector<3, T> setYZ(const Vector<3, T> & vector, T y, T z) {
 	return {
 		vector.v[0],
 		y,
@@ -1730,7 +1682,7 @@ Vector<3, T> setYZ(const Vector<3, T> & vector, T y, T z) {
 }
 
 template<typename T>
-Vector<3, T> setYZ(const Vector<3, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<3, T> setYZ(const Vector<3, T> & vector, const Vector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -1739,7 +1691,7 @@ Vector<3, T> setYZ(const Vector<3, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<3, T> setZX(const Vector<3, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<3, T> setZX(const Vector<3, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -1748,7 +1700,7 @@ Vector<3, T> setZX(const Vector<3, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<3, T> setZY(const Vector<3, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<3, T> setZY(const Vector<3, T> & vector, const Vector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -1757,7 +1709,7 @@ Vector<3, T> setZY(const Vector<3, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<3, T> setX(const Vector<3, T> & vector, T x, Vector<3, T> & target) {
+constexpr Vector<3, T> setX(const Vector<3, T> & vector, T x, Vector<3, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -1765,7 +1717,7 @@ Vector<3, T> setX(const Vector<3, T> & vector, T x, Vector<3, T> & target) {
 }
 
 template<typename T>
-Vector<3, T> setY(const Vector<3, T> & vector, T y, Vector<3, T> & target) {
+constexpr Vector<3, T> setY(const Vector<3, T> & vector, T y, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -1773,7 +1725,7 @@ Vector<3, T> setY(const Vector<3, T> & vector, T y, Vector<3, T> & target) {
 }
 
 template<typename T>
-Vector<3, T> setZ(const Vector<3, T> & vector, T z, Vector<3, T> & target) {
+constexpr Vector<3, T> setZ(const Vector<3, T> & vector, T z, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -1781,7 +1733,7 @@ Vector<3, T> setZ(const Vector<3, T> & vector, T z, Vector<3, T> & target) {
 }
 
 template<typename T>
-Vector<3, T> setXY(const Vector<3, T> & vector, T x, T y, Vector<3, T> & target) {
+constexpr Vector<3, T> setXY(const Vector<3, T> & vector, T x, T y, Vector<3, T> & target) {
 	target.v[0] = x;
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -1789,7 +1741,7 @@ Vector<3, T> setXY(const Vector<3, T> & vector, T x, T y, Vector<3, T> & target)
 }
 
 template<typename T>
-Vector<3, T> setXY(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
+constexpr Vector<3, T> setXY(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -1797,7 +1749,7 @@ Vector<3, T> setXY(const Vector<3, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<3, T> setXZ(const Vector<3, T> & vector, T x, T z, Vector<3, T> & target) {
+constexpr Vector<3, T> setXZ(const Vector<3, T> & vector, T x, T z, Vector<3, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -1805,7 +1757,7 @@ Vector<3, T> setXZ(const Vector<3, T> & vector, T x, T z, Vector<3, T> & target)
 }
 
 template<typename T>
-Vector<3, T> setXZ(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
+constexpr Vector<3, T> setXZ(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -1813,7 +1765,7 @@ Vector<3, T> setXZ(const Vector<3, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<3, T> setYX(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
+constexpr Vector<3, T> setYX(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -1821,7 +1773,7 @@ Vector<3, T> setYX(const Vector<3, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<3, T> setYZ(const Vector<3, T> & vector, T y, T z, Vector<3, T> & target) {
+constexpr Vector<3, T> setYZ(const Vector<3, T> & vector, T y, T z, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = z;
@@ -1829,7 +1781,7 @@ Vector<3, T> setYZ(const Vector<3, T> & vector, T y, T z, Vector<3, T> & target)
 }
 
 template<typename T>
-Vector<3, T> setYZ(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
+constexpr Vector<3, T> setYZ(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[1];
@@ -1837,7 +1789,7 @@ Vector<3, T> setYZ(const Vector<3, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<3, T> setZX(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
+constexpr Vector<3, T> setZX(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -1845,7 +1797,7 @@ Vector<3, T> setZX(const Vector<3, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<3, T> setZY(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
+constexpr Vector<3, T> setZY(const Vector<3, T> & vector, const Vector<2, T> & set, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[0];
@@ -1853,7 +1805,7 @@ Vector<3, T> setZY(const Vector<3, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<3, T> translateX(const Vector<3, T> & vector, T translateX) {
+constexpr Vector<3, T> translateX(const Vector<3, T> & vector, T translateX) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -1862,7 +1814,7 @@ Vector<3, T> translateX(const Vector<3, T> & vector, T translateX) {
 }
 
 template<typename T>
-Vector<3, T> translateY(const Vector<3, T> & vector, T translateY) {
+constexpr Vector<3, T> translateY(const Vector<3, T> & vector, T translateY) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -1871,7 +1823,7 @@ Vector<3, T> translateY(const Vector<3, T> & vector, T translateY) {
 }
 
 template<typename T>
-Vector<3, T> translateZ(const Vector<3, T> & vector, T translateZ) {
+constexpr Vector<3, T> translateZ(const Vector<3, T> & vector, T translateZ) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -1880,7 +1832,7 @@ Vector<3, T> translateZ(const Vector<3, T> & vector, T translateZ) {
 }
 
 template<typename T>
-Vector<3, T> translateXY(const Vector<3, T> & vector, T translateX, T translateY) {
+constexpr Vector<3, T> translateXY(const Vector<3, T> & vector, T translateX, T translateY) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -1889,7 +1841,7 @@ Vector<3, T> translateXY(const Vector<3, T> & vector, T translateX, T translateY
 }
 
 template<typename T>
-Vector<3, T> translateXY(const Vector<3, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<3, T> translateXY(const Vector<3, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -1898,7 +1850,7 @@ Vector<3, T> translateXY(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateXZ(const Vector<3, T> & vector, T translateX, T translateZ) {
+constexpr Vector<3, T> translateXZ(const Vector<3, T> & vector, T translateX, T translateZ) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -1907,7 +1859,7 @@ Vector<3, T> translateXZ(const Vector<3, T> & vector, T translateX, T translateZ
 }
 
 template<typename T>
-Vector<3, T> translateXZ(const Vector<3, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<3, T> translateXZ(const Vector<3, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -1916,7 +1868,7 @@ Vector<3, T> translateXZ(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateYX(const Vector<3, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<3, T> translateYX(const Vector<3, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -1925,7 +1877,7 @@ Vector<3, T> translateYX(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateYZ(const Vector<3, T> & vector, T translateY, T translateZ) {
+constexpr Vector<3, T> translateYZ(const Vector<3, T> & vector, T translateY, T translateZ) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -1934,7 +1886,7 @@ Vector<3, T> translateYZ(const Vector<3, T> & vector, T translateY, T translateZ
 }
 
 template<typename T>
-Vector<3, T> translateYZ(const Vector<3, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<3, T> translateYZ(const Vector<3, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -1943,7 +1895,7 @@ Vector<3, T> translateYZ(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateZX(const Vector<3, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<3, T> translateZX(const Vector<3, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -1952,7 +1904,7 @@ Vector<3, T> translateZX(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateZY(const Vector<3, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<3, T> translateZY(const Vector<3, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -1961,7 +1913,7 @@ Vector<3, T> translateZY(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateXYZ(const Vector<3, T> & vector, T translateX, T translateY, T translateZ) {
+constexpr Vector<3, T> translateXYZ(const Vector<3, T> & vector, T translateX, T translateY, T translateZ) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -1970,7 +1922,7 @@ Vector<3, T> translateXYZ(const Vector<3, T> & vector, T translateX, T translate
 }
 
 template<typename T>
-Vector<3, T> translateXYZ(const Vector<3, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<3, T> translateXYZ(const Vector<3, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -1979,7 +1931,7 @@ Vector<3, T> translateXYZ(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateXZY(const Vector<3, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<3, T> translateXZY(const Vector<3, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -1988,7 +1940,7 @@ Vector<3, T> translateXZY(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateYXZ(const Vector<3, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<3, T> translateYXZ(const Vector<3, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -1997,7 +1949,7 @@ Vector<3, T> translateYXZ(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateYZX(const Vector<3, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<3, T> translateYZX(const Vector<3, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -2006,7 +1958,7 @@ Vector<3, T> translateYZX(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateZXY(const Vector<3, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<3, T> translateZXY(const Vector<3, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -2015,7 +1967,7 @@ Vector<3, T> translateZXY(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateZYX(const Vector<3, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<3, T> translateZYX(const Vector<3, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -2024,7 +1976,7 @@ Vector<3, T> translateZYX(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateX(const Vector<3, T> & vector, T translateX, Vector<3, T> & target) {
+constexpr Vector<3, T> translateX(const Vector<3, T> & vector, T translateX, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -2032,7 +1984,7 @@ Vector<3, T> translateX(const Vector<3, T> & vector, T translateX, Vector<3, T>
 }
 
 template<typename T>
-Vector<3, T> translateY(const Vector<3, T> & vector, T translateY, Vector<3, T> & target) {
+constexpr Vector<3, T> translateY(const Vector<3, T> & vector, T translateY, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -2040,7 +1992,7 @@ Vector<3, T> translateY(const Vector<3, T> & vector, T translateY, Vector<3, T>
 }
 
 template<typename T>
-Vector<3, T> translateZ(const Vector<3, T> & vector, T translateZ, Vector<3, T> & target) {
+constexpr Vector<3, T> translateZ(const Vector<3, T> & vector, T translateZ, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -2048,7 +2000,7 @@ Vector<3, T> translateZ(const Vector<3, T> & vector, T translateZ, Vector<3, T>
 }
 
 template<typename T>
-Vector<3, T> translateXY(const Vector<3, T> & vector, T translateX, T translateY, Vector<3, T> & target) {
+constexpr Vector<3, T> translateXY(const Vector<3, T> & vector, T translateX, T translateY, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -2056,7 +2008,7 @@ Vector<3, T> translateXY(const Vector<3, T> & vector, T translateX, T translateY
 }
 
 template<typename T>
-Vector<3, T> translateXY(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateXY(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -2064,7 +2016,7 @@ Vector<3, T> translateXY(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateXZ(const Vector<3, T> & vector, T translateX, T translateZ, Vector<3, T> & target) {
+constexpr Vector<3, T> translateXZ(const Vector<3, T> & vector, T translateX, T translateZ, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -2072,7 +2024,7 @@ Vector<3, T> translateXZ(const Vector<3, T> & vector, T translateX, T translateZ
 }
 
 template<typename T>
-Vector<3, T> translateXZ(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateXZ(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -2080,7 +2032,7 @@ Vector<3, T> translateXZ(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateYX(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateYX(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -2088,7 +2040,7 @@ Vector<3, T> translateYX(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateYZ(const Vector<3, T> & vector, T translateY, T translateZ, Vector<3, T> & target) {
+constexpr Vector<3, T> translateYZ(const Vector<3, T> & vector, T translateY, T translateZ, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -2096,7 +2048,7 @@ Vector<3, T> translateYZ(const Vector<3, T> & vector, T translateY, T translateZ
 }
 
 template<typename T>
-Vector<3, T> translateYZ(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateYZ(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -2104,7 +2056,7 @@ Vector<3, T> translateYZ(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateZX(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateZX(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -2112,7 +2064,7 @@ Vector<3, T> translateZX(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateZY(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateZY(const Vector<3, T> & vector, const Vector<2, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -2120,7 +2072,7 @@ Vector<3, T> translateZY(const Vector<3, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<3, T> translateXYZ(const Vector<3, T> & vector, T translateX, T translateY, T translateZ, Vector<3, T> & target) {
+constexpr Vector<3, T> translateXYZ(const Vector<3, T> & vector, T translateX, T translateY, T translateZ, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -2128,7 +2080,7 @@ Vector<3, T> translateXYZ(const Vector<3, T> & vector, T translateX, T translate
 }
 
 template<typename T>
-Vector<3, T> translateXYZ(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateXYZ(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -2136,7 +2088,7 @@ Vector<3, T> translateXYZ(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateXZY(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateXZY(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -2144,7 +2096,7 @@ Vector<3, T> translateXZY(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateYXZ(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateYXZ(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -2152,7 +2104,7 @@ Vector<3, T> translateYXZ(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateYZX(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateYZX(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -2160,7 +2112,7 @@ Vector<3, T> translateYZX(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateZXY(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateZXY(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -2168,7 +2120,7 @@ Vector<3, T> translateZXY(const Vector<3, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<3, T> translateZYX(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
+constexpr Vector<3, T> translateZYX(const Vector<3, T> & vector, const Vector<3, T> & translate, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -2667,7 +2619,7 @@ Vector<3, T> & rotateZYX(const Vector<3, T> & vector, const Vector<3, T> & rotat
 }
 
 template<typename T>
-Vector<3, T> scaleX(const Vector<3, T> & vector, T scaleX) {
+constexpr Vector<3, T> scaleX(const Vector<3, T> & vector, T scaleX) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -2676,7 +2628,7 @@ Vector<3, T> scaleX(const Vector<3, T> & vector, T scaleX) {
 }
 
 template<typename T>
-Vector<3, T> scaleY(const Vector<3, T> & vector, T scaleY) {
+constexpr Vector<3, T> scaleY(const Vector<3, T> & vector, T scaleY) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -2685,7 +2637,7 @@ Vector<3, T> scaleY(const Vector<3, T> & vector, T scaleY) {
 }
 
 template<typename T>
-Vector<3, T> scaleZ(const Vector<3, T> & vector, T scaleZ) {
+constexpr Vector<3, T> scaleZ(const Vector<3, T> & vector, T scaleZ) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -2694,7 +2646,7 @@ Vector<3, T> scaleZ(const Vector<3, T> & vector, T scaleZ) {
 }
 
 template<typename T>
-Vector<3, T> scaleXY(const Vector<3, T> & vector, T scale) {
+constexpr Vector<3, T> scaleXY(const Vector<3, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -2703,7 +2655,7 @@ Vector<3, T> scaleXY(const Vector<3, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleXY(const Vector<3, T> & vector, T scaleX, T scaleY) {
+constexpr Vector<3, T> scaleXY(const Vector<3, T> & vector, T scaleX, T scaleY) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -2712,7 +2664,7 @@ Vector<3, T> scaleXY(const Vector<3, T> & vector, T scaleX, T scaleY) {
 }
 
 template<typename T>
-Vector<3, T> scaleXY(const Vector<3, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<3, T> scaleXY(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -2721,7 +2673,7 @@ Vector<3, T> scaleXY(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scale) {
+constexpr Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1],
@@ -2730,7 +2682,7 @@ Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scaleX, T scaleZ) {
+constexpr Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scaleX, T scaleZ) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -2739,7 +2691,7 @@ Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scaleX, T scaleZ) {
 }
 
 template<typename T>
-Vector<3, T> scaleXZ(const Vector<3, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<3, T> scaleXZ(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -2748,7 +2700,7 @@ Vector<3, T> scaleXZ(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleYX(const Vector<3, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<3, T> scaleYX(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -2757,7 +2709,7 @@ Vector<3, T> scaleYX(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scale) {
+constexpr Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale,
@@ -2766,7 +2718,7 @@ Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scaleY, T scaleZ) {
+constexpr Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scaleY, T scaleZ) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -2775,7 +2727,7 @@ Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scaleY, T scaleZ) {
 }
 
 template<typename T>
-Vector<3, T> scaleYZ(const Vector<3, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<3, T> scaleYZ(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -2784,7 +2736,7 @@ Vector<3, T> scaleYZ(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleZX(const Vector<3, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<3, T> scaleZX(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -2793,7 +2745,7 @@ Vector<3, T> scaleZX(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleZY(const Vector<3, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<3, T> scaleZY(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -2802,7 +2754,7 @@ Vector<3, T> scaleZY(const Vector<3, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scale) {
+constexpr Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -2811,7 +2763,7 @@ Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scaleX, T scaleY, T scaleZ) {
+constexpr Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scaleX, T scaleY, T scaleZ) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -2820,7 +2772,7 @@ Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scaleX, T scaleY, T scaleZ)
 }
 
 template<typename T>
-Vector<3, T> scaleXYZ(const Vector<3, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<3, T> scaleXYZ(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -2829,7 +2781,7 @@ Vector<3, T> scaleXYZ(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleXZY(const Vector<3, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<3, T> scaleXZY(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -2838,7 +2790,7 @@ Vector<3, T> scaleXZY(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleYXZ(const Vector<3, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<3, T> scaleYXZ(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -2847,7 +2799,7 @@ Vector<3, T> scaleYXZ(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleYZX(const Vector<3, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<3, T> scaleYZX(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -2856,7 +2808,7 @@ Vector<3, T> scaleYZX(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleZXY(const Vector<3, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<3, T> scaleZXY(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -2865,7 +2817,7 @@ Vector<3, T> scaleZXY(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleZYX(const Vector<3, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<3, T> scaleZYX(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -2874,7 +2826,7 @@ Vector<3, T> scaleZYX(const Vector<3, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<3, T> scaleX(const Vector<3, T> & vector, T scaleX, const Vector<3, T> & target) {
+constexpr Vector<3, T> scaleX(const Vector<3, T> & vector, T scaleX, const Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -2882,7 +2834,7 @@ Vector<3, T> scaleX(const Vector<3, T> & vector, T scaleX, const Vector<3, T> &
 }
 
 template<typename T>
-Vector<3, T> scaleY(const Vector<3, T> & vector, T scaleY, const Vector<3, T> & target) {
+constexpr Vector<3, T> scaleY(const Vector<3, T> & vector, T scaleY, const Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -2890,7 +2842,7 @@ Vector<3, T> scaleY(const Vector<3, T> & vector, T scaleY, const Vector<3, T> &
 }
 
 template<typename T>
-Vector<3, T> scaleZ(const Vector<3, T> & vector, T scaleZ, const Vector<3, T> & target) {
+constexpr Vector<3, T> scaleZ(const Vector<3, T> & vector, T scaleZ, const Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -2898,7 +2850,7 @@ Vector<3, T> scaleZ(const Vector<3, T> & vector, T scaleZ, const Vector<3, T> &
 }
 
 template<typename T>
-Vector<3, T> scaleXY(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXY(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2];
@@ -2906,7 +2858,7 @@ Vector<3, T> scaleXY(const Vector<3, T> & vector, T scale, Vector<3, T> & target
 }
 
 template<typename T>
-Vector<3, T> scaleXY(const Vector<3, T> & vector, T scaleX, T scaleY, const Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXY(const Vector<3, T> & vector, T scaleX, T scaleY, const Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -2914,7 +2866,7 @@ Vector<3, T> scaleXY(const Vector<3, T> & vector, T scaleX, T scaleY, const Vect
 }
 
 template<typename T>
-Vector<3, T> scaleXY(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXY(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -2922,7 +2874,7 @@ Vector<3, T> scaleXY(const Vector<3, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale;
@@ -2930,7 +2882,7 @@ Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scale, Vector<3, T> & target
 }
 
 template<typename T>
-Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scaleX, T scaleZ, const Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scaleX, T scaleZ, const Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -2938,7 +2890,7 @@ Vector<3, T> scaleXZ(const Vector<3, T> & vector, T scaleX, T scaleZ, const Vect
 }
 
 template<typename T>
-Vector<3, T> scaleXZ(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXZ(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -2946,7 +2898,7 @@ Vector<3, T> scaleXZ(const Vector<3, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<3, T> scaleYX(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleYX(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -2954,7 +2906,7 @@ Vector<3, T> scaleYX(const Vector<3, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -2962,7 +2914,7 @@ Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scale, Vector<3, T> & target
 }
 
 template<typename T>
-Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scaleY, T scaleZ, const Vector<3, T> & target) {
+constexpr Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scaleY, T scaleZ, const Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -2970,7 +2922,7 @@ Vector<3, T> scaleYZ(const Vector<3, T> & vector, T scaleY, T scaleZ, const Vect
 }
 
 template<typename T>
-Vector<3, T> scaleYZ(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleYZ(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -2978,7 +2930,7 @@ Vector<3, T> scaleYZ(const Vector<3, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<3, T> scaleZX(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleZX(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -2986,7 +2938,7 @@ Vector<3, T> scaleZX(const Vector<3, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<3, T> scaleZY(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleZY(const Vector<3, T> & vector, const Vector<2, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -2994,7 +2946,7 @@ Vector<3, T> scaleZY(const Vector<3, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -3002,7 +2954,7 @@ Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scale, Vector<3, T> & targe
 }
 
 template<typename T>
-Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scaleX, T scaleY, T scaleZ, const Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scaleX, T scaleY, T scaleZ, const Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -3010,7 +2962,7 @@ Vector<3, T> scaleXYZ(const Vector<3, T> & vector, T scaleX, T scaleY, T scaleZ,
 }
 
 template<typename T>
-Vector<3, T> scaleXYZ(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXYZ(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -3018,7 +2970,7 @@ Vector<3, T> scaleXYZ(const Vector<3, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<3, T> scaleXZY(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleXZY(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -3026,7 +2978,7 @@ Vector<3, T> scaleXZY(const Vector<3, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<3, T> scaleYXZ(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleYXZ(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -3034,7 +2986,7 @@ Vector<3, T> scaleYXZ(const Vector<3, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<3, T> scaleYZX(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleYZX(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -3042,7 +2994,7 @@ Vector<3, T> scaleYZX(const Vector<3, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<3, T> scaleZXY(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleZXY(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -3050,7 +3002,7 @@ Vector<3, T> scaleZXY(const Vector<3, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<3, T> scaleZYX(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
+constexpr Vector<3, T> scaleZYX(const Vector<3, T> & vector, const Vector<3, T> & scale, Vector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
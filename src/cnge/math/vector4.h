@@ -67,87 +67,40 @@ namespace VectorDimensions {
 
 template <typename T>
 class Vector<4, T> {
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] v;
-		}
-
 	public:
+		/// elements are stored back to back, so a VectorView can walk the whole array
 		static Vector<4, T> * newArray(u32 length) {
-			T * v = new T[4 * length];
-			Vector<4, T> * ret = new Vector<4, T>[length];
-			ret[0] = Vector<4, T>(v);
-			for (u32 i = 1; i < length; ++i)
-				ret[i] = Vector<4, T>(v + i * 4, false);
-			return ret;
+			return new Vector<4, T>[length];
 		}
 
-		T * v;
+		T v[4];
 
-		Vector() :
-			v(new T[4]()) {}
+		constexpr Vector() :
+			v() {}
 
-		Vector(T * v, bool owner = true) noexcept :
-			owner(owner),
-			v(v) {}
+		constexpr Vector(const std::array<T, 4> & values) noexcept :
+			v { values[0], values[1], values[2], values[3] } {}
 
-		explicit Vector(T value) :
-			v(new T[4] { value, value, value, value }) {}
+		constexpr explicit Vector(T value) :
+			v { value, value, value, value } {}
 
-		Vector(T x, T y, T z, T w) :
-			v(new T[4] { x, y, z, w }) {}
+		constexpr Vector(T x, T y, T z, T w) :
+			v { x, y, z, w } {}
 
 		template <typename T2>
-		Vector(const Vector<4, T2> & vector) :
-			v(new T[4] {
+		constexpr Vector(const Vector<4, T2> & vector) :
+			v {
 				(T) vector.v[0],
 				(T) vector.v[1],
 				(T) vector.v[2],
 				(T) vector.v[3]
-			}) {}
-
-		Vector(const Vector<4, T> & vector) :
-			v(new T[4] {
-				vector.v[0],
-				vector.v[1],
-				vector.v[2],
-				vector.v[3]
-			}) {}
-
-		Vector(Vector<4, T> && vector) :
-			owner(vector.owner),
-			v(vector.v) {
-			vector.owner = false;
-		}
-
-		Vector<4, T> & operator=(const Vector<4, T> & vector) {
-			v[0] = vector.v[0];
-			v[1] = vector.v[1];
-			v[2] = vector.v[2];
-			v[3] = vector.v[3];
-			return *this;
-		}
+			} {}
 
-		Vector<4, T> & operator=(Vector<4, T> && vector) {
-			if (owner) {
-				clean();
-				owner = vector.owner;
-				v = vector.v;
-				vector.owner = false;
-			}
-			else {
-				v[0] = vector.v[0];
-				v[1] = vector.v[1];
-				v[2] = vector.v[2];
-				v[3] = vector.v[3];
-			}
-			return *this;
-		}
+		constexpr Vector(const Vector<4, T> & vector) noexcept = default;
+
+		constexpr Vector<4, T> & operator=(const Vector<4, T> & vector) noexcept = default;
 
-		Vector<4, T> & operator+=(const Vector<4, T> & vector) {
+		constexpr Vector<4, T> & operator+=(const Vector<4, T> & vector) {
 			v[0] += vector.v[0];
 			v[1] += vector.v[1];
 			v[2] += vector.v[2];
@@ -155,7 +108,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & operator-=(const Vector<4, T> & vector) {
+		constexpr Vector<4, T> & operator-=(const Vector<4, T> & vector) {
 			v[0] -= vector.v[0];
 			v[1] -= vector.v[1];
 			v[2] -= vector.v[2];
@@ -163,7 +116,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & operator*=(T scalar) {
+		constexpr Vector<4, T> & operator*=(T scalar) {
 			v[0] *= scalar;
 			v[1] *= scalar;
 			v[2] *= scalar;
@@ -171,7 +124,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & operator*=(const Vector<4, T> & vector) {
+		constexpr Vector<4, T> & operator*=(const Vector<4, T> & vector) {
 			v[0] *= vector.v[0];
 			v[1] *= vector.v[1];
 			v[2] *= vector.v[2];
@@ -179,7 +132,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & operator/=(T scalar) {
+		constexpr Vector<4, T> & operator/=(T scalar) {
 			v[0] /= scalar;
 			v[1] /= scalar;
 			v[2] /= scalar;
@@ -187,7 +140,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & operator/=(const Vector<4, T> & vector) {
+		constexpr Vector<4, T> & operator/=(const Vector<4, T> & vector) {
 			v[0] /= vector.v[0];
 			v[1] /= vector.v[1];
 			v[2] /= vector.v[2];
@@ -215,35 +168,35 @@ class Vector<4, T> {
 			return v[VectorDimensions::VectorDimension<N>::dimension];
 		}
 
-		T & x() noexcept {
+		constexpr T & x() noexcept {
 			return v[0];
 		}
 
-		const T & x() const noexcept {
+		constexpr const T & x() const noexcept {
 			return v[0];
 		}
 
-		T & y() noexcept {
+		constexpr T & y() noexcept {
 			return v[1];
 		}
 
-		const T & y() const noexcept {
+		constexpr const T & y() const noexcept {
 			return v[1];
 		}
 
-		T & z() noexcept {
+		constexpr T & z() noexcept {
 			return v[2];
 		}
 
-		const T & z() const noexcept {
+		constexpr const T & z() const noexcept {
 			return v[2];
 		}
 
-		T & w() noexcept {
+		constexpr T & w() noexcept {
 			return v[3];
 		}
 
-		const T & w() const noexcept {
+		constexpr const T & w() const noexcept {
 			return v[3];
 		}
 
@@ -256,7 +209,7 @@ class Vector<4, T> {
 			);
 		}
 
-		T getLengthSquared() const {
+		constexpr T getLengthSquared() const {
 			return (
 				v[0] * v[0] +
 				v[1] * v[1] +
@@ -283,7 +236,7 @@ class Vector<4, T> {
 			return *this;
 		}
 		
-		Vector<2, T> & negate() {
+		constexpr Vector<2, T> & negate() {
 			v[0] = -v[0];
 			v[1] = -v[1];
 			v[2] = -v[2];
@@ -291,7 +244,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & project(const Vector<4, T> & projection) {
+		constexpr Vector<4, T> & project(const Vector<4, T> & projection) {
 			auto scalar = dot(*this, projection) / projection.getLengthSquared();
 			v[0] /= scalar;
 			v[1] /= scalar;
@@ -300,7 +253,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & set(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & set(const Vector<4, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
@@ -308,7 +261,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & translate(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translate(const Vector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
@@ -316,7 +269,7 @@ class Vector<4, T> {
 			return *this;
 		}
 		
-		Vector<4, T> & scale(T scale) {
+		constexpr Vector<4, T> & scale(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
@@ -324,7 +277,7 @@ class Vector<4, T> {
 			return *this;
 		}
 		
-		Vector<4, T> & scale(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scale(const Vector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
@@ -332,331 +285,331 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setX(T x) {
+		constexpr Vector<4, T> & setX(T x) {
 			v[0] = x;
 			return *this;
 		}
 
-		Vector<4, T> & setY(T y) {
+		constexpr Vector<4, T> & setY(T y) {
 			v[1] = y;
 			return *this;
 		}
 
-		Vector<4, T> & setZ(T z) {
+		constexpr Vector<4, T> & setZ(T z) {
 			v[2] = z;
 			return *this;
 		}
 
-		Vector<4, T> & setW(T w) {
+		constexpr Vector<4, T> & setW(T w) {
 			v[3] = w;
 			return *this;
 		}
 
-		Vector<4, T> & setXY(T x, T y) {
+		constexpr Vector<4, T> & setXY(T x, T y) {
 			v[0] = x;
 			v[1] = y;
 			return *this;
 		}
 
-		Vector<4, T> & setXY(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setXY(const Vector<2, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setXZ(T x, T z) {
+		constexpr Vector<4, T> & setXZ(T x, T z) {
 			v[0] = x;
 			v[2] = z;
 			return *this;
 		}
 
-		Vector<4, T> & setXZ(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setXZ(const Vector<2, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setXW(T x, T w) {
+		constexpr Vector<4, T> & setXW(T x, T w) {
 			v[0] = x;
 			v[3] = w;
 			return *this;
 		}
 
-		Vector<4, T> & setXW(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setXW(const Vector<2, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setYX(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setYX(const Vector<2, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setYZ(T y, T z) {
+		constexpr Vector<4, T> & setYZ(T y, T z) {
 			v[1] = y;
 			v[2] = z;
 			return *this;
 		}
 
-		Vector<4, T> & setYZ(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setYZ(const Vector<2, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setYW(T y, T w) {
+		constexpr Vector<4, T> & setYW(T y, T w) {
 			v[1] = y;
 			v[3] = w;
 			return *this;
 		}
 
-		Vector<4, T> & setYW(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setYW(const Vector<2, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setZX(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setZX(const Vector<2, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setZY(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setZY(const Vector<2, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setZW(T z, T w) {
+		constexpr Vector<4, T> & setZW(T z, T w) {
 			v[2] = z;
 			v[3] = w;
 			return *this;
 		}
 
-		Vector<4, T> & setZW(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setZW(const Vector<2, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setWX(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setWX(const Vector<2, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setWY(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setWY(const Vector<2, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setWZ(const Vector<2, T> & set) {
+		constexpr Vector<4, T> & setWZ(const Vector<2, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		Vector<4, T> & setXYZ(T x, T y, T z) {
+		constexpr Vector<4, T> & setXYZ(T x, T y, T z) {
 			v[0] = x;
 			v[1] = y;
 			v[2] = z;
 			return *this;
 		}
 
-		Vector<4, T> & setXYZ(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setXYZ(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setXYW(T x, T y, T w) {
+		constexpr Vector<4, T> & setXYW(T x, T y, T w) {
 			v[0] = x;
 			v[1] = y;
 			v[3] = w;
 			return *this;
 		}
 
-		Vector<4, T> & setXYW(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setXYW(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setXZY(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setXZY(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setXZW(T x, T z, T w) {
+		constexpr Vector<4, T> & setXZW(T x, T z, T w) {
 			v[0] = x;
 			v[2] = z;
 			v[3] = w;
 			return *this;
 		}
 
-		Vector<4, T> & setXZW(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setXZW(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setXWY(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setXWY(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setXWZ(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setXWZ(const Vector<3, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setYXZ(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setYXZ(const Vector<3, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setYXW(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setYXW(const Vector<3, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setYZX(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setYZX(const Vector<3, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setYZW(T y, T z, T w) {
+		constexpr Vector<4, T> & setYZW(T y, T z, T w) {
 			v[1] = y;
 			v[2] = z;
 			v[3] = w;
 			return *this;
 		}
 
-		Vector<4, T> & setYZW(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setYZW(const Vector<3, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setYWX(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setYWX(const Vector<3, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setYWZ(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setYWZ(const Vector<3, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setZXY(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setZXY(const Vector<3, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setZXW(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setZXW(const Vector<3, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setZYX(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setZYX(const Vector<3, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setZYW(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setZYW(const Vector<3, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setZWX(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setZWX(const Vector<3, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setZWY(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setZWY(const Vector<3, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setWXY(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setWXY(const Vector<3, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setWXZ(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setWXZ(const Vector<3, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setWYX(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setWYX(const Vector<3, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setWYZ(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setWYZ(const Vector<3, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setWZX(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setWZX(const Vector<3, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setWZY(const Vector<3, T> & set) {
+		constexpr Vector<4, T> & setWZY(const Vector<3, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		Vector<4, T> & setXYZW(T x, T y, T z, T w) {
+		constexpr Vector<4, T> & setXYZW(T x, T y, T z, T w) {
 			v[0] = x;
 			v[1] = y;
 			v[2] = z;
@@ -664,7 +617,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setXYZW(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setXYZW(const Vector<4, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
@@ -672,7 +625,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setXYWZ(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setXYWZ(const Vector<4, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[3] = set.v[2];
@@ -680,7 +633,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setXZYW(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setXZYW(const Vector<4, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
@@ -688,7 +641,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setXZWY(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setXZWY(const Vector<4, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[3] = set.v[2];
@@ -696,7 +649,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setXWYZ(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setXWYZ(const Vector<4, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			v[1] = set.v[2];
@@ -704,7 +657,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setXWZY(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setXWZY(const Vector<4, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			v[2] = set.v[2];
@@ -712,7 +665,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setYXZW(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setYXZW(const Vector<4, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
@@ -720,7 +673,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setYXWZ(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setYXWZ(const Vector<4, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[3] = set.v[2];
@@ -728,7 +681,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setYZXW(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setYZXW(const Vector<4, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
@@ -736,7 +689,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setYZWX(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setYZWX(const Vector<4, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[3] = set.v[2];
@@ -744,7 +697,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setYWXZ(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setYWXZ(const Vector<4, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			v[0] = set.v[2];
@@ -752,7 +705,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setYWZX(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setYWZX(const Vector<4, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			v[2] = set.v[2];
@@ -760,7 +713,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setZXYW(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setZXYW(const Vector<4, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
@@ -768,7 +721,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setZXWY(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setZXWY(const Vector<4, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[3] = set.v[2];
@@ -776,7 +729,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setZYXW(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setZYXW(const Vector<4, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
@@ -784,7 +737,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setZYWX(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setZYWX(const Vector<4, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[3] = set.v[2];
@@ -792,7 +745,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setZWXY(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setZWXY(const Vector<4, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			v[0] = set.v[2];
@@ -800,7 +753,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setZWYX(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setZWYX(const Vector<4, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			v[1] = set.v[2];
@@ -808,7 +761,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setWXYZ(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setWXYZ(const Vector<4, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
@@ -816,7 +769,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setWXZY(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setWXZY(const Vector<4, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
@@ -824,7 +777,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setWYXZ(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setWYXZ(const Vector<4, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
@@ -832,7 +785,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setWYZX(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setWYZX(const Vector<4, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
@@ -840,7 +793,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setWZXY(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setWZXY(const Vector<4, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
@@ -848,7 +801,7 @@ class Vector<4, T> {
 			return *this;
 		}
 
-		Vector<4, T> & setWZYX(const Vector<4, T> & set) {
+		constexpr Vector<4, T> & setWZYX(const Vector<4, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
@@ -856,2332 +809,2328 @@ class Vector<4, T> {
 			return *this;
 		}
 		
-		Vector<4, T> & translateX(T translateX) {
+		constexpr Vector<4, T> & translateX(T translateX) {
 			v[0] += translateX;
 		}
 
-		Vector<4, T> & translateY(T translateY) {
+		constexpr Vector<4, T> & translateY(T translateY) {
 			v[1] += translateY;
 		}
 
-		Vector<4, T> & translateZ(T translateZ) {
+		constexpr Vector<4, T> & translateZ(T translateZ) {
 			v[2] += translateZ;
 		}
 
-		Vector<4, T> & translateW(T translateW) {
+		constexpr Vector<4, T> & translateW(T translateW) {
 			v[3] += translateW;
 		}
 
-		Vector<4, T> & translateXY(T translateX, T translateY) {
+		constexpr Vector<4, T> & translateXY(T translateX, T translateY) {
 			v[0] += translateX;
 			v[1] += translateY;
 		}
 
-		Vector<4, T> & translateXY(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateXY(const Vector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 		}
 
-		Vector<4, T> & translateXZ(T translateX, T translateZ) {
+		constexpr Vector<4, T> & translateXZ(T translateX, T translateZ) {
 			v[0] += translateX;
 			v[2] += translateZ;
 		}
 
-		Vector<4, T> & translateXZ(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateXZ(const Vector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 		}
 
-		Vector<4, T> & translateXW(T translateX, T translateW) {
+		constexpr Vector<4, T> & translateXW(T translateX, T translateW) {
 			v[0] += translateX;
 			v[3] += translateW;
 		}
 
-		Vector<4, T> & translateXW(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateXW(const Vector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 		}
 
-		Vector<4, T> & translateYX(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateYX(const Vector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 		}
 
-		Vector<4, T> & translateYZ(T translateY, T translateZ) {
+		constexpr Vector<4, T> & translateYZ(T translateY, T translateZ) {
 			v[1] += translateY;
 			v[2] += translateZ;
 		}
 
-		Vector<4, T> & translateYZ(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateYZ(const Vector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 		}
 
-		Vector<4, T> & translateYW(T translateY, T translateW) {
+		constexpr Vector<4, T> & translateYW(T translateY, T translateW) {
 			v[1] += translateY;
 			v[3] += translateW;
 		}
 
-		Vector<4, T> & translateYW(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateYW(const Vector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 		}
 
-		Vector<4, T> & translateZX(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateZX(const Vector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 		}
 
-		Vector<4, T> & translateZY(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateZY(const Vector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 		}
 
-		Vector<4, T> & translateZW(T translateZ, T translateW) {
+		constexpr Vector<4, T> & translateZW(T translateZ, T translateW) {
 			v[2] += translateZ;
 			v[3] += translateW;
 		}
 
-		Vector<4, T> & translateZW(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateZW(const Vector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 		}
 
-		Vector<4, T> & translateWX(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateWX(const Vector<2, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 		}
 
-		Vector<4, T> & translateWY(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateWY(const Vector<2, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 		}
 
-		Vector<4, T> & translateWZ(const Vector<2, T> & translate) {
+		constexpr Vector<4, T> & translateWZ(const Vector<2, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 		}
 
-		Vector<4, T> & translateXYZ(T translateX, T translateY, T translateZ) {
+		constexpr Vector<4, T> & translateXYZ(T translateX, T translateY, T translateZ) {
 			v[0] += translateX;
 			v[1] += translateY;
 			v[2] += translateZ;
 		}
 
-		Vector<4, T> & translateXYZ(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateXYZ(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 		}
 
-		Vector<4, T> & translateXYW(T translateX, T translateY, T translateW) {
+		constexpr Vector<4, T> & translateXYW(T translateX, T translateY, T translateW) {
 			v[0] += translateX;
 			v[1] += translateY;
 			v[3] += translateW;
 		}
 
-		Vector<4, T> & translateXYW(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateXYW(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[3] += translate.v[2];
 		}
 
-		Vector<4, T> & translateXZY(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateXZY(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
 		}
 
-		Vector<4, T> & translateXZW(T translateX, T translateZ, T translateW) {
+		constexpr Vector<4, T> & translateXZW(T translateX, T translateZ, T translateW) {
 			v[0] += translateX;
 			v[2] += translateZ;
 			v[3] += translateW;
 		}
 
-		Vector<4, T> & translateXZW(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateXZW(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[3] += translate.v[2];
 		}
 
-		Vector<4, T> & translateXWY(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateXWY(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 			v[1] += translate.v[2];
 		}
 
-		Vector<4, T> & translateXWZ(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateXWZ(const Vector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 			v[2] += translate.v[2];
 		}
 
-		Vector<4, T> & translateYXZ(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateYXZ(const Vector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
 		}
 
-		Vector<4, T> & translateYXW(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateYXW(const Vector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[3] += translate.v[2];
 		}
 
-		Vector<4, T> & translateYZX(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateYZX(const Vector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
 		}
 
-		Vector<4, T> & translateYZW(T translateY, T translateZ, T translateW) {
+		constexpr Vector<4, T> & translateYZW(T translateY, T translateZ, T translateW) {
 			v[1] += translateY;
 			v[2] += translateZ;
 			v[3] += translateW;
 		}
 
-		Vector<4, T> & translateYZW(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateYZW(const Vector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[3] += translate.v[2];
 		}
 
-		Vector<4, T> & translateYWX(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateYWX(const Vector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 			v[0] += translate.v[2];
 		}
 
-		Vector<4, T> & translateYWZ(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateYWZ(const Vector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 			v[2] += translate.v[2];
 		}
 
-		Vector<4, T> & translateZXY(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateZXY(const Vector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
 		}
 
-		Vector<4, T> & translateZXW(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateZXW(const Vector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[3] += translate.v[2];
 		}
 
-		Vector<4, T> & translateZYX(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateZYX(const Vector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
 		}
 
-		Vector<4, T> & translateZYW(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateZYW(const Vector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[3] += translate.v[2];
 		}
 
-		Vector<4, T> & translateZWX(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateZWX(const Vector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 			v[0] += translate.v[2];
 		}
 
-		Vector<4, T> & translateZWY(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateZWY(const Vector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 			v[1] += translate.v[2];
 		}
 
-		Vector<4, T> & translateWXY(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateWXY(const Vector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
 		}
 
-		Vector<4, T> & translateWXZ(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateWXZ(const Vector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
 		}
 
-		Vector<4, T> & translateWYX(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateWYX(const Vector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
 		}
 
-		Vector<4, T> & translateWYZ(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateWYZ(const Vector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 		}
 
-		Vector<4, T> & translateWZX(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateWZX(const Vector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
 		}
 
-		Vector<4, T> & translateWZY(const Vector<3, T> & translate) {
+		constexpr Vector<4, T> & translateWZY(const Vector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
 		}
 
-		Vector<4, T> & translateXYZW(T translateX, T translateY, T translateZ, T translateW) {
+		constexpr Vector<4, T> & translateXYZW(T translateX, T translateY, T translateZ, T translateW) {
 			v[0] += translateX;
 			v[1] += translateY;
 			v[2] += translateZ;
 			v[3] += translateW;
 		}
 
-		Vector<4, T> & translateXYZW(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateXYZW(const Vector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 			v[3] += translate.v[3];
 		}
 
-		Vector<4, T> & translateXYWZ(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateXYWZ(const Vector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[3] += translate.v[2];
 			v[2] += translate.v[3];
 		}
 
-		Vector<4, T> & translateXZYW(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateXZYW(const Vector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
 			v[3] += translate.v[3];
 		}
 
-		Vector<4, T> & translateXZWY(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateXZWY(const Vector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[3] += translate.v[2];
 			v[1] += translate.v[3];
 		}
 
-		Vector<4, T> & translateXWYZ(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateXWYZ(const Vector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 			v[1] += translate.v[2];
 			v[2] += translate.v[3];
 		}
 
-		Vector<4, T> & translateXWZY(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateXWZY(const Vector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 			v[2] += translate.v[2];
 			v[1] += translate.v[3];
 		}
 
-		Vector<4, T> & translateYXZW(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateYXZW(const Vector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
 			v[3] += translate.v[3];
 		}
 
-		Vector<4, T> & translateYXWZ(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateYXWZ(const Vector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[3] += translate.v[2];
 			v[2] += translate.v[3];
 		}
 
-		Vector<4, T> & translateYZXW(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateYZXW(const Vector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
 			v[3] += translate.v[3];
 		}
 
-		Vector<4, T> & translateYZWX(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateYZWX(const Vector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[3] += translate.v[2];
 			v[0] += translate.v[3];
 		}
 
-		Vector<4, T> & translateYWXZ(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateYWXZ(const Vector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 			v[0] += translate.v[2];
 			v[2] += translate.v[3];
 		}
 
-		Vector<4, T> & translateYWZX(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateYWZX(const Vector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 			v[2] += translate.v[2];
 			v[0] += translate.v[3];
 		}
 
-		Vector<4, T> & translateZXYW(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateZXYW(const Vector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
 			v[3] += translate.v[3];
 		}
 
-		Vector<4, T> & translateZXWY(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateZXWY(const Vector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[3] += translate.v[2];
 			v[1] += translate.v[3];
 		}
 
-		Vector<4, T> & translateZYXW(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateZYXW(const Vector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
 			v[3] += translate.v[3];
 		}
 
-		Vector<4, T> & translateZYWX(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateZYWX(const Vector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[3] += translate.v[2];
 			v[0] += translate.v[3];
 		}
 
-		Vector<4, T> & translateZWXY(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateZWXY(const Vector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 			v[0] += translate.v[2];
 			v[1] += translate.v[3];
 		}
 
-		Vector<4, T> & translateZWYX(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateZWYX(const Vector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 			v[1] += translate.v[2];
 			v[0] += translate.v[3];
 		}
 
-		Vector<4, T> & translateWXYZ(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateWXYZ(const Vector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
 			v[2] += translate.v[3];
 		}
 
-		Vector<4, T> & translateWXZY(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateWXZY(const Vector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
 			v[1] += translate.v[3];
 		}
 
-		Vector<4, T> & translateWYXZ(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateWYXZ(const Vector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
 			v[2] += translate.v[3];
 		}
 
-		Vector<4, T> & translateWYZX(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateWYZX(const Vector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 			v[0] += translate.v[3];
 		}
 
-		Vector<4, T> & translateWZXY(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateWZXY(const Vector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
 			v[1] += translate.v[3];
 		}
 
-		Vector<4, T> & translateWZYX(const Vector<4, T> & translate) {
+		constexpr Vector<4, T> & translateWZYX(const Vector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
 			v[0] += translate.v[3];
 		}
 
-		Vector<4, T> & scaleX(T scaleX) {
+		constexpr Vector<4, T> & scaleX(T scaleX) {
 			v[0] *= scaleX;
 		}
 
-		Vector<4, T> & scaleY(T scaleY) {
+		constexpr Vector<4, T> & scaleY(T scaleY) {
 			v[1] *= scaleY;
 		}
 
-		Vector<4, T> & scaleZ(T scaleZ) {
+		constexpr Vector<4, T> & scaleZ(T scaleZ) {
 			v[2] *= scaleZ;
 		}
 
-		Vector<4, T> & scaleW(T scaleW) {
+		constexpr Vector<4, T> & scaleW(T scaleW) {
 			v[3] *= scaleW;
 		}
 
-		Vector<4, T> & scaleXY(T scale) {
+		constexpr Vector<4, T> & scaleXY(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 		}
 
-		Vector<4, T> & scaleXY(T scaleX, T scaleY) {
+		constexpr Vector<4, T> & scaleXY(T scaleX, T scaleY) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 		}
 
-		Vector<4, T> & scaleXY(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleXY(const Vector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleXZ(T scale) {
+		constexpr Vector<4, T> & scaleXZ(T scale) {
 			v[0] *= scale;
 			v[2] *= scale;
 		}
 
-		Vector<4, T> & scaleXZ(T scaleX, T scaleZ) {
+		constexpr Vector<4, T> & scaleXZ(T scaleX, T scaleZ) {
 			v[0] *= scaleX;
 			v[2] *= scaleZ;
 		}
 
-		Vector<4, T> & scaleXZ(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleXZ(const Vector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleXW(T scale) {
+		constexpr Vector<4, T> & scaleXW(T scale) {
 			v[0] *= scale;
 			v[3] *= scale;
 		}
 
-		Vector<4, T> & scaleXW(T scaleX, T scaleW) {
+		constexpr Vector<4, T> & scaleXW(T scaleX, T scaleW) {
 			v[0] *= scaleX;
 			v[3] *= scaleW;
 		}
 
-		Vector<4, T> & scaleXW(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleXW(const Vector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleYX(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleYX(const Vector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleYZ(T scale) {
+		constexpr Vector<4, T> & scaleYZ(T scale) {
 			v[1] *= scale;
 			v[2] *= scale;
 		}
 
-		Vector<4, T> & scaleYZ(T scaleY, T scaleZ) {
+		constexpr Vector<4, T> & scaleYZ(T scaleY, T scaleZ) {
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
 		}
 
-		Vector<4, T> & scaleYZ(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleYZ(const Vector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleYW(T scale) {
+		constexpr Vector<4, T> & scaleYW(T scale) {
 			v[1] *= scale;
 			v[3] *= scale;
 		}
 
-		Vector<4, T> & scaleYW(T scaleY, T scaleW) {
+		constexpr Vector<4, T> & scaleYW(T scaleY, T scaleW) {
 			v[1] *= scaleY;
 			v[3] *= scaleW;
 		}
 
-		Vector<4, T> & scaleYW(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleYW(const Vector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleZX(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleZX(const Vector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleZY(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleZY(const Vector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleZW(T scale) {
+		constexpr Vector<4, T> & scaleZW(T scale) {
 			v[2] *= scale;
 			v[3] *= scale;
 		}
 
-		Vector<4, T> & scaleZW(T scaleZ, T scaleW) {
+		constexpr Vector<4, T> & scaleZW(T scaleZ, T scaleW) {
 			v[2] *= scaleZ;
 			v[3] *= scaleW;
 		}
 
-		Vector<4, T> & scaleZW(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleZW(const Vector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleWX(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleWX(const Vector<2, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleWY(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleWY(const Vector<2, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleWZ(const Vector<2, T> & scale) {
+		constexpr Vector<4, T> & scaleWZ(const Vector<2, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 		}
 
-		Vector<4, T> & scaleXYZ(T scale) {
+		constexpr Vector<4, T> & scaleXYZ(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
 		}
 
-		Vector<4, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
+		constexpr Vector<4, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
 		}
 
-		Vector<4, T> & scaleXYZ(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleXYZ(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleXYW(T scale) {
+		constexpr Vector<4, T> & scaleXYW(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[3] *= scale;
 		}
 
-		Vector<4, T> & scaleXYW(T scaleX, T scaleY, T scaleW) {
+		constexpr Vector<4, T> & scaleXYW(T scaleX, T scaleY, T scaleW) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 			v[3] *= scaleW;
 		}
 
-		Vector<4, T> & scaleXYW(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleXYW(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[3] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleXZY(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleXZY(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleXZW(T scale) {
+		constexpr Vector<4, T> & scaleXZW(T scale) {
 			v[0] *= scale;
 			v[2] *= scale;
 			v[3] *= scale;
 		}
 
-		Vector<4, T> & scaleXZW(T scaleX, T scaleZ, T scaleW) {
+		constexpr Vector<4, T> & scaleXZW(T scaleX, T scaleZ, T scaleW) {
 			v[0] *= scaleX;
 			v[2] *= scaleZ;
 			v[3] *= scaleW;
 		}
 
-		Vector<4, T> & scaleXZW(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleXZW(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[3] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleXWY(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleXWY(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[1] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleXWZ(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleXWZ(const Vector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[2] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleYXZ(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleYXZ(const Vector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleYXW(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleYXW(const Vector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[3] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleYZX(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleYZX(const Vector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleYZW(T scale) {
+		constexpr Vector<4, T> & scaleYZW(T scale) {
 			v[1] *= scale;
 			v[2] *= scale;
 			v[3] *= scale;
 		}
 
-		Vector<4, T> & scaleYZW(T scaleY, T scaleZ, T scaleW) {
+		constexpr Vector<4, T> & scaleYZW(T scaleY, T scaleZ, T scaleW) {
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
 			v[3] *= scaleW;
 		}
 
-		Vector<4, T> & scaleYZW(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleYZW(const Vector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[3] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleYWX(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleYWX(const Vector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[0] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleYWZ(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleYWZ(const Vector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[2] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleZXY(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleZXY(const Vector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleZXW(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleZXW(const Vector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[3] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleZYX(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleZYX(const Vector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleZYW(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleZYW(const Vector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[3] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleZWX(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleZWX(const Vector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[0] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleZWY(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleZWY(const Vector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[1] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleWXY(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleWXY(const Vector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleWXZ(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleWXZ(const Vector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleWYX(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleWYX(const Vector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleWYZ(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleWYZ(const Vector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleWZX(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleWZX(const Vector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleWZY(const Vector<3, T> & scale) {
+		constexpr Vector<4, T> & scaleWZY(const Vector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
 		}
 
-		Vector<4, T> & scaleXYZW(T scale) {
+		constexpr Vector<4, T> & scaleXYZW(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
 			v[3] *= scale;
 		}
 
-		Vector<4, T> & scaleXYZW(T scaleX, T scaleY, T scaleZ, T scaleW) {
+		constexpr Vector<4, T> & scaleXYZW(T scaleX, T scaleY, T scaleZ, T scaleW) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
 			v[3] *= scaleW;
 		}
 
-		Vector<4, T> & scaleXYZW(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleXYZW(const Vector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[3] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleXYWZ(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleXYWZ(const Vector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[2] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleXZYW(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleXZYW(const Vector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[3] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleXZWY(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleXZWY(const Vector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[1] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleXWYZ(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleXWYZ(const Vector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[2] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleXWZY(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleXWZY(const Vector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[1] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleYXZW(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleYXZW(const Vector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[3] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleYXWZ(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleYXWZ(const Vector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[2] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleYZXW(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleYZXW(const Vector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[3] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleYZWX(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleYZWX(const Vector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[0] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleYWXZ(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleYWXZ(const Vector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[2] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleYWZX(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleYWZX(const Vector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[0] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleZXYW(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleZXYW(const Vector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[3] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleZXWY(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleZXWY(const Vector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[1] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleZYXW(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleZYXW(const Vector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[3] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleZYWX(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleZYWX(const Vector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[0] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleZWXY(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleZWXY(const Vector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[1] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleZWYX(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleZWYX(const Vector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[0] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleWXYZ(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleWXYZ(const Vector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[2] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleWXZY(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleWXZY(const Vector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[1] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleWYXZ(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleWYXZ(const Vector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[2] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleWYZX(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleWYZX(const Vector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[0] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleWZXY(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleWZXY(const Vector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[1] *= scale.v[3];
 		}
 
-		Vector<4, T> & scaleWZYX(const Vector<4, T> & scale) {
+		constexpr Vector<4, T> & scaleWZYX(const Vector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[0] *= scale.v[3];
 		}
 
-		T getX() const {
+		constexpr T getX() const {
 			return v[0];
 		}
 
-		T getY() const {
+		constexpr T getY() const {
 			return v[1];
 		}
 
-		T getZ() const {
+		constexpr T getZ() const {
 			return v[2];
 		}
 
-		T getW() const {
+		constexpr T getW() const {
 			return v[3];
 		}
 
-		Vector<2, T> getXX() const {
+		constexpr Vector<2, T> getXX() const {
 			return { v[0], v[0] };
 		}
 
-		Vector<2, T> getXY() const {
+		constexpr Vector<2, T> getXY() const {
 			return { v[0], v[1] };
 		}
 
-		Vector<2, T> getXZ() const {
+		constexpr Vector<2, T> getXZ() const {
 			return { v[0], v[2] };
 		}
 
-		Vector<2, T> getXW() const {
+		constexpr Vector<2, T> getXW() const {
 			return { v[0], v[3] };
 		}
 
-		Vector<2, T> getYX() const {
+		constexpr Vector<2, T> getYX() const {
 			return { v[1], v[0] };
 		}
 
-		Vector<2, T> getYY() const {
+		constexpr Vector<2, T> getYY() const {
 			return { v[1], v[1] };
 		}
 
-		Vector<2, T> getYZ() const {
+		constexpr Vector<2, T> getYZ() const {
 			return { v[1], v[2] };
 		}
 
-		Vector<2, T> getYW() const {
+		constexpr Vector<2, T> getYW() const {
 			return { v[1], v[3] };
 		}
 
-		Vector<2, T> getZX() const {
+		constexpr Vector<2, T> getZX() const {
 			return { v[2], v[0] };
 		}
 
-		Vector<2, T> getZY() const {
+		constexpr Vector<2, T> getZY() const {
 			return { v[2], v[1] };
 		}
 
-		Vector<2, T> getZZ() const {
+		constexpr Vector<2, T> getZZ() const {
 			return { v[2], v[2] };
 		}
 
-		Vector<2, T> getZW() const {
+		constexpr Vector<2, T> getZW() const {
 			return { v[2], v[3] };
 		}
 
-		Vector<2, T> getWX() const {
+		constexpr Vector<2, T> getWX() const {
 			return { v[3], v[0] };
 		}
 
-		Vector<2, T> getWY() const {
+		constexpr Vector<2, T> getWY() const {
 			return { v[3], v[1] };
 		}
 
-		Vector<2, T> getWZ() const {
+		constexpr Vector<2, T> getWZ() const {
 			return { v[3], v[2] };
 		}
 
-		Vector<2, T> getWW() const {
+		constexpr Vector<2, T> getWW() const {
 			return { v[3], v[3] };
 		}
 
-		Vector<3, T> getXXX() const {
+		constexpr Vector<3, T> getXXX() const {
 			return { v[0], v[0], v[0] };
 		}
 
-		Vector<3, T> getXXY() const {
+		constexpr Vector<3, T> getXXY() const {
 			return { v[0], v[0], v[1] };
 		}
 
-		Vector<3, T> getXXZ() const {
+		constexpr Vector<3, T> getXXZ() const {
 			return { v[0], v[0], v[2] };
 		}
 
-		Vector<3, T> getXXW() const {
+		constexpr Vector<3, T> getXXW() const {
 			return { v[0], v[0], v[3] };
 		}
 
-		Vector<3, T> getXYX() const {
+		constexpr Vector<3, T> getXYX() const {
 			return { v[0], v[1], v[0] };
 		}
 
-		Vector<3, T> getXYY() const {
+		constexpr Vector<3, T> getXYY() const {
 			return { v[0], v[1], v[1] };
 		}
 
-		Vector<3, T> getXYZ() const {
+		constexpr Vector<3, T> getXYZ() const {
 			return { v[0], v[1], v[2] };
 		}
 
-		Vector<3, T> getXYW() const {
+		constexpr Vector<3, T> getXYW() const {
 			return { v[0], v[1], v[3] };
 		}
 
-		Vector<3, T> getXZX() const {
+		constexpr Vector<3, T> getXZX() const {
 			return { v[0], v[2], v[0] };
 		}
 
-		Vector<3, T> getXZY() const {
+		constexpr Vector<3, T> getXZY() const {
 			return { v[0], v[2], v[1] };
 		}
 
-		Vector<3, T> getXZZ() const {
+		constexpr Vector<3, T> getXZZ() const {
 			return { v[0], v[2], v[2] };
 		}
 
-		Vector<3, T> getXZW() const {
+		constexpr Vector<3, T> getXZW() const {
 			return { v[0], v[2], v[3] };
 		}
 
-		Vector<3, T> getXWX() const {
+		constexpr Vector<3, T> getXWX() const {
 			return { v[0], v[3], v[0] };
 		}
 
-		Vector<3, T> getXWY() const {
+		constexpr Vector<3, T> getXWY() const {
 			return { v[0], v[3], v[1] };
 		}
 
-		Vector<3, T> getXWZ() const {
+		constexpr Vector<3, T> getXWZ() const {
 			return { v[0], v[3], v[2] };
 		}
 
-		Vector<3, T> getXWW() const {
+		constexpr Vector<3, T> getXWW() const {
 			return { v[0], v[3], v[3] };
 		}
 
-		Vector<3, T> getYXX() const {
+		constexpr Vector<3, T> getYXX() const {
 			return { v[1], v[0], v[0] };
 		}
 
-		Vector<3, T> getYXY() const {
+		constexpr Vector<3, T> getYXY() const {
 			return { v[1], v[0], v[1] };
 		}
 
-		Vector<3, T> getYXZ() const {
+		constexpr Vector<3, T> getYXZ() const {
 			return { v[1], v[0], v[2] };
 		}
 
-		Vector<3, T> getYXW() const {
+		constexpr Vector<3, T> getYXW() const {
 			return { v[1], v[0], v[3] };
 		}
 
-		Vector<3, T> getYYX() const {
+		constexpr Vector<3, T> getYYX() const {
 			return { v[1], v[1], v[0] };
 		}
 
-		Vector<3, T> getYYY() const {
+		constexpr Vector<3, T> getYYY() const {
 			return { v[1], v[1], v[1] };
 		}
 
-		Vector<3, T> getYYZ() const {
+		constexpr Vector<3, T> getYYZ() const {
 			return { v[1], v[1], v[2] };
 		}
 
-		Vector<3, T> getYYW() const {
+		constexpr Vector<3, T> getYYW() const {
 			return { v[1], v[1], v[3] };
 		}
 
-		Vector<3, T> getYZX() const {
+		constexpr Vector<3, T> getYZX() const {
 			return { v[1], v[2], v[0] };
 		}
 
-		Vector<3, T> getYZY() const {
+		constexpr Vector<3, T> getYZY() const {
 			return { v[1], v[2], v[1] };
 		}
 
-		Vector<3, T> getYZZ() const {
+		constexpr Vector<3, T> getYZZ() const {
 			return { v[1], v[2], v[2] };
 		}
 
-		Vector<3, T> getYZW() const {
+		constexpr Vector<3, T> getYZW() const {
 			return { v[1], v[2], v[3] };
 		}
 
-		Vector<3, T> getYWX() const {
+		constexpr Vector<3, T> getYWX() const {
 			return { v[1], v[3], v[0] };
 		}
 
-		Vector<3, T> getYWY() const {
+		constexpr Vector<3, T> getYWY() const {
 			return { v[1], v[3], v[1] };
 		}
 
-		Vector<3, T> getYWZ() const {
+		constexpr Vector<3, T> getYWZ() const {
 			return { v[1], v[3], v[2] };
 		}
 
-		Vector<3, T> getYWW() const {
+		constexpr Vector<3, T> getYWW() const {
 			return { v[1], v[3], v[3] };
 		}
 
-		Vector<3, T> getZXX() const {
+		constexpr Vector<3, T> getZXX() const {
 			return { v[2], v[0], v[0] };
 		}
 
-		Vector<3, T> getZXY() const {
+		constexpr Vector<3, T> getZXY() const {
 			return { v[2], v[0], v[1] };
 		}
 
-		Vector<3, T> getZXZ() const {
+		constexpr Vector<3, T> getZXZ() const {
 			return { v[2], v[0], v[2] };
 		}
 
-		Vector<3, T> getZXW() const {
+		constexpr Vector<3, T> getZXW() const {
 			return { v[2], v[0], v[3] };
 		}
 
-		Vector<3, T> getZYX() const {
+		constexpr Vector<3, T> getZYX() const {
 			return { v[2], v[1], v[0] };
 		}
 
-		Vector<3, T> getZYY() const {
+		constexpr Vector<3, T> getZYY() const {
 			return { v[2], v[1], v[1] };
 		}
 
-		Vector<3, T> getZYZ() const {
+		constexpr Vector<3, T> getZYZ() const {
 			return { v[2], v[1], v[2] };
 		}
 
-		Vector<3, T> getZYW() const {
+		constexpr Vector<3, T> getZYW() const {
 			return { v[2], v[1], v[3] };
 		}
 
-		Vector<3, T> getZZX() const {
+		constexpr Vector<3, T> getZZX() const {
 			return { v[2], v[2], v[0] };
 		}
 
-		Vector<3, T> getZZY() const {
+		constexpr Vector<3, T> getZZY() const {
 			return { v[2], v[2], v[1] };
 		}
 
-		Vector<3, T> getZZZ() const {
+		constexpr Vector<3, T> getZZZ() const {
 			return { v[2], v[2], v[2] };
 		}
 
-		Vector<3, T> getZZW() const {
+		constexpr Vector<3, T> getZZW() const {
 			return { v[2], v[2], v[3] };
 		}
 
-		Vector<3, T> getZWX() const {
+		constexpr Vector<3, T> getZWX() const {
 			return { v[2], v[3], v[0] };
 		}
 
-		Vector<3, T> getZWY() const {
+		constexpr Vector<3, T> getZWY() const {
 			return { v[2], v[3], v[1] };
 		}
 
-		Vector<3, T> getZWZ() const {
+		constexpr Vector<3, T> getZWZ() const {
 			return { v[2], v[3], v[2] };
 		}
 
-		Vector<3, T> getZWW() const {
+		constexpr Vector<3, T> getZWW() const {
 			return { v[2], v[3], v[3] };
 		}
 
-		Vector<3, T> getWXX() const {
+		constexpr Vector<3, T> getWXX() const {
 			return { v[3], v[0], v[0] };
 		}
 
-		Vector<3, T> getWXY() const {
+		constexpr Vector<3, T> getWXY() const {
 			return { v[3], v[0], v[1] };
 		}
 
-		Vector<3, T> getWXZ() const {
+		constexpr Vector<3, T> getWXZ() const {
 			return { v[3], v[0], v[2] };
 		}
 
-		Vector<3, T> getWXW() const {
+		constexpr Vector<3, T> getWXW() const {
 			return { v[3], v[0], v[3] };
 		}
 
-		Vector<3, T> getWYX() const {
+		constexpr Vector<3, T> getWYX() const {
 			return { v[3], v[1], v[0] };
 		}
 
-		Vector<3, T> getWYY() const {
+		constexpr Vector<3, T> getWYY() const {
 			return { v[3], v[1], v[1] };
 		}
 
-		Vector<3, T> getWYZ() const {
+		constexpr Vector<3, T> getWYZ() const {
 			return { v[3], v[1], v[2] };
 		}
 
-		Vector<3, T> getWYW() const {
+		constexpr Vector<3, T> getWYW() const {
 			return { v[3], v[1], v[3] };
 		}
 
-		Vector<3, T> getWZX() const {
+		constexpr Vector<3, T> getWZX() const {
 			return { v[3], v[2], v[0] };
 		}
 
-		Vector<3, T> getWZY() const {
+		constexpr Vector<3, T> getWZY() const {
 			return { v[3], v[2], v[1] };
 		}
 
-		Vector<3, T> getWZZ() const {
+		constexpr Vector<3, T> getWZZ() const {
 			return { v[3], v[2], v[2] };
 		}
 
-		Vector<3, T> getWZW() const {
+		constexpr Vector<3, T> getWZW() const {
 			return { v[3], v[2], v[3] };
 		}
 
-		Vector<3, T> getWWX() const {
+		constexpr Vector<3, T> getWWX() const {
 			return { v[3], v[3], v[0] };
 		}
 
-		Vector<3, T> getWWY() const {
+		constexpr Vector<3, T> getWWY() const {
 			return { v[3], v[3], v[1] };
 		}
 
-		Vector<3, T> getWWZ() const {
+		constexpr Vector<3, T> getWWZ() const {
 			return { v[3], v[3], v[2] };
 		}
 
-		Vector<3, T> getWWW() const {
+		constexpr Vector<3, T> getWWW() const {
 			return { v[3], v[3], v[3] };
 		}
 
-		Vector<4, T> getXXXX() const {
+		constexpr Vector<4, T> getXXXX() const {
 			return { v[0], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getXXXY() const {
+		constexpr Vector<4, T> getXXXY() const {
 			return { v[0], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getXXXZ() const {
+		constexpr Vector<4, T> getXXXZ() const {
 			return { v[0], v[0], v[0], v[2] };
 		}
 
-		Vector<4, T> getXXXW() const {
+		constexpr Vector<4, T> getXXXW() const {
 			return { v[0], v[0], v[0], v[3] };
 		}
 
-		Vector<4, T> getXXYX() const {
+		constexpr Vector<4, T> getXXYX() const {
 			return { v[0], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getXXYY() const {
+		constexpr Vector<4, T> getXXYY() const {
 			return { v[0], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getXXYZ() const {
+		constexpr Vector<4, T> getXXYZ() const {
 			return { v[0], v[0], v[1], v[2] };
 		}
 
-		Vector<4, T> getXXYW() const {
+		constexpr Vector<4, T> getXXYW() const {
 			return { v[0], v[0], v[1], v[3] };
 		}
 
-		Vector<4, T> getXXZX() const {
+		constexpr Vector<4, T> getXXZX() const {
 			return { v[0], v[0], v[2], v[0] };
 		}
 
-		Vector<4, T> getXXZY() const {
+		constexpr Vector<4, T> getXXZY() const {
 			return { v[0], v[0], v[2], v[1] };
 		}
 
-		Vector<4, T> getXXZZ() const {
+		constexpr Vector<4, T> getXXZZ() const {
 			return { v[0], v[0], v[2], v[2] };
 		}
 
-		Vector<4, T> getXXZW() const {
+		constexpr Vector<4, T> getXXZW() const {
 			return { v[0], v[0], v[2], v[3] };
 		}
 
-		Vector<4, T> getXXWX() const {
+		constexpr Vector<4, T> getXXWX() const {
 			return { v[0], v[0], v[3], v[0] };
 		}
 
-		Vector<4, T> getXXWY() const {
+		constexpr Vector<4, T> getXXWY() const {
 			return { v[0], v[0], v[3], v[1] };
 		}
 
-		Vector<4, T> getXXWZ() const {
+		constexpr Vector<4, T> getXXWZ() const {
 			return { v[0], v[0], v[3], v[2] };
 		}
 
-		Vector<4, T> getXXWW() const {
+		constexpr Vector<4, T> getXXWW() const {
 			return { v[0], v[0], v[3], v[3] };
 		}
 
-		Vector<4, T> getXYXX() const {
+		constexpr Vector<4, T> getXYXX() const {
 			return { v[0], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getXYXY() const {
+		constexpr Vector<4, T> getXYXY() const {
 			return { v[0], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getXYXZ() const {
+		constexpr Vector<4, T> getXYXZ() const {
 			return { v[0], v[1], v[0], v[2] };
 		}
 
-		Vector<4, T> getXYXW() const {
+		constexpr Vector<4, T> getXYXW() const {
 			return { v[0], v[1], v[0], v[3] };
 		}
 
-		Vector<4, T> getXYYX() const {
+		constexpr Vector<4, T> getXYYX() const {
 			return { v[0], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getXYYY() const {
+		constexpr Vector<4, T> getXYYY() const {
 			return { v[0], v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getXYYZ() const {
+		constexpr Vector<4, T> getXYYZ() const {
 			return { v[0], v[1], v[1], v[2] };
 		}
 
-		Vector<4, T> getXYYW() const {
+		constexpr Vector<4, T> getXYYW() const {
 			return { v[0], v[1], v[1], v[3] };
 		}
 
-		Vector<4, T> getXYZX() const {
+		constexpr Vector<4, T> getXYZX() const {
 			return { v[0], v[1], v[2], v[0] };
 		}
 
-		Vector<4, T> getXYZY() const {
+		constexpr Vector<4, T> getXYZY() const {
 			return { v[0], v[1], v[2], v[1] };
 		}
 
-		Vector<4, T> getXYZZ() const {
+		constexpr Vector<4, T> getXYZZ() const {
 			return { v[0], v[1], v[2], v[2] };
 		}
 
-		Vector<4, T> getXYZW() const {
+		constexpr Vector<4, T> getXYZW() const {
 			return { v[0], v[1], v[2], v[3] };
 		}
 
-		Vector<4, T> getXYWX() const {
+		constexpr Vector<4, T> getXYWX() const {
 			return { v[0], v[1], v[3], v[0] };
 		}
 
-		Vector<4, T> getXYWY() const {
+		constexpr Vector<4, T> getXYWY() const {
 			return { v[0], v[1], v[3], v[1] };
 		}
 
-		Vector<4, T> getXYWZ() const {
+		constexpr Vector<4, T> getXYWZ() const {
 			return { v[0], v[1], v[3], v[2] };
 		}
 
-		Vector<4, T> getXYWW() const {
+		constexpr Vector<4, T> getXYWW() const {
 			return { v[0], v[1], v[3], v[3] };
 		}
 
-		Vector<4, T> getXZXX() const {
+		constexpr Vector<4, T> getXZXX() const {
 			return { v[0], v[2], v[0], v[0] };
 		}
 
-		Vector<4, T> getXZXY() const {
+		constexpr Vector<4, T> getXZXY() const {
 			return { v[0], v[2], v[0], v[1] };
 		}
 
-		Vector<4, T> getXZXZ() const {
+		constexpr Vector<4, T> getXZXZ() const {
 			return { v[0], v[2], v[0], v[2] };
 		}
 
-		Vector<4, T> getXZXW() const {
+		constexpr Vector<4, T> getXZXW() const {
 			return { v[0], v[2], v[0], v[3] };
 		}
 
-		Vector<4, T> getXZYX() const {
+		constexpr Vector<4, T> getXZYX() const {
 			return { v[0], v[2], v[1], v[0] };
 		}
 
-		Vector<4, T> getXZYY() const {
+		constexpr Vector<4, T> getXZYY() const {
 			return { v[0], v[2], v[1], v[1] };
 		}
 
-		Vector<4, T> getXZYZ() const {
+		constexpr Vector<4, T> getXZYZ() const {
 			return { v[0], v[2], v[1], v[2] };
 		}
 
-		Vector<4, T> getXZYW() const {
+		constexpr Vector<4, T> getXZYW() const {
 			return { v[0], v[2], v[1], v[3] };
 		}
 
-		Vector<4, T> getXZZX() const {
+		constexpr Vector<4, T> getXZZX() const {
 			return { v[0], v[2], v[2], v[0] };
 		}
 
-		Vector<4, T> getXZZY() const {
+		constexpr Vector<4, T> getXZZY() const {
 			return { v[0], v[2], v[2], v[1] };
 		}
 
-		Vector<4, T> getXZZZ() const {
+		constexpr Vector<4, T> getXZZZ() const {
 			return { v[0], v[2], v[2], v[2] };
 		}
 
-		Vector<4, T> getXZZW() const {
+		constexpr Vector<4, T> getXZZW() const {
 			return { v[0], v[2], v[2], v[3] };
 		}
 
-		Vector<4, T> getXZWX() const {
+		constexpr Vector<4, T> getXZWX() const {
 			return { v[0], v[2], v[3], v[0] };
 		}
 
-		Vector<4, T> getXZWY() const {
+		constexpr Vector<4, T> getXZWY() const {
 			return { v[0], v[2], v[3], v[1] };
 		}
 
-		Vector<4, T> getXZWZ() const {
+		constexpr Vector<4, T> getXZWZ() const {
 			return { v[0], v[2], v[3], v[2] };
 		}
 
-		Vector<4, T> getXZWW() const {
+		constexpr Vector<4, T> getXZWW() const {
 			return { v[0], v[2], v[3], v[3] };
 		}
 
-		Vector<4, T> getXWXX() const {
+		constexpr Vector<4, T> getXWXX() const {
 			return { v[0], v[3], v[0], v[0] };
 		}
 
-		Vector<4, T> getXWXY() const {
+		constexpr Vector<4, T> getXWXY() const {
 			return { v[0], v[3], v[0], v[1] };
 		}
 
-		Vector<4, T> getXWXZ() const {
+		constexpr Vector<4, T> getXWXZ() const {
 			return { v[0], v[3], v[0], v[2] };
 		}
 
-		Vector<4, T> getXWXW() const {
+		constexpr Vector<4, T> getXWXW() const {
 			return { v[0], v[3], v[0], v[3] };
 		}
 
-		Vector<4, T> getXWYX() const {
+		constexpr Vector<4, T> getXWYX() const {
 			return { v[0], v[3], v[1], v[0] };
 		}
 
-		Vector<4, T> getXWYY() const {
+		constexpr Vector<4, T> getXWYY() const {
 			return { v[0], v[3], v[1], v[1] };
 		}
 
-		Vector<4, T> getXWYZ() const {
+		constexpr Vector<4, T> getXWYZ() const {
 			return { v[0], v[3], v[1], v[2] };
 		}
 
-		Vector<4, T> getXWYW() const {
+		constexpr Vector<4, T> getXWYW() const {
 			return { v[0], v[3], v[1], v[3] };
 		}
 
-		Vector<4, T> getXWZX() const {
+		constexpr Vector<4, T> getXWZX() const {
 			return { v[0], v[3], v[2], v[0] };
 		}
 
-		Vector<4, T> getXWZY() const {
+		constexpr Vector<4, T> getXWZY() const {
 			return { v[0], v[3], v[2], v[1] };
 		}
 
-		Vector<4, T> getXWZZ() const {
+		constexpr Vector<4, T> getXWZZ() const {
 			return { v[0], v[3], v[2], v[2] };
 		}
 
-		Vector<4, T> getXWZW() const {
+		constexpr Vector<4, T> getXWZW() const {
 			return { v[0], v[3], v[2], v[3] };
 		}
 
-		Vector<4, T> getXWWX() const {
+		constexpr Vector<4, T> getXWWX() const {
 			return { v[0], v[3], v[3], v[0] };
 		}
 
-		Vector<4, T> getXWWY() const {
+		constexpr Vector<4, T> getXWWY() const {
 			return { v[0], v[3], v[3], v[1] };
 		}
 
-		Vector<4, T> getXWWZ() const {
+		constexpr Vector<4, T> getXWWZ() const {
 			return { v[0], v[3], v[3], v[2] };
 		}
 
-		Vector<4, T> getXWWW() const {
+		constexpr Vector<4, T> getXWWW() const {
 			return { v[0], v[3], v[3], v[3] };
 		}
 
-		Vector<4, T> getYXXX() const {
+		constexpr Vector<4, T> getYXXX() const {
 			return { v[1], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getYXXY() const {
+		constexpr Vector<4, T> getYXXY() const {
 			return { v[1], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getYXXZ() const {
+		constexpr Vector<4, T> getYXXZ() const {
 			return { v[1], v[0], v[0], v[2] };
 		}
 
-		Vector<4, T> getYXXW() const {
+		constexpr Vector<4, T> getYXXW() const {
 			return { v[1], v[0], v[0], v[3] };
 		}
 
-		Vector<4, T> getYXYX() const {
+		constexpr Vector<4, T> getYXYX() const {
 			return { v[1], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getYXYY() const {
+		constexpr Vector<4, T> getYXYY() const {
 			return { v[1], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getYXYZ() const {
+		constexpr Vector<4, T> getYXYZ() const {
 			return { v[1], v[0], v[1], v[2] };
 		}
 
-		Vector<4, T> getYXYW() const {
+		constexpr Vector<4, T> getYXYW() const {
 			return { v[1], v[0], v[1], v[3] };
 		}
 
-		Vector<4, T> getYXZX() const {
+		constexpr Vector<4, T> getYXZX() const {
 			return { v[1], v[0], v[2], v[0] };
 		}
 
-		Vector<4, T> getYXZY() const {
+		constexpr Vector<4, T> getYXZY() const {
 			return { v[1], v[0], v[2], v[1] };
 		}
 
-		Vector<4, T> getYXZZ() const {
+		constexpr Vector<4, T> getYXZZ() const {
 			return { v[1], v[0], v[2], v[2] };
 		}
 
-		Vector<4, T> getYXZW() const {
+		constexpr Vector<4, T> getYXZW() const {
 			return { v[1], v[0], v[2], v[3] };
 		}
 
-		Vector<4, T> getYXWX() const {
+		constexpr Vector<4, T> getYXWX() const {
 			return { v[1], v[0], v[3], v[0] };
 		}
 
-		Vector<4, T> getYXWY() const {
+		constexpr Vector<4, T> getYXWY() const {
 			return { v[1], v[0], v[3], v[1] };
 		}
 
-		Vector<4, T> getYXWZ() const {
+		constexpr Vector<4, T> getYXWZ() const {
 			return { v[1], v[0], v[3], v[2] };
 		}
 
-		Vector<4, T> getYXWW() const {
+		constexpr Vector<4, T> getYXWW() const {
 			return { v[1], v[0], v[3], v[3] };
 		}
 
-		Vector<4, T> getYYXX() const {
+		constexpr Vector<4, T> getYYXX() const {
 			return { v[1], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getYYXY() const {
+		constexpr Vector<4, T> getYYXY() const {
 			return { v[1], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getYYXZ() const {
+		constexpr Vector<4, T> getYYXZ() const {
 			return { v[1], v[1], v[0], v[2] };
 		}
 
-		Vector<4, T> getYYXW() const {
+		constexpr Vector<4, T> getYYXW() const {
 			return { v[1], v[1], v[0], v[3] };
 		}
 
-		Vector<4, T> getYYYX() const {
+		constexpr Vector<4, T> getYYYX() const {
 			return { v[1], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getYYYY() const {
+		constexpr Vector<4, T> getYYYY() const {
 			return { v[1], v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getYYYZ() const {
+		constexpr Vector<4, T> getYYYZ() const {
 			return { v[1], v[1], v[1], v[2] };
 		}
 
-		Vector<4, T> getYYYW() const {
+		constexpr Vector<4, T> getYYYW() const {
 			return { v[1], v[1], v[1], v[3] };
 		}
 
-		Vector<4, T> getYYZX() const {
+		constexpr Vector<4, T> getYYZX() const {
 			return { v[1], v[1], v[2], v[0] };
 		}
 
-		Vector<4, T> getYYZY() const {
+		constexpr Vector<4, T> getYYZY() const {
 			return { v[1], v[1], v[2], v[1] };
 		}
 
-		Vector<4, T> getYYZZ() const {
+		constexpr Vector<4, T> getYYZZ() const {
 			return { v[1], v[1], v[2], v[2] };
 		}
 
-		Vector<4, T> getYYZW() const {
+		constexpr Vector<4, T> getYYZW() const {
 			return { v[1], v[1], v[2], v[3] };
 		}
 
-		Vector<4, T> getYYWX() const {
+		constexpr Vector<4, T> getYYWX() const {
 			return { v[1], v[1], v[3], v[0] };
 		}
 
-		Vector<4, T> getYYWY() const {
+		constexpr Vector<4, T> getYYWY() const {
 			return { v[1], v[1], v[3], v[1] };
 		}
 
-		Vector<4, T> getYYWZ() const {
+		constexpr Vector<4, T> getYYWZ() const {
 			return { v[1], v[1], v[3], v[2] };
 		}
 
-		Vector<4, T> getYYWW() const {
+		constexpr Vector<4, T> getYYWW() const {
 			return { v[1], v[1], v[3], v[3] };
 		}
 
-		Vector<4, T> getYZXX() const {
+		constexpr Vector<4, T> getYZXX() const {
 			return { v[1], v[2], v[0], v[0] };
 		}
 
-		Vector<4, T> getYZXY() const {
+		constexpr Vector<4, T> getYZXY() const {
 			return { v[1], v[2], v[0], v[1] };
 		}
 
-		Vector<4, T> getYZXZ() const {
+		constexpr Vector<4, T> getYZXZ() const {
 			return { v[1], v[2], v[0], v[2] };
 		}
 
-		Vector<4, T> getYZXW() const {
+		constexpr Vector<4, T> getYZXW() const {
 			return { v[1], v[2], v[0], v[3] };
 		}
 
-		Vector<4, T> getYZYX() const {
+		constexpr Vector<4, T> getYZYX() const {
 			return { v[1], v[2], v[1], v[0] };
 		}
 
-		Vector<4, T> getYZYY() const {
+		constexpr Vector<4, T> getYZYY() const {
 			return { v[1], v[2], v[1], v[1] };
 		}
 
-		Vector<4, T> getYZYZ() const {
+		constexpr Vector<4, T> getYZYZ() const {
 			return { v[1], v[2], v[1], v[2] };
 		}
 
-		Vector<4, T> getYZYW() const {
+		constexpr Vector<4, T> getYZYW() const {
 			return { v[1], v[2], v[1], v[3] };
 		}
 
-		Vector<4, T> getYZZX() const {
+		constexpr Vector<4, T> getYZZX() const {
 			return { v[1], v[2], v[2], v[0] };
 		}
 
-		Vector<4, T> getYZZY() const {
+		constexpr Vector<4, T> getYZZY() const {
 			return { v[1], v[2], v[2], v[1] };
 		}
 
-		Vector<4, T> getYZZZ() const {
+		constexpr Vector<4, T> getYZZZ() const {
 			return { v[1], v[2], v[2], v[2] };
 		}
 
-		Vector<4, T> getYZZW() const {
+		constexpr Vector<4, T> getYZZW() const {
 			return { v[1], v[2], v[2], v[3] };
 		}
 
-		Vector<4, T> getYZWX() const {
+		constexpr Vector<4, T> getYZWX() const {
 			return { v[1], v[2], v[3], v[0] };
 		}
 
-		Vector<4, T> getYZWY() const {
+		constexpr Vector<4, T> getYZWY() const {
 			return { v[1], v[2], v[3], v[1] };
 		}
 
-		Vector<4, T> getYZWZ() const {
+		constexpr Vector<4, T> getYZWZ() const {
 			return { v[1], v[2], v[3], v[2] };
 		}
 
-		Vector<4, T> getYZWW() const {
+		constexpr Vector<4, T> getYZWW() const {
 			return { v[1], v[2], v[3], v[3] };
 		}
 
-		Vector<4, T> getYWXX() const {
+		constexpr Vector<4, T> getYWXX() const {
 			return { v[1], v[3], v[0], v[0] };
 		}
 
-		Vector<4, T> getYWXY() const {
+		constexpr Vector<4, T> getYWXY() const {
 			return { v[1], v[3], v[0], v[1] };
 		}
 
-		Vector<4, T> getYWXZ() const {
+		constexpr Vector<4, T> getYWXZ() const {
 			return { v[1], v[3], v[0], v[2] };
 		}
 
-		Vector<4, T> getYWXW() const {
+		constexpr Vector<4, T> getYWXW() const {
 			return { v[1], v[3], v[0], v[3] };
 		}
 
-		Vector<4, T> getYWYX() const {
+		constexpr Vector<4, T> getYWYX() const {
 			return { v[1], v[3], v[1], v[0] };
 		}
 
-		Vector<4, T> getYWYY() const {
+		constexpr Vector<4, T> getYWYY() const {
 			return { v[1], v[3], v[1], v[1] };
 		}
 
-		Vector<4, T> getYWYZ() const {
+		constexpr Vector<4, T> getYWYZ() const {
 			return { v[1], v[3], v[1], v[2] };
 		}
 
-		Vector<4, T> getYWYW() const {
+		constexpr Vector<4, T> getYWYW() const {
 			return { v[1], v[3], v[1], v[3] };
 		}
 
-		Vector<4, T> getYWZX() const {
+		constexpr Vector<4, T> getYWZX() const {
 			return { v[1], v[3], v[2], v[0] };
 		}
 
-		Vector<4, T> getYWZY() const {
+		constexpr Vector<4, T> getYWZY() const {
 			return { v[1], v[3], v[2], v[1] };
 		}
 
-		Vector<4, T> getYWZZ() const {
+		constexpr Vector<4, T> getYWZZ() const {
 			return { v[1], v[3], v[2], v[2] };
 		}
 
-		Vector<4, T> getYWZW() const {
+		constexpr Vector<4, T> getYWZW() const {
 			return { v[1], v[3], v[2], v[3] };
 		}
 
-		Vector<4, T> getYWWX() const {
+		constexpr Vector<4, T> getYWWX() const {
 			return { v[1], v[3], v[3], v[0] };
 		}
 
-		Vector<4, T> getYWWY() const {
+		constexpr Vector<4, T> getYWWY() const {
 			return { v[1], v[3], v[3], v[1] };
 		}
 
-		Vector<4, T> getYWWZ() const {
+		constexpr Vector<4, T> getYWWZ() const {
 			return { v[1], v[3], v[3], v[2] };
 		}
 
-		Vector<4, T> getYWWW() const {
+		constexpr Vector<4, T> getYWWW() const {
 			return { v[1], v[3], v[3], v[3] };
 		}
 
-		Vector<4, T> getZXXX() const {
+		constexpr Vector<4, T> getZXXX() const {
 			return { v[2], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getZXXY() const {
+		constexpr Vector<4, T> getZXXY() const {
 			return { v[2], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getZXXZ() const {
+		constexpr Vector<4, T> getZXXZ() const {
 			return { v[2], v[0], v[0], v[2] };
 		}
 
-		Vector<4, T> getZXXW() const {
+		constexpr Vector<4, T> getZXXW() const {
 			return { v[2], v[0], v[0], v[3] };
 		}
 
-		Vector<4, T> getZXYX() const {
+		constexpr Vector<4, T> getZXYX() const {
 			return { v[2], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getZXYY() const {
+		constexpr Vector<4, T> getZXYY() const {
 			return { v[2], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getZXYZ() const {
+		constexpr Vector<4, T> getZXYZ() const {
 			return { v[2], v[0], v[1], v[2] };
 		}
 
-		Vector<4, T> getZXYW() const {
+		constexpr Vector<4, T> getZXYW() const {
 			return { v[2], v[0], v[1], v[3] };
 		}
 
-		Vector<4, T> getZXZX() const {
+		constexpr Vector<4, T> getZXZX() const {
 			return { v[2], v[0], v[2], v[0] };
 		}
 
-		Vector<4, T> getZXZY() const {
+		constexpr Vector<4, T> getZXZY() const {
 			return { v[2], v[0], v[2], v[1] };
 		}
 
-		Vector<4, T> getZXZZ() const {
+		constexpr Vector<4, T> getZXZZ() const {
 			return { v[2], v[0], v[2], v[2] };
 		}
 
-		Vector<4, T> getZXZW() const {
+		constexpr Vector<4, T> getZXZW() const {
 			return { v[2], v[0], v[2], v[3] };
 		}
 
-		Vector<4, T> getZXWX() const {
+		constexpr Vector<4, T> getZXWX() const {
 			return { v[2], v[0], v[3], v[0] };
 		}
 
-		Vector<4, T> getZXWY() const {
+		constexpr Vector<4, T> getZXWY() const {
 			return { v[2], v[0], v[3], v[1] };
 		}
 
-		Vector<4, T> getZXWZ() const {
+		constexpr Vector<4, T> getZXWZ() const {
 			return { v[2], v[0], v[3], v[2] };
 		}
 
-		Vector<4, T> getZXWW() const {
+		constexpr Vector<4, T> getZXWW() const {
 			return { v[2], v[0], v[3], v[3] };
 		}
 
-		Vector<4, T> getZYXX() const {
+		constexpr Vector<4, T> getZYXX() const {
 			return { v[2], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getZYXY() const {
+		constexpr Vector<4, T> getZYXY() const {
 			return { v[2], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getZYXZ() const {
+		constexpr Vector<4, T> getZYXZ() const {
 			return { v[2], v[1], v[0], v[2] };
 		}
 
-		Vector<4, T> getZYXW() const {
+		constexpr Vector<4, T> getZYXW() const {
 			return { v[2], v[1], v[0], v[3] };
 		}
 
-		Vector<4, T> getZYYX() const {
+		constexpr Vector<4, T> getZYYX() const {
 			return { v[2], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getZYYY() const {
+		constexpr Vector<4, T> getZYYY() const {
 			return { v[2], v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getZYYZ() const {
+		constexpr Vector<4, T> getZYYZ() const {
 			return { v[2], v[1], v[1], v[2] };
 		}
 
-		Vector<4, T> getZYYW() const {
+		constexpr Vector<4, T> getZYYW() const {
 			return { v[2], v[1], v[1], v[3] };
 		}
 
-		Vector<4, T> getZYZX() const {
+		constexpr Vector<4, T> getZYZX() const {
 			return { v[2], v[1], v[2], v[0] };
 		}
 
-		Vector<4, T> getZYZY() const {
+		constexpr Vector<4, T> getZYZY() const {
 			return { v[2], v[1], v[2], v[1] };
 		}
 
-		Vector<4, T> getZYZZ() const {
+		constexpr Vector<4, T> getZYZZ() const {
 			return { v[2], v[1], v[2], v[2] };
 		}
 
-		Vector<4, T> getZYZW() const {
+		constexpr Vector<4, T> getZYZW() const {
 			return { v[2], v[1], v[2], v[3] };
 		}
 
-		Vector<4, T> getZYWX() const {
+		constexpr Vector<4, T> getZYWX() const {
 			return { v[2], v[1], v[3], v[0] };
 		}
 
-		Vector<4, T> getZYWY() const {
+		constexpr Vector<4, T> getZYWY() const {
 			return { v[2], v[1], v[3], v[1] };
 		}
 
-		Vector<4, T> getZYWZ() const {
+		constexpr Vector<4, T> getZYWZ() const {
 			return { v[2], v[1], v[3], v[2] };
 		}
 
-		Vector<4, T> getZYWW() const {
+		constexpr Vector<4, T> getZYWW() const {
 			return { v[2], v[1], v[3], v[3] };
 		}
 
-		Vector<4, T> getZZXX() const {
+		constexpr Vector<4, T> getZZXX() const {
 			return { v[2], v[2], v[0], v[0] };
 		}
 
-		Vector<4, T> getZZXY() const {
+		constexpr Vector<4, T> getZZXY() const {
 			return { v[2], v[2], v[0], v[1] };
 		}
 
-		Vector<4, T> getZZXZ() const {
+		constexpr Vector<4, T> getZZXZ() const {
 			return { v[2], v[2], v[0], v[2] };
 		}
 
-		Vector<4, T> getZZXW() const {
+		constexpr Vector<4, T> getZZXW() const {
 			return { v[2], v[2], v[0], v[3] };
 		}
 
-		Vector<4, T> getZZYX() const {
+		constexpr Vector<4, T> getZZYX() const {
 			return { v[2], v[2], v[1], v[0] };
 		}
 
-		Vector<4, T> getZZYY() const {
+		constexpr Vector<4, T> getZZYY() const {
 			return { v[2], v[2], v[1], v[1] };
 		}
 
-		Vector<4, T> getZZYZ() const {
+		constexpr Vector<4, T> getZZYZ() const {
 			return { v[2], v[2], v[1], v[2] };
 		}
 
-		Vector<4, T> getZZYW() const {
+		constexpr Vector<4, T> getZZYW() const {
 			return { v[2], v[2], v[1], v[3] };
 		}
 
-		Vector<4, T> getZZZX() const {
+		constexpr Vector<4, T> getZZZX() const {
 			return { v[2], v[2], v[2], v[0] };
 		}
 
-		Vector<4, T> getZZZY() const {
+		constexpr Vector<4, T> getZZZY() const {
 			return { v[2], v[2], v[2], v[1] };
 		}
 
-		Vector<4, T> getZZZZ() const {
+		constexpr Vector<4, T> getZZZZ() const {
 			return { v[2], v[2], v[2], v[2] };
 		}
 
-		Vector<4, T> getZZZW() const {
+		constexpr Vector<4, T> getZZZW() const {
 			return { v[2], v[2], v[2], v[3] };
 		}
 
-		Vector<4, T> getZZWX() const {
+		constexpr Vector<4, T> getZZWX() const {
 			return { v[2], v[2], v[3], v[0] };
 		}
 
-		Vector<4, T> getZZWY() const {
+		constexpr Vector<4, T> getZZWY() const {
 			return { v[2], v[2], v[3], v[1] };
 		}
 
-		Vector<4, T> getZZWZ() const {
+		constexpr Vector<4, T> getZZWZ() const {
 			return { v[2], v[2], v[3], v[2] };
 		}
 
-		Vector<4, T> getZZWW() const {
+		constexpr Vector<4, T> getZZWW() const {
 			return { v[2], v[2], v[3], v[3] };
 		}
 
-		Vector<4, T> getZWXX() const {
+		constexpr Vector<4, T> getZWXX() const {
 			return { v[2], v[3], v[0], v[0] };
 		}
 
-		Vector<4, T> getZWXY() const {
+		constexpr Vector<4, T> getZWXY() const {
 			return { v[2], v[3], v[0], v[1] };
 		}
 
-		Vector<4, T> getZWXZ() const {
+		constexpr Vector<4, T> getZWXZ() const {
 			return { v[2], v[3], v[0], v[2] };
 		}
 
-		Vector<4, T> getZWXW() const {
+		constexpr Vector<4, T> getZWXW() const {
 			return { v[2], v[3], v[0], v[3] };
 		}
 
-		Vector<4, T> getZWYX() const {
+		constexpr Vector<4, T> getZWYX() const {
 			return { v[2], v[3], v[1], v[0] };
 		}
 
-		Vector<4, T> getZWYY() const {
+		constexpr Vector<4, T> getZWYY() const {
 			return { v[2], v[3], v[1], v[1] };
 		}
 
-		Vector<4, T> getZWYZ() const {
+		constexpr Vector<4, T> getZWYZ() const {
 			return { v[2], v[3], v[1], v[2] };
 		}
 
-		Vector<4, T> getZWYW() const {
+		constexpr Vector<4, T> getZWYW() const {
 			return { v[2], v[3], v[1], v[3] };
 		}
 
-		Vector<4, T> getZWZX() const {
+		constexpr Vector<4, T> getZWZX() const {
 			return { v[2], v[3], v[2], v[0] };
 		}
 
-		Vector<4, T> getZWZY() const {
+		constexpr Vector<4, T> getZWZY() const {
 			return { v[2], v[3], v[2], v[1] };
 		}
 
-		Vector<4, T> getZWZZ() const {
+		constexpr Vector<4, T> getZWZZ() const {
 			return { v[2], v[3], v[2], v[2] };
 		}
 
-		Vector<4, T> getZWZW() const {
+		constexpr Vector<4, T> getZWZW() const {
 			return { v[2], v[3], v[2], v[3] };
 		}
 
-		Vector<4, T> getZWWX() const {
+		constexpr Vector<4, T> getZWWX() const {
 			return { v[2], v[3], v[3], v[0] };
 		}
 
-		Vector<4, T> getZWWY() const {
+		constexpr Vector<4, T> getZWWY() const {
 			return { v[2], v[3], v[3], v[1] };
 		}
 
-		Vector<4, T> getZWWZ() const {
+		constexpr Vector<4, T> getZWWZ() const {
 			return { v[2], v[3], v[3], v[2] };
 		}
 
-		Vector<4, T> getZWWW() const {
+		constexpr Vector<4, T> getZWWW() const {
 			return { v[2], v[3], v[3], v[3] };
 		}
 
-		Vector<4, T> getWXXX() const {
+		constexpr Vector<4, T> getWXXX() const {
 			return { v[3], v[0], v[0], v[0] };
 		}
 
-		Vector<4, T> getWXXY() const {
+		constexpr Vector<4, T> getWXXY() const {
 			return { v[3], v[0], v[0], v[1] };
 		}
 
-		Vector<4, T> getWXXZ() const {
+		constexpr Vector<4, T> getWXXZ() const {
 			return { v[3], v[0], v[0], v[2] };
 		}
 
-		Vector<4, T> getWXXW() const {
+		constexpr Vector<4, T> getWXXW() const {
 			return { v[3], v[0], v[0], v[3] };
 		}
 
-		Vector<4, T> getWXYX() const {
+		constexpr Vector<4, T> getWXYX() const {
 			return { v[3], v[0], v[1], v[0] };
 		}
 
-		Vector<4, T> getWXYY() const {
+		constexpr Vector<4, T> getWXYY() const {
 			return { v[3], v[0], v[1], v[1] };
 		}
 
-		Vector<4, T> getWXYZ() const {
+		constexpr Vector<4, T> getWXYZ() const {
 			return { v[3], v[0], v[1], v[2] };
 		}
 
-		Vector<4, T> getWXYW() const {
+		constexpr Vector<4, T> getWXYW() const {
 			return { v[3], v[0], v[1], v[3] };
 		}
 
-		Vector<4, T> getWXZX() const {
+		constexpr Vector<4, T> getWXZX() const {
 			return { v[3], v[0], v[2], v[0] };
 		}
 
-		Vector<4, T> getWXZY() const {
+		constexpr Vector<4, T> getWXZY() const {
 			return { v[3], v[0], v[2], v[1] };
 		}
 
-		Vector<4, T> getWXZZ() const {
+		constexpr Vector<4, T> getWXZZ() const {
 			return { v[3], v[0], v[2], v[2] };
 		}
 
-		Vector<4, T> getWXZW() const {
+		constexpr Vector<4, T> getWXZW() const {
 			return { v[3], v[0], v[2], v[3] };
 		}
 
-		Vector<4, T> getWXWX() const {
+		constexpr Vector<4, T> getWXWX() const {
 			return { v[3], v[0], v[3], v[0] };
 		}
 
-		Vector<4, T> getWXWY() const {
+		constexpr Vector<4, T> getWXWY() const {
 			return { v[3], v[0], v[3], v[1] };
 		}
 
-		Vector<4, T> getWXWZ() const {
+		constexpr Vector<4, T> getWXWZ() const {
 			return { v[3], v[0], v[3], v[2] };
 		}
 
-		Vector<4, T> getWXWW() const {
+		constexpr Vector<4, T> getWXWW() const {
 			return { v[3], v[0], v[3], v[3] };
 		}
 
-		Vector<4, T> getWYXX() const {
+		constexpr Vector<4, T> getWYXX() const {
 			return { v[3], v[1], v[0], v[0] };
 		}
 
-		Vector<4, T> getWYXY() const {
+		constexpr Vector<4, T> getWYXY() const {
 			return { v[3], v[1], v[0], v[1] };
 		}
 
-		Vector<4, T> getWYXZ() const {
+		constexpr Vector<4, T> getWYXZ() const {
 			return { v[3], v[1], v[0], v[2] };
 		}
 
-		Vector<4, T> getWYXW() const {
+		constexpr Vector<4, T> getWYXW() const {
 			return { v[3], v[1], v[0], v[3] };
 		}
 
-		Vector<4, T> getWYYX() const {
+		constexpr Vector<4, T> getWYYX() const {
 			return { v[3], v[1], v[1], v[0] };
 		}
 
-		Vector<4, T> getWYYY() const {
+		constexpr Vector<4, T> getWYYY() const {
 			return { v[3], v[1], v[1], v[1] };
 		}
 
-		Vector<4, T> getWYYZ() const {
+		constexpr Vector<4, T> getWYYZ() const {
 			return { v[3], v[1], v[1], v[2] };
 		}
 
-		Vector<4, T> getWYYW() const {
+		constexpr Vector<4, T> getWYYW() const {
 			return { v[3], v[1], v[1], v[3] };
 		}
 
-		Vector<4, T> getWYZX() const {
+		constexpr Vector<4, T> getWYZX() const {
 			return { v[3], v[1], v[2], v[0] };
 		}
 
-		Vector<4, T> getWYZY() const {
+		constexpr Vector<4, T> getWYZY() const {
 			return { v[3], v[1], v[2], v[1] };
 		}
 
-		Vector<4, T> getWYZZ() const {
+		constexpr Vector<4, T> getWYZZ() const {
 			return { v[3], v[1], v[2], v[2] };
 		}
 
-		Vector<4, T> getWYZW() const {
+		constexpr Vector<4, T> getWYZW() const {
 			return { v[3], v[1], v[2], v[3] };
 		}
 
-		Vector<4, T> getWYWX() const {
+		constexpr Vector<4, T> getWYWX() const {
 			return { v[3], v[1], v[3], v[0] };
 		}
 
-		Vector<4, T> getWYWY() const {
+		constexpr Vector<4, T> getWYWY() const {
 			return { v[3], v[1], v[3], v[1] };
 		}
 
-		Vector<4, T> getWYWZ() const {
+		constexpr Vector<4, T> getWYWZ() const {
 			return { v[3], v[1], v[3], v[2] };
 		}
 
-		Vector<4, T> getWYWW() const {
+		constexpr Vector<4, T> getWYWW() const {
 			return { v[3], v[1], v[3], v[3] };
 		}
 
-		Vector<4, T> getWZXX() const {
+		constexpr Vector<4, T> getWZXX() const {
 			return { v[3], v[2], v[0], v[0] };
 		}
 
-		Vector<4, T> getWZXY() const {
+		constexpr Vector<4, T> getWZXY() const {
 			return { v[3], v[2], v[0], v[1] };
 		}
 
-		Vector<4, T> getWZXZ() const {
+		constexpr Vector<4, T> getWZXZ() const {
 			return { v[3], v[2], v[0], v[2] };
 		}
 
-		Vector<4, T> getWZXW() const {
+		constexpr Vector<4, T> getWZXW() const {
 			return { v[3], v[2], v[0], v[3] };
 		}
 
-		Vector<4, T> getWZYX() const {
+		constexpr Vector<4, T> getWZYX() const {
 			return { v[3], v[2], v[1], v[0] };
 		}
 
-		Vector<4, T> getWZYY() const {
+		constexpr Vector<4, T> getWZYY() const {
 			return { v[3], v[2], v[1], v[1] };
 		}
 
-		Vector<4, T> getWZYZ() const {
+		constexpr Vector<4, T> getWZYZ() const {
 			return { v[3], v[2], v[1], v[2] };
 		}
 
-		Vector<4, T> getWZYW() const {
+		constexpr Vector<4, T> getWZYW() const {
 			return { v[3], v[2], v[1], v[3] };
 		}
 
-		Vector<4, T> getWZZX() const {
+		constexpr Vector<4, T> getWZZX() const {
 			return { v[3], v[2], v[2], v[0] };
 		}
 
-		Vector<4, T> getWZZY() const {
+		constexpr Vector<4, T> getWZZY() const {
 			return { v[3], v[2], v[2], v[1] };
 		}
 
-		Vector<4, T> getWZZZ() const {
+		constexpr Vector<4, T> getWZZZ() const {
 			return { v[3], v[2], v[2], v[2] };
 		}
 
-		Vector<4, T> getWZZW() const {
+		constexpr Vector<4, T> getWZZW() const {
 			return { v[3], v[2], v[2], v[3] };
 		}
 
-		Vector<4, T> getWZWX() const {
+		constexpr Vector<4, T> getWZWX() const {
 			return { v[3], v[2], v[3], v[0] };
 		}
 
-		Vector<4, T> getWZWY() const {
+		constexpr Vector<4, T> getWZWY() const {
 			return { v[3], v[2], v[3], v[1] };
 		}
 
-		Vector<4, T> getWZWZ() const {
+		constexpr Vector<4, T> getWZWZ() const {
 			return { v[3], v[2], v[3], v[2] };
 		}
 
-		Vector<4, T> getWZWW() const {
+		constexpr Vector<4, T> getWZWW() const {
 			return { v[3], v[2], v[3], v[3] };
 		}
 
-		Vector<4, T> getWWXX() const {
+		constexpr Vector<4, T> getWWXX() const {
 			return { v[3], v[3], v[0], v[0] };
 		}
 
-		Vector<4, T> getWWXY() const {
+		constexpr Vector<4, T> getWWXY() const {
 			return { v[3], v[3], v[0], v[1] };
 		}
 
-		Vector<4, T> getWWXZ() const {
+		constexpr Vector<4, T> getWWXZ() const {
 			return { v[3], v[3], v[0], v[2] };
 		}
 
-		Vector<4, T> getWWXW() const {
+		constexpr Vector<4, T> getWWXW() const {
 			return { v[3], v[3], v[0], v[3] };
 		}
 
-		Vector<4, T> getWWYX() const {
+		constexpr Vector<4, T> getWWYX() const {
 			return { v[3], v[3], v[1], v[0] };
 		}
 
-		Vector<4, T> getWWYY() const {
+		constexpr Vector<4, T> getWWYY() const {
 			return { v[3], v[3], v[1], v[1] };
 		}
 
-		Vector<4, T> getWWYZ() const {
+		constexpr Vector<4, T> getWWYZ() const {
 			return { v[3], v[3], v[1], v[2] };
 		}
 
-		Vector<4, T> getWWYW() const {
+		constexpr Vector<4, T> getWWYW() const {
 			return { v[3], v[3], v[1], v[3] };
 		}
 
-		Vector<4, T> getWWZX() const {
+		constexpr Vector<4, T> getWWZX() const {
 			return { v[3], v[3], v[2], v[0] };
 		}
 
-		Vector<4, T> getWWZY() const {
+		constexpr Vector<4, T> getWWZY() const {
 			return { v[3], v[3], v[2], v[1] };
 		}
 
-		Vector<4, T> getWWZZ() const {
+		constexpr Vector<4, T> getWWZZ() const {
 			return { v[3], v[3], v[2], v[2] };
 		}
 
-		Vector<4, T> getWWZW() const {
+		constexpr Vector<4, T> getWWZW() const {
 			return { v[3], v[3], v[2], v[3] };
 		}
 
-		Vector<4, T> getWWWX() const {
+		constexpr Vector<4, T> getWWWX() const {
 			return { v[3], v[3], v[3], v[0] };
 		}
 
-		Vector<4, T> getWWWY() const {
+		constexpr Vector<4, T> getWWWY() const {
 			return { v[3], v[3], v[3], v[1] };
 		}
 
-		Vector<4, T> getWWWZ() const {
+		constexpr Vector<4, T> getWWWZ() const {
 			return { v[3], v[3], v[3], v[2] };
 		}
 
-		Vector<4, T> getWWWW() const {
+		constexpr Vector<4, T> getWWWW() const {
 			return { v[3], v[3], v[3], v[3] };
 		}
-
-		virtual ~Vector() noexcept {
-			clean();
-		}
 };
 
 template <typename T>
-Vector<4, T> operator-(const Vector<4, T> & vector) {
+constexpr Vector<4, T> operator-(const Vector<4, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1],
@@ -3191,7 +3140,7 @@ Vector<4, T> operator-(const Vector<4, T> & vector) {
 }
 
 template <typename T>
-Vector<4, T> operator+(const Vector<4, T> & left, const Vector<4, T> & right) {
+constexpr Vector<4, T> operator+(const Vector<4, T> & left, const Vector<4, T> & right) {
 	return {
 		left.v[0] + right.v[0],
 		left.v[1] + right.v[1],
@@ -3201,7 +3150,7 @@ Vector<4, T> operator+(const Vector<4, T> & left, const Vector<4, T> & right) {
 }
 
 template <typename T>
-Vector<4, T> operator-(const Vector<4, T> & left, const Vector<4, T> & right) {
+constexpr Vector<4, T> operator-(const Vector<4, T> & left, const Vector<4, T> & right) {
 	return {
 		left.v[0] - right.v[0],
 		left.v[1] - right.v[1],
@@ -3211,7 +3160,7 @@ Vector<4, T> operator-(const Vector<4, T> & left, const Vector<4, T> & right) {
 }
 
 template <typename T>
-Vector<4, T> operator*(T left, const Vector<4, T> & right) {
+constexpr Vector<4, T> operator*(T left, const Vector<4, T> & right) {
 	return {
 		left * right.v[0],
 		left * right.v[1],
@@ -3221,7 +3170,7 @@ Vector<4, T> operator*(T left, const Vector<4, T> & right) {
 }
 
 template <typename T>
-Vector<4, T> operator*(const Vector<4, T> & left, T right) {
+constexpr Vector<4, T> operator*(const Vector<4, T> & left, T right) {
 	return {
 		left.v[0] * right,
 		left.v[1] * right,
@@ -3231,7 +3180,7 @@ Vector<4, T> operator*(const Vector<4, T> & left, T right) {
 }
 
 template <typename T>
-Vector<4, T> operator*(const Vector<4, T> & left, const Vector<4, T> & right) {
+constexpr Vector<4, T> operator*(const Vector<4, T> & left, const Vector<4, T> & right) {
 	return {
 		left.v[0] * right.v[0],
 		left.v[1] * right.v[1],
@@ -3241,7 +3190,7 @@ Vector<4, T> operator*(const Vector<4, T> & left, const Vector<4, T> & right) {
 }
 
 template <typename T>
-Vector<4, T> operator/(const Vector<4, T> & left, T right) {
+constexpr Vector<4, T> operator/(const Vector<4, T> & left, T right) {
 	return {
 		left.v[0] / right,
 		left.v[1] / right,
@@ -3251,7 +3200,7 @@ Vector<4, T> operator/(const Vector<4, T> & left, T right) {
 }
 
 template <typename T>
-Vector<4, T> operator/(const Vector<4, T> & left, const Vector<4, T> & right) {
+constexpr Vector<4, T> operator/(const Vector<4, T> & left, const Vector<4, T> & right) {
 	return {
 		left.v[0] / right.v[0],
 		left.v[1] / right.v[1],
@@ -3303,7 +3252,7 @@ Vector<4, T> & normalize(const Vector<4, T> & vector, Vector<4, T> & target) {
 }
 
 template <typename T>
-Vector<4, T> negate(const Vector<4, T> & vector) {
+constexpr Vector<4, T> negate(const Vector<4, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1],
@@ -3313,7 +3262,7 @@ Vector<4, T> negate(const Vector<4, T> & vector) {
 }
 
 template <typename T>
-Vector<4, T> & negate(const Vector<4, T> & vector, Vector<4, T> & target) {
+constexpr Vector<4, T> & negate(const Vector<4, T> & vector, Vector<4, T> & target) {
 	target.v[0] = -vector.v[0];
 	target.v[1] = -vector.v[1];
 	target.v[2] = -vector.v[2];
@@ -3322,7 +3271,7 @@ Vector<4, T> & negate(const Vector<4, T> & vector, Vector<4, T> & target) {
 }
 
 template <typename T>
-T dot(const Vector<4, T> & left, const Vector<4, T> & right) {
+constexpr T dot(const Vector<4, T> & left, const Vector<4, T> & right) {
 	return (
 		left.v[0] * right.v[0] +
 		left.v[1] * right.v[1] +
@@ -3332,7 +3281,7 @@ T dot(const Vector<4, T> & left, const Vector<4, T> & right) {
 }
 
 template <typename T>
-Vector<4, T> project(const Vector<4, T> & vector, const Vector<4, T> & projection) {
+constexpr Vector<4, T> project(const Vector<4, T> & vector, const Vector<4, T> & projection) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	return {
 		scalar * projection.v[0],
@@ -3343,7 +3292,7 @@ Vector<4, T> project(const Vector<4, T> & vector, const Vector<4, T> & projectio
 }
 
 template <typename T>
-Vector<4, T> & project(const Vector<4, T> & vector, const Vector<4, T> & projection, Vector<4, T> & target) {
+constexpr Vector<4, T> & project(const Vector<4, T> & vector, const Vector<4, T> & projection, Vector<4, T> & target) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	target.v[0] = scalar * projection.v[0];
 	target.v[1] = scalar * projection.v[1];
@@ -3353,7 +3302,7 @@ Vector<4, T> & project(const Vector<4, T> & vector, const Vector<4, T> & project
 }
 
 template <typename T>
-Vector<4, T> translate(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translate(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0]	+ translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -3363,7 +3312,7 @@ Vector<4, T> translate(const Vector<4, T> & vector, const Vector<4, T> & transla
 }
 
 template <typename T>
-Vector<4, T> & translate(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> & translate(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -3372,7 +3321,7 @@ Vector<4, T> & translate(const Vector<4, T> & vector, const Vector<4, T> & trans
 }
 
 template <typename T>
-Vector<4, T> scale(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scale(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -3382,7 +3331,7 @@ Vector<4, T> scale(const Vector<4, T> & vector, T scale) {
 }
 
 template <typename T>
-Vector<4, T> & scale(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> & scale(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -3391,7 +3340,7 @@ Vector<4, T> & scale(const Vector<4, T> & vector, T scale, Vector<4, T> & target
 }
 
 template <typename T>
-Vector<4, T> scale(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scale(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -3401,7 +3350,7 @@ Vector<4, T> scale(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 }
 
 template <typename T>
-Vector<4, T> & scale(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> & scale(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -3410,7 +3359,7 @@ Vector<4, T> & scale(const Vector<4, T> & vector, const Vector<4, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> setX(const Vector<4, T> & vector, T x) {
+constexpr Vector<4, T> setX(const Vector<4, T> & vector, T x) {
 	return {
 		x,
 		vector.v[1],
@@ -3420,7 +3369,7 @@ Vector<4, T> setX(const Vector<4, T> & vector, T x) {
 }
 
 template<typename T>
-Vector<4, T> setY(const Vector<4, T> & vector, T y) {
+constexpr Vector<4, T> setY(const Vector<4, T> & vector, T y) {
 	return {
 		vector.v[0],
 		y,
@@ -3430,7 +3379,7 @@ Vector<4, T> setY(const Vector<4, T> & vector, T y) {
 }
 
 template<typename T>
-Vector<4, T> setZ(const Vector<4, T> & vector, T z) {
+constexpr Vector<4, T> setZ(const Vector<4, T> & vector, T z) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3440,7 +3389,7 @@ Vector<4, T> setZ(const Vector<4, T> & vector, T z) {
 }
 
 template<typename T>
-Vector<4, T> setW(const Vector<4, T> & vector, T w) {
+constexpr Vector<4, T> setW(const Vector<4, T> & vector, T w) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3450,7 +3399,7 @@ Vector<4, T> setW(const Vector<4, T> & vector, T w) {
 }
 
 template<typename T>
-Vector<4, T> setXY(const Vector<4, T> & vector, T x, T y) {
+constexpr Vector<4, T> setXY(const Vector<4, T> & vector, T x, T y) {
 	return {
 		x,
 		y,
@@ -3460,7 +3409,7 @@ Vector<4, T> setXY(const Vector<4, T> & vector, T x, T y) {
 }
 
 template<typename T>
-Vector<4, T> setXY(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setXY(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[1],
@@ -3470,7 +3419,7 @@ Vector<4, T> setXY(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setXZ(const Vector<4, T> & vector, T x, T z) {
+constexpr Vector<4, T> setXZ(const Vector<4, T> & vector, T x, T z) {
 	return {
 		x,
 		vector.v[1],
@@ -3480,7 +3429,7 @@ Vector<4, T> setXZ(const Vector<4, T> & vector, T x, T z) {
 }
 
 template<typename T>
-Vector<4, T> setXZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setXZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -3490,7 +3439,7 @@ Vector<4, T> setXZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setXW(const Vector<4, T> & vector, T x, T w) {
+constexpr Vector<4, T> setXW(const Vector<4, T> & vector, T x, T w) {
 	return {
 		x,
 		vector.v[1],
@@ -3500,7 +3449,7 @@ Vector<4, T> setXW(const Vector<4, T> & vector, T x, T w) {
 }
 
 template<typename T>
-Vector<4, T> setXW(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setXW(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -3510,7 +3459,7 @@ Vector<4, T> setXW(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYX(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setYX(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[0],
@@ -3520,7 +3469,7 @@ Vector<4, T> setYX(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYZ(const Vector<4, T> & vector, T y, T z) {
+constexpr Vector<4, T> setYZ(const Vector<4, T> & vector, T y, T z) {
 	return {
 		vector.v[0],
 		y,
@@ -3530,7 +3479,7 @@ Vector<4, T> setYZ(const Vector<4, T> & vector, T y, T z) {
 }
 
 template<typename T>
-Vector<4, T> setYZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setYZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -3540,7 +3489,7 @@ Vector<4, T> setYZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYW(const Vector<4, T> & vector, T y, T w) {
+constexpr Vector<4, T> setYW(const Vector<4, T> & vector, T y, T w) {
 	return {
 		vector.v[0],
 		y,
@@ -3550,7 +3499,7 @@ Vector<4, T> setYW(const Vector<4, T> & vector, T y, T w) {
 }
 
 template<typename T>
-Vector<4, T> setYW(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setYW(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -3560,7 +3509,7 @@ Vector<4, T> setYW(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZX(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setZX(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -3570,7 +3519,7 @@ Vector<4, T> setZX(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZY(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setZY(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -3580,7 +3529,7 @@ Vector<4, T> setZY(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZW(const Vector<4, T> & vector, T z, T w) {
+constexpr Vector<4, T> setZW(const Vector<4, T> & vector, T z, T w) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3590,7 +3539,7 @@ Vector<4, T> setZW(const Vector<4, T> & vector, T z, T w) {
 }
 
 template<typename T>
-Vector<4, T> setZW(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setZW(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3600,7 +3549,7 @@ Vector<4, T> setZW(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWX(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setWX(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -3610,7 +3559,7 @@ Vector<4, T> setWX(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWY(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setWY(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -3620,7 +3569,7 @@ Vector<4, T> setWY(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
+constexpr Vector<4, T> setWZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3630,7 +3579,7 @@ Vector<4, T> setWZ(const Vector<4, T> & vector, const Vector<2, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setXYZ(const Vector<4, T> & vector, T x, T y, T z) {
+constexpr Vector<4, T> setXYZ(const Vector<4, T> & vector, T x, T y, T z) {
 	return {
 		x,
 		y,
@@ -3640,7 +3589,7 @@ Vector<4, T> setXYZ(const Vector<4, T> & vector, T x, T y, T z) {
 }
 
 template<typename T>
-Vector<4, T> setXYZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setXYZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[1],
@@ -3650,7 +3599,7 @@ Vector<4, T> setXYZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setXYW(const Vector<4, T> & vector, T x, T y, T w) {
+constexpr Vector<4, T> setXYW(const Vector<4, T> & vector, T x, T y, T w) {
 	return {
 		x,
 		y,
@@ -3660,7 +3609,7 @@ Vector<4, T> setXYW(const Vector<4, T> & vector, T x, T y, T w) {
 }
 
 template<typename T>
-Vector<4, T> setXYW(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setXYW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[1],
@@ -3670,7 +3619,7 @@ Vector<4, T> setXYW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setXZY(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setXZY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[2],
@@ -3680,7 +3629,7 @@ Vector<4, T> setXZY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setXZW(const Vector<4, T> & vector, T x, T z, T w) {
+constexpr Vector<4, T> setXZW(const Vector<4, T> & vector, T x, T z, T w) {
 	return {
 		x,
 		vector.v[1],
@@ -3690,7 +3639,7 @@ Vector<4, T> setXZW(const Vector<4, T> & vector, T x, T z, T w) {
 }
 
 template<typename T>
-Vector<4, T> setXZW(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setXZW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -3700,7 +3649,7 @@ Vector<4, T> setXZW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setXWY(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setXWY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[2],
@@ -3710,7 +3659,7 @@ Vector<4, T> setXWY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setXWZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setXWZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -3720,7 +3669,7 @@ Vector<4, T> setXWZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYXZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setYXZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[0],
@@ -3730,7 +3679,7 @@ Vector<4, T> setYXZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYXW(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setYXW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[0],
@@ -3740,7 +3689,7 @@ Vector<4, T> setYXW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYZX(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setYZX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[2],
 		   set.v[0],
@@ -3750,7 +3699,7 @@ Vector<4, T> setYZX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYZW(const Vector<4, T> & vector, T y, T z, T w) {
+constexpr Vector<4, T> setYZW(const Vector<4, T> & vector, T y, T z, T w) {
 	return {
 		vector.v[0],
 		y,
@@ -3760,7 +3709,7 @@ Vector<4, T> setYZW(const Vector<4, T> & vector, T y, T z, T w) {
 }
 
 template<typename T>
-Vector<4, T> setYZW(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setYZW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -3770,7 +3719,7 @@ Vector<4, T> setYZW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYWX(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setYWX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[2],
 		   set.v[0],
@@ -3780,7 +3729,7 @@ Vector<4, T> setYWX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setYWZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setYWZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -3790,7 +3739,7 @@ Vector<4, T> setYWZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZXY(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setZXY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[2],
@@ -3800,7 +3749,7 @@ Vector<4, T> setZXY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZXW(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setZXW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -3810,7 +3759,7 @@ Vector<4, T> setZXW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZYX(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setZYX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[2],
 		   set.v[1],
@@ -3820,7 +3769,7 @@ Vector<4, T> setZYX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZYW(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setZYW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -3830,7 +3779,7 @@ Vector<4, T> setZYW(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZWX(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setZWX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[2],
 		vector.v[1],
@@ -3840,7 +3789,7 @@ Vector<4, T> setZWX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setZWY(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setZWY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[2],
@@ -3850,7 +3799,7 @@ Vector<4, T> setZWY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWXY(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setWXY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[2],
@@ -3860,7 +3809,7 @@ Vector<4, T> setWXY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWXZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setWXZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -3870,7 +3819,7 @@ Vector<4, T> setWXZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWYX(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setWYX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[2],
 		   set.v[1],
@@ -3880,7 +3829,7 @@ Vector<4, T> setWYX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWYZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setWYZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -3890,7 +3839,7 @@ Vector<4, T> setWYZ(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWZX(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setWZX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		   set.v[2],
 		vector.v[1],
@@ -3900,7 +3849,7 @@ Vector<4, T> setWZX(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setWZY(const Vector<4, T> & vector, const Vector<3, T> & set) {
+constexpr Vector<4, T> setWZY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[2],
@@ -3910,7 +3859,7 @@ Vector<4, T> setWZY(const Vector<4, T> & vector, const Vector<3, T> & set) {
 }
 
 template<typename T>
-Vector<4, T> setX(const Vector<4, T> & vector, T x, Vector<4, T> & target) {
+constexpr Vector<4, T> setX(const Vector<4, T> & vector, T x, Vector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -3919,7 +3868,7 @@ Vector<4, T> setX(const Vector<4, T> & vector, T x, Vector<4, T> & target) {
 }
 
 template<typename T>
-Vector<4, T> setY(const Vector<4, T> & vector, T y, Vector<4, T> & target) {
+constexpr Vector<4, T> setY(const Vector<4, T> & vector, T y, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -3928,7 +3877,7 @@ Vector<4, T> setY(const Vector<4, T> & vector, T y, Vector<4, T> & target) {
 }
 
 template<typename T>
-Vector<4, T> setZ(const Vector<4, T> & vector, T z, Vector<4, T> & target) {
+constexpr Vector<4, T> setZ(const Vector<4, T> & vector, T z, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -3937,7 +3886,7 @@ Vector<4, T> setZ(const Vector<4, T> & vector, T z, Vector<4, T> & target) {
 }
 
 template<typename T>
-Vector<4, T> setW(const Vector<4, T> & vector, T w, Vector<4, T> & target) {
+constexpr Vector<4, T> setW(const Vector<4, T> & vector, T w, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -3946,7 +3895,7 @@ Vector<4, T> setW(const Vector<4, T> & vector, T w, Vector<4, T> & target) {
 }
 
 template<typename T>
-Vector<4, T> setXY(const Vector<4, T> & vector, T x, T y, Vector<4, T> & target) {
+constexpr Vector<4, T> setXY(const Vector<4, T> & vector, T x, T y, Vector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -3955,7 +3904,7 @@ Vector<4, T> setXY(const Vector<4, T> & vector, T x, T y, Vector<4, T> & target)
 }
 
 template<typename T>
-Vector<4, T> setXY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -3964,7 +3913,7 @@ Vector<4, T> setXY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setXZ(const Vector<4, T> & vector, T x, T z, Vector<4, T> & target) {
+constexpr Vector<4, T> setXZ(const Vector<4, T> & vector, T x, T z, Vector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -3973,7 +3922,7 @@ Vector<4, T> setXZ(const Vector<4, T> & vector, T x, T z, Vector<4, T> & target)
 }
 
 template<typename T>
-Vector<4, T> setXZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -3982,7 +3931,7 @@ Vector<4, T> setXZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setXW(const Vector<4, T> & vector, T x, T w, Vector<4, T> & target) {
+constexpr Vector<4, T> setXW(const Vector<4, T> & vector, T x, T w, Vector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -3991,7 +3940,7 @@ Vector<4, T> setXW(const Vector<4, T> & vector, T x, T w, Vector<4, T> & target)
 }
 
 template<typename T>
-Vector<4, T> setXW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -4000,7 +3949,7 @@ Vector<4, T> setXW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setYX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -4009,7 +3958,7 @@ Vector<4, T> setYX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setYZ(const Vector<4, T> & vector, T y, T z, Vector<4, T> & target) {
+constexpr Vector<4, T> setYZ(const Vector<4, T> & vector, T y, T z, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = z;
@@ -4018,7 +3967,7 @@ Vector<4, T> setYZ(const Vector<4, T> & vector, T y, T z, Vector<4, T> & target)
 }
 
 template<typename T>
-Vector<4, T> setYZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[1];
@@ -4027,7 +3976,7 @@ Vector<4, T> setYZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setYW(const Vector<4, T> & vector, T y, T w, Vector<4, T> & target) {
+constexpr Vector<4, T> setYW(const Vector<4, T> & vector, T y, T w, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -4036,7 +3985,7 @@ Vector<4, T> setYW(const Vector<4, T> & vector, T y, T w, Vector<4, T> & target)
 }
 
 template<typename T>
-Vector<4, T> setYW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -4045,7 +3994,7 @@ Vector<4, T> setYW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setZX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -4054,7 +4003,7 @@ Vector<4, T> setZX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setZY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[0];
@@ -4063,7 +4012,7 @@ Vector<4, T> setZY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setZW(const Vector<4, T> & vector, T z, T w, Vector<4, T> & target) {
+constexpr Vector<4, T> setZW(const Vector<4, T> & vector, T z, T w, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -4072,7 +4021,7 @@ Vector<4, T> setZW(const Vector<4, T> & vector, T z, T w, Vector<4, T> & target)
 }
 
 template<typename T>
-Vector<4, T> setZW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -4081,7 +4030,7 @@ Vector<4, T> setZW(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setWX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -4090,7 +4039,7 @@ Vector<4, T> setWX(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setWY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -4099,7 +4048,7 @@ Vector<4, T> setWY(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setWZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -4108,7 +4057,7 @@ Vector<4, T> setWZ(const Vector<4, T> & vector, const Vector<2, T> & set, Vector
 }
 
 template<typename T>
-Vector<4, T> setXYZ(const Vector<4, T> & vector, T x, T y, T z, Vector<4, T> & target) {
+constexpr Vector<4, T> setXYZ(const Vector<4, T> & vector, T x, T y, T z, Vector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = y;
 	target.v[2] = z;
@@ -4117,7 +4066,7 @@ Vector<4, T> setXYZ(const Vector<4, T> & vector, T x, T y, T z, Vector<4, T> & t
 }
 
 template<typename T>
-Vector<4, T> setXYZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXYZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[2];
@@ -4126,7 +4075,7 @@ Vector<4, T> setXYZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setXYW(const Vector<4, T> & vector, T x, T y, T w, Vector<4, T> & target) {
+constexpr Vector<4, T> setXYW(const Vector<4, T> & vector, T x, T y, T w, Vector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -4135,7 +4084,7 @@ Vector<4, T> setXYW(const Vector<4, T> & vector, T x, T y, T w, Vector<4, T> & t
 }
 
 template<typename T>
-Vector<4, T> setXYW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXYW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -4144,7 +4093,7 @@ Vector<4, T> setXYW(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setXZY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXZY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[2];
 	target.v[2] =    set.v[1];
@@ -4153,7 +4102,7 @@ Vector<4, T> setXZY(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setXZW(const Vector<4, T> & vector, T x, T z, T w, Vector<4, T> & target) {
+constexpr Vector<4, T> setXZW(const Vector<4, T> & vector, T x, T z, T w, Vector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -4162,7 +4111,7 @@ Vector<4, T> setXZW(const Vector<4, T> & vector, T x, T z, T w, Vector<4, T> & t
 }
 
 template<typename T>
-Vector<4, T> setXZW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXZW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -4171,7 +4120,7 @@ Vector<4, T> setXZW(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setXWY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXWY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[2];
 	target.v[2] = vector.v[2];
@@ -4180,7 +4129,7 @@ Vector<4, T> setXWY(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setXWZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setXWZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[2];
@@ -4189,7 +4138,7 @@ Vector<4, T> setXWZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setYXZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYXZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[2];
@@ -4198,7 +4147,7 @@ Vector<4, T> setYXZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setYXW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYXW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -4207,7 +4156,7 @@ Vector<4, T> setYXW(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setYZX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYZX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[1];
@@ -4216,7 +4165,7 @@ Vector<4, T> setYZX(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setYZW(const Vector<4, T> & vector, T y, T z, T w, Vector<4, T> & target) {
+constexpr Vector<4, T> setYZW(const Vector<4, T> & vector, T y, T z, T w, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = z;
@@ -4225,7 +4174,7 @@ Vector<4, T> setYZW(const Vector<4, T> & vector, T y, T z, T w, Vector<4, T> & t
 }
 
 template<typename T>
-Vector<4, T> setYZW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYZW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[1];
@@ -4234,7 +4183,7 @@ Vector<4, T> setYZW(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setYWX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYWX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -4243,7 +4192,7 @@ Vector<4, T> setYWX(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setYWZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setYWZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[2];
@@ -4252,7 +4201,7 @@ Vector<4, T> setYWZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setZXY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZXY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[2];
 	target.v[2] =    set.v[0];
@@ -4261,7 +4210,7 @@ Vector<4, T> setZXY(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setZXW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZXW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -4270,7 +4219,7 @@ Vector<4, T> setZXW(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setZYX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZYX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[0];
@@ -4279,7 +4228,7 @@ Vector<4, T> setZYX(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setZYW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZYW(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[0];
@@ -4288,7 +4237,7 @@ Vector<4, T> setZYW(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setZWX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZWX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -4297,7 +4246,7 @@ Vector<4, T> setZWX(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setZWY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setZWY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[2];
 	target.v[2] =    set.v[0];
@@ -4306,7 +4255,7 @@ Vector<4, T> setZWY(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setWXY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWXY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[2];
 	target.v[2] = vector.v[2];
@@ -4315,7 +4264,7 @@ Vector<4, T> setWXY(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setWXZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWXZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[2];
@@ -4324,7 +4273,7 @@ Vector<4, T> setWXZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setWYX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWYX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -4333,7 +4282,7 @@ Vector<4, T> setWYX(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setWYZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWYZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[2];
@@ -4342,7 +4291,7 @@ Vector<4, T> setWYZ(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setWZX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWZX(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -4351,7 +4300,7 @@ Vector<4, T> setWZX(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> setWZY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
+constexpr Vector<4, T> setWZY(const Vector<4, T> & vector, const Vector<3, T> & set, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[2];
 	target.v[2] =    set.v[1];
@@ -4360,7 +4309,7 @@ Vector<4, T> setWZY(const Vector<4, T> & vector, const Vector<3, T> & set, Vecto
 }
 
 template<typename T>
-Vector<4, T> translateX(const Vector<4, T> & vector, T translateX) {
+constexpr Vector<4, T> translateX(const Vector<4, T> & vector, T translateX) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -4370,7 +4319,7 @@ Vector<4, T> translateX(const Vector<4, T> & vector, T translateX) {
 }
 
 template<typename T>
-Vector<4, T> translateY(const Vector<4, T> & vector, T translateY) {
+constexpr Vector<4, T> translateY(const Vector<4, T> & vector, T translateY) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -4380,7 +4329,7 @@ Vector<4, T> translateY(const Vector<4, T> & vector, T translateY) {
 }
 
 template<typename T>
-Vector<4, T> translateZ(const Vector<4, T> & vector, T translateZ) {
+constexpr Vector<4, T> translateZ(const Vector<4, T> & vector, T translateZ) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4390,7 +4339,7 @@ Vector<4, T> translateZ(const Vector<4, T> & vector, T translateZ) {
 }
 
 template<typename T>
-Vector<4, T> translateW(const Vector<4, T> & vector, T translateW) {
+constexpr Vector<4, T> translateW(const Vector<4, T> & vector, T translateW) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4400,7 +4349,7 @@ Vector<4, T> translateW(const Vector<4, T> & vector, T translateW) {
 }
 
 template<typename T>
-Vector<4, T> translateXY(const Vector<4, T> & vector, T translateX, T translateY) {
+constexpr Vector<4, T> translateXY(const Vector<4, T> & vector, T translateX, T translateY) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -4410,7 +4359,7 @@ Vector<4, T> translateXY(const Vector<4, T> & vector, T translateX, T translateY
 }
 
 template<typename T>
-Vector<4, T> translateXY(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateXY(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4420,7 +4369,7 @@ Vector<4, T> translateXY(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateXZ(const Vector<4, T> & vector, T translateX, T translateZ) {
+constexpr Vector<4, T> translateXZ(const Vector<4, T> & vector, T translateX, T translateZ) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -4430,7 +4379,7 @@ Vector<4, T> translateXZ(const Vector<4, T> & vector, T translateX, T translateZ
 }
 
 template<typename T>
-Vector<4, T> translateXZ(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateXZ(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -4440,7 +4389,7 @@ Vector<4, T> translateXZ(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateXW(const Vector<4, T> & vector, T translateX, T translateW) {
+constexpr Vector<4, T> translateXW(const Vector<4, T> & vector, T translateX, T translateW) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -4450,7 +4399,7 @@ Vector<4, T> translateXW(const Vector<4, T> & vector, T translateX, T translateW
 }
 
 template<typename T>
-Vector<4, T> translateXW(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateXW(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -4460,7 +4409,7 @@ Vector<4, T> translateXW(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateYX(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateYX(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4470,7 +4419,7 @@ Vector<4, T> translateYX(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateYZ(const Vector<4, T> & vector, T translateY, T translateZ) {
+constexpr Vector<4, T> translateYZ(const Vector<4, T> & vector, T translateY, T translateZ) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -4480,7 +4429,7 @@ Vector<4, T> translateYZ(const Vector<4, T> & vector, T translateY, T translateZ
 }
 
 template<typename T>
-Vector<4, T> translateYZ(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateYZ(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -4490,7 +4439,7 @@ Vector<4, T> translateYZ(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateYW(const Vector<4, T> & vector, T translateY, T translateW) {
+constexpr Vector<4, T> translateYW(const Vector<4, T> & vector, T translateY, T translateW) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -4500,7 +4449,7 @@ Vector<4, T> translateYW(const Vector<4, T> & vector, T translateY, T translateW
 }
 
 template<typename T>
-Vector<4, T> translateYW(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateYW(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -4510,7 +4459,7 @@ Vector<4, T> translateYW(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateZX(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateZX(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -4520,7 +4469,7 @@ Vector<4, T> translateZX(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateZY(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateZY(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -4530,7 +4479,7 @@ Vector<4, T> translateZY(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateZW(const Vector<4, T> & vector, T translateZ, T translateW) {
+constexpr Vector<4, T> translateZW(const Vector<4, T> & vector, T translateZ, T translateW) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4540,7 +4489,7 @@ Vector<4, T> translateZW(const Vector<4, T> & vector, T translateZ, T translateW
 }
 
 template<typename T>
-Vector<4, T> translateZW(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateZW(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4550,7 +4499,7 @@ Vector<4, T> translateZW(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateWX(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateWX(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -4560,7 +4509,7 @@ Vector<4, T> translateWX(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateWY(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateWY(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -4570,7 +4519,7 @@ Vector<4, T> translateWY(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateWZ(const Vector<4, T> & vector, const Vector<2, T> & translate) {
+constexpr Vector<4, T> translateWZ(const Vector<4, T> & vector, const Vector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4580,7 +4529,7 @@ Vector<4, T> translateWZ(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateXYZ(const Vector<4, T> & vector, T translateX, T translateY, T translateZ) {
+constexpr Vector<4, T> translateXYZ(const Vector<4, T> & vector, T translateX, T translateY, T translateZ) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -4590,7 +4539,7 @@ Vector<4, T> translateXYZ(const Vector<4, T> & vector, T translateX, T translate
 }
 
 template<typename T>
-Vector<4, T> translateXYZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateXYZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4600,7 +4549,7 @@ Vector<4, T> translateXYZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXYW(const Vector<4, T> & vector, T translateX, T translateY, T translateW) {
+constexpr Vector<4, T> translateXYW(const Vector<4, T> & vector, T translateX, T translateY, T translateW) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -4610,7 +4559,7 @@ Vector<4, T> translateXYW(const Vector<4, T> & vector, T translateX, T translate
 }
 
 template<typename T>
-Vector<4, T> translateXYW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateXYW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4620,7 +4569,7 @@ Vector<4, T> translateXYW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXZY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateXZY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -4630,7 +4579,7 @@ Vector<4, T> translateXZY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXZW(const Vector<4, T> & vector, T translateX, T translateZ, T translateW) {
+constexpr Vector<4, T> translateXZW(const Vector<4, T> & vector, T translateX, T translateZ, T translateW) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -4640,7 +4589,7 @@ Vector<4, T> translateXZW(const Vector<4, T> & vector, T translateX, T translate
 }
 
 template<typename T>
-Vector<4, T> translateXZW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateXZW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -4650,7 +4599,7 @@ Vector<4, T> translateXZW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXWY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateXWY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -4660,7 +4609,7 @@ Vector<4, T> translateXWY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXWZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateXWZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -4670,7 +4619,7 @@ Vector<4, T> translateXWZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYXZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateYXZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4680,7 +4629,7 @@ Vector<4, T> translateYXZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYXW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateYXW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4690,7 +4639,7 @@ Vector<4, T> translateYXW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYZX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateYZX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -4700,7 +4649,7 @@ Vector<4, T> translateYZX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYZW(const Vector<4, T> & vector, T translateY, T translateZ, T translateW) {
+constexpr Vector<4, T> translateYZW(const Vector<4, T> & vector, T translateY, T translateZ, T translateW) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -4710,7 +4659,7 @@ Vector<4, T> translateYZW(const Vector<4, T> & vector, T translateY, T translate
 }
 
 template<typename T>
-Vector<4, T> translateYZW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateYZW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -4720,7 +4669,7 @@ Vector<4, T> translateYZW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYWX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateYWX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -4730,7 +4679,7 @@ Vector<4, T> translateYWX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYWZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateYWZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -4740,7 +4689,7 @@ Vector<4, T> translateYWZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZXY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateZXY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -4750,7 +4699,7 @@ Vector<4, T> translateZXY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZXW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateZXW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -4760,7 +4709,7 @@ Vector<4, T> translateZXW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZYX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateZYX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -4770,7 +4719,7 @@ Vector<4, T> translateZYX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZYW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateZYW(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -4780,7 +4729,7 @@ Vector<4, T> translateZYW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZWX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateZWX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1],
@@ -4790,7 +4739,7 @@ Vector<4, T> translateZWX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZWY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateZWY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[2],
@@ -4800,7 +4749,7 @@ Vector<4, T> translateZWY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWXY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateWXY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -4810,7 +4759,7 @@ Vector<4, T> translateWXY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWXZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateWXZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -4820,7 +4769,7 @@ Vector<4, T> translateWXZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWYX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateWYX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -4830,7 +4779,7 @@ Vector<4, T> translateWYX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWYZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateWYZ(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -4840,7 +4789,7 @@ Vector<4, T> translateWYZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWZX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateWZX(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1],
@@ -4850,7 +4799,7 @@ Vector<4, T> translateWZX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWZY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
+constexpr Vector<4, T> translateWZY(const Vector<4, T> & vector, const Vector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[2],
@@ -4860,7 +4809,7 @@ Vector<4, T> translateWZY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXYZW(const Vector<4, T> & vector, T translateX, T translateY, T translateZ, T translateW) {
+constexpr Vector<4, T> translateXYZW(const Vector<4, T> & vector, T translateX, T translateY, T translateZ, T translateW) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -4870,7 +4819,7 @@ Vector<4, T> translateXYZW(const Vector<4, T> & vector, T translateX, T translat
 }
 
 template<typename T>
-Vector<4, T> translateXYZW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateXYZW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4880,7 +4829,7 @@ Vector<4, T> translateXYZW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXYWZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateXYWZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4890,7 +4839,7 @@ Vector<4, T> translateXYWZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXZYW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateXZYW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -4900,7 +4849,7 @@ Vector<4, T> translateXZYW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXZWY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateXZWY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[3],
@@ -4910,7 +4859,7 @@ Vector<4, T> translateXZWY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXWYZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateXWYZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -4920,7 +4869,7 @@ Vector<4, T> translateXWYZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXWZY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateXWZY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[3],
@@ -4930,7 +4879,7 @@ Vector<4, T> translateXWZY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYXZW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateYXZW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4940,7 +4889,7 @@ Vector<4, T> translateYXZW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYXWZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateYXWZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4950,7 +4899,7 @@ Vector<4, T> translateYXWZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYZXW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateYZXW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -4960,7 +4909,7 @@ Vector<4, T> translateYZXW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYZWX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateYZWX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[0],
@@ -4970,7 +4919,7 @@ Vector<4, T> translateYZWX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYWXZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateYWXZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -4980,7 +4929,7 @@ Vector<4, T> translateYWXZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYWZX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateYWZX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[0],
@@ -4990,7 +4939,7 @@ Vector<4, T> translateYWZX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZXYW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateZXYW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -5000,7 +4949,7 @@ Vector<4, T> translateZXYW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZXWY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateZXWY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[3],
@@ -5010,7 +4959,7 @@ Vector<4, T> translateZXWY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZYXW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateZYXW(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -5020,7 +4969,7 @@ Vector<4, T> translateZYXW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZYWX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateZYWX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[1],
@@ -5030,7 +4979,7 @@ Vector<4, T> translateZYWX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZWXY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateZWXY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[3],
@@ -5040,7 +4989,7 @@ Vector<4, T> translateZWXY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZWYX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateZWYX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[2],
@@ -5050,7 +4999,7 @@ Vector<4, T> translateZWYX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWXYZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateWXYZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -5060,7 +5009,7 @@ Vector<4, T> translateWXYZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWXZY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateWXZY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[3],
@@ -5070,7 +5019,7 @@ Vector<4, T> translateWXZY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWYXZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateWYXZ(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -5080,7 +5029,7 @@ Vector<4, T> translateWYXZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWYZX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateWYZX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[1],
@@ -5090,7 +5039,7 @@ Vector<4, T> translateWYZX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWZXY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateWZXY(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[3],
@@ -5100,7 +5049,7 @@ Vector<4, T> translateWZXY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWZYX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
+constexpr Vector<4, T> translateWZYX(const Vector<4, T> & vector, const Vector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[2],
@@ -5110,7 +5059,7 @@ Vector<4, T> translateWZYX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateX(const Vector<4, T> & vector, T translateX, Vector<4, T> & target) {
+constexpr Vector<4, T> translateX(const Vector<4, T> & vector, T translateX, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5119,7 +5068,7 @@ Vector<4, T> translateX(const Vector<4, T> & vector, T translateX, Vector<4, T>
 }
 
 template<typename T>
-Vector<4, T> translateY(const Vector<4, T> & vector, T translateY, Vector<4, T> & target) {
+constexpr Vector<4, T> translateY(const Vector<4, T> & vector, T translateY, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -5128,7 +5077,7 @@ Vector<4, T> translateY(const Vector<4, T> & vector, T translateY, Vector<4, T>
 }
 
 template<typename T>
-Vector<4, T> translateZ(const Vector<4, T> & vector, T translateZ, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZ(const Vector<4, T> & vector, T translateZ, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -5137,7 +5086,7 @@ Vector<4, T> translateZ(const Vector<4, T> & vector, T translateZ, Vector<4, T>
 }
 
 template<typename T>
-Vector<4, T> translateW(const Vector<4, T> & vector, T translateW, Vector<4, T> & target) {
+constexpr Vector<4, T> translateW(const Vector<4, T> & vector, T translateW, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5146,7 +5095,7 @@ Vector<4, T> translateW(const Vector<4, T> & vector, T translateW, Vector<4, T>
 }
 
 template<typename T>
-Vector<4, T> translateXY(const Vector<4, T> & vector, T translateX, T translateY, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXY(const Vector<4, T> & vector, T translateX, T translateY, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -5155,7 +5104,7 @@ Vector<4, T> translateXY(const Vector<4, T> & vector, T translateX, T translateY
 }
 
 template<typename T>
-Vector<4, T> translateXY(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXY(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -5164,7 +5113,7 @@ Vector<4, T> translateXY(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateXZ(const Vector<4, T> & vector, T translateX, T translateZ, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXZ(const Vector<4, T> & vector, T translateX, T translateZ, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -5173,7 +5122,7 @@ Vector<4, T> translateXZ(const Vector<4, T> & vector, T translateX, T translateZ
 }
 
 template<typename T>
-Vector<4, T> translateXZ(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXZ(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5182,7 +5131,7 @@ Vector<4, T> translateXZ(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateXW(const Vector<4, T> & vector, T translateX, T translateW, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXW(const Vector<4, T> & vector, T translateX, T translateW, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5191,7 +5140,7 @@ Vector<4, T> translateXW(const Vector<4, T> & vector, T translateX, T translateW
 }
 
 template<typename T>
-Vector<4, T> translateXW(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXW(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5200,7 +5149,7 @@ Vector<4, T> translateXW(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateYX(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYX(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -5209,7 +5158,7 @@ Vector<4, T> translateYX(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateYZ(const Vector<4, T> & vector, T translateY, T translateZ, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYZ(const Vector<4, T> & vector, T translateY, T translateZ, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -5218,7 +5167,7 @@ Vector<4, T> translateYZ(const Vector<4, T> & vector, T translateY, T translateZ
 }
 
 template<typename T>
-Vector<4, T> translateYZ(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYZ(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5227,7 +5176,7 @@ Vector<4, T> translateYZ(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateYW(const Vector<4, T> & vector, T translateY, T translateW, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYW(const Vector<4, T> & vector, T translateY, T translateW, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -5236,7 +5185,7 @@ Vector<4, T> translateYW(const Vector<4, T> & vector, T translateY, T translateW
 }
 
 template<typename T>
-Vector<4, T> translateYW(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYW(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -5245,7 +5194,7 @@ Vector<4, T> translateYW(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateZX(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZX(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5254,7 +5203,7 @@ Vector<4, T> translateZX(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateZY(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZY(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5263,7 +5212,7 @@ Vector<4, T> translateZY(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateZW(const Vector<4, T> & vector, T translateZ, T translateW, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZW(const Vector<4, T> & vector, T translateZ, T translateW, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -5272,7 +5221,7 @@ Vector<4, T> translateZW(const Vector<4, T> & vector, T translateZ, T translateW
 }
 
 template<typename T>
-Vector<4, T> translateZW(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZW(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5281,7 +5230,7 @@ Vector<4, T> translateZW(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateWX(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWX(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5290,7 +5239,7 @@ Vector<4, T> translateWX(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateWY(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWY(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -5299,7 +5248,7 @@ Vector<4, T> translateWY(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateWZ(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWZ(const Vector<4, T> & vector, const Vector<2, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5308,7 +5257,7 @@ Vector<4, T> translateWZ(const Vector<4, T> & vector, const Vector<2, T> & trans
 }
 
 template<typename T>
-Vector<4, T> translateXYZ(const Vector<4, T> & vector, T translateX, T translateY, T translateZ, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXYZ(const Vector<4, T> & vector, T translateX, T translateY, T translateZ, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -5317,7 +5266,7 @@ Vector<4, T> translateXYZ(const Vector<4, T> & vector, T translateX, T translate
 }
 
 template<typename T>
-Vector<4, T> translateXYZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXYZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5326,7 +5275,7 @@ Vector<4, T> translateXYZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXYW(const Vector<4, T> & vector, T translateX, T translateY, T translateW, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXYW(const Vector<4, T> & vector, T translateX, T translateY, T translateW, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -5335,7 +5284,7 @@ Vector<4, T> translateXYW(const Vector<4, T> & vector, T translateX, T translate
 }
 
 template<typename T>
-Vector<4, T> translateXYW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXYW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -5344,7 +5293,7 @@ Vector<4, T> translateXYW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXZY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXZY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5353,7 +5302,7 @@ Vector<4, T> translateXZY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXZW(const Vector<4, T> & vector, T translateX, T translateZ, T translateW, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXZW(const Vector<4, T> & vector, T translateX, T translateZ, T translateW, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -5362,7 +5311,7 @@ Vector<4, T> translateXZW(const Vector<4, T> & vector, T translateX, T translate
 }
 
 template<typename T>
-Vector<4, T> translateXZW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXZW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5371,7 +5320,7 @@ Vector<4, T> translateXZW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXWY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXWY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2];
@@ -5380,7 +5329,7 @@ Vector<4, T> translateXWY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXWZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXWZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5389,7 +5338,7 @@ Vector<4, T> translateXWZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYXZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYXZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5398,7 +5347,7 @@ Vector<4, T> translateYXZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYXW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYXW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -5407,7 +5356,7 @@ Vector<4, T> translateYXW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYZX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYZX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5416,7 +5365,7 @@ Vector<4, T> translateYZX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYZW(const Vector<4, T> & vector, T translateY, T translateZ, T translateW, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYZW(const Vector<4, T> & vector, T translateY, T translateZ, T translateW, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -5425,7 +5374,7 @@ Vector<4, T> translateYZW(const Vector<4, T> & vector, T translateY, T translate
 }
 
 template<typename T>
-Vector<4, T> translateYZW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYZW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5434,7 +5383,7 @@ Vector<4, T> translateYZW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYWX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYWX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -5443,7 +5392,7 @@ Vector<4, T> translateYWX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateYWZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYWZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5452,7 +5401,7 @@ Vector<4, T> translateYWZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZXY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZXY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5461,7 +5410,7 @@ Vector<4, T> translateZXY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZXW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZXW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5470,7 +5419,7 @@ Vector<4, T> translateZXW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZYX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZYX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5479,7 +5428,7 @@ Vector<4, T> translateZYX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZYW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZYW(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5488,7 +5437,7 @@ Vector<4, T> translateZYW(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZWX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZWX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5497,7 +5446,7 @@ Vector<4, T> translateZWX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateZWY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZWY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5506,7 +5455,7 @@ Vector<4, T> translateZWY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWXY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWXY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2];
@@ -5515,7 +5464,7 @@ Vector<4, T> translateWXY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWXZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWXZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5524,7 +5473,7 @@ Vector<4, T> translateWXZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWYX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWYX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -5533,7 +5482,7 @@ Vector<4, T> translateWYX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWYZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWYZ(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5542,7 +5491,7 @@ Vector<4, T> translateWYZ(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWZX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWZX(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5551,7 +5500,7 @@ Vector<4, T> translateWZX(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateWZY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWZY(const Vector<4, T> & vector, const Vector<3, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5560,7 +5509,7 @@ Vector<4, T> translateWZY(const Vector<4, T> & vector, const Vector<3, T> & tran
 }
 
 template<typename T>
-Vector<4, T> translateXYZW(const Vector<4, T> & vector, T translateX, T translateY, T translateZ, T translateW, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXYZW(const Vector<4, T> & vector, T translateX, T translateY, T translateZ, T translateW, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -5569,7 +5518,7 @@ Vector<4, T> translateXYZW(const Vector<4, T> & vector, T translateX, T translat
 }
 
 template<typename T>
-Vector<4, T> translateXYZW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXYZW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5578,7 +5527,7 @@ Vector<4, T> translateXYZW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXYWZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXYWZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5587,7 +5536,7 @@ Vector<4, T> translateXYWZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXZYW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXZYW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5596,7 +5545,7 @@ Vector<4, T> translateXZYW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXZWY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXZWY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5605,7 +5554,7 @@ Vector<4, T> translateXZWY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXWYZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXWYZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5614,7 +5563,7 @@ Vector<4, T> translateXWYZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateXWZY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateXWZY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5623,7 +5572,7 @@ Vector<4, T> translateXWZY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYXZW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYXZW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5632,7 +5581,7 @@ Vector<4, T> translateYXZW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYXWZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYXWZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5641,7 +5590,7 @@ Vector<4, T> translateYXWZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYZXW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYZXW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5650,7 +5599,7 @@ Vector<4, T> translateYZXW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYZWX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYZWX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5659,7 +5608,7 @@ Vector<4, T> translateYZWX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYWXZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYWXZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5668,7 +5617,7 @@ Vector<4, T> translateYWXZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateYWZX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateYWZX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5677,7 +5626,7 @@ Vector<4, T> translateYWZX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZXYW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZXYW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5686,7 +5635,7 @@ Vector<4, T> translateZXYW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZXWY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZXWY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5695,7 +5644,7 @@ Vector<4, T> translateZXWY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZYXW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZYXW(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5704,7 +5653,7 @@ Vector<4, T> translateZYXW(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZYWX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZYWX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5713,7 +5662,7 @@ Vector<4, T> translateZYWX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZWXY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZWXY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5722,7 +5671,7 @@ Vector<4, T> translateZWXY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateZWYX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateZWYX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5731,7 +5680,7 @@ Vector<4, T> translateZWYX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWXYZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWXYZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5740,7 +5689,7 @@ Vector<4, T> translateWXYZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWXZY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWXZY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5749,7 +5698,7 @@ Vector<4, T> translateWXZY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWYXZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWYXZ(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5758,7 +5707,7 @@ Vector<4, T> translateWYXZ(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWYZX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWYZX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5767,7 +5716,7 @@ Vector<4, T> translateWYZX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWZXY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWZXY(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5776,7 +5725,7 @@ Vector<4, T> translateWZXY(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> translateWZYX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
+constexpr Vector<4, T> translateWZYX(const Vector<4, T> & vector, const Vector<4, T> & translate, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5785,7 +5734,7 @@ Vector<4, T> translateWZYX(const Vector<4, T> & vector, const Vector<4, T> & tra
 }
 
 template<typename T>
-Vector<4, T> scaleX(const Vector<4, T> & vector, T scaleX) {
+constexpr Vector<4, T> scaleX(const Vector<4, T> & vector, T scaleX) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -5795,7 +5744,7 @@ Vector<4, T> scaleX(const Vector<4, T> & vector, T scaleX) {
 }
 
 template<typename T>
-Vector<4, T> scaleY(const Vector<4, T> & vector, T scaleY) {
+constexpr Vector<4, T> scaleY(const Vector<4, T> & vector, T scaleY) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -5805,7 +5754,7 @@ Vector<4, T> scaleY(const Vector<4, T> & vector, T scaleY) {
 }
 
 template<typename T>
-Vector<4, T> scaleZ(const Vector<4, T> & vector, T scaleZ) {
+constexpr Vector<4, T> scaleZ(const Vector<4, T> & vector, T scaleZ) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -5815,7 +5764,7 @@ Vector<4, T> scaleZ(const Vector<4, T> & vector, T scaleZ) {
 }
 
 template<typename T>
-Vector<4, T> scaleW(const Vector<4, T> & vector, T scaleW) {
+constexpr Vector<4, T> scaleW(const Vector<4, T> & vector, T scaleW) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -5825,7 +5774,7 @@ Vector<4, T> scaleW(const Vector<4, T> & vector, T scaleW) {
 }
 
 template<typename T>
-Vector<4, T> scaleXY(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleXY(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -5835,7 +5784,7 @@ Vector<4, T> scaleXY(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXY(const Vector<4, T> & vector, T scaleX, T scaleY) {
+constexpr Vector<4, T> scaleXY(const Vector<4, T> & vector, T scaleX, T scaleY) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -5845,7 +5794,7 @@ Vector<4, T> scaleXY(const Vector<4, T> & vector, T scaleX, T scaleY) {
 }
 
 template<typename T>
-Vector<4, T> scaleXY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleXY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -5855,7 +5804,7 @@ Vector<4, T> scaleXY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1],
@@ -5865,7 +5814,7 @@ Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scaleX, T scaleZ) {
+constexpr Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scaleX, T scaleZ) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -5875,7 +5824,7 @@ Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scaleX, T scaleZ) {
 }
 
 template<typename T>
-Vector<4, T> scaleXZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleXZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -5885,7 +5834,7 @@ Vector<4, T> scaleXZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXW(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleXW(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1],
@@ -5895,7 +5844,7 @@ Vector<4, T> scaleXW(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXW(const Vector<4, T> & vector, T scaleX, T scaleW) {
+constexpr Vector<4, T> scaleXW(const Vector<4, T> & vector, T scaleX, T scaleW) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -5905,7 +5854,7 @@ Vector<4, T> scaleXW(const Vector<4, T> & vector, T scaleX, T scaleW) {
 }
 
 template<typename T>
-Vector<4, T> scaleXW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleXW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -5915,7 +5864,7 @@ Vector<4, T> scaleXW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleYX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -5925,7 +5874,7 @@ Vector<4, T> scaleYX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale,
@@ -5935,7 +5884,7 @@ Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scaleY, T scaleZ) {
+constexpr Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scaleY, T scaleZ) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -5945,7 +5894,7 @@ Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scaleY, T scaleZ) {
 }
 
 template<typename T>
-Vector<4, T> scaleYZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleYZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -5955,7 +5904,7 @@ Vector<4, T> scaleYZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYW(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleYW(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale,
@@ -5965,7 +5914,7 @@ Vector<4, T> scaleYW(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYW(const Vector<4, T> & vector, T scaleY, T scaleW) {
+constexpr Vector<4, T> scaleYW(const Vector<4, T> & vector, T scaleY, T scaleW) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -5975,7 +5924,7 @@ Vector<4, T> scaleYW(const Vector<4, T> & vector, T scaleY, T scaleW) {
 }
 
 template<typename T>
-Vector<4, T> scaleYW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleYW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -5985,7 +5934,7 @@ Vector<4, T> scaleYW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleZX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -5995,7 +5944,7 @@ Vector<4, T> scaleZX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleZY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -6005,7 +5954,7 @@ Vector<4, T> scaleZY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZW(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleZW(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -6015,7 +5964,7 @@ Vector<4, T> scaleZW(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZW(const Vector<4, T> & vector, T scaleZ, T scaleW) {
+constexpr Vector<4, T> scaleZW(const Vector<4, T> & vector, T scaleZ, T scaleW) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -6025,7 +5974,7 @@ Vector<4, T> scaleZW(const Vector<4, T> & vector, T scaleZ, T scaleW) {
 }
 
 template<typename T>
-Vector<4, T> scaleZW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleZW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -6035,7 +5984,7 @@ Vector<4, T> scaleZW(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleWX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -6045,7 +5994,7 @@ Vector<4, T> scaleWX(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleWY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -6055,7 +6004,7 @@ Vector<4, T> scaleWY(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
+constexpr Vector<4, T> scaleWZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -6065,7 +6014,7 @@ Vector<4, T> scaleWZ(const Vector<4, T> & vector, const Vector<2, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -6075,7 +6024,7 @@ Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ) {
+constexpr Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -6085,7 +6034,7 @@ Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ)
 }
 
 template<typename T>
-Vector<4, T> scaleXYZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleXYZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -6095,7 +6044,7 @@ Vector<4, T> scaleXYZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -6105,7 +6054,7 @@ Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleW) {
+constexpr Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleW) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -6115,7 +6064,7 @@ Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleW)
 }
 
 template<typename T>
-Vector<4, T> scaleXYW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleXYW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -6125,7 +6074,7 @@ Vector<4, T> scaleXYW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXZY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleXZY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -6135,7 +6084,7 @@ Vector<4, T> scaleXZY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1],
@@ -6145,7 +6094,7 @@ Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scaleX, T scaleZ, T scaleW) {
+constexpr Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scaleX, T scaleZ, T scaleW) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -6155,7 +6104,7 @@ Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scaleX, T scaleZ, T scaleW)
 }
 
 template<typename T>
-Vector<4, T> scaleXZW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleXZW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -6165,7 +6114,7 @@ Vector<4, T> scaleXZW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXWY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleXWY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -6175,7 +6124,7 @@ Vector<4, T> scaleXWY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXWZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleXWZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -6185,7 +6134,7 @@ Vector<4, T> scaleXWZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYXZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleYXZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -6195,7 +6144,7 @@ Vector<4, T> scaleYXZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYXW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleYXW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -6205,7 +6154,7 @@ Vector<4, T> scaleYXW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYZX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleYZX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -6215,7 +6164,7 @@ Vector<4, T> scaleYZX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale,
@@ -6225,7 +6174,7 @@ Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scaleY, T scaleZ, T scaleW) {
+constexpr Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scaleY, T scaleZ, T scaleW) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -6235,7 +6184,7 @@ Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scaleY, T scaleZ, T scaleW)
 }
 
 template<typename T>
-Vector<4, T> scaleYZW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleYZW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -6245,7 +6194,7 @@ Vector<4, T> scaleYZW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYWX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleYWX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -6255,7 +6204,7 @@ Vector<4, T> scaleYWX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleYWZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleYWZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -6265,7 +6214,7 @@ Vector<4, T> scaleYWZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZXY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleZXY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -6275,7 +6224,7 @@ Vector<4, T> scaleZXY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZXW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleZXW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -6285,7 +6234,7 @@ Vector<4, T> scaleZXW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZYX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleZYX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -6295,7 +6244,7 @@ Vector<4, T> scaleZYX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZYW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleZYW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -6305,7 +6254,7 @@ Vector<4, T> scaleZYW(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZWX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleZWX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1],
@@ -6315,7 +6264,7 @@ Vector<4, T> scaleZWX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleZWY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleZWY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[2],
@@ -6325,7 +6274,7 @@ Vector<4, T> scaleZWY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWXY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleWXY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -6335,7 +6284,7 @@ Vector<4, T> scaleWXY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWXZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleWXZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -6345,7 +6294,7 @@ Vector<4, T> scaleWXZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWYX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleWYX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -6355,7 +6304,7 @@ Vector<4, T> scaleWYX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWYZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleWYZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -6365,7 +6314,7 @@ Vector<4, T> scaleWYZ(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWZX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleWZX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1],
@@ -6375,7 +6324,7 @@ Vector<4, T> scaleWZX(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleWZY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
+constexpr Vector<4, T> scaleWZY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[2],
@@ -6385,7 +6334,7 @@ Vector<4, T> scaleWZY(const Vector<4, T> & vector, const Vector<3, T> & scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scale) {
+constexpr Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -6395,7 +6344,7 @@ Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ, T scaleW) {
+constexpr Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ, T scaleW) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -6405,7 +6354,7 @@ Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ
 }
 
 template<typename T>
-Vector<4, T> scaleXYZW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleXYZW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -6415,7 +6364,7 @@ Vector<4, T> scaleXYZW(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleXYWZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleXYWZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -6425,7 +6374,7 @@ Vector<4, T> scaleXYWZ(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleXZYW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleXZYW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -6435,7 +6384,7 @@ Vector<4, T> scaleXZYW(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleXZWY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleXZWY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[3],
@@ -6445,7 +6394,7 @@ Vector<4, T> scaleXZWY(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleXWYZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleXWYZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -6455,7 +6404,7 @@ Vector<4, T> scaleXWYZ(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleXWZY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleXWZY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[3],
@@ -6465,7 +6414,7 @@ Vector<4, T> scaleXWZY(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleYXZW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleYXZW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -6475,7 +6424,7 @@ Vector<4, T> scaleYXZW(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleYXWZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleYXWZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -6485,7 +6434,7 @@ Vector<4, T> scaleYXWZ(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleYZXW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleYZXW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -6495,7 +6444,7 @@ Vector<4, T> scaleYZXW(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleYZWX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleYZWX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[0],
@@ -6505,7 +6454,7 @@ Vector<4, T> scaleYZWX(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleYWXZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleYWXZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -6515,7 +6464,7 @@ Vector<4, T> scaleYWXZ(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleYWZX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleYWZX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[0],
@@ -6525,7 +6474,7 @@ Vector<4, T> scaleYWZX(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleZXYW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleZXYW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -6535,7 +6484,7 @@ Vector<4, T> scaleZXYW(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleZXWY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleZXWY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[3],
@@ -6545,7 +6494,7 @@ Vector<4, T> scaleZXWY(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleZYXW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleZYXW(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -6555,7 +6504,7 @@ Vector<4, T> scaleZYXW(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleZYWX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleZYWX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[1],
@@ -6565,7 +6514,7 @@ Vector<4, T> scaleZYWX(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleZWXY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleZWXY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[3],
@@ -6575,7 +6524,7 @@ Vector<4, T> scaleZWXY(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleZWYX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleZWYX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[2],
@@ -6585,7 +6534,7 @@ Vector<4, T> scaleZWYX(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleWXYZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleWXYZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -6595,7 +6544,7 @@ Vector<4, T> scaleWXYZ(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleWXZY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleWXZY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[3],
@@ -6605,7 +6554,7 @@ Vector<4, T> scaleWXZY(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleWYXZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleWYXZ(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -6615,7 +6564,7 @@ Vector<4, T> scaleWYXZ(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleWYZX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleWYZX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[1],
@@ -6625,7 +6574,7 @@ Vector<4, T> scaleWYZX(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleWZXY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleWZXY(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[3],
@@ -6635,7 +6584,7 @@ Vector<4, T> scaleWZXY(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleWZYX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
+constexpr Vector<4, T> scaleWZYX(const Vector<4, T> & vector, const Vector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[2],
@@ -6645,7 +6594,7 @@ Vector<4, T> scaleWZYX(const Vector<4, T> & vector, const Vector<4, T> & scale)
 }
 
 template<typename T>
-Vector<4, T> scaleX(const Vector<4, T> & vector, T scaleX, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleX(const Vector<4, T> & vector, T scaleX, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6654,7 +6603,7 @@ Vector<4, T> scaleX(const Vector<4, T> & vector, T scaleX, const Vector<4, T> &
 }
 
 template<typename T>
-Vector<4, T> scaleY(const Vector<4, T> & vector, T scaleY, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleY(const Vector<4, T> & vector, T scaleY, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -6663,7 +6612,7 @@ Vector<4, T> scaleY(const Vector<4, T> & vector, T scaleY, const Vector<4, T> &
 }
 
 template<typename T>
-Vector<4, T> scaleZ(const Vector<4, T> & vector, T scaleZ, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZ(const Vector<4, T> & vector, T scaleZ, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6672,7 +6621,7 @@ Vector<4, T> scaleZ(const Vector<4, T> & vector, T scaleZ, const Vector<4, T> &
 }
 
 template<typename T>
-Vector<4, T> scaleW(const Vector<4, T> & vector, T scaleW, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleW(const Vector<4, T> & vector, T scaleW, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6681,7 +6630,7 @@ Vector<4, T> scaleW(const Vector<4, T> & vector, T scaleW, const Vector<4, T> &
 }
 
 template<typename T>
-Vector<4, T> scaleXY(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXY(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2];
@@ -6690,7 +6639,7 @@ Vector<4, T> scaleXY(const Vector<4, T> & vector, T scale, Vector<4, T> & target
 }
 
 template<typename T>
-Vector<4, T> scaleXY(const Vector<4, T> & vector, T scaleX, T scaleY, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXY(const Vector<4, T> & vector, T scaleX, T scaleY, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -6699,7 +6648,7 @@ Vector<4, T> scaleXY(const Vector<4, T> & vector, T scaleX, T scaleY, const Vect
 }
 
 template<typename T>
-Vector<4, T> scaleXY(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXY(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -6708,7 +6657,7 @@ Vector<4, T> scaleXY(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale;
@@ -6717,7 +6666,7 @@ Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scale, Vector<4, T> & target
 }
 
 template<typename T>
-Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scaleX, T scaleZ, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scaleX, T scaleZ, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6726,7 +6675,7 @@ Vector<4, T> scaleXZ(const Vector<4, T> & vector, T scaleX, T scaleZ, const Vect
 }
 
 template<typename T>
-Vector<4, T> scaleXZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6735,7 +6684,7 @@ Vector<4, T> scaleXZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleXW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6744,7 +6693,7 @@ Vector<4, T> scaleXW(const Vector<4, T> & vector, T scale, Vector<4, T> & target
 }
 
 template<typename T>
-Vector<4, T> scaleXW(const Vector<4, T> & vector, T scaleX, T scaleW, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXW(const Vector<4, T> & vector, T scaleX, T scaleW, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6753,7 +6702,7 @@ Vector<4, T> scaleXW(const Vector<4, T> & vector, T scaleX, T scaleW, const Vect
 }
 
 template<typename T>
-Vector<4, T> scaleXW(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXW(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6762,7 +6711,7 @@ Vector<4, T> scaleXW(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleYX(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYX(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -6771,7 +6720,7 @@ Vector<4, T> scaleYX(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -6780,7 +6729,7 @@ Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scale, Vector<4, T> & target
 }
 
 template<typename T>
-Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scaleY, T scaleZ, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scaleY, T scaleZ, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6789,7 +6738,7 @@ Vector<4, T> scaleYZ(const Vector<4, T> & vector, T scaleY, T scaleZ, const Vect
 }
 
 template<typename T>
-Vector<4, T> scaleYZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6798,7 +6747,7 @@ Vector<4, T> scaleYZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleYW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2];
@@ -6807,7 +6756,7 @@ Vector<4, T> scaleYW(const Vector<4, T> & vector, T scale, Vector<4, T> & target
 }
 
 template<typename T>
-Vector<4, T> scaleYW(const Vector<4, T> & vector, T scaleY, T scaleW, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYW(const Vector<4, T> & vector, T scaleY, T scaleW, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -6816,7 +6765,7 @@ Vector<4, T> scaleYW(const Vector<4, T> & vector, T scaleY, T scaleW, const Vect
 }
 
 template<typename T>
-Vector<4, T> scaleYW(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYW(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -6825,7 +6774,7 @@ Vector<4, T> scaleYW(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleZX(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZX(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -6834,7 +6783,7 @@ Vector<4, T> scaleZX(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleZY(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZY(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -6843,7 +6792,7 @@ Vector<4, T> scaleZY(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale;
@@ -6852,7 +6801,7 @@ Vector<4, T> scaleZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target
 }
 
 template<typename T>
-Vector<4, T> scaleZW(const Vector<4, T> & vector, T scaleZ, T scaleW, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZW(const Vector<4, T> & vector, T scaleZ, T scaleW, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6861,7 +6810,7 @@ Vector<4, T> scaleZW(const Vector<4, T> & vector, T scaleZ, T scaleW, const Vect
 }
 
 template<typename T>
-Vector<4, T> scaleZW(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZW(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -6870,7 +6819,7 @@ Vector<4, T> scaleZW(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleWX(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWX(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6879,7 +6828,7 @@ Vector<4, T> scaleWX(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleWY(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWY(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -6888,7 +6837,7 @@ Vector<4, T> scaleWY(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleWZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6897,7 +6846,7 @@ Vector<4, T> scaleWZ(const Vector<4, T> & vector, const Vector<2, T> & scale, Ve
 }
 
 template<typename T>
-Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -6906,7 +6855,7 @@ Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scale, Vector<4, T> & targe
 }
 
 template<typename T>
-Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6915,7 +6864,7 @@ Vector<4, T> scaleXYZ(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ,
 }
 
 template<typename T>
-Vector<4, T> scaleXYZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -6924,7 +6873,7 @@ Vector<4, T> scaleXYZ(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2];
@@ -6933,7 +6882,7 @@ Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scale, Vector<4, T> & targe
 }
 
 template<typename T>
-Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleW, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleW, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -6942,7 +6891,7 @@ Vector<4, T> scaleXYW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleW,
 }
 
 template<typename T>
-Vector<4, T> scaleXYW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -6951,7 +6900,7 @@ Vector<4, T> scaleXYW(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleXZY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6960,7 +6909,7 @@ Vector<4, T> scaleXZY(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale;
@@ -6969,7 +6918,7 @@ Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scale, Vector<4, T> & targe
 }
 
 template<typename T>
-Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scaleX, T scaleZ, T scaleW, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scaleX, T scaleZ, T scaleW, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6978,7 +6927,7 @@ Vector<4, T> scaleXZW(const Vector<4, T> & vector, T scaleX, T scaleZ, T scaleW,
 }
 
 template<typename T>
-Vector<4, T> scaleXZW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6987,7 +6936,7 @@ Vector<4, T> scaleXZW(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleXWY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXWY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2];
@@ -6996,7 +6945,7 @@ Vector<4, T> scaleXWY(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleXWZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXWZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7005,7 +6954,7 @@ Vector<4, T> scaleXWZ(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleYXZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYXZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7014,7 +6963,7 @@ Vector<4, T> scaleYXZ(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleYXW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYXW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -7023,7 +6972,7 @@ Vector<4, T> scaleYXW(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleYZX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7032,7 +6981,7 @@ Vector<4, T> scaleYZX(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -7041,7 +6990,7 @@ Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scale, Vector<4, T> & targe
 }
 
 template<typename T>
-Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scaleY, T scaleZ, T scaleW, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scaleY, T scaleZ, T scaleW, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -7050,7 +6999,7 @@ Vector<4, T> scaleYZW(const Vector<4, T> & vector, T scaleY, T scaleZ, T scaleW,
 }
 
 template<typename T>
-Vector<4, T> scaleYZW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7059,7 +7008,7 @@ Vector<4, T> scaleYZW(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleYWX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYWX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -7068,7 +7017,7 @@ Vector<4, T> scaleYWX(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleYWZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYWZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7077,7 +7026,7 @@ Vector<4, T> scaleYWZ(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleZXY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZXY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7086,7 +7035,7 @@ Vector<4, T> scaleZXY(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleZXW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZXW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7095,7 +7044,7 @@ Vector<4, T> scaleZXW(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleZYX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZYX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7104,7 +7053,7 @@ Vector<4, T> scaleZYX(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleZYW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZYW(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7113,7 +7062,7 @@ Vector<4, T> scaleZYW(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleZWX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZWX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7122,7 +7071,7 @@ Vector<4, T> scaleZWX(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleZWY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZWY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7131,7 +7080,7 @@ Vector<4, T> scaleZWY(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleWXY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWXY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2];
@@ -7140,7 +7089,7 @@ Vector<4, T> scaleWXY(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleWXZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWXZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7149,7 +7098,7 @@ Vector<4, T> scaleWXZ(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleWYX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWYX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -7158,7 +7107,7 @@ Vector<4, T> scaleWYX(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleWYZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWYZ(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7167,7 +7116,7 @@ Vector<4, T> scaleWYZ(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleWZX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWZX(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7176,7 +7125,7 @@ Vector<4, T> scaleWZX(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleWZY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWZY(const Vector<4, T> & vector, const Vector<3, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7185,7 +7134,7 @@ Vector<4, T> scaleWZY(const Vector<4, T> & vector, const Vector<3, T> & scale, V
 }
 
 template<typename T>
-Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -7194,7 +7143,7 @@ Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scale, Vector<4, T> & targ
 }
 
 template<typename T>
-Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ, T scaleW, const Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ, T scaleW, const Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -7203,7 +7152,7 @@ Vector<4, T> scaleXYZW(const Vector<4, T> & vector, T scaleX, T scaleY, T scaleZ
 }
 
 template<typename T>
-Vector<4, T> scaleXYZW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYZW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7212,7 +7161,7 @@ Vector<4, T> scaleXYZW(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleXYWZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXYWZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7221,7 +7170,7 @@ Vector<4, T> scaleXYWZ(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleXZYW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZYW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7230,7 +7179,7 @@ Vector<4, T> scaleXZYW(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleXZWY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXZWY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7239,7 +7188,7 @@ Vector<4, T> scaleXZWY(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleXWYZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXWYZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7248,7 +7197,7 @@ Vector<4, T> scaleXWYZ(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleXWZY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleXWZY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7257,7 +7206,7 @@ Vector<4, T> scaleXWZY(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleYXZW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYXZW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7266,7 +7215,7 @@ Vector<4, T> scaleYXZW(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleYXWZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYXWZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7275,7 +7224,7 @@ Vector<4, T> scaleYXWZ(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleYZXW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZXW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7284,7 +7233,7 @@ Vector<4, T> scaleYZXW(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleYZWX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYZWX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7293,7 +7242,7 @@ Vector<4, T> scaleYZWX(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleYWXZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYWXZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7302,7 +7251,7 @@ Vector<4, T> scaleYWXZ(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleYWZX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleYWZX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7311,7 +7260,7 @@ Vector<4, T> scaleYWZX(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleZXYW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZXYW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7320,7 +7269,7 @@ Vector<4, T> scaleZXYW(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleZXWY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZXWY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7329,7 +7278,7 @@ Vector<4, T> scaleZXWY(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleZYXW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZYXW(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7338,7 +7287,7 @@ Vector<4, T> scaleZYXW(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleZYWX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZYWX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7347,7 +7296,7 @@ Vector<4, T> scaleZYWX(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleZWXY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZWXY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7356,7 +7305,7 @@ Vector<4, T> scaleZWXY(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleZWYX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleZWYX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7365,7 +7314,7 @@ Vector<4, T> scaleZWYX(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleWXYZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWXYZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7374,7 +7323,7 @@ Vector<4, T> scaleWXYZ(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleWXZY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWXZY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7383,7 +7332,7 @@ Vector<4, T> scaleWXZY(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleWYXZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWYXZ(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7392,7 +7341,7 @@ Vector<4, T> scaleWYXZ(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleWYZX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWYZX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7401,7 +7350,7 @@ Vector<4, T> scaleWYZX(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleWZXY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWZXY(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7410,7 +7359,7 @@ Vector<4, T> scaleWZXY(const Vector<4, T> & vector, const Vector<4, T> & scale,
 }
 
 template<typename T>
-Vector<4, T> scaleWZYX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
+constexpr Vector<4, T> scaleWZYX(const Vector<4, T> & vector, const Vector<4, T> & scale, Vector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
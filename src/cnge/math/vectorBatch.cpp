@@ -0,0 +1,318 @@
+
+#include "vectorBatch.h"
+
+namespace VectorBatchKernels {
+	namespace Scalar {
+		static void add(const f32 * left, const f32 * right, f32 * out, size begin, size count) {
+			for (auto i = begin; i < count; ++i)
+				out[i] = left[i] + right[i];
+		}
+
+		static void fma(const f32 * left, const f32 * right, const f32 * add, f32 * out, size begin, size count) {
+			for (auto i = begin; i < count; ++i)
+				out[i] = left[i] * right[i] + add[i];
+		}
+
+		static void fma(const f32 * left, f32 right, const f32 * add, f32 * out, size begin, size count) {
+			for (auto i = begin; i < count; ++i)
+				out[i] = left[i] * right + add[i];
+		}
+
+		static void dot(const f32 * left, const f32 * right, f32 * out, u32 dimensions, size stride, size begin, size length) {
+			for (auto i = begin; i < length; ++i) {
+				auto sum = 0.f;
+				for (auto j = 0_u32; j < dimensions; ++j)
+					sum += left[j * stride + i] * right[j * stride + i];
+				out[i] = sum;
+			}
+		}
+
+		static void normalize(const f32 * batch, f32 * out, u32 dimensions, size stride, size begin) {
+			for (auto i = begin; i < stride; ++i) {
+				auto lengthSquared = 0.f;
+				for (auto j = 0_u32; j < dimensions; ++j)
+					lengthSquared += batch[j * stride + i] * batch[j * stride + i];
+				auto scalar = 1 / std::sqrt(lengthSquared);
+				for (auto j = 0_u32; j < dimensions; ++j)
+					out[j * stride + i] = batch[j * stride + i] * scalar;
+			}
+		}
+
+		static void transform(const Matrix<4, 4, f32> & matrix, const f32 * batch, f32 * out, u32 dimensions, size stride, size begin) {
+			for (auto i = begin; i < stride; ++i) {
+				f32 point[4] = { 0, 0, 0, 1 };
+				for (auto j = 0_u32; j < dimensions; ++j)
+					point[j] = batch[j * stride + i];
+				for (auto j = 0_u32; j < dimensions; ++j)
+					out[j * stride + i] = matrix.m[j] * point[0] + matrix.m[4 + j] * point[1] + matrix.m[8 + j] * point[2] + matrix.m[12 + j] * point[3];
+			}
+		}
+	}
+
+#if CNGE_MATH_SSE
+	/* four vectors per register */
+	namespace Sse {
+		static size add(const f32 * left, const f32 * right, f32 * out, size count) {
+			auto i = 0_size;
+			for (; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(left + i), _mm_loadu_ps(right + i)));
+			return i;
+		}
+
+		static size fma(const f32 * left, const f32 * right, const f32 * add, f32 * out, size count) {
+			auto i = 0_size;
+			for (; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(left + i), _mm_loadu_ps(right + i)), _mm_loadu_ps(add + i)));
+			return i;
+		}
+
+		static size fma(const f32 * left, f32 right, const f32 * add, f32 * out, size count) {
+			auto scalar = _mm_set1_ps(right);
+			auto i = 0_size;
+			for (; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(left + i), scalar), _mm_loadu_ps(add + i)));
+			return i;
+		}
+
+		template <u32 N>
+		static size dot(const f32 * left, const f32 * right, f32 * out, size stride, size length) {
+			auto i = 0_size;
+			for (; i + 4 <= length; i += 4) {
+				auto sum = _mm_mul_ps(_mm_loadu_ps(left + i), _mm_loadu_ps(right + i));
+				for (auto j = 1_u32; j < N; ++j)
+					sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(left + j * stride + i), _mm_loadu_ps(right + j * stride + i)));
+				_mm_storeu_ps(out + i, sum);
+			}
+			return i;
+		}
+
+		template <u32 N>
+		static size normalize(const f32 * batch, f32 * out, size stride) {
+			auto one = _mm_set1_ps(1);
+			auto i = 0_size;
+			for (; i + 4 <= stride; i += 4) {
+				__m128 components[N];
+				auto lengthSquared = _mm_setzero_ps();
+				for (auto j = 0_u32; j < N; ++j) {
+					components[j] = _mm_loadu_ps(batch + j * stride + i);
+					lengthSquared = _mm_add_ps(lengthSquared, _mm_mul_ps(components[j], components[j]));
+				}
+				auto scalar = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+				for (auto j = 0_u32; j < N; ++j)
+					_mm_storeu_ps(out + j * stride + i, _mm_mul_ps(components[j], scalar));
+			}
+			return i;
+		}
+
+		template <u32 N>
+		static size transform(const Matrix<4, 4, f32> & matrix, const f32 * batch, f32 * out, size stride) {
+			/* the matrix is broadcast once up front, out may alias batch so it can't be left to the compiler */
+			__m128 columns[4][N];
+			for (auto k = 0_u32; k < 4; ++k)
+				for (auto j = 0_u32; j < N; ++j)
+					columns[k][j] = _mm_set1_ps(matrix.m[k * 4 + j]);
+
+			auto i = 0_size;
+			for (; i + 4 <= stride; i += 4) {
+				__m128 components[N];
+				for (auto j = 0_u32; j < N; ++j)
+					components[j] = _mm_loadu_ps(batch + j * stride + i);
+
+				/* every row is worked out before any are stored so out may be batch */
+				__m128 rows[N];
+				for (auto j = 0_u32; j < N; ++j) {
+					/* w is 1 unless the batch has its own */
+					auto row = N > 3 ? _mm_mul_ps(columns[3][j], components[N - 1]) : columns[3][j];
+					for (auto k = 0_u32; k < N && k < 3; ++k)
+						row = _mm_add_ps(row, _mm_mul_ps(columns[k][j], components[k]));
+					rows[j] = row;
+				}
+				for (auto j = 0_u32; j < N; ++j)
+					_mm_storeu_ps(out + j * stride + i, rows[j]);
+			}
+			return i;
+		}
+	}
+
+	/* eight vectors per register */
+	namespace Avx2 {
+		CNGE_TARGET_AVX2
+		static size add(const f32 * left, const f32 * right, f32 * out, size count) {
+			auto i = 0_size;
+			for (; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(left + i), _mm256_loadu_ps(right + i)));
+			return i;
+		}
+
+		CNGE_TARGET_AVX2
+		static size fma(const f32 * left, const f32 * right, const f32 * add, f32 * out, size count) {
+			auto i = 0_size;
+			for (; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_loadu_ps(left + i), _mm256_loadu_ps(right + i), _mm256_loadu_ps(add + i)));
+			return i;
+		}
+
+		CNGE_TARGET_AVX2
+		static size fma(const f32 * left, f32 right, const f32 * add, f32 * out, size count) {
+			auto scalar = _mm256_set1_ps(right);
+			auto i = 0_size;
+			for (; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_loadu_ps(left + i), scalar, _mm256_loadu_ps(add + i)));
+			return i;
+		}
+
+		template <u32 N>
+		CNGE_TARGET_AVX2
+		static size dot(const f32 * left, const f32 * right, f32 * out, size stride, size length) {
+			auto i = 0_size;
+			for (; i + 8 <= length; i += 8) {
+				auto sum = _mm256_mul_ps(_mm256_loadu_ps(left + i), _mm256_loadu_ps(right + i));
+				for (auto j = 1_u32; j < N; ++j)
+					sum = _mm256_fmadd_ps(_mm256_loadu_ps(left + j * stride + i), _mm256_loadu_ps(right + j * stride + i), sum);
+				_mm256_storeu_ps(out + i, sum);
+			}
+			return i;
+		}
+
+		template <u32 N>
+		CNGE_TARGET_AVX2
+		static size normalize(const f32 * batch, f32 * out, size stride) {
+			auto one = _mm256_set1_ps(1);
+			auto i = 0_size;
+			for (; i + 8 <= stride; i += 8) {
+				__m256 components[N];
+				auto lengthSquared = _mm256_setzero_ps();
+				for (auto j = 0_u32; j < N; ++j) {
+					components[j] = _mm256_loadu_ps(batch + j * stride + i);
+					lengthSquared = _mm256_fmadd_ps(components[j], components[j], lengthSquared);
+				}
+				auto scalar = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared));
+				for (auto j = 0_u32; j < N; ++j)
+					_mm256_storeu_ps(out + j * stride + i, _mm256_mul_ps(components[j], scalar));
+			}
+			return i;
+		}
+
+		template <u32 N>
+		CNGE_TARGET_AVX2
+		static size transform(const Matrix<4, 4, f32> & matrix, const f32 * batch, f32 * out, size stride) {
+			__m256 columns[4][N];
+			for (auto k = 0_u32; k < 4; ++k)
+				for (auto j = 0_u32; j < N; ++j)
+					columns[k][j] = _mm256_set1_ps(matrix.m[k * 4 + j]);
+
+			auto i = 0_size;
+			for (; i + 8 <= stride; i += 8) {
+				__m256 components[N];
+				for (auto j = 0_u32; j < N; ++j)
+					components[j] = _mm256_loadu_ps(batch + j * stride + i);
+
+				__m256 rows[N];
+				for (auto j = 0_u32; j < N; ++j) {
+					auto row = N > 3 ? _mm256_mul_ps(columns[3][j], components[N - 1]) : columns[3][j];
+					for (auto k = 0_u32; k < N && k < 3; ++k)
+						row = _mm256_fmadd_ps(columns[k][j], components[k], row);
+					rows[j] = row;
+				}
+				for (auto j = 0_u32; j < N; ++j)
+					_mm256_storeu_ps(out + j * stride + i, rows[j]);
+			}
+			return i;
+		}
+	}
+#endif
+
+	/* each returns how far it got, the scalar loops pick up the tail */
+	static size simdAdd(const f32 * left, const f32 * right, f32 * out, size count) {
+	#if CNGE_MATH_SSE
+		return CNGE::Cpu::hasAvx2() ? Avx2::add(left, right, out, count) : Sse::add(left, right, out, count);
+	#else
+		return 0;
+	#endif
+	}
+
+	static size simdFma(const f32 * left, const f32 * right, const f32 * add, f32 * out, size count) {
+	#if CNGE_MATH_SSE
+		return CNGE::Cpu::hasAvx2() ? Avx2::fma(left, right, add, out, count) : Sse::fma(left, right, add, out, count);
+	#else
+		return 0;
+	#endif
+	}
+
+	static size simdFma(const f32 * left, f32 right, const f32 * add, f32 * out, size count) {
+	#if CNGE_MATH_SSE
+		return CNGE::Cpu::hasAvx2() ? Avx2::fma(left, right, add, out, count) : Sse::fma(left, right, add, out, count);
+	#else
+		return 0;
+	#endif
+	}
+
+	template <u32 N>
+	static size simdDot(const f32 * left, const f32 * right, f32 * out, size stride, size length) {
+	#if CNGE_MATH_SSE
+		return CNGE::Cpu::hasAvx2() ? Avx2::dot<N>(left, right, out, stride, length) : Sse::dot<N>(left, right, out, stride, length);
+	#else
+		return 0;
+	#endif
+	}
+
+	template <u32 N>
+	static size simdNormalize(const f32 * batch, f32 * out, size stride) {
+	#if CNGE_MATH_SSE
+		return CNGE::Cpu::hasAvx2() ? Avx2::normalize<N>(batch, out, stride) : Sse::normalize<N>(batch, out, stride);
+	#else
+		return 0;
+	#endif
+	}
+
+	template <u32 N>
+	static size simdTransform(const Matrix<4, 4, f32> & matrix, const f32 * batch, f32 * out, size stride) {
+	#if CNGE_MATH_SSE
+		return CNGE::Cpu::hasAvx2() ? Avx2::transform<N>(matrix, batch, out, stride) : Sse::transform<N>(matrix, batch, out, stride);
+	#else
+		return 0;
+	#endif
+	}
+
+	void add(const f32 * left, const f32 * right, f32 * out, size count) {
+		Scalar::add(left, right, out, simdAdd(left, right, out, count), count);
+	}
+
+	void fma(const f32 * left, const f32 * right, const f32 * add, f32 * out, size count) {
+		Scalar::fma(left, right, add, out, simdFma(left, right, add, out, count), count);
+	}
+
+	void fma(const f32 * left, f32 right, const f32 * add, f32 * out, size count) {
+		Scalar::fma(left, right, add, out, simdFma(left, right, add, out, count), count);
+	}
+
+	void dot(const f32 * left, const f32 * right, f32 * out, u32 dimensions, size stride, size length) {
+		auto done = 0_size;
+		switch (dimensions) {
+			case 2: done = simdDot<2>(left, right, out, stride, length); break;
+			case 3: done = simdDot<3>(left, right, out, stride, length); break;
+			case 4: done = simdDot<4>(left, right, out, stride, length); break;
+		}
+		Scalar::dot(left, right, out, dimensions, stride, done, length);
+	}
+
+	void normalize(const f32 * batch, f32 * out, u32 dimensions, size stride) {
+		auto done = 0_size;
+		switch (dimensions) {
+			case 2: done = simdNormalize<2>(batch, out, stride); break;
+			case 3: done = simdNormalize<3>(batch, out, stride); break;
+			case 4: done = simdNormalize<4>(batch, out, stride); break;
+		}
+		Scalar::normalize(batch, out, dimensions, stride, done);
+	}
+
+	void transform(const Matrix<4, 4, f32> & matrix, const f32 * batch, f32 * out, u32 dimensions, size stride) {
+		auto done = 0_size;
+		switch (dimensions) {
+			case 2: done = simdTransform<2>(matrix, batch, out, stride); break;
+			case 3: done = simdTransform<3>(matrix, batch, out, stride); break;
+			case 4: done = simdTransform<4>(matrix, batch, out, stride); break;
+		}
+		Scalar::transform(matrix, batch, out, dimensions, stride, done);
+	}
+}
@@ -0,0 +1,268 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CNGE_VECTOR_BATCH
+#define CNGE_VECTOR_BATCH
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "types.h"
+#include "vector2.h"
+#include "vector3.h"
+#include "vector4.h"
+#include "matrix4.h"
+
+/// N component vectors stored as structure of arrays, every x back to back,
+/// then every y, and so on, so batch operations can fill whole simd registers
+///
+/// each component array is padded out to a multiple of LANES, the padding
+/// is worked on along with everything else and never read back
+template <u32 N, typename T>
+class VectorBatch {
+
+	static_assert(N > 1 && N < 5, "VectorBatch holds 2, 3 or 4 component vectors!");
+
+	public:
+		static constexpr u32 LANES = 8;
+
+		VectorBatch() :
+			length(0),
+			stride(0),
+			storage() {}
+
+		explicit VectorBatch(u32 length) :
+			length(length),
+			stride(padded(length)),
+			storage(N * stride) {}
+
+		VectorBatch(const VectorBatch<N, T> & batch) = default;
+		VectorBatch(VectorBatch<N, T> && batch) noexcept = default;
+
+		VectorBatch<N, T> & operator=(const VectorBatch<N, T> & batch) = default;
+		VectorBatch<N, T> & operator=(VectorBatch<N, T> && batch) noexcept = default;
+
+		/// the array of one component, batch[0] is every x
+		T * operator[](u32 dimension) noexcept {
+			return storage.data() + dimension * stride;
+		}
+
+		const T * operator[](u32 dimension) const noexcept {
+			return storage.data() + dimension * stride;
+		}
+
+		T * x() noexcept { return (*this)[0]; }
+		T * y() noexcept { return (*this)[1]; }
+		T * z() noexcept { static_assert(N > 2, "VectorBatch has no z!"); return (*this)[2]; }
+		T * w() noexcept { static_assert(N > 3, "VectorBatch has no w!"); return (*this)[3]; }
+
+		const T * x() const noexcept { return (*this)[0]; }
+		const T * y() const noexcept { return (*this)[1]; }
+		const T * z() const noexcept { static_assert(N > 2, "VectorBatch has no z!"); return (*this)[2]; }
+		const T * w() const noexcept { static_assert(N > 3, "VectorBatch has no w!"); return (*this)[3]; }
+
+		/// every component array back to back, N * getStride() values
+		T * data() noexcept {
+			return storage.data();
+		}
+
+		const T * data() const noexcept {
+			return storage.data();
+		}
+
+		u32 getLength() const noexcept {
+			return length;
+		}
+
+		u32 getStride() const noexcept {
+			return stride;
+		}
+
+		/// keeps the first min(length, newLength) vectors, new ones are zero
+		void resize(u32 newLength) {
+			auto newStride = padded(newLength);
+			if (newStride != stride) {
+				auto newStorage = std::vector<T>(N * newStride);
+				auto keep = newLength < length ? newLength : length;
+				for (u32 i = 0; i < N; ++i)
+					std::copy(storage.begin() + i * stride, storage.begin() + i * stride + keep, newStorage.begin() + i * newStride);
+				storage = std::move(newStorage);
+				stride  = newStride;
+			}
+			else {
+				for (u32 i = 0; i < N; ++i)
+					std::fill(storage.begin() + i * stride + newLength, storage.begin() + i * stride + stride, T());
+			}
+			length = newLength;
+		}
+
+		/// gathers one vector out of the component arrays
+		Vector<N, T> get(u32 index) const {
+			auto vector = Vector<N, T>();
+			for (u32 i = 0; i < N; ++i)
+				vector.v[i] = (*this)[i][index];
+			return vector;
+		}
+
+		/// scatters one vector into the component arrays
+		void set(u32 index, const Vector<N, T> & vector) {
+			for (u32 i = 0; i < N; ++i)
+				(*this)[i][index] = vector.v[i];
+		}
+
+	private:
+		u32 length;
+		u32 stride;
+		std::vector<T> storage;
+
+		static u32 padded(u32 length) {
+			return (length + LANES - 1) / LANES * LANES;
+		}
+};
+
+/// the float batch loops, simd where the processor allows
+///
+/// add and fma see the batch as one flat run of values, so they don't care
+/// how many components there are, the rest walk the component arrays
+/// stride values apart
+namespace VectorBatchKernels {
+	void add(const f32 * left, const f32 * right, f32 * out, size count);
+	void fma(const f32 * left, const f32 * right, const f32 * add, f32 * out, size count);
+	void fma(const f32 * left, f32 right, const f32 * add, f32 * out, size count);
+	void dot(const f32 * left, const f32 * right, f32 * out, u32 dimensions, size stride, size length);
+	void normalize(const f32 * batch, f32 * out, u32 dimensions, size stride);
+	void transform(const Matrix<4, 4, f32> & matrix, const f32 * batch, f32 * out, u32 dimensions, size stride);
+}
+
+/* every batch passed to one of these has to be the same length, target may be an input */
+
+template <u32 N, typename T>
+VectorBatch<N, T> & add(const VectorBatch<N, T> & left, const VectorBatch<N, T> & right, VectorBatch<N, T> & target) {
+	for (u32 i = 0; i < N * target.getStride(); ++i)
+		target.data()[i] = left.data()[i] + right.data()[i];
+	return target;
+}
+
+/// left * right + add, componentwise
+template <u32 N, typename T>
+VectorBatch<N, T> & fma(const VectorBatch<N, T> & left, const VectorBatch<N, T> & right, const VectorBatch<N, T> & add, VectorBatch<N, T> & target) {
+	for (u32 i = 0; i < N * target.getStride(); ++i)
+		target.data()[i] = left.data()[i] * right.data()[i] + add.data()[i];
+	return target;
+}
+
+/// left * right + add, e.g. velocities * delta + positions
+template <u32 N, typename T>
+VectorBatch<N, T> & fma(const VectorBatch<N, T> & left, T right, const VectorBatch<N, T> & add, VectorBatch<N, T> & target) {
+	for (u32 i = 0; i < N * target.getStride(); ++i)
+		target.data()[i] = left.data()[i] * right + add.data()[i];
+	return target;
+}
+
+/// target gets getLength() values
+template <u32 N, typename T>
+T * dot(const VectorBatch<N, T> & left, const VectorBatch<N, T> & right, T * target) {
+	for (u32 i = 0; i < left.getLength(); ++i) {
+		target[i] = 0;
+		for (u32 j = 0; j < N; ++j)
+			target[i] += left[j][i] * right[j][i];
+	}
+	return target;
+}
+
+template <u32 N, typename T>
+VectorBatch<N, T> & normalize(const VectorBatch<N, T> & batch, VectorBatch<N, T> & target) {
+	for (u32 i = 0; i < batch.getStride(); ++i) {
+		auto lengthSquared = T();
+		for (u32 j = 0; j < N; ++j)
+			lengthSquared += batch[j][i] * batch[j][i];
+		auto scalar = 1 / sqrt(lengthSquared);
+		for (u32 j = 0; j < N; ++j)
+			target[j][i] = batch[j][i] * scalar;
+	}
+	return target;
+}
+
+/// matrix * each vector, missing components are taken as z = 0 and w = 1
+/// so 2 and 3 component batches transform as points
+template <u32 N, typename T>
+VectorBatch<N, T> & transform(const Matrix<4, 4, T> & matrix, const VectorBatch<N, T> & batch, VectorBatch<N, T> & target) {
+	for (u32 i = 0; i < batch.getStride(); ++i) {
+		auto point = Vector<4, T>(0, 0, 0, 1);
+		for (u32 j = 0; j < N; ++j)
+			point.v[j] = batch[j][i];
+		point = matrix * point;
+		for (u32 j = 0; j < N; ++j)
+			target[j][i] = point.v[j];
+	}
+	return target;
+}
+
+template <u32 N>
+VectorBatch<N, f32> & add(const VectorBatch<N, f32> & left, const VectorBatch<N, f32> & right, VectorBatch<N, f32> & target) {
+	VectorBatchKernels::add(left.data(), right.data(), target.data(), N * target.getStride());
+	return target;
+}
+
+template <u32 N>
+VectorBatch<N, f32> & fma(const VectorBatch<N, f32> & left, const VectorBatch<N, f32> & right, const VectorBatch<N, f32> & add, VectorBatch<N, f32> & target) {
+	VectorBatchKernels::fma(left.data(), right.data(), add.data(), target.data(), N * target.getStride());
+	return target;
+}
+
+template <u32 N>
+VectorBatch<N, f32> & fma(const VectorBatch<N, f32> & left, f32 right, const VectorBatch<N, f32> & add, VectorBatch<N, f32> & target) {
+	VectorBatchKernels::fma(left.data(), right, add.data(), target.data(), N * target.getStride());
+	return target;
+}
+
+template <u32 N>
+f32 * dot(const VectorBatch<N, f32> & left, const VectorBatch<N, f32> & right, f32 * target) {
+	VectorBatchKernels::dot(left.data(), right.data(), target, N, left.getStride(), left.getLength());
+	return target;
+}
+
+template <u32 N>
+VectorBatch<N, f32> & normalize(const VectorBatch<N, f32> & batch, VectorBatch<N, f32> & target) {
+	VectorBatchKernels::normalize(batch.data(), target.data(), N, batch.getStride());
+	return target;
+}
+
+template <u32 N>
+VectorBatch<N, f32> & transform(const Matrix<4, 4, f32> & matrix, const VectorBatch<N, f32> & batch, VectorBatch<N, f32> & target) {
+	VectorBatchKernels::transform(matrix, batch.data(), target.data(), N, batch.getStride());
+	return target;
+}
+
+using VectorBatch2f = VectorBatch<2, f32>;
+using VectorBatch3f = VectorBatch<3, f32>;
+using VectorBatch4f = VectorBatch<4, f32>;
+using VectorBatch2d = VectorBatch<2, f64>;
+using VectorBatch3d = VectorBatch<3, f64>;
+using VectorBatch4d = VectorBatch<4, f64>;
+
+#endif // CNGE_VECTOR_BATCH
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CNGE_VECTOR_EXPRESSION
+#define CNGE_VECTOR_EXPRESSION
+
+#include <type_traits>
+#include <functional>
+
+#include "types.h"
+
+template <u32 N, typename T>
+class Vector;
+
+/// base of everything that can stand in for a Vector<N, T> in arithmetic,
+/// the vector itself and the lazy results of its operators
+///
+/// an expression only reads its operands when it is assigned into a
+/// vector, so `result = a + b * s - c` is one loop with no temporaries,
+/// don't hold on to one past the statement that made it
+template <u32 N, typename T, typename E>
+class VectorExpression {
+	public:
+		constexpr T get(u32 index) const {
+			if constexpr (std::is_same_v<E, Vector<N, T>>)
+				return static_cast<const E &>(*this).v[index];
+			else
+				return static_cast<const E &>(*this).get(index);
+		}
+};
+
+/* vectors are held by reference, the nodes built on top of them by value */
+template <u32 N, typename T, typename E>
+using VectorOperand = std::conditional_t<std::is_same_v<E, Vector<N, T>>, const E &, E>;
+
+template <u32 N, typename T, typename L, typename R, typename Op>
+class VectorBinary : public VectorExpression<N, T, VectorBinary<N, T, L, R, Op>> {
+	public:
+		constexpr VectorBinary(const L & left, const R & right) :
+			left(left),
+			right(right) {}
+
+		constexpr T get(u32 index) const {
+			return T(Op()(left.get(index), right.get(index)));
+		}
+
+	private:
+		VectorOperand<N, T, L> left;
+		VectorOperand<N, T, R> right;
+};
+
+/// the scalar sits on the left when ScalarFirst, for `s * v` and `s / v` order
+template <u32 N, typename T, typename E, typename Op, bool ScalarFirst>
+class VectorScalar : public VectorExpression<N, T, VectorScalar<N, T, E, Op, ScalarFirst>> {
+	public:
+		constexpr VectorScalar(const E & expression, T scalar) :
+			expression(expression),
+			scalar(scalar) {}
+
+		constexpr T get(u32 index) const {
+			if constexpr (ScalarFirst)
+				return T(Op()(scalar, expression.get(index)));
+			else
+				return T(Op()(expression.get(index), scalar));
+		}
+
+	private:
+		VectorOperand<N, T, E> expression;
+		T scalar;
+};
+
+template <u32 N, typename T, typename E, typename Op>
+class VectorUnary : public VectorExpression<N, T, VectorUnary<N, T, E, Op>> {
+	public:
+		constexpr explicit VectorUnary(const E & expression) :
+			expression(expression) {}
+
+		constexpr T get(u32 index) const {
+			return T(Op()(expression.get(index)));
+		}
+
+	private:
+		VectorOperand<N, T, E> expression;
+};
+
+#endif // CNGE_VECTOR_EXPRESSION
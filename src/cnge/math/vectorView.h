@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CNGE_VECTOR_VIEW
+#define CNGE_VECTOR_VIEW
+
+#include <ostream>
+#include <type_traits>
+
+#include "types.h"
+#include "Vector.h"
+
+/// a non owning window onto N contiguous values somewhere else,
+/// like a matrix column, an element of newArray, or a raw float buffer
+///
+/// assigning to a view writes through into the values it looks at,
+/// it never rebinds the pointer
+template <u32 N, typename T>
+class VectorView {
+	public:
+		using Value = std::remove_const_t<T>;
+
+		T * v;
+
+		constexpr explicit VectorView(T * v) noexcept :
+			v(v) {}
+
+		constexpr VectorView(Vector<N, Value> & vector) noexcept :
+			v(vector.v) {}
+
+		template <typename T2 = T, std::enable_if_t<std::is_const_v<T2>, int> = 0>
+		constexpr VectorView(const Vector<N, Value> & vector) noexcept :
+			v(vector.v) {}
+
+		template <typename T2 = T, std::enable_if_t<std::is_const_v<T2>, int> = 0>
+		constexpr VectorView(const VectorView<N, Value> & view) noexcept :
+			v(view.v) {}
+
+		constexpr VectorView(const VectorView<N, T> & view) noexcept = default;
+
+		constexpr VectorView<N, T> & operator=(const VectorView<N, T> & view) {
+			for (u32 i = 0; i < N; ++i)
+				v[i] = view.v[i];
+			return *this;
+		}
+
+		constexpr VectorView<N, T> & operator=(const Vector<N, Value> & vector) {
+			for (u32 i = 0; i < N; ++i)
+				v[i] = vector.v[i];
+			return *this;
+		}
+
+		constexpr T & operator[](u32 index) const noexcept {
+			return v[index];
+		}
+
+		/// copies the viewed values out into their own vector
+		constexpr operator Vector<N, Value>() const {
+			auto copy = Vector<N, Value>();
+			for (u32 i = 0; i < N; ++i)
+				copy.v[i] = v[i];
+			return copy;
+		}
+};
+
+template <u32 N, typename T>
+std::ostream & operator<<(std::ostream & stream, const VectorView<N, T> & view) {
+	return stream << Vector<N, std::remove_const_t<T>>(view);
+}
+
+template <u32 N> using VectorViewf = VectorView<N, float >;
+template <u32 N> using VectorViewd = VectorView<N, double>;
+
+#endif // CNGE_VECTOR_VIEW
@@ -2,6 +2,7 @@
 #include <iostream>
 
 #include "cnge/load/resource.h"
+#include "cnge/engine/uniformRing.h"
 
 #include "sceneManager.h"
 
@@ -108,6 +109,9 @@ namespace CNGE {
 			/* run back through the loop with the other loading status if neccessary */
 			keepGoing = (isLoading != lastLoading);
 		}
+
+		/* the uniform blocks drawn with this frame go to the gpu */
+		UniformRing::endFrame();
 	}
 
 }
@@ -0,0 +1,63 @@
+
+#include "cpu.h"
+
+#if CNGE_X86
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+namespace CNGE {
+#if CNGE_X86
+	static auto cpuid(u32 leaf, u32 subleaf, u32 registers[4]) -> void {
+	#ifdef _MSC_VER
+		__cpuidex(reinterpret_cast<int*>(registers), i32(leaf), i32(subleaf));
+	#else
+		__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+	#endif
+	}
+
+	static auto readXcr0() -> u64 {
+	#ifdef _MSC_VER
+		return _xgetbv(0);
+	#else
+		u32 low, high;
+		__asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+		return (u64(high) << 32) | low;
+	#endif
+	}
+
+	static auto checkAvx2() -> bool {
+		u32 registers[4] {};
+
+		cpuid(0, 0, registers);
+		if (registers[0] < 7)
+			return false;
+
+		cpuid(1, 0, registers);
+
+		const auto fma = (registers[2] & (1 << 12)) != 0;
+		const auto osxsave = (registers[2] & (1 << 27)) != 0;
+		const auto avx = (registers[2] & (1 << 28)) != 0;
+
+		/* the os has to save the ymm registers on a context switch */
+		if (!fma || !osxsave || !avx || (readXcr0() & 0x6) != 0x6)
+			return false;
+
+		cpuid(7, 0, registers);
+
+		return (registers[1] & (1 << 5)) != 0;
+	}
+#else
+	static auto checkAvx2() -> bool {
+		return false;
+	}
+#endif
+
+	auto Cpu::hasAvx2() -> bool {
+		static const auto avx2 = checkAvx2();
+		return avx2;
+	}
+}
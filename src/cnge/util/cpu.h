@@ -0,0 +1,30 @@
+
+#ifndef CNGE_CPU
+#define CNGE_CPU
+
+#include "types.h"
+
+/* simd code is only built for x86, everything else takes the plain paths */
+#if defined(_M_X64) || defined(__x86_64__)
+	#define CNGE_X86 1
+#else
+	#define CNGE_X86 0
+#endif
+
+/* msvc lets any function use any intrinsic, gcc and clang need to be told per function */
+#if CNGE_X86 && (defined(__GNUC__) || defined(__clang__))
+	#define CNGE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+	#define CNGE_TARGET_AVX2
+#endif
+
+namespace CNGE {
+	/// what the processor we are running on can do, checked once
+	class Cpu {
+	public:
+		/// avx2 and fma, with the os saving the wide registers
+		static auto hasAvx2() -> bool;
+	};
+}
+
+#endif
@@ -0,0 +1,258 @@
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include "batchPipeline.h"
+#include "cnge/image/decoderRegistry.h"
+#include "cnge/image/export/streamExport.h"
+#include "cnge/image/png/pngWriter.h"
+#include "cnge/load/boundedQueue.h"
+
+namespace Convert {
+	using clock = std::chrono::steady_clock;
+
+	/// one image on its way through the stages
+	struct Job {
+		u32 input;
+		CNGE::DecodedImage image;
+	};
+
+	static auto workersOr(u32 workers) -> u32 {
+		return workers == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : workers;
+	}
+
+	static auto nanosSince(clock::time_point start) -> u64 {
+		return u64(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count());
+	}
+
+	BatchPipeline::BatchPipeline(BatchOptions&& options) : options(std::move(options)) {
+		/* names are compared ignoring case, since the output may be on a case insensitive filesystem */
+		auto taken = std::unordered_set<std::string>();
+
+		outputPaths.reserve(this->options.inputs.size());
+
+		for (const auto& input : this->options.inputs) {
+			const auto stem = std::filesystem::path(input).stem().string();
+
+			auto name = stem + ".png";
+
+			for (auto number = 1_u32;; ++number) {
+				auto key = name;
+				std::transform(key.begin(), key.end(), key.begin(), [](char c) { return char(std::tolower(u8(c))); });
+
+				if (taken.insert(std::move(key)).second)
+					break;
+
+				name = stem + "-" + std::to_string(number) + ".png";
+			}
+
+			outputPaths.push_back((std::filesystem::path(this->options.outputDirectory) / name).string());
+		}
+	}
+
+	auto BatchPipeline::getOutputSize(u32 sourceWidth, u32 sourceHeight, u32& width, u32& height) const -> void {
+		auto scale = f64(options.scale);
+
+		if (options.maxWidth > 0 || options.maxHeight > 0) {
+			const auto scaleX = options.maxWidth > 0 ? f64(options.maxWidth) / sourceWidth : 1e9;
+			const auto scaleY = options.maxHeight > 0 ? f64(options.maxHeight) / sourceHeight : 1e9;
+			scale = std::min(scaleX, scaleY);
+		}
+
+		const auto scaledWidth = sourceWidth * scale + 0.5;
+		const auto scaledHeight = sourceHeight * scale + 0.5;
+
+		/* checked before the casts, which are undefined out of range */
+		if (!(scale > 0.0) || scaledWidth >= 4294967296.0 || scaledHeight >= 4294967296.0)
+			throw std::runtime_error("Output size is out of range");
+
+		width = std::max(u32(scaledWidth), 1_u32);
+		height = std::max(u32(scaledHeight), 1_u32);
+	}
+
+	auto BatchPipeline::getOutputPath(u32 input) const -> const std::string& {
+		return outputPaths[input];
+	}
+
+	auto BatchPipeline::runStreaming(BatchStats& stats) -> void {
+		auto nextInput = std::atomic<u32>(0);
+		auto printMutex = std::mutex();
+
+		auto threads = std::vector<std::thread>();
+
+		for (auto i = 0_u32; i < workersOr(options.decoders); ++i) {
+			threads.emplace_back([&] {
+				for (auto input = nextInput++; input < options.inputs.size(); input = nextInput++) {
+					const auto start = clock::now();
+
+					try {
+						const auto& path = options.inputs[input];
+						const auto outputPath = getOutputPath(input);
+
+						auto source = CNGE::DecoderRegistry::openRows(path.c_str());
+
+						auto exportOptions = CNGE::StreamExport::Options();
+						exportOptions.cropLeft = options.cropLeft;
+						exportOptions.cropTop = options.cropTop;
+						exportOptions.cropWidth = options.cropWidth == 0 ? source->getWidth() - std::min(options.cropLeft, source->getWidth()) : options.cropWidth;
+						exportOptions.cropHeight = options.cropHeight == 0 ? source->getHeight() - std::min(options.cropTop, source->getHeight()) : options.cropHeight;
+						exportOptions.filter = options.filter;
+						exportOptions.linear = options.linear;
+						exportOptions.level = options.level;
+						exportOptions.threads = workersOr(options.encoders);
+
+						getOutputSize(exportOptions.cropWidth, exportOptions.cropHeight, exportOptions.width, exportOptions.height);
+
+						{
+							auto file = std::ofstream(outputPath, std::ios::binary);
+
+							if (!file)
+								throw std::runtime_error("Couldn't open " + outputPath + " for writing");
+
+							CNGE::StreamExport::run(*source, file, exportOptions);
+						}
+
+						stats.bytesIn += std::filesystem::file_size(path);
+						stats.bytesOut += std::filesystem::file_size(outputPath);
+						stats.encodeTime += nanosSince(start);
+						stats.done += 1;
+
+					} catch (std::exception& ex) {
+						stats.failed += 1;
+
+						auto lock = std::lock_guard(printMutex);
+						std::cerr << options.inputs[input] << ": " << ex.what() << std::endl;
+					}
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+	auto BatchPipeline::run(BatchStats& stats) -> void {
+		if (options.stream) {
+			runStreaming(stats);
+			return;
+		}
+
+		const auto numDecoders = workersOr(options.decoders);
+		const auto numResizers = workersOr(options.resizers);
+		const auto numEncoders = workersOr(options.encoders);
+
+		auto decoded = CNGE::BoundedQueue<Job>(options.queueSize, numDecoders);
+		auto resized = CNGE::BoundedQueue<Job>(options.queueSize, numResizers);
+
+		auto nextInput = std::atomic<u32>(0);
+		auto printMutex = std::mutex();
+
+		auto fail = [&](u32 input, const char* message) {
+			stats.failed += 1;
+
+			auto lock = std::lock_guard(printMutex);
+			std::cerr << options.inputs[input] << ": " << message << std::endl;
+		};
+
+		auto threads = std::vector<std::thread>();
+
+		for (auto i = 0_u32; i < numDecoders; ++i) {
+			threads.emplace_back([&] {
+				/* inputs are taken in order, so the first files come out first */
+				for (auto input = nextInput++; input < options.inputs.size(); input = nextInput++) {
+					const auto start = clock::now();
+
+					try {
+						const auto& path = options.inputs[input];
+
+						auto image = CNGE::DecoderRegistry::decode(path.c_str());
+
+						stats.bytesIn += std::filesystem::file_size(path);
+						stats.decodeTime += nanosSince(start);
+
+						decoded.push(Job { input, std::move(image) });
+
+					} catch (std::exception& ex) {
+						fail(input, ex.what());
+					}
+				}
+
+				decoded.close();
+			});
+		}
+
+		for (auto i = 0_u32; i < numResizers; ++i) {
+			threads.emplace_back([&] {
+				while (auto job = decoded.pop()) {
+					const auto start = clock::now();
+
+					try {
+						const auto sourceWidth = job->image.width, sourceHeight = job->image.height;
+
+						auto width = 0_u32, height = 0_u32;
+						getOutputSize(sourceWidth, sourceHeight, width, height);
+
+						/* images already the right size skip straight to encoding */
+						if (width != sourceWidth || height != sourceHeight) {
+							const auto resampler = CNGE::Resampler(sourceWidth, sourceHeight, width, height, options.filter, options.linear);
+
+							auto pixels = std::make_unique<u8[]>(size(width) * height * 4);
+							resampler.run(job->image.pixels.get(), pixels.get());
+
+							job->image = CNGE::DecodedImage { width, height, std::move(pixels) };
+						}
+
+						stats.resizeTime += nanosSince(start);
+
+						resized.push(std::move(*job));
+
+					} catch (std::exception& ex) {
+						fail(job->input, ex.what());
+					}
+				}
+
+				resized.close();
+			});
+		}
+
+		for (auto i = 0_u32; i < numEncoders; ++i) {
+			threads.emplace_back([&] {
+				while (auto job = resized.pop()) {
+					const auto start = clock::now();
+
+					try {
+						const auto path = getOutputPath(job->input);
+
+						auto file = std::ofstream(path, std::ios::binary);
+
+						if (!file)
+							throw std::runtime_error("Couldn't open " + path + " for writing");
+
+						/* the stage already runs one image per worker, so each png is deflated on one thread */
+						{
+							auto writer = CNGE::PngWriter(file, job->image.width, job->image.height, 4, options.level, 1);
+							writer.writeRows(job->image.pixels.get(), job->image.height, size(job->image.width) * 4);
+						}
+
+						stats.bytesOut += u64(file.tellp());
+						stats.encodeTime += nanosSince(start);
+						stats.done += 1;
+
+					} catch (std::exception& ex) {
+						fail(job->input, ex.what());
+					}
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+	}
+}
@@ -0,0 +1,79 @@
+
+#ifndef EBETCONVERT_BATCH_PIPELINE
+#define EBETCONVERT_BATCH_PIPELINE
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "types.h"
+#include "cnge/image/resample/resampler.h"
+
+namespace Convert {
+	struct BatchOptions {
+		std::vector<std::string> inputs;
+		std::string outputDirectory;
+
+		/* streaming reads each input in bands instead of decoding it whole, for images too big for memory */
+		bool stream = false;
+		/* the part of each input to keep when streaming, a size of 0 keeps the rest */
+		u32 cropLeft = 0, cropTop = 0, cropWidth = 0, cropHeight = 0;
+
+		/* the output fits inside this box keeping its aspect, 0 leaves a side free */
+		u32 maxWidth = 0;
+		u32 maxHeight = 0;
+		/* applied when no box is given */
+		f32 scale = 1.0f;
+
+		CNGE::Resampler::Filter filter = CNGE::Resampler::Filter::LANCZOS3;
+		bool linear = false;
+
+		/* workers per stage, 0 means one per hardware thread */
+		u32 decoders = 0;
+		u32 resizers = 0;
+		u32 encoders = 0;
+
+		/// how many images can wait between two stages
+		u32 queueSize = 4;
+
+		i32 level = 6;
+	};
+
+	/// what a run got through, safe to read while it is running
+	struct BatchStats {
+		std::atomic<u32> done { 0 };
+		std::atomic<u32> failed { 0 };
+		std::atomic<u64> bytesIn { 0 };
+		std::atomic<u64> bytesOut { 0 };
+
+		/* nanoseconds each stage spent working, summed over its workers */
+		std::atomic<u64> decodeTime { 0 };
+		std::atomic<u64> resizeTime { 0 };
+		std::atomic<u64> encodeTime { 0 };
+	};
+
+	/// decodes, resizes and encodes every input to a png, each stage on its own threads
+	/// stages hand images over through bounded queues, so a slow stage holds back the ones before it
+	/// instead of letting decoded images pile up in memory
+	class BatchPipeline {
+	private:
+		BatchOptions options;
+
+		/// one per input, inputs with the same name get a number after it instead of overwriting each other
+		std::vector<std::string> outputPaths;
+
+		auto getOutputSize(u32 sourceWidth, u32 sourceHeight, u32& width, u32& height) const -> void;
+		auto getOutputPath(u32 input) const -> const std::string&;
+
+		/// each decode worker takes a whole input through a stream export
+		auto runStreaming(BatchStats&) -> void;
+
+	public:
+		explicit BatchPipeline(BatchOptions&&);
+
+		/// blocks until every input is written or has failed
+		auto run(BatchStats&) -> void;
+	};
+}
+
+#endif
@@ -0,0 +1,118 @@
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "batchPipeline.h"
+
+/// ebetConvert [options] <files...> -o <directory>
+///   --width <n> --height <n>    fit inside this box
+///   --scale <f>                 scale by this much when no box is given
+///   --filter box|bilinear|lanczos3
+///   --linear                    resize in linear light
+///   --stream                    read each input in bands instead of decoding it whole
+///   --crop <x,y,w,h>            keep only this part of each input, implies --stream
+///   --decoders <n> --resizers <n> --encoders <n>   workers per stage
+///   --queue <n>                 images waiting between stages
+///   --level <0-9>               png compression
+auto parseArguments(i32 argc, char** argv, Convert::BatchOptions& options) -> void {
+	auto next = [&](i32& i) -> std::string {
+		if (i + 1 >= argc)
+			throw std::runtime_error(std::string(argv[i]) + " needs a value");
+
+		return argv[++i];
+	};
+
+	for (auto i = 1; i < argc; ++i) {
+		const auto argument = std::string(argv[i]);
+
+		if (argument == "-o") options.outputDirectory = next(i);
+		else if (argument == "--width") options.maxWidth = std::stoul(next(i));
+		else if (argument == "--height") options.maxHeight = std::stoul(next(i));
+		else if (argument == "--scale") options.scale = std::stof(next(i));
+		else if (argument == "--filter") options.filter = CNGE::Resampler::parseFilter(next(i));
+		else if (argument == "--linear") options.linear = true;
+		else if (argument == "--stream") options.stream = true;
+		else if (argument == "--crop") {
+			const auto crop = next(i);
+
+			if (std::sscanf(crop.c_str(), "%u,%u,%u,%u", &options.cropLeft, &options.cropTop, &options.cropWidth, &options.cropHeight) != 4)
+				throw std::runtime_error("--crop needs x,y,width,height");
+
+			options.stream = true;
+		}
+		else if (argument == "--decoders") options.decoders = std::stoul(next(i));
+		else if (argument == "--resizers") options.resizers = std::stoul(next(i));
+		else if (argument == "--encoders") options.encoders = std::stoul(next(i));
+		else if (argument == "--queue") options.queueSize = std::max(std::stoul(next(i)), 1ul);
+		else if (argument == "--level") options.level = std::stoi(next(i));
+		else options.inputs.push_back(argument);
+	}
+
+	if (options.inputs.empty() || options.outputDirectory.empty())
+		throw std::runtime_error("usage: ebetConvert [options] <files...> -o <directory>");
+
+	/* also catches a scale that didn't parse to a number */
+	if (!(options.scale > 0.0f))
+		throw std::runtime_error("--scale has to be more than 0");
+}
+
+auto main(i32 argc, char** argv) -> i32 {
+	auto options = Convert::BatchOptions();
+
+	try {
+		parseArguments(argc, argv, options);
+		std::filesystem::create_directories(options.outputDirectory);
+
+	} catch (std::exception& ex) {
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	const auto numInputs = u32(options.inputs.size());
+
+	auto stats = Convert::BatchStats();
+	auto pipeline = Convert::BatchPipeline(std::move(options));
+
+	const auto start = std::chrono::steady_clock::now();
+	auto elapsed = [&start] { return std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count(); };
+
+	auto report = [&](const char* prefix) {
+		const auto seconds = std::max(elapsed(), 1e-9);
+
+		std::cout << std::fixed << std::setprecision(1) << prefix
+			<< stats.done + stats.failed << "/" << numInputs << " images, "
+			<< stats.done / seconds << " images/s, "
+			<< stats.bytesIn / seconds / 1e6 << " MB/s in, "
+			<< stats.bytesOut / seconds / 1e6 << " MB/s out" << std::endl;
+	};
+
+	auto running = std::atomic<bool>(true);
+	auto worker = std::thread([&] { pipeline.run(stats); running = false; });
+
+	/* progress once a second for long batches */
+	auto lastReport = 0.0;
+
+	while (running) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		if (running && elapsed() - lastReport >= 1.0) {
+			lastReport = elapsed();
+			report("");
+		}
+	}
+
+	worker.join();
+
+	report("done, ");
+
+	/* where the time went shows which stage to give more workers, streaming counts it all as encode */
+	std::cout << "busy seconds, decode " << stats.decodeTime / 1e9 << ", resize " << stats.resizeTime / 1e9 << ", encode " << stats.encodeTime / 1e9
+		<< ", " << stats.failed << " failed" << std::endl;
+
+	return stats.failed > 0 ? 1 : 0;
+}
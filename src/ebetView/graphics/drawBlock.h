@@ -0,0 +1,31 @@
+#ifndef EBETVIEW_DRAW_BLOCK
+#define EBETVIEW_DRAW_BLOCK
+
+/* everything that changes per draw, filled from the uniform ring */
+/* one layout for every textured rect shader, each reads the members it needs */
+#define EBETVIEW_DRAW_BLOCK_SOURCE \
+	"layout(std140) uniform Draw {" \
+	"mat3x2 model;" \
+	"mat3x2 projView;" \
+	"vec4 texModif;" \
+	"vec4 inColor;" \
+	"float exposure;" \
+	"int tonemap;" \
+	"};"
+
+namespace Game {
+	/// places a unit rect with the model and projView of the draw block
+	/// and passes its texture coordinates through texModif
+	constexpr static const char* RECT_VERTEX_SHADER =
+		"#version 330 core\n"
+		"layout(location = 0) in vec3 vertex;"
+		"layout(location = 1) in vec2 texCoord;"
+		EBETVIEW_DRAW_BLOCK_SOURCE
+		"out vec2 texPass;"
+		"void main() {"
+		"texPass = (texCoord * texModif.xy) + texModif.zw;"
+		"gl_Position = vec4(projView * vec3(model * vec3(vertex.xy, 1), 1), 0, 1);"
+		"}";
+}
+
+#endif
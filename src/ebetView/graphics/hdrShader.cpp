@@ -0,0 +1,43 @@
+
+#include <cmath>
+
+#include "cnge/engine/texture/texture.h"
+#include "hdrShader.h"
+#include "drawBlock.h"
+
+namespace Game {
+	constexpr static const char* FRAGMENT_SHADER =
+		"#version 330 core\n"
+		"uniform sampler2D tex;"
+		EBETVIEW_DRAW_BLOCK_SOURCE
+		"in vec2 texPass;"
+		"out vec4 color;"
+		/* narkowicz's fit of the aces filmic curve */
+		"vec3 aces(vec3 x) {"
+		"return clamp((x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14), 0.0, 1.0);"
+		"}"
+		"vec3 toSrgb(vec3 x) {"
+		"return mix(x * 12.92, 1.055 * pow(x, vec3(1.0 / 2.4)) - 0.055, step(0.0031308, x));"
+		"}"
+		"void main() {"
+		"vec4 hdr = texture(tex, texPass);"
+		"vec3 linear = max(hdr.rgb * exposure, 0.0);"
+		"if (tonemap == 1) linear = linear / (1.0 + linear);"
+		"else if (tonemap == 2) linear = aces(linear);"
+		"color = vec4(toSrgb(clamp(linear, 0.0, 1.0)), clamp(hdr.a, 0.0, 1.0));"
+		"}";
+
+	HdrShader::HdrShader() : Shader(false, RECT_VERTEX_SHADER, FRAGMENT_SHADER) {};
+
+	auto HdrShader::getUniforms() -> void {
+		texModifOffset = getBlockOffset("texModif");
+		exposureOffset = getBlockOffset("exposure");
+		tonemapOffset = getBlockOffset("tonemap");
+	}
+
+	auto HdrShader::giveParams(f32 stops, i32 tonemap) -> void {
+		giveBlockVector4(texModifOffset, CNGE::Texture::DEFAULT_TILE_VALUES);
+		giveBlockFloat(exposureOffset, std::exp2(stops));
+		giveBlockInt(tonemapOffset, tonemap);
+	}
+}
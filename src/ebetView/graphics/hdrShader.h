@@ -0,0 +1,32 @@
+
+#ifndef EBETVIEW_HDR_SHADER
+#define EBETVIEW_HDR_SHADER
+
+#include "cnge/engine/shader.h"
+#include "types.h"
+
+namespace Game {
+	/// draws a half float texture with an exposure and tonemap applied
+	class HdrShader : public CNGE::Shader {
+	private:
+		/* where they are in the draw block */
+		i32 texModifOffset = -1;
+		i32 exposureOffset = -1;
+		i32 tonemapOffset = -1;
+
+	public:
+		constexpr static i32 TONEMAP_CLAMP = 0;
+		constexpr static i32 TONEMAP_REINHARD = 1;
+		constexpr static i32 TONEMAP_ACES = 2;
+		constexpr static i32 NUM_TONEMAPS = 3;
+
+		HdrShader();
+
+		auto getUniforms() -> void override;
+
+		/// exposure in stops, 0 leaves the values as they are
+		auto giveParams(f32 stops, i32 tonemap) -> void;
+	};
+}
+
+#endif
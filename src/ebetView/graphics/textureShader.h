@@ -8,8 +8,9 @@
 namespace Game {
 	class TextureShader : public CNGE::Shader {
 	private:
-		i32 colorLoc = 0;
-		i32 texModifLoc = 0;
+		/* where they are in the draw block */
+		i32 colorOffset = -1;
+		i32 texModifOffset = -1;
 		
 	public:
 		TextureShader();
@@ -1,20 +1,25 @@
 
+#include <cctype>
+#include <vector>
+
 #include "cnfw/window.h"
 #include "cnfw/loop.h"
+#include "cnge/engine/glState.h"
+#include "cnge/engine/uniformRing.h"
 #include "cnge/scene/sceneManager.h"
 
 #include "scene/viewScene.h"
 
-auto getInputFile() -> std::string {
+auto getArguments() -> std::vector<std::string> {
 	auto numArgs = 0;
 	
 	auto* const args = CommandLineToArgvW(GetCommandLine(), &numArgs);
-	auto ret = std::string();
+	auto ret = std::vector<std::string>();
 	
-	if (numArgs > 1) {
-		/* if we have a first argument grab it */
-		auto wideString = std::wstring(args[1]);
-		ret = std::string(wideString.begin(), wideString.end());
+	/* skip the executable itself */
+	for (auto i = 1; i < numArgs; ++i) {
+		auto wideString = std::wstring(args[i]);
+		ret.emplace_back(wideString.begin(), wideString.end());
 	}
 
 	LocalFree(args);
@@ -22,6 +27,30 @@ auto getInputFile() -> std::string {
 	return ret;
 }
 
+/// ebetView <file> [--sequence <fps>]
+/// ebetView --shared <name>
+/// the file can be - to read a png from stdin, or a fifo
+auto parseArguments(std::string& inputFile, u32& sequenceFPS, bool& shared) -> void {
+	auto arguments = getArguments();
+
+	for (auto i = 0_size; i < arguments.size(); ++i) {
+		if (arguments[i] == "--shared") {
+			/* the name of the frame ring takes the place of the file */
+			shared = true;
+
+		} else if (arguments[i] == "--sequence") {
+			/* the frame rate is optional */
+			sequenceFPS = 24;
+
+			if (i + 1 < arguments.size() && std::isdigit(u8(arguments[i + 1][0])))
+				sequenceFPS = std::stoul(arguments[++i]);
+
+		} else if (inputFile.empty()) {
+			inputFile = std::move(arguments[i]);
+		}
+	}
+}
+
 auto WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow) -> i32 {
 	SetThreadDpiAwarenessContext(DPI_AWARENESS_CONTEXT_SYSTEM_AWARE);
 	SetProcessDPIAware();
@@ -38,17 +67,26 @@ auto WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int
 	
 	/* opengl enables */
 	glEnable(GL_CLIP_DISTANCE0);
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	CNGE::GLState::setBlend(true);
+	CNGE::GLState::blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	
 	/* parse which file we are opening */
-	auto inputFile = getInputFile();
+	auto inputFile = std::string();
+	auto sequenceFPS = 0_u32;
+	auto shared = false;
+	parseArguments(inputFile, sequenceFPS, shared);
 	
 	/* setup the scene no load screen */
 	auto sceneManager = CNGE::SceneManager();
-	sceneManager.startLoadingQuick(window.getInput(), std::make_unique<Game::ViewScene>(std::move(inputFile)));
+	sceneManager.startLoadingQuick(window.getInput(), std::make_unique<Game::ViewScene>(std::move(inputFile), sequenceFPS, shared));
 
-	auto loop = CNFW::Loop(60);
+	/* sequences run the loop at a whole multiple of their frame rate */
+	/* so every frame stays on screen for the same number of loops */
+	auto loopFPS = 60_u32;
+	if (sequenceFPS > 0)
+		loopFPS = sequenceFPS * ((loopFPS + sequenceFPS - 1) / sequenceFPS);
+
+	auto loop = CNFW::Loop(loopFPS);
 
 	loop.begin([&window]() { return window.getShouldClose(); }, [&window, &sceneManager](auto* timing) {
 		window.poll();
@@ -56,5 +94,7 @@ auto WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int
 		sceneManager.update(&window, timing);
 	});
 
+	CNGE::UniformRing::release();
+
 	return 0;
 }
@@ -6,7 +6,9 @@ namespace Game {
 
 	TextureShader Res::textureShader = TextureShader();
 
+	HdrShader Res::hdrShader = HdrShader();
+
 	CNGE::ResourceBundle Res::viewResources = CNGE::ResourceBundle({
-		&rect, &textureShader
+		&rect, &textureShader, &hdrShader
 	});
 }
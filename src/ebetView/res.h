@@ -8,6 +8,7 @@
 
 #include "graphics/rect.h"
 #include "graphics/textureShader.h"
+#include "graphics/hdrShader.h"
 
 namespace Game {
 	class Res {
@@ -16,6 +17,8 @@ namespace Game {
 
 		static TextureShader textureShader;
 
+		static HdrShader hdrShader;
+
 		static CNGE::ResourceBundle viewResources;
 	};
 }
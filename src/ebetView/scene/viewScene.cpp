@@ -2,37 +2,92 @@
 #include "viewScene.h"
 
 #include "cnge/math/math.h"
+#include "cnge/engine/glState.h"
 #include "cnge/engine/transform.h"
 #include "ebetView/res.h"
 
-#include <iostream>
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+
+#include "cnge/engine/texture/decodedTexture.h"
+#include "cnge/engine/texture/textureLoader.h"
+#include "cnge/engine/texture/pngStreamTexture.h"
+#include "cnge/image/export/streamExport.h"
 
 namespace Game {
-	ViewScene::ViewScene(std::string&& inputFile) :
+	ViewScene::ViewScene(std::string&& inputFile, u32 sequenceFPS, bool shared) :
 		Scene(&Res::viewResources),
 		backgroundColor(0x37393f),
 		imageTexture(nullptr),
-		image(nullptr),
+		hdr(false),
+		exposure(0),
+		tonemap(HdrShader::TONEMAP_ACES),
+		sequenceFPS(sequenceFPS),
+		sequence(nullptr),
+		sequenceTexture(nullptr),
+		shared(shared),
+		sharedFrames(nullptr),
+		sharedTexture(nullptr),
+		book(nullptr),
+		page(0),
+		pageShown(false),
+		tiles(nullptr),
 		inputFile(std::move(inputFile)),
+		sourceWidth(0),
+		sourceHeight(0),
 		dragX(0),
 		dragY(0),
 		offsetX(0),
 		offsetY(0),
 		zoom(0),
-		dragging(false)
+		dragging(false),
+		exportThread(),
+		exportState(std::make_shared<ExportState>())
 	{}
 
 	auto ViewScene::start() -> void {
 		try {
-			imageTexture = std::make_unique<CNGE::Texture>(inputFile.c_str(), CNGE::TextureParams().setDefaultMinFilter(GL_LINEAR).setDefaultMagFilter(GL_NEAREST));
-			imageTexture->quickGather();
-			imageTexture->process();
+			if (sequenceFPS > 0) {
+				startSequence();
+
+			} else if (shared) {
+				startShared();
+
+			} else if (CNGE::PngStream::isStream(inputFile)) {
+				/* piped in, shown a few rows at a time as it arrives */
+				imageTexture = std::make_unique<CNGE::PngStreamTexture>(inputFile.c_str(), CNGE::TextureParams().setDefaultMinFilter(GL_LINEAR).setDefaultMagFilter(GL_NEAREST));
+				imageTexture->quickGather();
+				imageTexture->process();
+
+				sourceWidth = i32(imageTexture->getWidth());
+				sourceHeight = i32(imageTexture->getHeight());
+
+			} else if (CNGE::ZipArchive::isZip(inputFile)) {
+				startBook();
+
+			} else {
+				const auto& decoder = CNGE::DecoderRegistry::find(inputFile.c_str());
+
+				/* formats we can read a piece at a time never get decoded whole */
+				if (decoder.has(CNGE::Decoder::REGION)) {
+					startTiles(decoder);
+
+				} else {
+					imageTexture = CNGE::TextureLoader::create(decoder, inputFile.c_str(), CNGE::TextureParams().setDefaultMinFilter(GL_LINEAR).setDefaultMagFilter(GL_NEAREST));
+					imageTexture->quickGather();
+					imageTexture->process();
+
+					hdr = dynamic_cast<CNGE::HdrTexture*>(imageTexture.get()) != nullptr;
 
-			image = imageTexture->getImage();
+					sourceWidth = i32(imageTexture->getWidth());
+					sourceHeight = i32(imageTexture->getHeight());
+				}
+			}
 			
 		} catch (std::exception& ex) {
 			errMessage = ex.what();
-			std::cout << errMessage << std::endl;
+			showStatus(errMessage);
 		}
 
 		resetView();
@@ -40,18 +95,72 @@ namespace Game {
 		dragging = false;
 	}
 
+	auto ViewScene::startSequence() -> void {
+		sequence = std::make_unique<CNGE::SequencePlayer>(inputFile, sequenceFPS);
+
+		sequenceTexture = std::make_unique<CNGE::StreamTexture>(sequence->getWidth(), sequence->getHeight(), 3, CNGE::TextureParams().setDefaultMinFilter(GL_LINEAR).setDefaultMagFilter(GL_NEAREST));
+		sequenceTexture->process();
+
+		sourceWidth = sequence->getWidth();
+		sourceHeight = sequence->getHeight();
+	}
+
+	auto ViewScene::startShared() -> void {
+		sharedFrames = std::make_unique<CNGE::SharedFrameReader>(inputFile);
+
+		sharedTexture = std::make_unique<CNGE::StreamTexture>(sharedFrames->getWidth(), sharedFrames->getHeight(), 3, CNGE::TextureParams().setDefaultMinFilter(GL_LINEAR).setDefaultMagFilter(GL_NEAREST));
+		sharedTexture->process();
+
+		sourceWidth = i32(sharedFrames->getWidth());
+		sourceHeight = i32(sharedFrames->getHeight());
+	}
+
+	auto ViewScene::startBook() -> void {
+		book = std::make_unique<CNGE::ArchiveBook>(inputFile.c_str());
+
+		page = 0;
+		pageShown = false;
+
+		book->request(page);
+	}
+
+	auto ViewScene::startTiles(const CNGE::Decoder& decoder) -> void {
+		tiles = std::make_unique<CNGE::TiledTexture>(decoder.openTiles(inputFile.c_str()), 256_size << 20, 0, CNGE::TextureParams().setDefaultMinFilter(GL_LINEAR).setDefaultMagFilter(GL_NEAREST));
+
+		sourceWidth = i32(tiles->getSource()->getWidth());
+		sourceHeight = i32(tiles->getSource()->getHeight());
+	}
+
+	auto ViewScene::showStatus(const std::string& message) -> void {
+		const auto title = message.empty() ? std::string("EbetView") : "EbetView - " + message;
+
+		CNFW::Window::setTitle(title.c_str());
+	}
+
 	auto ViewScene::resetView() -> void {
 		offsetX = 0;
 		offsetY = 0;
 		zoom = 1.0f;
 	}
 
+	auto ViewScene::hasSource() const -> bool {
+		return sourceWidth > 0 && sourceHeight > 0;
+	}
+
 	auto ViewScene::getImageWidth() -> i32 {
-		return i32(roundf(image->getWidth() * zoom / 2.0f)) * 2;
+		return i32(roundf(sourceWidth * zoom / 2.0f)) * 2;
 	}
 	
 	auto ViewScene::getImageHeight() -> i32 {
-		return i32(roundf(image->getHeight() * zoom / 2.0f)) * 2;
+		return i32(roundf(sourceHeight * zoom / 2.0f)) * 2;
+	}
+
+	auto ViewScene::getImageLeft() -> i32 {
+		return i32(aspect.getWidth()) / 2 - getImageWidth() / 2 + offsetX;
+	}
+
+	auto ViewScene::getImageTop() -> i32 {
+		return i32(aspect.getHeight()) / 2 - getImageHeight() / 2 + offsetY;
 	}
 
 	auto ViewScene::fitInFrame() -> void {
@@ -101,16 +210,239 @@ namespace Game {
 	auto ViewScene::resized(u32 width, u32 height) -> void {
 		aspect.update(width, height);
 		camera.setOrthoPixel(aspect.getWidth(), aspect.getHeight());
-		glViewport(aspect.getLeft(), aspect.getTop(), aspect.getWidth(), aspect.getHeight());
+		CNGE::GLState::viewport(aspect.getLeft(), aspect.getTop(), aspect.getWidth(), aspect.getHeight());
 
-		if (image != nullptr)
+		if (hasSource())
 			fitInFrame();
 		
 		setShouldRender(true);
 	}
 
+	auto ViewScene::updateSequence(CNFW::Input* input, CNFW::Timing* timing) -> void {
+		/* space pauses, arrows step while paused */
+		if (input->getKeyPressed(VK_SPACE))
+			sequence->setPaused(!sequence->getPaused());
+
+		if (sequence->getPaused()) {
+			if (input->getKeyPressed(VK_RIGHT))
+				sequence->step(1);
+			else if (input->getKeyPressed(VK_LEFT))
+				sequence->step(-1);
+		}
+
+		if (auto* frame = sequence->update(timing->delta)) {
+			sequenceTexture->upload(frame->getPixels());
+
+			setShouldRender(true);
+		}
+	}
+
+	auto ViewScene::updateShared() -> void {
+		/* straight from the producer's slot into the pixel buffer, no image in between */
+		if (const auto* frame = sharedFrames->acquire()) {
+			sharedTexture->stage(frame);
+
+			/* the sequence is checked again after the copy, a frame written over */
+			/* while it was copied is dropped and the last good one stays up */
+			if (sharedFrames->release()) {
+				sharedTexture->commit();
+				setShouldRender(true);
+			}
+		}
+	}
+
+	auto ViewScene::updateHdr(CNFW::Input* input) -> void {
+		/* up and down change exposure by half stops, t cycles the tonemap */
+		if (input->getKeyPressed(VK_UP)) {
+			exposure += 0.5f;
+			setShouldRender(true);
+
+		} else if (input->getKeyPressed(VK_DOWN)) {
+			exposure -= 0.5f;
+			setShouldRender(true);
+		}
+
+		if (input->getKeyPressed('T')) {
+			tonemap = (tonemap + 1) % HdrShader::NUM_TONEMAPS;
+			setShouldRender(true);
+		}
+	}
+
+	auto ViewScene::updateBook(CNFW::Input* input) -> void {
+		/* left and right or page up and down flip pages */
+		auto flip = 0;
+
+		if (input->getKeyPressed(VK_RIGHT) || input->getKeyPressed(VK_NEXT))
+			flip = 1;
+		else if (input->getKeyPressed(VK_LEFT) || input->getKeyPressed(VK_PRIOR))
+			flip = -1;
+
+		if (flip != 0) {
+			const auto next = std::clamp(i32(page) + flip, 0, i32(book->getNumPages()) - 1);
+
+			if (u32(next) != page) {
+				page = u32(next);
+				pageShown = false;
+
+				book->request(page);
+			}
+		}
+
+		/* the old page stays up until the new one is decoded */
+		if (pageShown)
+			return;
+
+		try {
+			auto image = book->take(page);
+
+			if (image == nullptr)
+				return;
+
+			imageTexture = std::make_unique<CNGE::DecodedTexture>(std::move(image), CNGE::TextureParams().setDefaultMinFilter(GL_LINEAR).setDefaultMagFilter(GL_NEAREST));
+			imageTexture->process();
+
+			/* the book keeps its own copy for flipping back */
+			imageTexture->discard();
+
+			sourceWidth = i32(imageTexture->getWidth());
+			sourceHeight = i32(imageTexture->getHeight());
+
+			showStatus(std::to_string(page + 1) + "/" + std::to_string(book->getNumPages()) + " " + book->getPageName(page));
+
+		} catch (std::exception& ex) {
+			errMessage = ex.what();
+			showStatus(errMessage);
+		}
+
+		pageShown = true;
+
+		resetView();
+		fitInFrame();
+
+		setShouldRender(true);
+	}
+
+	auto ViewScene::getVisibleRegion(f32& visibleLeft, f32& visibleTop, f32& visibleRight, f32& visibleBottom) -> void {
+		const auto scale = f32(getImageWidth()) / sourceWidth;
+		const auto left = getImageLeft();
+		const auto top = getImageTop();
+
+		/* the part of the screen the image covers, in image pixels */
+		visibleLeft = std::clamp((0 - left) / scale, 0.0f, f32(sourceWidth));
+		visibleRight = std::clamp((i32(aspect.getWidth()) - left) / scale, 0.0f, f32(sourceWidth));
+		visibleTop = std::clamp((0 - top) / scale, 0.0f, f32(sourceHeight));
+		visibleBottom = std::clamp((i32(aspect.getHeight()) - top) / scale, 0.0f, f32(sourceHeight));
+	}
+
+	auto ViewScene::exportView() -> void {
+		auto visibleLeft = 0.0f, visibleTop = 0.0f, visibleRight = 0.0f, visibleBottom = 0.0f;
+		getVisibleRegion(visibleLeft, visibleTop, visibleRight, visibleBottom);
+
+		const auto scale = f32(getImageWidth()) / sourceWidth;
+
+		auto options = CNGE::StreamExport::Options();
+		options.cropLeft = u32(visibleLeft);
+		options.cropTop = u32(visibleTop);
+		options.cropWidth = std::max(u32(ceilf(visibleRight)) - options.cropLeft, 1_u32);
+		options.cropHeight = std::max(u32(ceilf(visibleBottom)) - options.cropTop, 1_u32);
+		options.width = std::max(u32(roundf(options.cropWidth * scale)), 1_u32);
+		options.height = std::max(u32(roundf(options.cropHeight * scale)), 1_u32);
+
+		/* one export at a time, the ui never waits on a running one */
+		if (!exportState->done.load()) {
+			showStatus("an export is already running");
+			return;
+		}
+
+		/* already finished, so this returns right away */
+		if (exportThread.joinable())
+			exportThread.join();
+
+		exportState->done.store(false);
+
+		const auto output = inputFile + ".view.png";
+
+		showStatus("exporting " + output);
+
+		exportThread = std::thread([input = inputFile, output, options, state = exportState] {
+
+			/* written under another name first so an export cut short never looks finished */
+			const auto partial = output + ".part";
+
+			try {
+				CNGE::StreamExport::run(input.c_str(), partial.c_str(), options);
+				std::filesystem::rename(partial, output);
+
+				auto lock = std::lock_guard(state->mutex);
+				state->message = "exported " + output;
+
+			} catch (std::exception& ex) {
+				auto error = std::error_code();
+				std::filesystem::remove(partial, error);
+
+				auto lock = std::lock_guard(state->mutex);
+				state->message = std::string("export failed: ") + ex.what();
+			}
+
+			state->done.store(true);
+		});
+	}
+
+	auto ViewScene::getVisibleTiles(u32& tileLeft, u32& tileTop, u32& tileRight, u32& tileBottom) -> void {
+		auto* source = tiles->getSource();
+
+		auto visibleLeft = 0.0f, visibleTop = 0.0f, visibleRight = 0.0f, visibleBottom = 0.0f;
+		getVisibleRegion(visibleLeft, visibleTop, visibleRight, visibleBottom);
+
+		tileLeft = u32(visibleLeft) / source->getTileWidth();
+		tileTop = u32(visibleTop) / source->getTileHeight();
+		tileRight = std::min(u32(ceilf(visibleRight / source->getTileWidth())), source->getTilesWide());
+		tileBottom = std::min(u32(ceilf(visibleBottom / source->getTileHeight())), source->getTilesTall());
+	}
+
+	auto ViewScene::updateTiles() -> void {
+		auto tileLeft = 0_u32, tileTop = 0_u32, tileRight = 0_u32, tileBottom = 0_u32;
+		getVisibleTiles(tileLeft, tileTop, tileRight, tileBottom);
+
+		tiles->request(tileLeft, tileTop, tileRight, tileBottom);
+
+		if (tiles->update())
+			setShouldRender(true);
+	}
+
 	auto ViewScene::update(CNFW::Input* input, CNFW::Timing* timing) -> void {
-		if (image != nullptr) {
+		if (sequence != nullptr)
+			updateSequence(input, timing);
+
+		if (sharedFrames != nullptr)
+			updateShared();
+
+		if (hdr && hasSource())
+			updateHdr(input);
+
+		if (book != nullptr)
+			updateBook(input);
+
+		/* the export thread can't touch the window, so how it ended is shown from here */
+		{
+			auto lock = std::lock_guard(exportState->mutex);
+
+			if (!exportState->message.empty())
+				showStatus(std::exchange(exportState->message, {}));
+		}
+
+		/* progressive formats keep arriving after start, and can fail partway */
+		if (imageTexture != nullptr) {
+			if (imageTexture->update())
+				setShouldRender(true);
+
+			if (auto error = imageTexture->getError(); !error.empty() && error != errMessage) {
+				errMessage = std::move(error);
+				showStatus(errMessage);
+			}
+		}
+
+		if (hasSource()) {
 			auto const currentScroll = input->getScroll();
 
 			if (currentScroll != 0) {
@@ -152,6 +484,10 @@ namespace Game {
 				dragY = input->getMouseY();
 			}
 
+			/* e exports what is on screen, only for images that came from a file */
+			if (input->getKeyPressed('E') && sequence == nullptr && sharedFrames == nullptr && book == nullptr && !CNGE::PngStream::isStream(inputFile))
+				exportView();
+
 			auto const middleClick = input->getButtonPressed(CNFW::Input::BUTTON_MIDDLE);
 
 			if (middleClick) {
@@ -162,13 +498,63 @@ namespace Game {
 
 			camera.update();
 		}
+
+		if (tiles != nullptr)
+			updateTiles();
+	}
+
+	auto ViewScene::renderTiles() -> void {
+		auto* source = tiles->getSource();
+
+		const auto tileWidth = source->getTileWidth();
+		const auto tileHeight = source->getTileHeight();
+
+		const auto scale = f32(getImageWidth()) / sourceWidth;
+		const auto left = getImageLeft();
+		const auto top = getImageTop();
+
+		auto tileLeft = 0_u32, tileTop = 0_u32, tileRight = 0_u32, tileBottom = 0_u32;
+		getVisibleTiles(tileLeft, tileTop, tileRight, tileBottom);
+
+		for (auto y = tileTop; y < tileBottom; ++y) {
+			for (auto x = tileLeft; x < tileRight; ++x) {
+				if (!tiles->bindTile(x, y))
+					continue;
+
+				const auto pixelLeft = x * tileWidth;
+				const auto pixelTop = y * tileHeight;
+				const auto pixelRight = std::min(pixelLeft + tileWidth, source->getWidth());
+				const auto pixelBottom = std::min(pixelTop + tileHeight, source->getHeight());
+
+				/* round both edges of each tile so neighbors meet without gaps */
+				const auto screenLeft = left + i32(roundf(pixelLeft * scale));
+				const auto screenTop = top + i32(roundf(pixelTop * scale));
+				const auto screenRight = left + i32(roundf(pixelRight * scale));
+				const auto screenBottom = top + i32(roundf(pixelBottom * scale));
+
+				/* edge tiles only show the part that is inside the image */
+				f32 texModif[4] {
+					f32(pixelRight - pixelLeft) / tileWidth,
+					f32(pixelBottom - pixelTop) / tileHeight,
+					0, 0
+				};
+
+				Res::textureShader.enable(CNGE::Transform::toAffine(screenLeft, screenTop, 0, screenRight - screenLeft, screenBottom - screenTop), camera.getAffineProjection());
+				Res::textureShader.giveParams(1, 1, 1, 1, texModif);
+
+				Res::rect.render();
+			}
+		}
 	}
 
 	auto ViewScene::render() -> void {
 		glClearColor(backgroundColor.r, backgroundColor.g, backgroundColor.b, 1);
 		glClear(GL_COLOR_BUFFER_BIT);
 
-		if (image != nullptr) {
+		if (tiles != nullptr) {
+			renderTiles();
+
+		} else if (hasSource()) {
 			const auto screenWidth = i32(aspect.getWidth());
 			const auto screenHeight = i32(aspect.getHeight());
 
@@ -181,9 +567,23 @@ namespace Game {
 			const auto halfImgWidth = imgWidth / 2;
 			const auto halfImgHeight = imgHeight / 2;
 
-			imageTexture->bind();
-			Res::textureShader.enable(CNGE::Transform::toModel(halfScreenWidth - halfImgWidth + offsetX, halfScreenHeight - halfImgHeight + offsetY, 0, imgWidth, imgHeight), camera.getProjection());
-			Res::textureShader.giveParams(1, 1, 1, 1);
+			if (sequence != nullptr)
+				sequenceTexture->bind();
+			else if (sharedFrames != nullptr)
+				sharedTexture->bind();
+			else
+				imageTexture->bind();
+
+			const auto model = CNGE::Transform::toAffine(halfScreenWidth - halfImgWidth + offsetX, halfScreenHeight - halfImgHeight + offsetY, 0, imgWidth, imgHeight);
+
+			if (hdr) {
+				Res::hdrShader.enable(model, camera.getAffineProjection());
+				Res::hdrShader.giveParams(exposure, tonemap);
+
+			} else {
+				Res::textureShader.enable(model, camera.getAffineProjection());
+				Res::textureShader.giveParams(1, 1, 1, 1);
+			}
 
 			Res::rect.render();
 		}
@@ -192,4 +592,15 @@ namespace Game {
 	auto ViewScene::switchScene() -> CNGE::SwitchReturn {
 		return noSwitch();
 	}
+
+	ViewScene::~ViewScene() {
+		if (!exportThread.joinable())
+			return;
+
+		/* a running export only holds its own copies, so it is left to finish on its own */
+		if (exportState->done.load())
+			exportThread.join();
+		else
+			exportThread.detach();
+	}
 }
@@ -7,7 +7,20 @@
 #include "cnge/scene/scene.h"
 #include "cnge/util/color.h"
 #include "cnge/engine/texture/texture.h"
+#include "cnge/engine/texture/hdrTexture.h"
+#include "cnge/engine/texture/streamTexture.h"
+#include "cnge/engine/texture/tiledTexture.h"
 #include "cnge/image/image.h"
+#include "cnge/image/decoderRegistry.h"
+#include "cnge/image/archive/archiveBook.h"
+#include "cnge/image/sequence/sequencePlayer.h"
+#include "cnge/image/shared/sharedFrames.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 
 namespace Game {
 	class ViewScene : public CNGE::Scene {
@@ -18,19 +31,60 @@ namespace Game {
 		CNGE::FullAspect aspect;
 
 		std::unique_ptr<CNGE::Texture> imageTexture;
-		CNGE::Image1D* image;
+
+		/* float images, drawn through the tonemapper */
+		bool hdr;
+		f32 exposure;
+		i32 tonemap;
+
+		/* sequence mode */
+		u32 sequenceFPS;
+		std::unique_ptr<CNGE::SequencePlayer> sequence;
+		std::unique_ptr<CNGE::StreamTexture> sequenceTexture;
+
+		/* live frames from another process */
+		bool shared;
+		std::unique_ptr<CNGE::SharedFrameReader> sharedFrames;
+		std::unique_ptr<CNGE::StreamTexture> sharedTexture;
+
+		/* zip and cbz archives, one page at a time */
+		std::unique_ptr<CNGE::ArchiveBook> book;
+		u32 page;
+		bool pageShown;
+
+		/* images too big to decode at once */
+		std::unique_ptr<CNGE::TiledTexture> tiles;
 		
 		std::string inputFile;
 		std::string errMessage;
 
+		/* size of whatever we are showing, 0 when nothing loaded */
+		i32 sourceWidth, sourceHeight;
+
 		i32 offsetX, offsetY;
 		f32 zoom;
 
 		bool dragging;
 		i32 dragX, dragY;
+
+		/* writes the visible part of the image out in the background */
+		std::thread exportThread;
+
+		/// what the export thread hands back, shared so it can outlive the scene
+		struct ExportState {
+			std::atomic<bool> done { true };
+
+			std::mutex mutex;
+			/// how the export ended, taken by the ui to show in the title
+			std::string message;
+		};
+
+		std::shared_ptr<ExportState> exportState;
 		
 	public:
-		ViewScene(std::string&& inputFile);
+		/// a sequence fps of 0 opens the file as a single image
+		/// shared treats the input as the name of a shared frame ring
+		ViewScene(std::string&& inputFile, u32 sequenceFPS, bool shared);
 		
 		auto start() -> void override;
 
@@ -42,14 +96,47 @@ namespace Game {
 
 		auto switchScene() -> CNGE::SwitchReturn override;
 
+		~ViewScene();
+
+		/// messages go in the title bar, there is no console to print them to
+		/// an empty message puts the plain title back
+		auto showStatus(const std::string&) -> void;
+
 		/* image functions */
 		
 		auto resetView() -> void;
+
+		[[nodiscard]] auto hasSource() const -> bool;
 		
 		auto getImageWidth() -> i32;
 		auto getImageHeight() -> i32;
 
+		auto getImageLeft() -> i32;
+		auto getImageTop() -> i32;
+
 		auto fitInFrame() -> void;
+
+		/// the part of the image on screen, in image pixels
+		auto getVisibleRegion(f32&, f32&, f32&, f32&) -> void;
+
+		/// exports what is on screen at the size it is shown, next to the input
+		auto exportView() -> void;
+
+		auto startSequence() -> void;
+		auto updateSequence(CNFW::Input*, CNFW::Timing*) -> void;
+
+		auto startShared() -> void;
+		auto updateShared() -> void;
+
+		auto updateHdr(CNFW::Input*) -> void;
+
+		auto startBook() -> void;
+		auto updateBook(CNFW::Input*) -> void;
+
+		auto startTiles(const CNGE::Decoder&) -> void;
+		auto getVisibleTiles(u32&, u32&, u32&, u32&) -> void;
+		auto updateTiles() -> void;
+		auto renderTiles() -> void;
 	};
 }
 
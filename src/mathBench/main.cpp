@@ -0,0 +1,338 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "cnge/util/cpu.h"
+#include "cnge/math/vector.h"
+#include "cnge/math/vector2.h"
+#include "cnge/math/vector3.h"
+#include "cnge/math/vector4.h"
+#include "cnge/math/matrixN.h"
+#include "cnge/math/matrix4.h"
+
+/// mathBench [iterations]
+///
+/// times the everyday Vector2f, Vector3f, Vector4f and Matrix4f operations,
+/// plus `result = a + b * s - c` on the generic types both fused through the
+/// operator expressions and with a named temporary per operator, and counts
+/// heap allocations in each
+///
+/// the results are written to stdout as json so runs from different
+/// compilers or different revisions of the math headers can be diffed
+
+static auto allocations = std::atomic<u64>(0);
+
+auto operator new(size bytes) -> void* {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+
+	if (auto memory = std::malloc(bytes == 0 ? 1 : bytes))
+		return memory;
+
+	throw std::bad_alloc();
+}
+
+auto operator new[](size bytes) -> void* {
+	return operator new(bytes);
+}
+
+auto operator delete(void* memory) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete[](void* memory) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete(void* memory, size) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete[](void* memory, size) noexcept -> void {
+	std::free(memory);
+}
+
+namespace Bench {
+	struct Result {
+		std::string name;
+		f64 nanoseconds;
+		f64 allocations;
+	};
+
+	static auto results = std::vector<Result>();
+
+	/// makes the optimizer produce all of a value, without the cost of a volatile store and reload
+	/// the value can stay a local, it only has to be in memory once at this point
+	template<typename Value>
+	inline auto keep(const Value& value) -> void {
+	#if defined(_MSC_VER) && !defined(__clang__)
+		static const volatile void* escape = nullptr;
+		escape = &value;
+		_ReadWriteBarrier();
+	#else
+		asm volatile("" : : "m"(value) : "memory");
+	#endif
+	}
+
+	/* every operation reads its inputs out of these by index so nothing folds at compile time */
+	constexpr auto INPUTS = 256_u32;
+
+	template<typename Body>
+	auto run(const std::string& name, u64 iterations, Body body) -> void {
+		/* an untimed pass first, so caches, branch predictors and clock speed have settled */
+		for (auto i = 0_u64; i < iterations / 8; ++i)
+			body(u32(i % INPUTS));
+
+		const auto allocationsBefore = allocations.load();
+		const auto start = std::chrono::steady_clock::now();
+
+		for (auto i = 0_u64; i < iterations; ++i)
+			body(u32(i % INPUTS));
+
+		const auto end = std::chrono::steady_clock::now();
+		const auto nanoseconds = std::chrono::duration<f64, std::nano>(end - start).count();
+
+		results.push_back({ name, nanoseconds / iterations, f64(allocations.load() - allocationsBefore) / iterations });
+	}
+
+	/* small values that never hit zero so normalize and inverse stay finite */
+	auto input(u32 index, u32 component) -> f32 {
+		return 1.f + f32((index * 7 + component * 13) % 17) * 0.125f;
+	}
+
+	template<typename Value>
+	auto fill(Value& value, u32 count, f32 seed) -> void {
+		for (auto i = 0_u32; i < count; ++i)
+			value.v[i] = seed + i * 0.25f;
+	}
+
+	template<u32 N, typename Swizzle>
+	auto fixedVectors(const std::string& label, u64 iterations, Swizzle swizzle) -> void {
+		auto vectors = std::vector<Vector<N, f32>>(INPUTS);
+		for (auto i = 0_u32; i < INPUTS; ++i)
+			for (auto j = 0_u32; j < N; ++j)
+				vectors[i].v[j] = input(i, j);
+
+		run(label + " construct", iterations, [&](u32 i) {
+			auto vector = Vector<N, f32>(input(i, 0));
+			keep(vector);
+		});
+
+		run(label + " copy", iterations, [&](u32 i) {
+			auto vector = vectors[i];
+			keep(vector);
+		});
+
+		run(label + " add", iterations, [&](u32 i) {
+			auto vector = vectors[i] + vectors[(i + 1) % INPUTS];
+			keep(vector);
+		});
+
+		run(label + " scale", iterations, [&](u32 i) {
+			auto vector = vectors[i] * input(i, 1);
+			keep(vector);
+		});
+
+		run(label + " dot", iterations, [&](u32 i) {
+			keep(dot(vectors[i], vectors[(i + 1) % INPUTS]));
+		});
+
+		run(label + " normalize", iterations, [&](u32 i) {
+			auto vector = normalize(vectors[i]);
+			keep(vector);
+		});
+
+		run(label + " swizzle", iterations, [&](u32 i) {
+			auto vector = swizzle(vectors[i]);
+			keep(vector);
+		});
+	}
+
+	auto matrix4s(u64 iterations) -> void {
+		auto matrices = std::vector<Matrix4f>(INPUTS);
+		auto vectors = std::vector<Vector4f>(INPUTS);
+		for (auto i = 0_u32; i < INPUTS; ++i) {
+			/* a rotation and scale with a translation, always invertible */
+			matrices[i] = Matrix4f::makeTranslate(input(i, 0), input(i, 1), input(i, 2));
+			matrices[i].rotateXYZ(input(i, 3), input(i, 4), input(i, 5)).scale(input(i, 6), input(i, 7), input(i, 8));
+			vectors[i] = Vector4f(input(i, 0), input(i, 1), input(i, 2), 1.f);
+		}
+
+		run("matrix4f construct", iterations, [&](u32 i) {
+			auto matrix = Matrix4f(
+				input(i, 0), 0, 0, input(i, 1),
+				0, input(i, 2), 0, input(i, 3),
+				0, 0, 1, 0,
+				0, 0, 0, 1
+			);
+			keep(matrix);
+		});
+
+		run("matrix4f copy", iterations, [&](u32 i) {
+			auto matrix = matrices[i];
+			keep(matrix);
+		});
+
+		run("matrix4f multiply", iterations, [&](u32 i) {
+			auto matrix = matrices[i] * matrices[(i + 1) % INPUTS];
+			keep(matrix);
+		});
+
+		run("matrix4f multiply vector", iterations, [&](u32 i) {
+			auto vector = matrices[i] * vectors[i];
+			keep(vector);
+		});
+
+		run("matrix4f transpose", iterations, [&](u32 i) {
+			auto matrix = transpose(matrices[i]);
+			keep(matrix);
+		});
+
+		run("matrix4f inverse", iterations, [&](u32 i) {
+			auto matrix = inverse(matrices[i]);
+			keep(matrix);
+		});
+
+		run("matrix4f orthographic", iterations, [&](u32 i) {
+			auto matrix = Matrix4f::makeOrthographic(0, input(i, 0) * 100, input(i, 1) * 100, 0, -1, 1);
+			keep(matrix);
+		});
+
+		run("matrix4f perspective", iterations, [&](u32 i) {
+			auto matrix = Matrix4f::makePerspective(input(i, 0), input(i, 1), 0.1f, 100.f);
+			keep(matrix);
+		});
+
+		run("matrix4f transform2D", iterations, [&](u32 i) {
+			auto matrix = Matrix4f();
+			matrix.setTransform2D(input(i, 0), input(i, 1), input(i, 2), input(i, 3), input(i, 4));
+			keep(matrix);
+		});
+	}
+
+	template<u32 N>
+	auto vectors(u64 iterations) -> void {
+		auto a = Vector<N, f32>();
+		auto b = Vector<N, f32>();
+		auto c = Vector<N, f32>();
+		fill(a, N, 1.f);
+		fill(b, N, 2.f);
+		fill(c, N, 3.f);
+
+		const auto label = "vector<" + std::to_string(N) + ">";
+
+		run(label + " fused", iterations, [&](u32 i) {
+			Vector<N, f32> result = a + b * f32(i) - c;
+			keep(result);
+		});
+
+		run(label + " temporaries", iterations, [&](u32 i) {
+			Vector<N, f32> scaled = b * f32(i);
+			Vector<N, f32> sum = a + scaled;
+			Vector<N, f32> result = sum - c;
+			keep(result);
+		});
+	}
+
+	template<u32 N, u32 M>
+	auto matrices(u64 iterations) -> void {
+		auto a = Matrix<N, M, f32>();
+		auto b = Matrix<N, M, f32>();
+		auto c = Matrix<N, M, f32>();
+		for (auto i = 0_u32; i < N * M; ++i) {
+			a.m[i] = 1.f + i;
+			b.m[i] = 2.f + i;
+			c.m[i] = 3.f + i;
+		}
+
+		const auto label = "matrix<" + std::to_string(N) + "," + std::to_string(M) + ">";
+
+		run(label + " fused", iterations, [&](u32 i) {
+			Matrix<N, M, f32> result = a + b * f32(i) - c;
+			keep(result);
+		});
+
+		run(label + " temporaries", iterations, [&](u32 i) {
+			Matrix<N, M, f32> scaled = b * f32(i);
+			Matrix<N, M, f32> sum = a + scaled;
+			Matrix<N, M, f32> result = sum - c;
+			keep(result);
+		});
+	}
+
+	auto compiler() -> std::string {
+	#if defined(__clang__)
+		return "clang " __clang_version__;
+	#elif defined(_MSC_VER)
+		return "msvc " + std::to_string(_MSC_VER);
+	#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+	#else
+		return "unknown";
+	#endif
+	}
+
+	/* which Matrix4Kernels path the float operations went down */
+	auto simd() -> std::string {
+	#if CNGE_MATH_SSE
+		return CNGE::Cpu::hasAvx2() ? "avx2" : "sse";
+	#else
+		return "scalar";
+	#endif
+	}
+
+	auto print(u64 iterations) -> void {
+		std::printf("{\n");
+		std::printf("\t\"compiler\": \"%s\",\n", compiler().c_str());
+		std::printf("\t\"simd\": \"%s\",\n", simd().c_str());
+		std::printf("\t\"iterations\": %llu,\n", (unsigned long long)iterations);
+		std::printf("\t\"results\": [\n");
+
+		for (auto i = 0_size; i < results.size(); ++i) {
+			const auto& result = results[i];
+			std::printf(
+				"\t\t{ \"name\": \"%s\", \"nsPerOp\": %.3f, \"opsPerSecond\": %.0f, \"allocationsPerOp\": %.3f }%s\n",
+				result.name.c_str(),
+				result.nanoseconds,
+				result.nanoseconds > 0 ? 1e9 / result.nanoseconds : 0.0,
+				result.allocations,
+				i + 1 < results.size() ? "," : ""
+			);
+		}
+
+		std::printf("\t]\n");
+		std::printf("}\n");
+	}
+}
+
+auto main(i32 argc, char** argv) -> i32 {
+	const auto iterations = argc > 1 ? std::stoull(argv[1]) : 10'000'000_u64;
+
+	Bench::results.reserve(64);
+
+	/* the loop and keep on their own, subtract it to get the cost of an operation */
+	Bench::run("baseline", iterations, [](u32 i) {
+		Bench::keep(f32(i));
+	});
+
+	Bench::fixedVectors<2>("vector2f", iterations, [](const Vector2f& vector) { return vector.getYX(); });
+	Bench::fixedVectors<3>("vector3f", iterations, [](const Vector3f& vector) { return vector.getZYX(); });
+	Bench::fixedVectors<4>("vector4f", iterations, [](const Vector4f& vector) { return vector.getWZYX(); });
+	Bench::matrix4s(iterations);
+
+	Bench::vectors<8>(iterations);
+	Bench::vectors<64>(iterations / 8);
+	Bench::matrices<3, 2>(iterations);
+	Bench::matrices<8, 8>(iterations / 8);
+
+	Bench::print(iterations);
+
+	return 0;
+}
@@ -0,0 +1,303 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cnge/util/cpu.h"
+#include "cnge/math/matrix4.h"
+#include "cnge/math/matrix4Kernels.h"
+
+/// mathTest [seed]
+///
+/// checks the simd Matrix4Kernels against the Scalar ones on random and
+/// edge case inputs, prints every mismatch and exits with 1 if there was any
+///
+/// results may differ from the scalar ones by the reordering and fusing of
+/// the float operations, so each element has to be within TOLERANCE times
+/// the larger of 1 and its magnitude of the scalar result, where the
+/// magnitude of a product element is the sum of the absolute values of
+/// the terms that went into it so cancellation doesn't count against it,
+/// inverses are held to INVERSE_TOLERANCE since the cofactors are summed
+/// in a different order
+
+namespace Test {
+	constexpr auto TOLERANCE = 1e-5f;
+	constexpr auto INVERSE_TOLERANCE = 1e-4f;
+
+	constexpr auto RANDOM_CASES = 10'000_u32;
+
+	static auto failures = 0_u32;
+	static auto checks = 0_u32;
+
+	/* nans match nans and infinities match the same infinity */
+	auto close(f32 actual, f32 expected, f32 magnitude, f32 tolerance) -> bool {
+		if (std::isnan(expected))
+			return std::isnan(actual);
+
+		if (std::isinf(expected))
+			return actual == expected;
+
+		return std::abs(actual - expected) <= tolerance * std::max({ 1.f, std::abs(expected), magnitude });
+	}
+
+	/// magnitudes may be null when the result's own size is enough
+	auto compare(const std::string& name, const f32* actual, const f32* expected, const f32* magnitudes, u32 count, f32 tolerance) -> void {
+		++checks;
+
+		for (auto i = 0_u32; i < count; ++i) {
+			if (close(actual[i], expected[i], magnitudes == nullptr ? 0.f : magnitudes[i], tolerance))
+				continue;
+
+			++failures;
+			std::printf("FAIL %s: element %u is %.9g, scalar gives %.9g\n", name.c_str(), i, actual[i], expected[i]);
+			return;
+		}
+	}
+
+	auto compare(const std::string& name, const Matrix4f& actual, const Matrix4f& expected, const Matrix4f* magnitudes = nullptr, f32 tolerance = TOLERANCE) -> void {
+		compare(name, actual.m, expected.m, magnitudes == nullptr ? nullptr : magnitudes->m, 16, tolerance);
+	}
+
+	auto compare(const std::string& name, const Vector4f& actual, const Vector4f& expected, const Vector4f& magnitudes) -> void {
+		compare(name, actual.v, expected.v, magnitudes.v, 4, TOLERANCE);
+	}
+
+	auto absolute(Matrix4f matrix) -> Matrix4f {
+		for (auto& element : matrix.m)
+			element = std::abs(element);
+
+		return matrix;
+	}
+
+	auto absolute(Vector4f vector) -> Vector4f {
+		for (auto& element : vector.v)
+			element = std::abs(element);
+
+		return vector;
+	}
+
+	/* |left| * |right|, how big the terms summed into each element were */
+	auto productMagnitudes(const Matrix4f& left, const Matrix4f& right) -> Matrix4f {
+		auto magnitudes = Matrix4f();
+		Matrix4Kernels::Scalar::multiply(absolute(left), absolute(right), magnitudes);
+
+		return magnitudes;
+	}
+
+	auto productMagnitudes(const Matrix4f& matrix, const Vector4f& vector) -> Vector4f {
+		auto magnitudes = Vector4f();
+		Matrix4Kernels::Scalar::multiplyVector(absolute(matrix), absolute(vector), magnitudes);
+
+		return magnitudes;
+	}
+
+	/* a rotation, scale and translation, so always invertible and never badly conditioned */
+	auto makeInvertible(std::mt19937& random) -> Matrix4f {
+		auto angle = std::uniform_real_distribution<f32>(-10.f, 10.f);
+		auto scale = std::uniform_real_distribution<f32>(0.25f, 4.f);
+		auto offset = std::uniform_real_distribution<f32>(-100.f, 100.f);
+
+		auto matrix = Matrix4f::makeTranslate(offset(random), offset(random), offset(random));
+		matrix.rotateXYZ(angle(random), angle(random), angle(random)).scale(scale(random), scale(random), scale(random));
+
+		return matrix;
+	}
+
+	auto makeRandom(std::mt19937& random) -> Matrix4f {
+		auto value = std::uniform_real_distribution<f32>(-100.f, 100.f);
+
+		auto matrix = Matrix4f();
+		for (auto& element : matrix.m)
+			element = value(random);
+
+		return matrix;
+	}
+
+	auto makeFilled(f32 value) -> Matrix4f {
+		auto matrix = Matrix4f();
+		for (auto& element : matrix.m)
+			element = value;
+
+		return matrix;
+	}
+
+	/* the one being tested against Scalar, Sse when it is built in */
+	namespace Kernels = Matrix4Kernels;
+
+	auto checkMultiply(const std::string& name, const Matrix4f& left, const Matrix4f& right) -> void {
+		auto expected = Matrix4f(), actual = Matrix4f();
+
+		const auto magnitudes = productMagnitudes(left, right);
+
+		Matrix4Kernels::Scalar::multiply(left, right, expected);
+		Kernels::multiply(left, right, actual);
+		compare(name + " multiply", actual, expected, &magnitudes);
+
+		/* multiplyBatch takes the avx2 path when the cpu has it */
+		Kernels::multiplyBatch(left, &right, &actual, 1);
+		compare(name + " multiplyBatch", actual, expected, &magnitudes);
+	}
+
+	auto checkMultiplyVector(const std::string& name, const Matrix4f& matrix, const Vector4f& vector) -> void {
+		auto expected = Vector4f(), actual = Vector4f();
+
+		Matrix4Kernels::Scalar::multiplyVector(matrix, vector, expected);
+		Kernels::multiplyVector(matrix, vector, actual);
+		compare(name + " multiplyVector", actual, expected, productMagnitudes(matrix, vector));
+	}
+
+	auto checkTranspose(const std::string& name, const Matrix4f& matrix) -> void {
+		auto expected = Matrix4f(), actual = Matrix4f();
+
+		Matrix4Kernels::Scalar::transpose(matrix, expected);
+		Kernels::transpose(matrix, actual);
+
+		/* a transpose only moves values, so it has to be exact */
+		compare(name + " transpose", actual, expected, nullptr, 0.f);
+	}
+
+	auto checkInvert(const std::string& name, const Matrix4f& matrix) -> void {
+		auto expected = Matrix4f(), actual = Matrix4f();
+
+		Matrix4Kernels::Scalar::invert(matrix, expected);
+		Kernels::invert(matrix, actual);
+		compare(name + " invert", actual, expected, nullptr, INVERSE_TOLERANCE);
+	}
+
+	auto checkTransform2D(const std::string& name, f32 translateX, f32 translateY, f32 rotation, f32 scaleX, f32 scaleY) -> void {
+		auto expected = Matrix4f(), actual = Matrix4f();
+
+		Matrix4Kernels::Scalar::transform2D(expected, translateX, translateY, rotation, scaleX, scaleY);
+		Kernels::transform2D(actual, translateX, translateY, rotation, scaleX, scaleY);
+		compare(name + " transform2D", actual, expected);
+	}
+
+	auto randomCases(u32 seed) -> void {
+		auto random = std::mt19937(seed);
+		auto value = std::uniform_real_distribution<f32>(-100.f, 100.f);
+		auto angle = std::uniform_real_distribution<f32>(-10.f, 10.f);
+		auto scale = std::uniform_real_distribution<f32>(-4.f, 4.f);
+
+		/* a batch of several so the avx2 pairs and the odd tail both run */
+		auto lefts = std::vector<Matrix4f>();
+		auto rights = std::vector<Matrix4f>();
+		auto vectors = std::vector<Vector4f>();
+
+		for (auto i = 0_u32; i < RANDOM_CASES; ++i) {
+			const auto left = makeRandom(random);
+			const auto right = makeRandom(random);
+			const auto vector = Vector4f(value(random), value(random), value(random), value(random));
+			const auto invertible = makeInvertible(random);
+
+			checkMultiply("random", left, right);
+			checkMultiplyVector("random", left, vector);
+			checkTranspose("random", left);
+			checkInvert("random", invertible);
+			checkTransform2D("random", value(random), value(random), angle(random), scale(random), scale(random));
+
+			if (i < 7) {
+				lefts.push_back(left);
+				rights.push_back(right);
+				vectors.push_back(vector);
+			}
+		}
+
+		for (auto count = 1_size; count <= rights.size(); ++count) {
+			auto expectedMatrices = std::vector<Matrix4f>(count), actualMatrices = std::vector<Matrix4f>(count);
+			auto expectedVectors = std::vector<Vector4f>(count), actualVectors = std::vector<Vector4f>(count);
+
+			for (auto i = 0_size; i < count; ++i) {
+				Matrix4Kernels::Scalar::multiply(lefts[0], rights[i], expectedMatrices[i]);
+				Matrix4Kernels::Scalar::multiplyVector(lefts[0], vectors[i], expectedVectors[i]);
+			}
+
+			Kernels::multiplyBatch(lefts[0], rights.data(), actualMatrices.data(), count);
+			Kernels::multiplyVectorBatch(lefts[0], vectors.data(), actualVectors.data(), count);
+
+			for (auto i = 0_size; i < count; ++i) {
+				const auto matrixMagnitudes = productMagnitudes(lefts[0], rights[i]);
+
+				compare("batch of " + std::to_string(count) + " multiplyBatch", actualMatrices[i], expectedMatrices[i], &matrixMagnitudes);
+				compare("batch of " + std::to_string(count) + " multiplyVectorBatch", actualVectors[i], expectedVectors[i], productMagnitudes(lefts[0], vectors[i]));
+			}
+		}
+	}
+
+	auto edgeCases() -> void {
+		const auto infinity = std::numeric_limits<f32>::infinity();
+		const auto nan = std::numeric_limits<f32>::quiet_NaN();
+
+		const auto identity = Matrix4f::makeIdentity();
+		const auto zero = Matrix4f();
+		const auto negativeZero = makeFilled(-0.f);
+		const auto huge = makeFilled(1e18f);
+		const auto tiny = makeFilled(1e-20f);
+		const auto denormal = makeFilled(1e-40f);
+		const auto infinite = makeFilled(infinity);
+		const auto notANumber = makeFilled(nan);
+		const auto translate = Matrix4f::makeTranslate(1e6f, -1e6f, 3.f);
+		const auto scaled = Matrix4f::makeScale(1e-3f, 1e3f, -1.f);
+		const auto orthographic = Matrix4f::makeOrthographic(0.f, 1920.f, 1080.f, 0.f, -1.f, 1.f);
+		const auto perspective = Matrix4f::makePerspective(1.2f, 16.f / 9.f, 0.01f, 1000.f);
+
+		const std::pair<const char*, const Matrix4f*> matrices[] {
+			{ "identity", &identity },
+			{ "zero", &zero },
+			{ "negative zero", &negativeZero },
+			{ "huge", &huge },
+			{ "tiny", &tiny },
+			{ "denormal", &denormal },
+			{ "infinite", &infinite },
+			{ "nan", &notANumber },
+			{ "translate", &translate },
+			{ "scale", &scaled },
+			{ "orthographic", &orthographic },
+			{ "perspective", &perspective },
+		};
+
+		for (const auto& [leftName, left] : matrices) {
+			checkTranspose(leftName, *left);
+			checkMultiplyVector(leftName, *left, Vector4f(1.f, -2.f, 3.f, 1.f));
+
+			for (const auto& [rightName, right] : matrices)
+				checkMultiply(std::string(leftName) + " * " + rightName, *left, *right);
+		}
+
+		/* only the ones that have an inverse */
+		checkInvert("identity", identity);
+		checkInvert("translate", translate);
+		checkInvert("scale", scaled);
+		checkInvert("orthographic", orthographic);
+		checkInvert("perspective", perspective);
+
+		checkTransform2D("identity", 0.f, 0.f, 0.f, 1.f, 1.f);
+		checkTransform2D("quarter turn", 10.f, 20.f, 1.5707964f, 2.f, 3.f);
+		checkTransform2D("half turn", -5.f, 5.f, -3.1415927f, 1.f, -1.f);
+		checkTransform2D("zero scale", 1.f, 1.f, 0.5f, 0.f, 0.f);
+		checkTransform2D("large angle", 0.f, 0.f, 1e4f, 1.f, 1.f);
+		checkTransform2D("large values", 1e18f, -1e18f, 0.25f, 1e18f, 1e-18f);
+	}
+
+	/* which kernels were actually checked */
+	auto simd() -> const char* {
+	#if CNGE_MATH_SSE
+		return CNGE::Cpu::hasAvx2() ? "sse, avx2 batches" : "sse";
+	#else
+		return "scalar only, nothing to compare";
+	#endif
+	}
+}
+
+auto main(i32 argc, char** argv) -> i32 {
+	const auto seed = argc > 1 ? u32(std::stoul(argv[1])) : 1_u32;
+
+	Test::edgeCases();
+	Test::randomCases(seed);
+
+	std::printf("%s: %u checks, %u failures, seed %u\n", Test::simd(), Test::checks, Test::failures, seed);
+
+	return Test::failures == 0 ? 0 : 1;
+}